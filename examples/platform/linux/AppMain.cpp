@@ -246,6 +246,10 @@ int ChipLinuxAppInit(int argc, char * const argv[], OptionSet * customOptions)
     err = DeviceLayer::PlatformMgr().InitChipStack();
     SuccessOrExit(err);
 
+    // Run session establishment crypto off the Matter thread.
+    err = DeviceLayer::PlatformMgr().StartBackgroundEventLoopTask();
+    SuccessOrExit(err);
+
     // Init the commissionable data provider based on command line options
     // to handle custom verifiers, discriminators, etc.
     err = chip::examples::InitCommissionableDataProvider(gCommissionableDataProvider, LinuxDeviceOptions::GetInstance());
@@ -436,6 +440,8 @@ void ChipLinuxAppMainLoop(AppMainLoopImplementation * impl)
     shellThread.join();
 #endif
 
+    DeviceLayer::PlatformMgr().StopBackgroundEventLoopTask();
+
     Server::GetInstance().Shutdown();
 
     DeviceLayer::PlatformMgr().Shutdown();
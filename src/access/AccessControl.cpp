@@ -89,6 +89,13 @@ constexpr bool IsValidGroupNodeId(NodeId aNodeId)
     return IsGroupId(aNodeId) && IsValidGroupId(GroupIdFromNodeId(aNodeId));
 }
 
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+bool IsSameSubject(const SubjectDescriptor & a, const SubjectDescriptor & b)
+{
+    return a.fabricIndex == b.fabricIndex && a.authMode == b.authMode && a.subject == b.subject && a.cats == b.cats;
+}
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+
 #if CHIP_PROGRESS_LOGGING && CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 1
 
 char GetAuthModeStringForLogging(AuthMode authMode)
@@ -189,6 +196,7 @@ CHIP_ERROR AccessControl::Init(AccessControl::Delegate * delegate, DeviceTypeRes
     {
         mDelegate           = delegate;
         mDeviceTypeResolver = &deviceTypeResolver;
+        InvalidateIndex();
     }
 
     return retval;
@@ -200,6 +208,7 @@ void AccessControl::Finish()
     ChipLogProgress(DataManagement, "AccessControl: finishing");
     mDelegate->Finish();
     mDelegate = nullptr;
+    InvalidateIndex();
 }
 
 CHIP_ERROR AccessControl::CreateEntry(const SubjectDescriptor * subjectDescriptor, FabricIndex fabric, size_t * index,
@@ -323,6 +332,39 @@ CHIP_ERROR AccessControl::Check(const SubjectDescriptor & subjectDescriptor, con
     }
 #endif // CHIP_PROGRESS_LOGGING && CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 1
 
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    if (mDecisionCache != nullptr)
+    {
+        CHIP_ERROR result;
+        if (mDecisionCache->Find(subjectDescriptor, requestPath, requestPrivilege, result))
+        {
+            mDecisionCacheStatistics.hits++;
+#if CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+            ChipLogProgress(DataManagement, "AccessControl: %s (cached)",
+                            (result == CHIP_NO_ERROR) ? "allowed" : (result == CHIP_ERROR_ACCESS_DENIED) ? "denied" : "error");
+#else
+            if (result != CHIP_NO_ERROR)
+            {
+                ChipLogProgress(DataManagement, "AccessControl: %s (cached)",
+                                (result == CHIP_ERROR_ACCESS_DENIED) ? "denied" : "error");
+            }
+#endif // CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+            return result;
+        }
+
+        mDecisionCacheStatistics.misses++;
+        result = CheckUncached(subjectDescriptor, requestPath, requestPrivilege);
+        mDecisionCache->Add(subjectDescriptor, requestPath, requestPrivilege, result);
+        return result;
+    }
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+
+    return CheckUncached(subjectDescriptor, requestPath, requestPrivilege);
+}
+
+CHIP_ERROR AccessControl::CheckUncached(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                        Privilege requestPrivilege)
+{
     {
         CHIP_ERROR result = mDelegate->Check(subjectDescriptor, requestPath, requestPrivilege);
         if (result != CHIP_ERROR_NOT_IMPLEMENTED)
@@ -352,6 +394,45 @@ CHIP_ERROR AccessControl::Check(const SubjectDescriptor & subjectDescriptor, con
         return CHIP_NO_ERROR;
     }
 
+    CHIP_ERROR result;
+#if CHIP_CONFIG_ACCESS_CONTROL_INDEX
+    if (mIndexState == IndexState::kStale)
+    {
+        CHIP_ERROR err = BuildIndex();
+        mIndexState    = IndexState::kValid;
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogProgress(DataManagement, "AccessControl: not using index: %" CHIP_ERROR_FORMAT, err.Format());
+            mIndexState = IndexState::kUnusable;
+        }
+    }
+    if (mIndexState == IndexState::kValid)
+    {
+        result = CheckIndex(subjectDescriptor, requestPath, requestPrivilege);
+    }
+    else
+#endif // CHIP_CONFIG_ACCESS_CONTROL_INDEX
+    {
+        result = CheckEntries(subjectDescriptor, requestPath, requestPrivilege);
+    }
+
+    if (result == CHIP_NO_ERROR)
+    {
+#if CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+        ChipLogProgress(DataManagement, "AccessControl: allowed");
+#endif // CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+    }
+    else if (result == CHIP_ERROR_ACCESS_DENIED)
+    {
+        ChipLogProgress(DataManagement, "AccessControl: denied");
+    }
+
+    return result;
+}
+
+CHIP_ERROR AccessControl::CheckEntries(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                       Privilege requestPrivilege)
+{
     EntryIterator iterator;
     ReturnErrorOnFailure(Entries(iterator, &subjectDescriptor.fabricIndex));
 
@@ -453,18 +534,262 @@ CHIP_ERROR AccessControl::Check(const SubjectDescriptor & subjectDescriptor, con
             }
         }
         // Entry passed all checks: access is allowed.
+        return CHIP_NO_ERROR;
+    }
 
-#if CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
-        ChipLogProgress(DataManagement, "AccessControl: allowed");
-#endif // CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+    // No entry was found which passed all checks: access is denied.
+    return CHIP_ERROR_ACCESS_DENIED;
+}
+
+#if CHIP_CONFIG_ACCESS_CONTROL_INDEX
+CHIP_ERROR AccessControl::BuildIndex()
+{
+    mIndexedEntryCount      = 0;
+    mIndexedEntryGroupCount = 0;
+    mIndexedSubjectCount    = 0;
+    mIndexedTargetCount     = 0;
+
+    EntryIterator iterator;
+    ReturnErrorOnFailure(Entries(iterator));
+
+    Entry entry;
+    CHIP_ERROR err;
+    while ((err = iterator.Next(entry)) == CHIP_NO_ERROR)
+    {
+        ReturnErrorOnFailure(IndexEntry(entry));
+    }
+    VerifyOrReturnError(err == CHIP_ERROR_SENTINEL, err);
+
+    GroupIndexedEntries();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AccessControl::IndexEntry(const Entry & entry)
+{
+    VerifyOrReturnError(mIndexedEntryCount < kIndexMaxEntries, CHIP_ERROR_NO_MEMORY);
+    IndexedEntry & indexedEntry = mIndexedEntries[mIndexedEntryCount];
+
+    ReturnErrorOnFailure(entry.GetFabricIndex(indexedEntry.fabricIndex));
+    ReturnErrorOnFailure(entry.GetAuthMode(indexedEntry.authMode));
+    // Operational PASE not supported for v1.0. Entries which would make CheckEntries fail are not indexed, so that
+    // checks keep failing the same way.
+    VerifyOrReturnError(indexedEntry.authMode == AuthMode::kCase || indexedEntry.authMode == AuthMode::kGroup,
+                        CHIP_ERROR_INCORRECT_STATE);
+
+    Privilege privilege = Privilege::kView;
+    ReturnErrorOnFailure(entry.GetPrivilege(privilege));
+    indexedEntry.requestPrivileges = 0;
+    for (auto requestPrivilege :
+         { Privilege::kView, Privilege::kProxyView, Privilege::kOperate, Privilege::kManage, Privilege::kAdminister })
+    {
+        if (CheckRequestPrivilegeAgainstEntryPrivilege(requestPrivilege, privilege))
+        {
+            indexedEntry.requestPrivileges = static_cast<uint8_t>(indexedEntry.requestPrivileges | to_underlying(requestPrivilege));
+        }
+    }
+
+    size_t subjectCount = 0;
+    ReturnErrorOnFailure(entry.GetSubjectCount(subjectCount));
+    VerifyOrReturnError(subjectCount <= kIndexMaxSubjects - mIndexedSubjectCount, CHIP_ERROR_NO_MEMORY);
+    for (size_t i = 0; i < subjectCount; ++i)
+    {
+        NodeId subject = kUndefinedNodeId;
+        ReturnErrorOnFailure(entry.GetSubject(i, subject));
+        if (IsOperationalNodeId(subject) || IsCASEAuthTag(subject))
+        {
+            VerifyOrReturnError(indexedEntry.authMode == AuthMode::kCase, CHIP_ERROR_INCORRECT_STATE);
+        }
+        else
+        {
+            VerifyOrReturnError(IsGroupId(subject) && indexedEntry.authMode == AuthMode::kGroup, CHIP_ERROR_INCORRECT_STATE);
+        }
+        mIndexedSubjects[mIndexedSubjectCount + i] = subject;
+    }
+
+    size_t targetCount = 0;
+    ReturnErrorOnFailure(entry.GetTargetCount(targetCount));
+    VerifyOrReturnError(targetCount <= kIndexMaxTargets - mIndexedTargetCount, CHIP_ERROR_NO_MEMORY);
+    for (size_t i = 0; i < targetCount; ++i)
+    {
+        ReturnErrorOnFailure(entry.GetTarget(i, mIndexedTargets[mIndexedTargetCount + i]));
+    }
+
+    indexedEntry.firstSubject = static_cast<uint16_t>(mIndexedSubjectCount);
+    indexedEntry.subjectCount = static_cast<uint16_t>(subjectCount);
+    indexedEntry.firstTarget  = static_cast<uint16_t>(mIndexedTargetCount);
+    indexedEntry.targetCount  = static_cast<uint16_t>(targetCount);
+    mIndexedSubjectCount += subjectCount;
+    mIndexedTargetCount += targetCount;
+    mIndexedEntryCount++;
+    return CHIP_NO_ERROR;
+}
+
+void AccessControl::GroupIndexedEntries()
+{
+    // Stable insertion sort by fabric and auth mode, so entries of a group keep their relative order.
+    auto groupsBefore = [](const IndexedEntry & a, const IndexedEntry & b) {
+        return (a.fabricIndex != b.fabricIndex) ? (a.fabricIndex < b.fabricIndex)
+                                                : (to_underlying(a.authMode) < to_underlying(b.authMode));
+    };
+    for (size_t i = 1; i < mIndexedEntryCount; ++i)
+    {
+        IndexedEntry indexedEntry = mIndexedEntries[i];
+        size_t j                  = i;
+        for (; j > 0 && groupsBefore(indexedEntry, mIndexedEntries[j - 1]); --j)
+        {
+            mIndexedEntries[j] = mIndexedEntries[j - 1];
+        }
+        mIndexedEntries[j] = indexedEntry;
+    }
+
+    for (size_t i = 0; i < mIndexedEntryCount; ++i)
+    {
+        const IndexedEntry & indexedEntry = mIndexedEntries[i];
+        if (i == 0 || groupsBefore(mIndexedEntries[i - 1], indexedEntry))
+        {
+            IndexedEntryGroup & group = mIndexedEntryGroups[mIndexedEntryGroupCount++];
+            group.fabricIndex         = indexedEntry.fabricIndex;
+            group.authMode            = indexedEntry.authMode;
+            group.firstEntry          = static_cast<uint16_t>(i);
+            group.entryCount          = 0;
+        }
+        mIndexedEntryGroups[mIndexedEntryGroupCount - 1].entryCount++;
+    }
+}
+
+CHIP_ERROR AccessControl::CheckIndex(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                     Privilege requestPrivilege) const
+{
+    const IndexedEntryGroup * group = nullptr;
+    for (size_t i = 0; i < mIndexedEntryGroupCount; ++i)
+    {
+        if (mIndexedEntryGroups[i].fabricIndex == subjectDescriptor.fabricIndex &&
+            mIndexedEntryGroups[i].authMode == subjectDescriptor.authMode)
+        {
+            group = &mIndexedEntryGroups[i];
+            break;
+        }
+    }
+    VerifyOrReturnError(group != nullptr, CHIP_ERROR_ACCESS_DENIED);
+
+    for (size_t i = group->firstEntry; i < group->firstEntry + group->entryCount; ++i)
+    {
+        const IndexedEntry & indexedEntry = mIndexedEntries[i];
+        if ((indexedEntry.requestPrivileges & to_underlying(requestPrivilege)) == 0)
+        {
+            continue;
+        }
+
+        if (indexedEntry.subjectCount > 0)
+        {
+            bool subjectMatched = false;
+            for (size_t j = indexedEntry.firstSubject; j < indexedEntry.firstSubject + indexedEntry.subjectCount; ++j)
+            {
+                NodeId subject = mIndexedSubjects[j];
+                if (IsCASEAuthTag(subject) ? subjectDescriptor.cats.CheckSubjectAgainstCATs(subject)
+                                           : (subject == subjectDescriptor.subject))
+                {
+                    subjectMatched = true;
+                    break;
+                }
+            }
+            if (!subjectMatched)
+            {
+                continue;
+            }
+        }
+
+        if (indexedEntry.targetCount > 0)
+        {
+            bool targetMatched = false;
+            for (size_t j = indexedEntry.firstTarget; j < indexedEntry.firstTarget + indexedEntry.targetCount; ++j)
+            {
+                const Entry::Target & target = mIndexedTargets[j];
+                if ((target.flags & Entry::Target::kCluster) && target.cluster != requestPath.cluster)
+                {
+                    continue;
+                }
+                if ((target.flags & Entry::Target::kEndpoint) && target.endpoint != requestPath.endpoint)
+                {
+                    continue;
+                }
+                if (target.flags & Entry::Target::kDeviceType &&
+                    !mDeviceTypeResolver->IsDeviceTypeOnEndpoint(target.deviceType, requestPath.endpoint))
+                {
+                    continue;
+                }
+                targetMatched = true;
+                break;
+            }
+            if (!targetMatched)
+            {
+                continue;
+            }
+        }
 
         return CHIP_NO_ERROR;
     }
 
-    // No entry was found which passed all checks: access is denied.
-    ChipLogProgress(DataManagement, "AccessControl: denied");
     return CHIP_ERROR_ACCESS_DENIED;
 }
+#endif // CHIP_CONFIG_ACCESS_CONTROL_INDEX
+
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+AccessControl::DecisionCache::DecisionCache(AccessControl & accessControl) :
+    mAccessControl(accessControl), mOuterCache(accessControl.mDecisionCache)
+{
+    mAccessControl.mDecisionCache = this;
+    mAccessControl.AddEntryListener(*this);
+}
+
+AccessControl::DecisionCache::~DecisionCache()
+{
+    mAccessControl.RemoveEntryListener(*this);
+    mAccessControl.mDecisionCache = mOuterCache;
+}
+
+bool AccessControl::DecisionCache::Find(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                        Privilege requestPrivilege, CHIP_ERROR & result) const
+{
+    VerifyOrReturnValue(mDecisionCount > 0 && IsSameSubject(subjectDescriptor, mSubjectDescriptor), false);
+
+    for (size_t i = 0; i < mDecisionCount; ++i)
+    {
+        const Decision & decision = mDecisions[i];
+        if (decision.requestPath.cluster == requestPath.cluster && decision.requestPath.endpoint == requestPath.endpoint &&
+            decision.requestPrivilege == requestPrivilege)
+        {
+            result = decision.allowed ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+            return true;
+        }
+    }
+    return false;
+}
+
+void AccessControl::DecisionCache::Add(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                       Privilege requestPrivilege, CHIP_ERROR result)
+{
+    // Other errors are not decisions, and may not happen again.
+    VerifyOrReturn(result == CHIP_NO_ERROR || result == CHIP_ERROR_ACCESS_DENIED);
+
+    if (mDecisionCount == 0 || !IsSameSubject(subjectDescriptor, mSubjectDescriptor))
+    {
+        mSubjectDescriptor = subjectDescriptor;
+        mDecisionCount     = 0;
+        mNextDecision      = 0;
+    }
+
+    Decision & decision       = mDecisions[mNextDecision];
+    decision.requestPath      = requestPath;
+    decision.requestPrivilege = requestPrivilege;
+    decision.allowed          = (result == CHIP_NO_ERROR);
+    mNextDecision             = (mNextDecision + 1) % ArraySize(mDecisions);
+    if (mDecisionCount < ArraySize(mDecisions))
+    {
+        mDecisionCount++;
+    }
+}
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
 
 #if CHIP_ACCESS_CONTROL_DUMP_ENABLED
 CHIP_ERROR AccessControl::Dump(const Entry & entry)
@@ -615,6 +940,8 @@ exit:
 void AccessControl::NotifyEntryChanged(const SubjectDescriptor * subjectDescriptor, FabricIndex fabric, size_t index,
                                        const Entry * entry, EntryListener::ChangeType changeType)
 {
+    InvalidateIndex();
+
     for (EntryListener * listener = mEntryListener; listener != nullptr; listener = listener->mNext)
     {
         listener->OnEntryChanged(subjectDescriptor, fabric, index, entry, changeType);
@@ -329,6 +329,66 @@ public:
         friend class AccessControl;
     };
 
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    /**
+     * Memoizes the decisions of Check() for one subject while it exists, so that checks which repeat the same request path and
+     * privilege (e.g. for each attribute of a cluster in a wildcard read) only evaluate the access control list once.
+     *
+     * Meant to be scoped to the processing of one report or invoke request of an interaction: cached decisions are dropped
+     * when entries change, but not when the device types on endpoints do. Caches may be nested, in which case only the
+     * innermost one is used.
+     */
+    class DecisionCache : public EntryListener
+    {
+    public:
+        explicit DecisionCache(AccessControl & accessControl);
+        ~DecisionCache() override;
+
+        DecisionCache(const DecisionCache &) = delete;
+        DecisionCache & operator=(const DecisionCache &) = delete;
+
+        void OnEntryChanged(const SubjectDescriptor * subjectDescriptor, FabricIndex fabric, size_t index, const Entry * entry,
+                            ChangeType changeType) override
+        {
+            mDecisionCount = 0;
+        }
+
+    private:
+        struct Decision
+        {
+            RequestPath requestPath;
+            Privilege requestPrivilege;
+            bool allowed;
+        };
+
+        bool Find(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege,
+                  CHIP_ERROR & result) const;
+        void Add(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege,
+                 CHIP_ERROR result);
+
+        AccessControl & mAccessControl;
+        DecisionCache * mOuterCache;
+        SubjectDescriptor mSubjectDescriptor;
+        Decision mDecisions[CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE];
+        size_t mDecisionCount = 0;
+        size_t mNextDecision  = 0; // Decision replaced when the cache is full.
+
+        friend class AccessControl;
+    };
+#else
+    class DecisionCache
+    {
+    public:
+        explicit DecisionCache(AccessControl & accessControl) {}
+    };
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+
+    struct DecisionCacheStatistics
+    {
+        uint32_t hits   = 0; /**< Checks answered by a decision cache. */
+        uint32_t misses = 0; /**< Checks evaluated while a decision cache was in use. */
+    };
+
     class Delegate
     {
     public:
@@ -504,6 +564,7 @@ public:
     {
         ReturnErrorCodeIf(!IsValid(entry), CHIP_ERROR_INVALID_ARGUMENT);
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        InvalidateIndex();
         return mDelegate->CreateEntry(index, entry, fabricIndex);
     }
 
@@ -554,6 +615,7 @@ public:
     {
         ReturnErrorCodeIf(!IsValid(entry), CHIP_ERROR_INVALID_ARGUMENT);
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        InvalidateIndex();
         return mDelegate->UpdateEntry(index, entry, fabricIndex);
     }
 
@@ -575,6 +637,7 @@ public:
     CHIP_ERROR DeleteEntry(size_t index, const FabricIndex * fabricIndex = nullptr)
     {
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        InvalidateIndex();
         return mDelegate->DeleteEntry(index, fabricIndex);
     }
 
@@ -644,6 +707,9 @@ public:
      */
     CHIP_ERROR Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege);
 
+    const DecisionCacheStatistics & GetDecisionCacheStatistics() const { return mDecisionCacheStatistics; }
+    void ResetDecisionCacheStatistics() { mDecisionCacheStatistics = DecisionCacheStatistics(); }
+
 #if CHIP_ACCESS_CONTROL_DUMP_ENABLED
     CHIP_ERROR Dump(const Entry & entry);
 #endif
@@ -656,12 +722,89 @@ private:
     void NotifyEntryChanged(const SubjectDescriptor * subjectDescriptor, FabricIndex fabric, size_t index, const Entry * entry,
                             EntryListener::ChangeType changeType);
 
+    // Mark the index (if enabled) stale, as the entries are about to change or have changed.
+    void InvalidateIndex()
+    {
+#if CHIP_CONFIG_ACCESS_CONTROL_INDEX
+        mIndexState = IndexState::kStale;
+#endif // CHIP_CONFIG_ACCESS_CONTROL_INDEX
+    }
+
+    // Check without consulting the decision cache, once Check() verified that access control is initialized.
+    CHIP_ERROR CheckUncached(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                             Privilege requestPrivilege);
+
+    // Check against the entries, without logging the result.
+    CHIP_ERROR CheckEntries(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                            Privilege requestPrivilege);
+
+#if CHIP_CONFIG_ACCESS_CONTROL_INDEX
+    // Flattened copy of an entry, held by the index.
+    struct IndexedEntry
+    {
+        FabricIndex fabricIndex;
+        AuthMode authMode;
+        uint8_t requestPrivileges; // Request privileges granted by the entry (bitwise or of Privilege values).
+        uint16_t firstSubject;
+        uint16_t subjectCount;
+        uint16_t firstTarget;
+        uint16_t targetCount;
+    };
+
+    // Range of consecutive indexed entries of the same fabric and auth mode.
+    struct IndexedEntryGroup
+    {
+        FabricIndex fabricIndex;
+        AuthMode authMode;
+        uint16_t firstEntry;
+        uint16_t entryCount;
+    };
+
+    enum class IndexState : uint8_t
+    {
+        kStale,    ///< The entries changed since the index was built.
+        kValid,    ///< The index matches the entries.
+        kUnusable, ///< The entries do not fit into the index, or could not be read; checks iterate the entries.
+    };
+
+    static constexpr size_t kIndexMaxEntries  = CHIP_CONFIG_ACCESS_CONTROL_INDEX_MAX_ENTRIES;
+    static constexpr size_t kIndexMaxSubjects = kIndexMaxEntries * CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_MAX_SUBJECTS_PER_ENTRY;
+    static constexpr size_t kIndexMaxTargets  = kIndexMaxEntries * CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_MAX_TARGETS_PER_ENTRY;
+    static_assert(kIndexMaxSubjects <= UINT16_MAX && kIndexMaxTargets <= UINT16_MAX, "Index ranges must fit into uint16_t");
+
+    // Build the index from the entries. On failure, the index must not be used.
+    CHIP_ERROR BuildIndex();
+    CHIP_ERROR IndexEntry(const Entry & entry);
+    void GroupIndexedEntries();
+
+    // Check against the index, which must be valid.
+    CHIP_ERROR CheckIndex(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                          Privilege requestPrivilege) const;
+#endif // CHIP_CONFIG_ACCESS_CONTROL_INDEX
+
 private:
     Delegate * mDelegate = nullptr;
 
     DeviceTypeResolver * mDeviceTypeResolver = nullptr;
 
     EntryListener * mEntryListener = nullptr;
+
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    DecisionCache * mDecisionCache = nullptr;
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    DecisionCacheStatistics mDecisionCacheStatistics;
+
+#if CHIP_CONFIG_ACCESS_CONTROL_INDEX
+    IndexState mIndexState = IndexState::kStale;
+    IndexedEntry mIndexedEntries[kIndexMaxEntries];
+    IndexedEntryGroup mIndexedEntryGroups[kIndexMaxEntries];
+    NodeId mIndexedSubjects[kIndexMaxSubjects];
+    Entry::Target mIndexedTargets[kIndexMaxTargets];
+    size_t mIndexedEntryCount      = 0;
+    size_t mIndexedEntryGroupCount = 0;
+    size_t mIndexedSubjectCount    = 0;
+    size_t mIndexedTargetCount     = 0;
+#endif // CHIP_CONFIG_ACCESS_CONTROL_INDEX
 };
 
 /**
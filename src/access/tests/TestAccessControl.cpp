@@ -1732,6 +1732,88 @@ void TestCheck(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+void TestCheckAfterEntriesChange(nlTestSuite * inSuite, void * inContext)
+{
+    // Checks must track changes to the entries, which invalidate the index (if enabled).
+    LoadAccessControl(accessControl, entryData1, entryData1Count);
+    for (const auto & checkData : checkData1)
+    {
+        NL_TEST_ASSERT(inSuite,
+                       accessControl.Check(checkData.subjectDescriptor, checkData.requestPath, checkData.privilege) ==
+                           (checkData.allow ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED));
+    }
+
+    NL_TEST_ASSERT(inSuite, accessControl.DeleteAllEntriesForFabric(2) == CHIP_NO_ERROR);
+    for (const auto & checkData : checkData1)
+    {
+        const bool allow = checkData.allow &&
+            (checkData.subjectDescriptor.authMode == AuthMode::kPase || checkData.subjectDescriptor.fabricIndex != 2);
+        NL_TEST_ASSERT(inSuite,
+                       accessControl.Check(checkData.subjectDescriptor, checkData.requestPath, checkData.privilege) ==
+                           (allow ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED));
+    }
+
+    for (const auto & entryData : entryData1)
+    {
+        if (entryData.fabricIndex == 2)
+        {
+            NL_TEST_ASSERT(inSuite, LoadAccessControl(accessControl, &entryData, 1) == CHIP_NO_ERROR);
+        }
+    }
+    for (const auto & checkData : checkData1)
+    {
+        NL_TEST_ASSERT(inSuite,
+                       accessControl.Check(checkData.subjectDescriptor, checkData.requestPath, checkData.privilege) ==
+                           (checkData.allow ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED));
+    }
+}
+
+void TestCheckWithDecisionCache(nlTestSuite * inSuite, void * inContext)
+{
+    LoadAccessControl(accessControl, entryData1, entryData1Count);
+    accessControl.ResetDecisionCacheStatistics();
+
+    {
+        AccessControl::DecisionCache decisionCache(accessControl);
+        for (const auto & checkData : checkData1)
+        {
+            CHIP_ERROR expectedResult = checkData.allow ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+            for (int i = 0; i < 3; ++i)
+            {
+                NL_TEST_ASSERT(inSuite,
+                               accessControl.Check(checkData.subjectDescriptor, checkData.requestPath, checkData.privilege) ==
+                                   expectedResult);
+            }
+        }
+
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+        // Repeated checks are always answered by the cache (some check data repeat a check, too).
+        const AccessControl::DecisionCacheStatistics & statistics = accessControl.GetDecisionCacheStatistics();
+        NL_TEST_ASSERT(inSuite, statistics.hits + statistics.misses == 3 * ArraySize(checkData1));
+        NL_TEST_ASSERT(inSuite, statistics.misses <= ArraySize(checkData1));
+#endif
+
+        // Changing entries drops cached decisions.
+        const CheckData & checkData = checkData1[ArraySize(checkData1) - 1];
+        NL_TEST_ASSERT(inSuite, checkData.allow && checkData.subjectDescriptor.fabricIndex == 2);
+        NL_TEST_ASSERT(inSuite,
+                       accessControl.Check(checkData.subjectDescriptor, checkData.requestPath, checkData.privilege) ==
+                           CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, accessControl.DeleteAllEntriesForFabric(2) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite,
+                       accessControl.Check(checkData.subjectDescriptor, checkData.requestPath, checkData.privilege) ==
+                           CHIP_ERROR_ACCESS_DENIED);
+    }
+
+    // Without a decision cache, checks are not counted.
+    accessControl.ResetDecisionCacheStatistics();
+    NL_TEST_ASSERT(inSuite,
+                   accessControl.Check(checkData1[0].subjectDescriptor, checkData1[0].requestPath, checkData1[0].privilege) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, accessControl.GetDecisionCacheStatistics().hits == 0);
+    NL_TEST_ASSERT(inSuite, accessControl.GetDecisionCacheStatistics().misses == 0);
+}
+
 void TestCreateReadEntry(nlTestSuite * inSuite, void * inContext)
 {
     for (size_t i = 0; i < entryData1Count; ++i)
@@ -2207,6 +2289,8 @@ int TestAccessControl()
         NL_TEST_DEF("TestFabricFilteredReadEntry", TestFabricFilteredReadEntry),
         NL_TEST_DEF("TestFabricFilteredCreateEntry", TestFabricFilteredCreateEntry),
         NL_TEST_DEF("TestCheck", TestCheck),
+        NL_TEST_DEF("TestCheckAfterEntriesChange", TestCheckAfterEntriesChange),
+        NL_TEST_DEF("TestCheckWithDecisionCache", TestCheckWithDecisionCache),
         NL_TEST_SENTINEL()
     };
     // clang-format on
@@ -24,28 +24,13 @@
 namespace chip {
 namespace app {
 
-CHIP_ERROR ClusterStateCache::GetElementTLVSize(TLV::TLVReader * apData, size_t & aSize)
-{
-    Platform::ScopedMemoryBufferWithSize<uint8_t> backingBuffer;
-    TLV::TLVReader reader;
-    reader.Init(*apData);
-    size_t totalBufSize = reader.GetTotalLength();
-    backingBuffer.Calloc(totalBufSize);
-    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
-    TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), totalBufSize);
-    ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), reader));
-    aSize = writer.GetLengthWritten();
-    ReturnErrorOnFailure(writer.Finalize(backingBuffer));
-    return CHIP_NO_ERROR;
-}
-
 CHIP_ERROR ClusterStateCache::UpdateCache(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
                                           const StatusIB & aStatus)
 {
-    AttributeState state;
     bool endpointIsNew = false;
+    bool clusterIsNew  = (mCache.FindCluster(aPath.mEndpointId, aPath.mClusterId) == nullptr);
 
-    if (mCache.find(aPath.mEndpointId) == mCache.end())
+    if (!mCache.HasEndpoint(aPath.mEndpointId))
     {
         //
         // Since we might potentially be creating a new entry at mCache[aPath.mEndpointId][aPath.mClusterId] that
@@ -59,22 +44,13 @@ CHIP_ERROR ClusterStateCache::UpdateCache(const ConcreteDataAttributePath & aPat
     {
         if (mCacheData)
         {
-            size_t elementSize = 0;
-            ReturnErrorOnFailure(GetElementTLVSize(apData, elementSize));
-            Platform::ScopedMemoryBufferWithSize<uint8_t> backingBuffer;
-            backingBuffer.Calloc(elementSize);
-            VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
-            TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), elementSize);
-            ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), *apData));
-            ReturnErrorOnFailure(writer.Finalize(backingBuffer));
-
-            state.Set<Platform::ScopedMemoryBufferWithSize<uint8_t>>(std::move(backingBuffer));
+            ReturnErrorOnFailure(mCache.SetAttributeData(aPath, *apData));
         }
         //
         // Clear out the committed data version and only set it again once we have received all data for this cluster.
         // Otherwise, we may have incomplete data that looks like it's complete since it has a valid data version.
         //
-        mCache[aPath.mEndpointId][aPath.mClusterId].mCommittedDataVersion.ClearValue();
+        mCache.GetOrAddCluster(aPath.mEndpointId, aPath.mClusterId).mCommittedDataVersion.ClearValue();
 
         // This commits a pending data version if the last report path is valid and it is different from the current path.
         if (mLastReportDataPath.IsValidConcreteClusterPath() && mLastReportDataPath != aPath)
@@ -95,7 +71,7 @@ CHIP_ERROR ClusterStateCache::UpdateCache(const ConcreteDataAttributePath & aPat
         // if this data item is encompassed by a wildcard path, let's go ahead and update its pending data version.
         if (foundEncompassingWildcardPath)
         {
-            mCache[aPath.mEndpointId][aPath.mClusterId].mPendingDataVersion = aPath.mDataVersion;
+            mCache.GetOrAddCluster(aPath.mEndpointId, aPath.mClusterId).mPendingDataVersion = aPath.mDataVersion;
         }
 
         mLastReportDataPath = aPath;
@@ -104,7 +80,7 @@ CHIP_ERROR ClusterStateCache::UpdateCache(const ConcreteDataAttributePath & aPat
     {
         if (mCacheData)
         {
-            state.Set<StatusIB>(aStatus);
+            ReturnErrorOnFailure(mCache.SetAttributeStatus(aPath, aStatus));
         }
     }
 
@@ -119,10 +95,17 @@ CHIP_ERROR ClusterStateCache::UpdateCache(const ConcreteDataAttributePath & aPat
 
     if (mCacheData)
     {
-        mCache[aPath.mEndpointId][aPath.mClusterId].mAttributes[aPath.mAttributeId] = std::move(state);
         mChangedAttributeSet.insert(aPath);
     }
 
+    //
+    // A new cluster counts as read when it is added, so that it is not evicted before it had a chance to be read.
+    //
+    if (clusterIsNew && mCache.FindCluster(aPath.mEndpointId, aPath.mClusterId) != nullptr)
+    {
+        MarkClusterRead(aPath.mEndpointId, aPath.mClusterId);
+    }
+
     return CHIP_NO_ERROR;
 }
 
@@ -154,11 +137,15 @@ CHIP_ERROR ClusterStateCache::UpdateEventCache(const EventHeader & aEventHeader,
             //
             handle.RightSize();
 
+            size_t eventDataSize = handle->DataLength();
             EventData eventData;
             eventData.first  = aEventHeader;
             eventData.second = std::move(handle);
 
-            mEventDataCache.insert(std::move(eventData));
+            if (mEventDataCache.insert(std::move(eventData)).second)
+            {
+                mEventDataSize += eventDataSize;
+            }
         }
         mHighestReceivedEventNumber.SetValue(aEventHeader.mEventNumber);
     }
@@ -188,7 +175,7 @@ void ClusterStateCache::CommitPendingDataVersion()
         return;
     }
 
-    auto & lastClusterInfo = mCache[mLastReportDataPath.mEndpointId][mLastReportDataPath.mClusterId];
+    auto & lastClusterInfo = mCache.GetOrAddCluster(mLastReportDataPath.mEndpointId, mLastReportDataPath.mClusterId);
     if (lastClusterInfo.mPendingDataVersion.HasValue())
     {
         lastClusterInfo.mCommittedDataVersion = lastClusterInfo.mPendingDataVersion;
@@ -223,90 +210,90 @@ void ClusterStateCache::OnReportEnd()
     }
 
     mCallback.OnReportEnd();
+
+    EvictClusters();
+    EvictEvents();
 }
 
-CHIP_ERROR ClusterStateCache::Get(const ConcreteAttributePath & path, TLV::TLVReader & reader) const
+void ClusterStateCache::MarkClusterRead(EndpointId endpointId, ClusterId clusterId) const
 {
-    CHIP_ERROR err;
-    auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
-    ReturnErrorOnFailure(err);
-    if (attributeState->Is<StatusIB>())
+    VerifyOrReturn(mMaxAttributeDataBytes != 0);
+
+    const CachedClusterInfo * info = mCache.FindCluster(endpointId, clusterId);
+    if (info != nullptr)
     {
-        return CHIP_ERROR_IM_STATUS_CODE_RECEIVED;
+        info->mLastReadTick = ++mReadTick;
     }
-
-    reader.Init(attributeState->Get<Platform::ScopedMemoryBufferWithSize<uint8_t>>().Get(),
-                attributeState->Get<Platform::ScopedMemoryBufferWithSize<uint8_t>>().AllocatedSize());
-    return reader.Next();
 }
 
-CHIP_ERROR ClusterStateCache::Get(EventNumber eventNumber, TLV::TLVReader & reader) const
+void ClusterStateCache::EvictClusters()
 {
-    CHIP_ERROR err;
-
-    auto eventData = GetEventData(eventNumber, err);
-    ReturnErrorOnFailure(err);
-
-    System::PacketBufferTLVReader bufReader;
-
-    bufReader.Init(eventData->second.Retain());
-    ReturnErrorOnFailure(bufReader.Next());
+    if (mMaxAttributeDataBytes == 0 || mCache.GetAttributeDataSize() <= mMaxAttributeDataBytes)
+    {
+        return;
+    }
 
-    reader.Init(bufReader);
-    return CHIP_NO_ERROR;
-}
+    std::vector<std::pair<uint64_t, ConcreteClusterPath>> clusters;
+    mCache.ForEachCluster([&clusters](EndpointId endpointId, ClusterId clusterId, const CachedClusterInfo & info) {
+        clusters.push_back(std::make_pair(info.mLastReadTick, ConcreteClusterPath(endpointId, clusterId)));
+        return CHIP_NO_ERROR;
+    });
+    std::sort(clusters.begin(), clusters.end(),
+              [](const std::pair<uint64_t, ConcreteClusterPath> & x, const std::pair<uint64_t, ConcreteClusterPath> & y) {
+                  return x.first < y.first;
+              });
 
-const ClusterStateCache::EndpointState * ClusterStateCache::GetEndpointState(EndpointId endpointId, CHIP_ERROR & err) const
-{
-    auto endpointIter = mCache.find(endpointId);
-    if (endpointIter == mCache.end())
+    for (auto & cluster : clusters)
     {
-        err = CHIP_ERROR_KEY_NOT_FOUND;
-        return nullptr;
+        if (mCache.GetAttributeDataSize() <= mMaxAttributeDataBytes)
+        {
+            break;
+        }
+        mCache.RemoveCluster(cluster.second.mEndpointId, cluster.second.mClusterId);
+        ChipLogDetail(DataManagement, "Evicted cluster from cache: Endpoint=%u Cluster=" ChipLogFormatMEI,
+                      cluster.second.mEndpointId, ChipLogValueMEI(cluster.second.mClusterId));
+        mCallback.OnClusterEvicted(this, cluster.second.mEndpointId, cluster.second.mClusterId);
     }
-
-    err = CHIP_NO_ERROR;
-    return &endpointIter->second;
 }
 
-const ClusterStateCache::ClusterState * ClusterStateCache::GetClusterState(EndpointId endpointId, ClusterId clusterId,
-                                                                           CHIP_ERROR & err) const
+void ClusterStateCache::EvictEvents()
 {
-    auto endpointState = GetEndpointState(endpointId, err);
-    if (err != CHIP_NO_ERROR)
+    while (mMaxEventDataBytes != 0 && mEventDataSize > mMaxEventDataBytes && !mEventDataCache.empty())
     {
-        return nullptr;
+        auto oldest = mEventDataCache.begin();
+        mEventDataSize -= oldest->second->DataLength();
+        mEventDataCache.erase(oldest);
     }
+}
 
-    auto clusterState = endpointState->find(clusterId);
-    if (clusterState == endpointState->end())
+CHIP_ERROR ClusterStateCache::Get(const ConcreteAttributePath & path, TLV::TLVReader & reader) const
+{
+    CachedAttributeState attributeState;
+    ReturnErrorOnFailure(mCache.GetAttribute(path, attributeState));
+    MarkClusterRead(path.mEndpointId, path.mClusterId);
+    if (attributeState.IsStatus())
     {
-        err = CHIP_ERROR_KEY_NOT_FOUND;
-        return nullptr;
+        return CHIP_ERROR_IM_STATUS_CODE_RECEIVED;
     }
 
-    err = CHIP_NO_ERROR;
-    return &clusterState->second;
+    reader.Init(attributeState.GetData());
+    return reader.Next();
 }
 
-const ClusterStateCache::AttributeState * ClusterStateCache::GetAttributeState(EndpointId endpointId, ClusterId clusterId,
-                                                                               AttributeId attributeId, CHIP_ERROR & err) const
+CHIP_ERROR ClusterStateCache::Get(EventNumber eventNumber, TLV::TLVReader & reader) const
 {
-    auto clusterState = GetClusterState(endpointId, clusterId, err);
-    if (err != CHIP_NO_ERROR)
-    {
-        return nullptr;
-    }
+    CHIP_ERROR err;
 
-    auto attributeState = clusterState->mAttributes.find(attributeId);
-    if (attributeState == clusterState->mAttributes.end())
-    {
-        err = CHIP_ERROR_KEY_NOT_FOUND;
-        return nullptr;
-    }
+    auto eventData = GetEventData(eventNumber, err);
+    ReturnErrorOnFailure(err);
 
-    err = CHIP_NO_ERROR;
-    return &attributeState->second;
+    System::PacketBufferTLVReader bufReader;
+
+    bufReader.Init(eventData->second.Retain());
+    ReturnErrorOnFailure(bufReader.Next());
+
+    reader.Init(bufReader);
+    return CHIP_NO_ERROR;
 }
 
 const ClusterStateCache::EventData * ClusterStateCache::GetEventData(EventNumber eventNumber, CHIP_ERROR & err) const
@@ -358,10 +345,9 @@ void ClusterStateCache::OnAttributeData(const ConcreteDataAttributePath & aPath,
 CHIP_ERROR ClusterStateCache::GetVersion(const ConcreteClusterPath & aPath, Optional<DataVersion> & aVersion) const
 {
     VerifyOrReturnError(aPath.IsValidConcreteClusterPath(), CHIP_ERROR_INVALID_ARGUMENT);
-    CHIP_ERROR err;
-    auto clusterState = GetClusterState(aPath.mEndpointId, aPath.mClusterId, err);
-    ReturnErrorOnFailure(err);
-    aVersion = clusterState->mCommittedDataVersion;
+    const CachedClusterInfo * versions = mCache.FindCluster(aPath.mEndpointId, aPath.mClusterId);
+    VerifyOrReturnError(versions != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+    aVersion = versions->mCommittedDataVersion;
     return CHIP_NO_ERROR;
 }
 
@@ -381,17 +367,16 @@ void ClusterStateCache::OnEventData(const EventHeader & aEventHeader, TLV::TLVRe
 
 CHIP_ERROR ClusterStateCache::GetStatus(const ConcreteAttributePath & path, StatusIB & status) const
 {
-    CHIP_ERROR err;
+    CachedAttributeState attributeState;
+    ReturnErrorOnFailure(mCache.GetAttribute(path, attributeState));
+    MarkClusterRead(path.mEndpointId, path.mClusterId);
 
-    auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
-    ReturnErrorOnFailure(err);
-
-    if (!attributeState->Is<StatusIB>())
+    if (!attributeState.IsStatus())
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
 
-    status = attributeState->Get<StatusIB>();
+    status = attributeState.GetStatus();
     return CHIP_NO_ERROR;
 }
 
@@ -409,27 +394,23 @@ CHIP_ERROR ClusterStateCache::GetStatus(const ConcreteEventPath & path, StatusIB
 
 void ClusterStateCache::GetSortedFilters(std::vector<std::pair<DataVersionFilter, size_t>> & aVector) const
 {
-    for (auto const & endpointIter : mCache)
-    {
-        EndpointId endpointId = endpointIter.first;
-        for (auto const & clusterIter : endpointIter.second)
+    CHIP_ERROR err = mCache.ForEachCluster([this, &aVector](EndpointId endpointId, ClusterId clusterId,
+                                                            const CachedClusterInfo & versions) -> CHIP_ERROR {
+        if (!versions.mCommittedDataVersion.HasValue())
         {
-            if (!clusterIter.second.mCommittedDataVersion.HasValue())
-            {
-                continue;
-            }
-            DataVersion dataVersion = clusterIter.second.mCommittedDataVersion.Value();
-            uint32_t clusterSize    = 0;
-            ClusterId clusterId     = clusterIter.first;
+            return CHIP_NO_ERROR;
+        }
+        DataVersion dataVersion = versions.mCommittedDataVersion.Value();
+        uint32_t clusterSize    = 0;
 
-            for (auto const & attributeIter : clusterIter.second.mAttributes)
-            {
-                if (attributeIter.second.Is<StatusIB>())
+        ReturnErrorOnFailure(mCache.ForEachAttribute(
+            endpointId, clusterId, [&clusterSize](AttributeId attributeId, const CachedAttributeState & state) -> CHIP_ERROR {
+                if (state.IsStatus())
                 {
                     clusterSize +=
                         5; // 1 byte: anonymous tag control byte for struct. 1 byte: control byte for uint8 value. 1 byte:
                            // context-specific tag for uint8 value.1 byte: the uint8 value. 1 byte: end of container.
-                    if (attributeIter.second.Get<StatusIB>().mClusterStatus.HasValue())
+                    if (state.GetStatus().mClusterStatus.HasValue())
                     {
                         clusterSize += 3; // 1 byte: control byte for uint8 value. 1 byte: context-specific tag for uint8 value. 1
                                           // byte: the uint8 value.
@@ -438,26 +419,27 @@ void ClusterStateCache::GetSortedFilters(std::vector<std::pair<DataVersionFilter
                 else
                 {
                     TLV::TLVReader bufReader;
-                    bufReader.Init(attributeIter.second.Get<Platform::ScopedMemoryBufferWithSize<uint8_t>>().Get(),
-                                   attributeIter.second.Get<Platform::ScopedMemoryBufferWithSize<uint8_t>>().AllocatedSize());
-                    ReturnOnFailure(bufReader.Next());
+                    bufReader.Init(state.GetData());
+                    ReturnErrorOnFailure(bufReader.Next());
                     // Skip to the end of the element.
-                    ReturnOnFailure(bufReader.Skip());
+                    ReturnErrorOnFailure(bufReader.Skip());
 
                     // Compute the amount of value data
                     clusterSize += bufReader.GetLengthRead();
                 }
-            }
-            if (clusterSize == 0)
-            {
-                continue;
-            }
+                return CHIP_NO_ERROR;
+            }));
+        if (clusterSize == 0)
+        {
+            return CHIP_NO_ERROR;
+        }
 
-            DataVersionFilter filter(endpointId, clusterId, dataVersion);
+        DataVersionFilter filter(endpointId, clusterId, dataVersion);
 
-            aVector.push_back(std::make_pair(filter, clusterSize));
-        }
-    }
+        aVector.push_back(std::make_pair(filter, clusterSize));
+        return CHIP_NO_ERROR;
+    });
+    ReturnOnFailure(err);
     std::sort(aVector.begin(), aVector.end(),
               [](const std::pair<DataVersionFilter, size_t> & x, const std::pair<DataVersionFilter, size_t> & y) {
                   return x.second > y.second;
@@ -547,6 +529,173 @@ exit:
     return err;
 }
 
+CHIP_ERROR ClusterStateCache::SaveSnapshot(TLV::TLVWriter & aWriter) const
+{
+    TLV::TLVType snapshotContainer;
+    ReturnErrorOnFailure(aWriter.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, snapshotContainer));
+    ReturnErrorOnFailure(aWriter.Put(kSnapshotFormatVersionTag, kSnapshotFormatVersion));
+    if (mHighestReceivedEventNumber.HasValue())
+    {
+        ReturnErrorOnFailure(aWriter.Put(kSnapshotEventNumberTag, mHighestReceivedEventNumber.Value()));
+    }
+
+    TLV::TLVType clustersContainer;
+    ReturnErrorOnFailure(aWriter.StartContainer(kSnapshotClustersTag, TLV::kTLVType_Array, clustersContainer));
+    ReturnErrorOnFailure(mCache.ForEachCluster([this, &aWriter](EndpointId endpointId, ClusterId clusterId,
+                                                                const CachedClusterInfo & info) -> CHIP_ERROR {
+        TLV::TLVType clusterContainer;
+        ReturnErrorOnFailure(aWriter.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, clusterContainer));
+        ReturnErrorOnFailure(aWriter.Put(kSnapshotEndpointIdTag, endpointId));
+        ReturnErrorOnFailure(aWriter.Put(kSnapshotClusterIdTag, clusterId));
+        if (info.mCommittedDataVersion.HasValue())
+        {
+            ReturnErrorOnFailure(aWriter.Put(kSnapshotDataVersionTag, info.mCommittedDataVersion.Value()));
+        }
+
+        TLV::TLVType attributesContainer;
+        ReturnErrorOnFailure(aWriter.StartContainer(kSnapshotAttributesTag, TLV::kTLVType_Array, attributesContainer));
+        ReturnErrorOnFailure(mCache.ForEachAttribute(
+            endpointId, clusterId, [&aWriter](AttributeId attributeId, const CachedAttributeState & state) -> CHIP_ERROR {
+                TLV::TLVType attributeContainer;
+                ReturnErrorOnFailure(aWriter.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, attributeContainer));
+                ReturnErrorOnFailure(aWriter.Put(kSnapshotAttributeIdTag, attributeId));
+                if (state.IsStatus())
+                {
+                    const StatusIB & status = state.GetStatus();
+                    ReturnErrorOnFailure(aWriter.Put(kSnapshotStatusTag, status.mStatus));
+                    if (status.mClusterStatus.HasValue())
+                    {
+                        ReturnErrorOnFailure(aWriter.Put(kSnapshotClusterStatusTag, status.mClusterStatus.Value()));
+                    }
+                }
+                else
+                {
+                    TLV::TLVReader dataReader;
+                    dataReader.Init(state.GetData());
+                    ReturnErrorOnFailure(dataReader.Next());
+                    ReturnErrorOnFailure(aWriter.CopyElement(kSnapshotAttributeDataTag, dataReader));
+                }
+                return aWriter.EndContainer(attributeContainer);
+            }));
+        ReturnErrorOnFailure(aWriter.EndContainer(attributesContainer));
+        return aWriter.EndContainer(clusterContainer);
+    }));
+    ReturnErrorOnFailure(aWriter.EndContainer(clustersContainer));
+    return aWriter.EndContainer(snapshotContainer);
+}
+
+CHIP_ERROR ClusterStateCache::LoadSnapshot(TLV::TLVReader & aReader)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    uint8_t formatVersion;
+    TLV::TLVType snapshotContainer;
+    TLV::TLVType clustersContainer;
+
+    // Merging the snapshot into cached attributes would tag them with data versions of another state of the node.
+    VerifyOrReturnError(mCache.IsEmpty(), CHIP_ERROR_INCORRECT_STATE);
+
+    VerifyOrReturnError(aReader.GetType() == TLV::kTLVType_Structure, CHIP_ERROR_WRONG_TLV_TYPE);
+    ReturnErrorOnFailure(aReader.EnterContainer(snapshotContainer));
+
+    ReturnErrorOnFailure(aReader.Next(kSnapshotFormatVersionTag));
+    ReturnErrorOnFailure(aReader.Get(formatVersion));
+    VerifyOrReturnError(formatVersion == kSnapshotFormatVersion, CHIP_ERROR_VERSION_MISMATCH);
+
+    ReturnErrorOnFailure(aReader.Next());
+    Optional<EventNumber> eventNumber;
+    if (aReader.GetTag() == kSnapshotEventNumberTag)
+    {
+        EventNumber number;
+        ReturnErrorOnFailure(aReader.Get(number));
+        eventNumber.SetValue(number);
+        ReturnErrorOnFailure(aReader.Next());
+    }
+
+    VerifyOrReturnError(aReader.GetTag() == kSnapshotClustersTag, CHIP_ERROR_INVALID_TLV_TAG);
+    ReturnErrorOnFailure(aReader.EnterContainer(clustersContainer));
+    while (CHIP_NO_ERROR == (err = aReader.Next()))
+    {
+        TLV::TLVType clusterContainer;
+        TLV::TLVType attributesContainer;
+        ConcreteAttributePath path;
+        Optional<DataVersion> dataVersion;
+
+        ReturnErrorOnFailure(aReader.EnterContainer(clusterContainer));
+        ReturnErrorOnFailure(aReader.Next(kSnapshotEndpointIdTag));
+        ReturnErrorOnFailure(aReader.Get(path.mEndpointId));
+        ReturnErrorOnFailure(aReader.Next(kSnapshotClusterIdTag));
+        ReturnErrorOnFailure(aReader.Get(path.mClusterId));
+        ReturnErrorOnFailure(aReader.Next());
+        if (aReader.GetTag() == kSnapshotDataVersionTag)
+        {
+            DataVersion version;
+            ReturnErrorOnFailure(aReader.Get(version));
+            dataVersion.SetValue(version);
+            ReturnErrorOnFailure(aReader.Next());
+        }
+
+        VerifyOrReturnError(aReader.GetTag() == kSnapshotAttributesTag, CHIP_ERROR_INVALID_TLV_TAG);
+
+        // A cluster listed again by a corrupted snapshot loses the data version it was given until it is loaded in full.
+        if (mCache.FindCluster(path.mEndpointId, path.mClusterId) != nullptr)
+        {
+            CachedClusterInfo & info = mCache.GetOrAddCluster(path.mEndpointId, path.mClusterId);
+            info.mCommittedDataVersion.ClearValue();
+            info.mPendingDataVersion.ClearValue();
+        }
+
+        ReturnErrorOnFailure(aReader.EnterContainer(attributesContainer));
+        while (CHIP_NO_ERROR == (err = aReader.Next()))
+        {
+            TLV::TLVType attributeContainer;
+            ReturnErrorOnFailure(aReader.EnterContainer(attributeContainer));
+            ReturnErrorOnFailure(aReader.Next(kSnapshotAttributeIdTag));
+            ReturnErrorOnFailure(aReader.Get(path.mAttributeId));
+            ReturnErrorOnFailure(aReader.Next());
+            if (aReader.GetTag() == kSnapshotStatusTag)
+            {
+                StatusIB status;
+                ReturnErrorOnFailure(aReader.Get(status.mStatus));
+                CHIP_ERROR clusterStatusErr = aReader.Next(kSnapshotClusterStatusTag);
+                if (clusterStatusErr == CHIP_NO_ERROR)
+                {
+                    ClusterStatus clusterStatus;
+                    ReturnErrorOnFailure(aReader.Get(clusterStatus));
+                    status.mClusterStatus.SetValue(clusterStatus);
+                }
+                VerifyOrReturnError(clusterStatusErr == CHIP_NO_ERROR || clusterStatusErr == CHIP_END_OF_TLV, clusterStatusErr);
+                ReturnErrorOnFailure(mCache.SetAttributeStatus(path, status));
+            }
+            else
+            {
+                VerifyOrReturnError(aReader.GetTag() == kSnapshotAttributeDataTag, CHIP_ERROR_INVALID_TLV_TAG);
+                ReturnErrorOnFailure(mCache.SetAttributeData(path, aReader));
+            }
+            ReturnErrorOnFailure(aReader.ExitContainer(attributeContainer));
+        }
+        VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+        ReturnErrorOnFailure(aReader.ExitContainer(attributesContainer));
+        ReturnErrorOnFailure(aReader.ExitContainer(clusterContainer));
+
+        // Only now that all the attributes of the cluster are cached can its data version be used to filter it out of reads.
+        CachedClusterInfo & info   = mCache.GetOrAddCluster(path.mEndpointId, path.mClusterId);
+        info.mCommittedDataVersion = dataVersion;
+        info.mPendingDataVersion.ClearValue();
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    ReturnErrorOnFailure(aReader.ExitContainer(clustersContainer));
+    ReturnErrorOnFailure(aReader.ExitContainer(snapshotContainer));
+
+    if (eventNumber.HasValue() &&
+        (!mHighestReceivedEventNumber.HasValue() || mHighestReceivedEventNumber.Value() < eventNumber.Value()))
+    {
+        mHighestReceivedEventNumber = eventNumber;
+    }
+
+    EvictClusters();
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR ClusterStateCache::GetLastReportDataPath(ConcreteClusterPath & aPath)
 {
     if (mLastReportDataPath.IsValidConcreteClusterPath())
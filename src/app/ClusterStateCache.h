@@ -23,10 +23,11 @@
 #include "system/TLVPacketBufferBackingStore.h"
 #include <app/AttributePathParams.h>
 #include <app/BufferedReadCallback.h>
+#include <app/ClusterStateCacheStorage.h>
 #include <app/ReadClient.h>
 #include <app/data-model/DecodableList.h>
 #include <app/data-model/Decode.h>
-#include <lib/support/Variant.h>
+#include <lib/core/CHIPConfig.h>
 #include <list>
 #include <map>
 #include <queue>
@@ -53,7 +54,8 @@ namespace app {
  * For events, functions that permit iteration over the cached events sorted by event number are provided.
  *
  * The data is stored internally in the cache as TLV. This permits re-use of the existing cluster objects
- * to de-serialize the state on-demand.
+ * to de-serialize the state on-demand.  The attribute state is kept in a FlatClusterStateStorage when
+ * CHIP_CONFIG_CLUSTER_STATE_CACHE_FLAT_STORAGE is enabled and in a MapClusterStateStorage otherwise.
  *
  * The cache serves as a callback adapter as well in that it 'forwards' the ReadClient::Callback calls transparently
  * through to a registered callback. In addition, it provides its own enhancements to the base ReadClient::Callback
@@ -84,6 +86,11 @@ public:
          * Called anytime an endpoint was added to the cache
          */
         virtual void OnEndpointAdded(ClusterStateCache * cache, EndpointId endpointId){};
+
+        /*
+         * Called anytime a cluster was evicted from a cache with bounded size (see SetMaxCachedBytes).
+         */
+        virtual void OnClusterEvicted(ClusterStateCache * cache, EndpointId endpointId, ClusterId clusterId){};
     };
 
     /**
@@ -107,6 +114,58 @@ public:
         mHighestReceivedEventNumber.SetValue(highestReceivedEventNumber);
     }
 
+    /*
+     * Bound the memory used by the cache, which is unbounded by default.  The limits are enforced at the end of every
+     * report, after the callbacks for the report have been called.
+     *
+     * If the attribute values take more than maxAttributeDataBytes, the clusters that were least recently read with
+     * Get() or GetStatus() are evicted (see Callback::OnClusterEvicted) until they fit.  An evicted cluster loses its data
+     * version, so it is not included in the DataVersionFilters of the next read or subscription and is reported again in
+     * full.  Until then, reports of changes to it only re-populate the changed attributes.
+     *
+     * If the cached events take more than maxEventDataBytes, the events with the lowest event numbers are evicted until
+     * they fit.  Evicted events are not requested again.
+     *
+     * A limit of 0 leaves the respective data unbounded.
+     */
+    void SetMaxCachedBytes(size_t maxAttributeDataBytes, size_t maxEventDataBytes)
+    {
+        mMaxAttributeDataBytes = maxAttributeDataBytes;
+        mMaxEventDataBytes     = maxEventDataBytes;
+    }
+
+    /*
+     * Get the number of bytes taken by the cached attribute values and events, as limited by SetMaxCachedBytes.
+     */
+    size_t GetAttributeDataSize() const { return mCache.GetAttributeDataSize(); }
+    size_t GetEventDataSize() const { return mEventDataSize; }
+
+    /*
+     * Serialize a snapshot of the cached attribute values and statuses, the committed cluster data versions and the
+     * highest received event number into aWriter, as an anonymous TLV structure.  Cached events are not included.
+     *
+     * The snapshot can be persisted by the application (keyed by the node it was taken for) and passed to
+     * LoadSnapshot() after a restart, so that the first read or subscription of the node only requests the clusters that
+     * changed in the meantime instead of priming the cache again.
+     *
+     * Clusters whose data is incomplete when the snapshot is taken (e.g. while a report is being received) are saved
+     * without a data version.
+     */
+    CHIP_ERROR SaveSnapshot(TLV::TLVWriter & aWriter) const;
+
+    /*
+     * Load a snapshot taken with SaveSnapshot() into the cache.  aReader must be positioned on the snapshot structure.
+     *
+     * This must be called before the cache is used with a ReadClient, while it holds no attributes, and does not invoke
+     * any of the Callback change notifications.  A cluster only gets the data version from the snapshot once all of its
+     * attributes were loaded, so a snapshot that fails to load part way through never causes a cluster with missing
+     * attributes to be filtered out of a read.
+     *
+     * Returns CHIP_ERROR_INCORRECT_STATE if the cache already holds attributes, and CHIP_ERROR_VERSION_MISMATCH for a
+     * snapshot written in an unsupported format.
+     */
+    CHIP_ERROR LoadSnapshot(TLV::TLVReader & aReader);
+
     /*
      * When registering as a callback to the ReadClient, the ClusterStateCache cannot not be passed as a callback
      * directly. Instead, utilize this method below to correctly set up the callback chain such that
@@ -120,7 +179,7 @@ public:
      *
      * For some types of attributes, the value for the attribute is directly backed by the underlying TLV buffer
      * and has pointers into that buffer. (e.g octet strings, char strings and lists).  This buffer only remains
-     * valid until the cached value for that path is updated, so it must not be held
+     * valid until the cached value for that path (or, with flat storage, any path) is updated, so it must not be held
      * across any async call boundaries.
      *
      * The template parameter AttributeObjectTypeT is generally expected to be a
@@ -181,7 +240,7 @@ public:
      *
      * For some types of attributes, the value for the attribute is directly backed by the underlying TLV buffer
      * and has pointers into that buffer. (e.g octet strings, char strings and lists).  This buffer only remains
-     * valid until the cached value for that path is updated, so it must not be held
+     * valid until the cached value for that path (or, with flat storage, any path) is updated, so it must not be held
      * across any async call boundaries.
      *
      * The template parameter ClusterObjectT is generally expected to be a
@@ -228,8 +287,8 @@ public:
      * Retrieve the value of an attribute by updating a in-out TLVReader to be positioned
      * right at the attribute value.
      *
-     * The underlying TLV buffer only remains valid until the cached value for that path is updated, so it must
-     * not be held across any async call boundaries.
+     * The underlying TLV buffer only remains valid until the cached value for that path (or, with flat storage, any
+     * path) is updated, so it must not be held across any async call boundaries.
      *
      * Notable return values:
      *      - If neither data nor status for the specified path exist in the cache, CHIP_ERROR_KEY_NOT_FOUND
@@ -267,7 +326,8 @@ public:
      *
      * For some types of events, the values for the fields in the event are directly backed by the underlying TLV buffer
      * and have pointers into that buffer. (e.g octet strings, char strings and lists). Unlike its attribute counterpart,
-     * these pointers are stable and will not change until a call to `ClearEventCache` happens.
+     * these pointers are stable and will not change until a call to `ClearEventCache` happens (or the event is evicted
+     * at the end of a report, see SetMaxCachedBytes).
      *
      * The template parameter EventObjectTypeT is generally expected to be a
      * ClusterName::Events::EventName::DecodableType, but any
@@ -340,18 +400,11 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachAttribute(EndpointId endpointId, ClusterId clusterId, IteratorFunc func) const
     {
-        CHIP_ERROR err;
-
-        auto clusterState = GetClusterState(endpointId, clusterId, err);
-        ReturnErrorOnFailure(err);
-
-        for (auto & attributeIter : clusterState->mAttributes)
-        {
-            const ConcreteAttributePath path(endpointId, clusterId, attributeIter.first);
-            ReturnErrorOnFailure(func(path));
-        }
-
-        return CHIP_NO_ERROR;
+        return mCache.ForEachAttribute(endpointId, clusterId,
+                                       [endpointId, clusterId, &func](AttributeId attributeId, const CachedAttributeState &) {
+                                           const ConcreteAttributePath path(endpointId, clusterId, attributeId);
+                                           return func(path);
+                                       });
     }
 
     /*
@@ -370,21 +423,14 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachAttribute(ClusterId clusterId, IteratorFunc func) const
     {
-        for (auto & endpointIter : mCache)
-        {
-            for (auto & clusterIter : endpointIter.second)
+        return mCache.ForEachCluster([this, clusterId, &func](EndpointId endpointId, ClusterId clusterIdIter,
+                                                              const CachedClusterInfo &) -> CHIP_ERROR {
+            if (clusterIdIter != clusterId)
             {
-                if (clusterIter.first == clusterId)
-                {
-                    for (auto & attributeIter : clusterIter.second.mAttributes)
-                    {
-                        const ConcreteAttributePath path(endpointIter.first, clusterId, attributeIter.first);
-                        ReturnErrorOnFailure(func(path));
-                    }
-                }
+                return CHIP_NO_ERROR;
             }
-        }
-        return CHIP_NO_ERROR;
+            return ForEachAttribute(endpointId, clusterId, func);
+        });
     }
 
     /*
@@ -403,15 +449,7 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachCluster(EndpointId endpointId, IteratorFunc func) const
     {
-        auto endpointIter = mCache.find(endpointId);
-        if (endpointIter->first == endpointId)
-        {
-            for (auto & clusterIter : endpointIter->second)
-            {
-                ReturnErrorOnFailure(func(clusterIter.first));
-            }
-        }
-        return CHIP_NO_ERROR;
+        return mCache.ForEachCluster(endpointId, func);
     }
 
     /*
@@ -485,6 +523,7 @@ public:
     void ClearEventCache(bool resetTrackedEventCounters = false)
     {
         mEventDataCache.clear();
+        mEventDataSize = 0;
         if (resetTrackedEventCounters)
         {
             mHighestReceivedEventNumber.ClearValue();
@@ -500,20 +539,11 @@ public:
     CHIP_ERROR GetLastReportDataPath(ConcreteClusterPath & aPath);
 
 private:
-    using AttributeState = Variant<Platform::ScopedMemoryBufferWithSize<uint8_t>, StatusIB>;
-    // mPendingDataVersion represents a tentative data version for a cluster that we have gotten some reports for.
-    //
-    // mCurrentDataVersion represents a known data version for a cluster.  In order for this to have a
-    // value the cluster must be included in a path in mRequestPathSet that has a wildcard attribute
-    // and we must not be in the middle of receiving reports for that cluster.
-    struct ClusterState
-    {
-        std::map<AttributeId, AttributeState> mAttributes;
-        Optional<DataVersion> mPendingDataVersion;
-        Optional<DataVersion> mCommittedDataVersion;
-    };
-    using EndpointState = std::map<ClusterId, ClusterState>;
-    using NodeState     = std::map<EndpointId, EndpointState>;
+#if CHIP_CONFIG_CLUSTER_STATE_CACHE_FLAT_STORAGE
+    using NodeState = FlatClusterStateStorage;
+#else
+    using NodeState = MapClusterStateStorage;
+#endif // CHIP_CONFIG_CLUSTER_STATE_CACHE_FLAT_STORAGE
 
     struct Comparator
     {
@@ -523,6 +553,20 @@ private:
         }
     };
 
+    // Tags of the snapshot written by SaveSnapshot().
+    static constexpr uint8_t kSnapshotFormatVersion     = 1;
+    static constexpr TLV::Tag kSnapshotFormatVersionTag = TLV::ContextTag(1);
+    static constexpr TLV::Tag kSnapshotEventNumberTag   = TLV::ContextTag(2);
+    static constexpr TLV::Tag kSnapshotClustersTag      = TLV::ContextTag(3);
+    static constexpr TLV::Tag kSnapshotEndpointIdTag    = TLV::ContextTag(4);
+    static constexpr TLV::Tag kSnapshotClusterIdTag     = TLV::ContextTag(5);
+    static constexpr TLV::Tag kSnapshotDataVersionTag   = TLV::ContextTag(6);
+    static constexpr TLV::Tag kSnapshotAttributesTag    = TLV::ContextTag(7);
+    static constexpr TLV::Tag kSnapshotAttributeIdTag   = TLV::ContextTag(8);
+    static constexpr TLV::Tag kSnapshotAttributeDataTag = TLV::ContextTag(9);
+    static constexpr TLV::Tag kSnapshotStatusTag        = TLV::ContextTag(10);
+    static constexpr TLV::Tag kSnapshotClusterStatusTag = TLV::ContextTag(11);
+
     using EventData = std::pair<EventHeader, System::PacketBufferHandle>;
 
     //
@@ -537,23 +581,6 @@ private:
         }
     };
 
-    /*
-     * These functions provide a way to index into the cached state with different sub-sets of a path, returning
-     * appropriate slices of the data as requested.
-     *
-     * In all variants, the respective slice is returned if a valid path is provided. 'err' is updated to reflect
-     * the status of the operation.
-     *
-     * Notable status values:
-     *      - If a cluster instance corresponding to endpointId and clusterId doesn't exist in the cache,
-     *        CHIP_ERROR_KEY_NOT_FOUND shall be returned.
-     *
-     */
-    const EndpointState * GetEndpointState(EndpointId endpointId, CHIP_ERROR & err) const;
-    const ClusterState * GetClusterState(EndpointId endpointId, ClusterId clusterId, CHIP_ERROR & err) const;
-    const AttributeState * GetAttributeState(EndpointId endpointId, ClusterId clusterId, AttributeId attributeId,
-                                             CHIP_ERROR & err) const;
-
     const EventData * GetEventData(EventNumber number, CHIP_ERROR & err) const;
 
     /*
@@ -614,13 +641,18 @@ private:
     // Commit the pending cluster data version, if there is one.
     void CommitPendingDataVersion();
 
+    // Record a read of the given cluster, for evicting the least recently read clusters first.
+    void MarkClusterRead(EndpointId endpointId, ClusterId clusterId) const;
+
+    // Evict clusters and events until the cache is within the limits set with SetMaxCachedBytes.
+    void EvictClusters();
+    void EvictEvents();
+
     // Get our list of data version filters, sorted from larges to smallest by the total size of the TLV
     // payload for the filter's cluster.  Applying filters in this order should maximize space savings
     // on the wire if not all filters can be applied.
     void GetSortedFilters(std::vector<std::pair<DataVersionFilter, size_t>> & aVector) const;
 
-    CHIP_ERROR GetElementTLVSize(TLV::TLVReader * apData, size_t & aSize);
-
     Callback & mCallback;
     NodeState mCache;
     std::set<ConcreteAttributePath> mChangedAttributeSet;
@@ -633,6 +665,10 @@ private:
     BufferedReadCallback mBufferedReader;
     ConcreteClusterPath mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
     bool mCacheData                         = true;
+    size_t mMaxAttributeDataBytes           = 0;
+    size_t mMaxEventDataBytes               = 0;
+    size_t mEventDataSize                   = 0;
+    mutable uint64_t mReadTick              = 0;
 };
 
 }; // namespace app
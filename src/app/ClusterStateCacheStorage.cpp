@@ -0,0 +1,303 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/ClusterStateCacheStorage.h>
+
+#include <lib/core/TLVWriter.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace chip {
+namespace app {
+
+namespace {
+
+// Returns a bound on the size of the element the reader is positioned on, once written with an anonymous tag.  The
+// reader may be positioned in a much larger buffer, e.g. a snapshot of the whole cache, so its total length is not used.
+CHIP_ERROR GetElementSizeBound(const TLV::TLVReader & data, size_t & size)
+{
+    // The head of the element is already read: bound it by a control byte and the widest length field.
+    constexpr size_t kMaxAnonymousHeadSize = 1 + sizeof(uint64_t);
+
+    TLV::TLVReader reader;
+    reader.Init(data);
+    const uint32_t headEnd = reader.GetLengthRead();
+    ReturnErrorOnFailure(reader.Skip());
+    size = kMaxAnonymousHeadSize + (reader.GetLengthRead() - headEnd);
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+CHIP_ERROR MapClusterStateStorage::GetElementTLVSize(TLV::TLVReader * apData, size_t & aSize)
+{
+    Platform::ScopedMemoryBufferWithSize<uint8_t> backingBuffer;
+    TLV::TLVReader reader;
+    reader.Init(*apData);
+    size_t totalBufSize;
+    ReturnErrorOnFailure(GetElementSizeBound(reader, totalBufSize));
+    backingBuffer.Calloc(totalBufSize);
+    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), totalBufSize);
+    ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), reader));
+    aSize = writer.GetLengthWritten();
+    ReturnErrorOnFailure(writer.Finalize(backingBuffer));
+    return CHIP_NO_ERROR;
+}
+
+const MapClusterStateStorage::ClusterState * MapClusterStateStorage::FindClusterState(EndpointId endpointId,
+                                                                                      ClusterId clusterId) const
+{
+    auto endpointIter = mEndpoints.find(endpointId);
+    if (endpointIter == mEndpoints.end())
+    {
+        return nullptr;
+    }
+
+    auto clusterIter = endpointIter->second.find(clusterId);
+    if (clusterIter == endpointIter->second.end())
+    {
+        return nullptr;
+    }
+
+    return &clusterIter->second;
+}
+
+CHIP_ERROR MapClusterStateStorage::GetAttribute(const ConcreteAttributePath & path, CachedAttributeState & state) const
+{
+    const ClusterState * clusterState = FindClusterState(path.mEndpointId, path.mClusterId);
+    VerifyOrReturnError(clusterState != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+
+    auto attributeIter = clusterState->mAttributes.find(path.mAttributeId);
+    VerifyOrReturnError(attributeIter != clusterState->mAttributes.end(), CHIP_ERROR_KEY_NOT_FOUND);
+
+    state = StateOf(attributeIter->second);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR MapClusterStateStorage::SetAttributeData(const ConcreteAttributePath & path, TLV::TLVReader & data)
+{
+    size_t elementSize = 0;
+    ReturnErrorOnFailure(GetElementTLVSize(&data, elementSize));
+    Platform::ScopedMemoryBufferWithSize<uint8_t> backingBuffer;
+    backingBuffer.Calloc(elementSize);
+    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), elementSize);
+    ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), data));
+    ReturnErrorOnFailure(writer.Finalize(backingBuffer));
+
+    AttributeState state;
+    state.Set<Platform::ScopedMemoryBufferWithSize<uint8_t>>(std::move(backingBuffer));
+    SetAttributeState(path, std::move(state));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR MapClusterStateStorage::SetAttributeStatus(const ConcreteAttributePath & path, const StatusIB & status)
+{
+    AttributeState state;
+    state.Set<StatusIB>(status);
+    SetAttributeState(path, std::move(state));
+    return CHIP_NO_ERROR;
+}
+
+void MapClusterStateStorage::SetAttributeState(const ConcreteAttributePath & path, AttributeState && state)
+{
+    AttributeState & attributeState = mEndpoints[path.mEndpointId][path.mClusterId].mAttributes[path.mAttributeId];
+    mAttributeDataSize              = mAttributeDataSize - DataSizeOf(attributeState) + DataSizeOf(state);
+    attributeState                  = std::move(state);
+}
+
+void MapClusterStateStorage::RemoveCluster(EndpointId endpointId, ClusterId clusterId)
+{
+    auto endpointIter = mEndpoints.find(endpointId);
+    VerifyOrReturn(endpointIter != mEndpoints.end());
+
+    auto clusterIter = endpointIter->second.find(clusterId);
+    VerifyOrReturn(clusterIter != endpointIter->second.end());
+
+    for (auto & attributeIter : clusterIter->second.mAttributes)
+    {
+        mAttributeDataSize -= DataSizeOf(attributeIter.second);
+    }
+    endpointIter->second.erase(clusterIter);
+    if (endpointIter->second.empty())
+    {
+        mEndpoints.erase(endpointIter);
+    }
+}
+
+std::vector<FlatClusterStateStorage::ClusterEntry>::const_iterator FlatClusterStateStorage::LowerBoundCluster(uint64_t key) const
+{
+    return std::lower_bound(mClusters.begin(), mClusters.end(), key,
+                            [](const ClusterEntry & entry, uint64_t value) { return entry.mKey < value; });
+}
+
+std::vector<FlatClusterStateStorage::AttributeEntry>::const_iterator
+FlatClusterStateStorage::LowerBoundAttribute(uint64_t clusterKey, AttributeId attributeId) const
+{
+    return std::lower_bound(mAttributes.begin(), mAttributes.end(), std::make_pair(clusterKey, attributeId),
+                            [](const AttributeEntry & entry, const std::pair<uint64_t, AttributeId> & value) {
+                                return entry.mClusterKey < value.first ||
+                                    (entry.mClusterKey == value.first && entry.mAttributeId < value.second);
+                            });
+}
+
+CachedClusterInfo & FlatClusterStateStorage::GetOrAddCluster(EndpointId endpointId, ClusterId clusterId)
+{
+    const uint64_t key = ClusterKey(endpointId, clusterId);
+
+    // Reports are usually received in path order, so check for an append first.
+    if (mClusters.empty() || mClusters.back().mKey < key)
+    {
+        mClusters.push_back(ClusterEntry{ key, CachedClusterInfo() });
+        return mClusters.back().mVersions;
+    }
+
+    auto position = mClusters.begin() + (LowerBoundCluster(key) - mClusters.cbegin());
+    if (position == mClusters.end() || position->mKey != key)
+    {
+        position = mClusters.insert(position, ClusterEntry{ key, CachedClusterInfo() });
+    }
+    return position->mVersions;
+}
+
+FlatClusterStateStorage::AttributeEntry & FlatClusterStateStorage::GetOrAddAttribute(const ConcreteAttributePath & path)
+{
+    GetOrAddCluster(path.mEndpointId, path.mClusterId);
+
+    AttributeEntry entry;
+    entry.mClusterKey  = ClusterKey(path.mEndpointId, path.mClusterId);
+    entry.mAttributeId = path.mAttributeId;
+
+    if (mAttributes.empty() || mAttributes.back().mClusterKey < entry.mClusterKey ||
+        (mAttributes.back().mClusterKey == entry.mClusterKey && mAttributes.back().mAttributeId < entry.mAttributeId))
+    {
+        mAttributes.push_back(entry);
+        return mAttributes.back();
+    }
+
+    auto position = mAttributes.begin() + (LowerBoundAttribute(entry.mClusterKey, entry.mAttributeId) - mAttributes.cbegin());
+    if (position == mAttributes.end() || position->mClusterKey != entry.mClusterKey || position->mAttributeId != entry.mAttributeId)
+    {
+        position = mAttributes.insert(position, entry);
+    }
+    return *position;
+}
+
+void FlatClusterStateStorage::ReleaseValue(AttributeEntry & entry)
+{
+    if (!entry.mIsStatus)
+    {
+        mUnusedArenaBytes += entry.mLength;
+    }
+    entry.mOffset = 0;
+    entry.mLength = 0;
+}
+
+void FlatClusterStateStorage::RemoveCluster(EndpointId endpointId, ClusterId clusterId)
+{
+    const uint64_t key = ClusterKey(endpointId, clusterId);
+    auto clusterIter   = LowerBoundCluster(key);
+    VerifyOrReturn(clusterIter != mClusters.end() && clusterIter->mKey == key);
+    mClusters.erase(clusterIter);
+
+    auto first = mAttributes.begin() + (LowerBoundAttribute(key, 0) - mAttributes.cbegin());
+    auto last  = first;
+    for (; last != mAttributes.end() && last->mClusterKey == key; ++last)
+    {
+        ReleaseValue(*last);
+    }
+    mAttributes.erase(first, last);
+
+    CompactArenaIfNeeded();
+}
+
+void FlatClusterStateStorage::CompactArenaIfNeeded()
+{
+    if (mArena.size() < kMinCompactionSize || mUnusedArenaBytes <= mArena.size() / 2)
+    {
+        return;
+    }
+
+    std::vector<uint8_t> arena;
+    arena.reserve(mArena.size() - mUnusedArenaBytes);
+    for (auto & entry : mAttributes)
+    {
+        if (!entry.mIsStatus)
+        {
+            uint32_t offset = static_cast<uint32_t>(arena.size());
+            arena.insert(arena.end(), mArena.begin() + entry.mOffset, mArena.begin() + entry.mOffset + entry.mLength);
+            entry.mOffset = offset;
+        }
+    }
+    mArena.swap(arena);
+    mUnusedArenaBytes = 0;
+}
+
+CHIP_ERROR FlatClusterStateStorage::GetAttribute(const ConcreteAttributePath & path, CachedAttributeState & state) const
+{
+    const uint64_t key = ClusterKey(path.mEndpointId, path.mClusterId);
+    auto attributeIter = LowerBoundAttribute(key, path.mAttributeId);
+    VerifyOrReturnError(attributeIter != mAttributes.end() && attributeIter->mClusterKey == key &&
+                            attributeIter->mAttributeId == path.mAttributeId,
+                        CHIP_ERROR_KEY_NOT_FOUND);
+
+    state = StateOf(*attributeIter);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR FlatClusterStateStorage::SetAttributeData(const ConcreteAttributePath & path, TLV::TLVReader & data)
+{
+    CompactArenaIfNeeded();
+
+    const size_t offset = mArena.size();
+    size_t maxSize;
+    ReturnErrorOnFailure(GetElementSizeBound(data, maxSize));
+    VerifyOrReturnError(offset + maxSize <= UINT32_MAX, CHIP_ERROR_NO_MEMORY);
+    mArena.resize(offset + maxSize);
+
+    TLV::TLVWriter writer;
+    writer.Init(mArena.data() + offset, maxSize);
+    CHIP_ERROR err = writer.CopyElement(TLV::AnonymousTag(), data);
+    if (err == CHIP_NO_ERROR)
+    {
+        err = writer.Finalize();
+    }
+    mArena.resize(err == CHIP_NO_ERROR ? offset + writer.GetLengthWritten() : offset);
+    ReturnErrorOnFailure(err);
+
+    AttributeEntry & entry = GetOrAddAttribute(path);
+    ReleaseValue(entry);
+    entry.mOffset   = static_cast<uint32_t>(offset);
+    entry.mLength   = writer.GetLengthWritten();
+    entry.mIsStatus = false;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR FlatClusterStateStorage::SetAttributeStatus(const ConcreteAttributePath & path, const StatusIB & status)
+{
+    AttributeEntry & entry = GetOrAddAttribute(path);
+    ReleaseValue(entry);
+    entry.mStatus   = status;
+    entry.mIsStatus = true;
+    return CHIP_NO_ERROR;
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,332 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the storage backends that hold the attribute state of a ClusterStateCache.
+ *
+ */
+
+#pragma once
+
+#include <app/ConcreteAttributePath.h>
+#include <app/MessageDef/StatusIB.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/Optional.h>
+#include <lib/core/TLVReader.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/Span.h>
+#include <lib/support/Variant.h>
+
+#include <map>
+#include <stdint.h>
+#include <vector>
+
+namespace chip {
+namespace app {
+
+/*
+ * The information tracked for a cached cluster.
+ *
+ * mPendingDataVersion represents a tentative data version for a cluster that we have gotten some reports for.
+ *
+ * mCommittedDataVersion represents a known data version for a cluster.  In order for this to have a
+ * value the cluster must be included in a wildcard attribute path of the read or subscription and we
+ * must not be in the middle of receiving reports for that cluster.
+ *
+ * mLastReadTick orders clusters by when they were last read (or added), for evicting the least recently
+ * read clusters from a cache with bounded size.
+ */
+struct CachedClusterInfo
+{
+    Optional<DataVersion> mPendingDataVersion;
+    Optional<DataVersion> mCommittedDataVersion;
+    mutable uint64_t mLastReadTick = 0;
+};
+
+/*
+ * A view of the cached state of an attribute: either its value, encoded as an anonymous TLV element, or the StatusIB
+ * received for it.  The view is only valid until the storage it was obtained from is next modified.
+ */
+class CachedAttributeState
+{
+public:
+    CachedAttributeState() = default;
+    explicit CachedAttributeState(const ByteSpan & data) : mData(data) {}
+    explicit CachedAttributeState(const StatusIB & status) : mStatus(&status) {}
+
+    bool IsStatus() const { return mStatus != nullptr; }
+    const StatusIB & GetStatus() const { return *mStatus; }
+    const ByteSpan & GetData() const { return mData; }
+
+private:
+    ByteSpan mData;
+    const StatusIB * mStatus = nullptr;
+};
+
+/*
+ * The storage backends below hold the attribute state of a ClusterStateCache and share the same interface:
+ *
+ *  - bool IsEmpty() const;
+ *  - bool HasEndpoint(EndpointId endpointId) const;
+ *  - const CachedClusterInfo * FindCluster(EndpointId endpointId, ClusterId clusterId) const;
+ *  - CachedClusterInfo & GetOrAddCluster(EndpointId endpointId, ClusterId clusterId);
+ *  - void RemoveCluster(EndpointId endpointId, ClusterId clusterId);
+ *  - CHIP_ERROR GetAttribute(const ConcreteAttributePath & path, CachedAttributeState & state) const;
+ *  - CHIP_ERROR SetAttributeData(const ConcreteAttributePath & path, TLV::TLVReader & data);
+ *  - CHIP_ERROR SetAttributeStatus(const ConcreteAttributePath & path, const StatusIB & status);
+ *  - size_t GetAttributeDataSize() const;
+ *  - CHIP_ERROR ForEachAttribute(EndpointId endpointId, ClusterId clusterId, IteratorFunc func) const;
+ *      with CHIP_ERROR IteratorFunc(AttributeId attributeId, const CachedAttributeState & state);
+ *  - CHIP_ERROR ForEachCluster(EndpointId endpointId, IteratorFunc func) const;
+ *      with CHIP_ERROR IteratorFunc(ClusterId clusterId);
+ *  - CHIP_ERROR ForEachCluster(IteratorFunc func) const;
+ *      with CHIP_ERROR IteratorFunc(EndpointId endpointId, ClusterId clusterId, const CachedClusterInfo & versions);
+ *
+ * Lookups return CHIP_ERROR_KEY_NOT_FOUND for paths that are not in the storage, and iteration is in increasing order
+ * of endpoint, cluster and attribute ID.  Setting the state of an attribute adds its cluster if needed.
+ * GetAttributeDataSize() returns the total size of the cached attribute values.
+ */
+
+/*
+ * Storage that keeps nested maps of endpoints, clusters and attributes, with each attribute value in its own heap
+ * allocation.
+ */
+class MapClusterStateStorage
+{
+public:
+    bool IsEmpty() const { return mEndpoints.empty(); }
+    bool HasEndpoint(EndpointId endpointId) const { return mEndpoints.find(endpointId) != mEndpoints.end(); }
+
+    const CachedClusterInfo * FindCluster(EndpointId endpointId, ClusterId clusterId) const
+    {
+        const ClusterState * clusterState = FindClusterState(endpointId, clusterId);
+        return clusterState != nullptr ? &clusterState->mVersions : nullptr;
+    }
+
+    CachedClusterInfo & GetOrAddCluster(EndpointId endpointId, ClusterId clusterId)
+    {
+        return mEndpoints[endpointId][clusterId].mVersions;
+    }
+
+    void RemoveCluster(EndpointId endpointId, ClusterId clusterId);
+
+    CHIP_ERROR GetAttribute(const ConcreteAttributePath & path, CachedAttributeState & state) const;
+    CHIP_ERROR SetAttributeData(const ConcreteAttributePath & path, TLV::TLVReader & data);
+    CHIP_ERROR SetAttributeStatus(const ConcreteAttributePath & path, const StatusIB & status);
+    size_t GetAttributeDataSize() const { return mAttributeDataSize; }
+
+    template <typename IteratorFunc>
+    CHIP_ERROR ForEachAttribute(EndpointId endpointId, ClusterId clusterId, IteratorFunc func) const
+    {
+        const ClusterState * clusterState = FindClusterState(endpointId, clusterId);
+        VerifyOrReturnError(clusterState != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+
+        for (auto & attributeIter : clusterState->mAttributes)
+        {
+            ReturnErrorOnFailure(func(attributeIter.first, StateOf(attributeIter.second)));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    template <typename IteratorFunc>
+    CHIP_ERROR ForEachCluster(EndpointId endpointId, IteratorFunc func) const
+    {
+        auto endpointIter = mEndpoints.find(endpointId);
+        if (endpointIter != mEndpoints.end())
+        {
+            for (auto & clusterIter : endpointIter->second)
+            {
+                ReturnErrorOnFailure(func(clusterIter.first));
+            }
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    template <typename IteratorFunc>
+    CHIP_ERROR ForEachCluster(IteratorFunc func) const
+    {
+        for (auto & endpointIter : mEndpoints)
+        {
+            for (auto & clusterIter : endpointIter.second)
+            {
+                ReturnErrorOnFailure(func(endpointIter.first, clusterIter.first, clusterIter.second.mVersions));
+            }
+        }
+        return CHIP_NO_ERROR;
+    }
+
+private:
+    using AttributeState = Variant<Platform::ScopedMemoryBufferWithSize<uint8_t>, StatusIB>;
+    struct ClusterState
+    {
+        std::map<AttributeId, AttributeState> mAttributes;
+        CachedClusterInfo mVersions;
+    };
+    using EndpointState = std::map<ClusterId, ClusterState>;
+
+    const ClusterState * FindClusterState(EndpointId endpointId, ClusterId clusterId) const;
+
+    static CachedAttributeState StateOf(const AttributeState & state)
+    {
+        if (state.Is<StatusIB>())
+        {
+            return CachedAttributeState(state.Get<StatusIB>());
+        }
+        const auto & buffer = state.Get<Platform::ScopedMemoryBufferWithSize<uint8_t>>();
+        return CachedAttributeState(ByteSpan(buffer.Get(), buffer.AllocatedSize()));
+    }
+
+    static CHIP_ERROR GetElementTLVSize(TLV::TLVReader * apData, size_t & aSize);
+
+    static size_t DataSizeOf(const AttributeState & state)
+    {
+        using Buffer = Platform::ScopedMemoryBufferWithSize<uint8_t>;
+        return state.Is<Buffer>() ? state.Get<Buffer>().AllocatedSize() : 0;
+    }
+
+    void SetAttributeState(const ConcreteAttributePath & path, AttributeState && state);
+
+    std::map<EndpointId, EndpointState> mEndpoints;
+    size_t mAttributeDataSize = 0;
+};
+
+/*
+ * Storage that keeps clusters and attributes in vectors sorted by their packed (endpoint, cluster) key and attribute
+ * ID, with all attribute values of the cache appended to a single arena.  This avoids a heap allocation per attribute
+ * and per map node, and makes lookups a binary search over contiguous memory.
+ *
+ * The space of replaced and removed values is reclaimed by compacting the arena once more than half of it is unused.
+ * Since both compacting and growing the arena move values, they are moved by any update of the storage, not just
+ * updates of their own path, which is why this backend is not enabled by default.
+ */
+class FlatClusterStateStorage
+{
+public:
+    bool IsEmpty() const { return mClusters.empty(); }
+    bool HasEndpoint(EndpointId endpointId) const
+    {
+        auto clusterIter = LowerBoundCluster(ClusterKey(endpointId, 0));
+        return clusterIter != mClusters.end() && EndpointOf(clusterIter->mKey) == endpointId;
+    }
+
+    const CachedClusterInfo * FindCluster(EndpointId endpointId, ClusterId clusterId) const
+    {
+        const uint64_t key = ClusterKey(endpointId, clusterId);
+        auto clusterIter   = LowerBoundCluster(key);
+        return (clusterIter != mClusters.end() && clusterIter->mKey == key) ? &clusterIter->mVersions : nullptr;
+    }
+
+    CachedClusterInfo & GetOrAddCluster(EndpointId endpointId, ClusterId clusterId);
+    void RemoveCluster(EndpointId endpointId, ClusterId clusterId);
+
+    CHIP_ERROR GetAttribute(const ConcreteAttributePath & path, CachedAttributeState & state) const;
+    CHIP_ERROR SetAttributeData(const ConcreteAttributePath & path, TLV::TLVReader & data);
+    CHIP_ERROR SetAttributeStatus(const ConcreteAttributePath & path, const StatusIB & status);
+    size_t GetAttributeDataSize() const { return mArena.size() - mUnusedArenaBytes; }
+
+    template <typename IteratorFunc>
+    CHIP_ERROR ForEachAttribute(EndpointId endpointId, ClusterId clusterId, IteratorFunc func) const
+    {
+        VerifyOrReturnError(FindCluster(endpointId, clusterId) != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+
+        const uint64_t key = ClusterKey(endpointId, clusterId);
+        for (auto attributeIter = LowerBoundAttribute(key, 0);
+             attributeIter != mAttributes.end() && attributeIter->mClusterKey == key; ++attributeIter)
+        {
+            ReturnErrorOnFailure(func(attributeIter->mAttributeId, StateOf(*attributeIter)));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    template <typename IteratorFunc>
+    CHIP_ERROR ForEachCluster(EndpointId endpointId, IteratorFunc func) const
+    {
+        for (auto clusterIter = LowerBoundCluster(ClusterKey(endpointId, 0));
+             clusterIter != mClusters.end() && EndpointOf(clusterIter->mKey) == endpointId; ++clusterIter)
+        {
+            ReturnErrorOnFailure(func(ClusterOf(clusterIter->mKey)));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    template <typename IteratorFunc>
+    CHIP_ERROR ForEachCluster(IteratorFunc func) const
+    {
+        for (auto & cluster : mClusters)
+        {
+            ReturnErrorOnFailure(func(EndpointOf(cluster.mKey), ClusterOf(cluster.mKey), cluster.mVersions));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+private:
+    struct ClusterEntry
+    {
+        uint64_t mKey;
+        CachedClusterInfo mVersions;
+    };
+
+    struct AttributeEntry
+    {
+        uint64_t mClusterKey;
+        AttributeId mAttributeId;
+        // Location of the value in mArena; unused if mIsStatus.
+        uint32_t mOffset = 0;
+        uint32_t mLength = 0;
+        StatusIB mStatus;
+        bool mIsStatus = false;
+    };
+
+    // Don't bother compacting arenas smaller than this.
+    static constexpr size_t kMinCompactionSize = 1024;
+
+    static constexpr uint64_t ClusterKey(EndpointId endpointId, ClusterId clusterId)
+    {
+        return (static_cast<uint64_t>(endpointId) << 32) | clusterId;
+    }
+    static constexpr EndpointId EndpointOf(uint64_t key) { return static_cast<EndpointId>(key >> 32); }
+    static constexpr ClusterId ClusterOf(uint64_t key) { return static_cast<ClusterId>(key); }
+
+    std::vector<ClusterEntry>::const_iterator LowerBoundCluster(uint64_t key) const;
+    std::vector<AttributeEntry>::const_iterator LowerBoundAttribute(uint64_t clusterKey, AttributeId attributeId) const;
+    AttributeEntry & GetOrAddAttribute(const ConcreteAttributePath & path);
+    void ReleaseValue(AttributeEntry & entry);
+    void CompactArenaIfNeeded();
+
+    CachedAttributeState StateOf(const AttributeEntry & entry) const
+    {
+        if (entry.mIsStatus)
+        {
+            return CachedAttributeState(entry.mStatus);
+        }
+        return CachedAttributeState(ByteSpan(mArena.data() + entry.mOffset, entry.mLength));
+    }
+
+    std::vector<ClusterEntry> mClusters;
+    std::vector<AttributeEntry> mAttributes;
+    std::vector<uint8_t> mArena;
+    // Bytes of mArena that hold replaced or removed values.
+    size_t mUnusedArenaBytes = 0;
+};
+
+} // namespace app
+} // namespace chip
@@ -23,9 +23,11 @@
 #include <app/InteractionModelEngine.h>
 #include <app/RequiredPrivilege.h>
 #include <assert.h>
+#include <algorithm>
 #include <inttypes.h>
 #include <lib/core/TLVUtilities.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
 #include <lib/support/logging/CHIPLogging.h>
 
 using namespace chip::TLV;
@@ -57,6 +59,81 @@ public:
     virtual ~CircularEventReader() = default;
 };
 
+/**
+ * @brief
+ *   A TLVBackingStore for reading a single event, located through its offset and length, out of a CircularEventBuffer.
+ */
+class IndexedEventBackingStore : public TLV::TLVBackingStore
+{
+public:
+    IndexedEventBackingStore(const CircularEventBuffer & aBuffer, uint32_t aOffset, uint32_t aLength) :
+        mpQueue(aBuffer.GetQueue()), mQueueSize(aBuffer.GetTotalDataLength()), mOffset(aOffset), mLength(aLength)
+    {}
+
+    CHIP_ERROR OnInit(TLVReader & aReader, const uint8_t *& aBufStart, uint32_t & aBufLen) override
+    {
+        aBufStart = nullptr;
+        return GetNextBuffer(aReader, aBufStart, aBufLen);
+    }
+
+    CHIP_ERROR GetNextBuffer(TLVReader & aReader, const uint8_t *& aBufStart, uint32_t & aBufLen) override
+    {
+        if (aBufStart == nullptr)
+        {
+            aBufStart = mpQueue + mOffset;
+            aBufLen   = std::min(mLength, mQueueSize - mOffset);
+        }
+        else if (aBufStart >= mpQueue + mQueueSize)
+        {
+            // The event wraps around the end of the queue.
+            aBufStart = mpQueue;
+            aBufLen   = mLength - (mQueueSize - mOffset);
+        }
+        else
+        {
+            aBufLen = 0;
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR OnInit(TLVWriter & aWriter, uint8_t *& aBufStart, uint32_t & aBufLen) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
+    CHIP_ERROR GetNewBuffer(TLVWriter & aWriter, uint8_t *& aBufStart, uint32_t & aBufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    CHIP_ERROR FinalizeBuffer(TLVWriter & aWriter, uint8_t * aBufStart, uint32_t aBufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+private:
+    const uint8_t * mpQueue;
+    uint32_t mQueueSize;
+    uint32_t mOffset;
+    uint32_t mLength;
+};
+
+/**
+ * @brief
+ *   Copy the bytes [aStart, aEnd) of an indexed event into a writer, splitting the copy where the event wraps around the end of
+ *   the queue.
+ */
+CHIP_ERROR CopyIndexedEventBytes(const CircularEventBuffer & aBuffer, const EventIndexEntry & aEntry, uint32_t aStart,
+                                 uint32_t aEnd, TLVWriter & aWriter)
+{
+    const uint32_t queueSize = aBuffer.GetTotalDataLength();
+    const uint32_t offset    = (aEntry.mOffset + aStart) % queueSize;
+    const uint32_t length    = aEnd - aStart;
+    const uint32_t firstPart = std::min(length, queueSize - offset);
+
+    ReturnErrorOnFailure(aWriter.PutPreEncodedElements(aBuffer.GetQueue() + offset, firstPart));
+    if (firstPart < length)
+    {
+        ReturnErrorOnFailure(aWriter.PutPreEncodedElements(aBuffer.GetQueue(), length - firstPart));
+    }
+    return CHIP_NO_ERROR;
+}
+
 EventManagement & EventManagement::GetInstance()
 {
     return sInstance;
@@ -101,6 +178,7 @@ void EventManagement::Init(Messaging::ExchangeManager * apExchangeManager, uint3
         return;
     }
     mpExchangeMgr = apExchangeManager;
+    mUseEventIndex = false;
 
     for (uint32_t bufferIndex = 0; bufferIndex < aNumBuffers; bufferIndex++)
     {
@@ -108,7 +186,9 @@ void EventManagement::Init(Messaging::ExchangeManager * apExchangeManager, uint3
 
         current = &apCircularEventBuffer[bufferIndex];
         current->Init(apLogStorageResources[bufferIndex].mpBuffer, apLogStorageResources[bufferIndex].mBufferSize, prev, next,
-                      apLogStorageResources[bufferIndex].mPriority);
+                      apLogStorageResources[bufferIndex].mPriority, apLogStorageResources[bufferIndex].mpIndex,
+                      apLogStorageResources[bufferIndex].mIndexSize);
+        mUseEventIndex = mUseEventIndex || current->HasIndex();
 
         prev = current;
 
@@ -130,6 +210,7 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
 {
     CircularTLVWriter writer;
     CircularTLVReader reader;
+    EventIndexEntry entry;
     CHIP_ERROR err                   = CHIP_NO_ERROR;
     CircularEventBuffer * nextBuffer = apEventBuffer->GetNextCircularEventBuffer();
     if (nextBuffer == nullptr)
@@ -137,6 +218,7 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
     CircularEventBuffer backup = *nextBuffer;
+    const uint32_t offset      = static_cast<uint32_t>(nextBuffer->QueueTail() - nextBuffer->GetQueue());
 
     // Set up the next buffer s.t. it fails if needs to evict an element
     nextBuffer->mProcessEvictedElement = AlwaysFail;
@@ -149,12 +231,22 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
     err = reader.Next();
     SuccessOrExit(err);
 
+    if (nextBuffer->HasIndex() && !apEventBuffer->GetHeadIndexEntry(entry))
+    {
+        err = ParseEventIndexEntry(reader, entry);
+        SuccessOrExit(err);
+    }
+
     err = writer.CopyElement(reader);
     SuccessOrExit(err);
 
     err = writer.Finalize();
     SuccessOrExit(err);
 
+    entry.mOffset = offset;
+    entry.mLength = writer.GetLengthWritten();
+    nextBuffer->AppendIndexEntry(entry);
+
     ChipLogDetail(EventLogging, "Copy Event to next buffer with priority %u", static_cast<unsigned>(nextBuffer->GetPriority()));
 exit:
     if (err != CHIP_NO_ERROR)
@@ -198,6 +290,10 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, P
             eventBuffer->mProcessEvictedElement = EvictEvent;
             eventBuffer->mAppData               = &ctx;
             err                                 = eventBuffer->EvictHead();
+            if (err == CHIP_NO_ERROR)
+            {
+                eventBuffer->RemoveHeadIndexEntry();
+            }
 
             // one of two things happened: either the element was evicted immediately if the head's priority is same as current
             // buffer(final one), or we figured out how much space we need to evict it into the next buffer, the check happens in
@@ -226,6 +322,7 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, P
                     // caller know that we could not honor the
                     // request
                     SuccessOrExit(err);
+                    eventBuffer->RemoveHeadIndexEntry();
                     continue;
                 }
                 // we cannot copy event outright. We remember the
@@ -427,6 +524,8 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
     CircularTLVWriter checkpoint = writer;
     EventLoadOutContext ctxt     = EventLoadOutContext(writer, aEventOptions.mPriority, mLastEventNumber);
     EventOptions opts;
+    EventIndexEntry entry;
+    const uint8_t * head = nullptr;
 
     Timestamp timestamp;
 #if CHIP_DEVICE_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS
@@ -464,11 +563,51 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
     err = EnsureSpaceInCircularBuffer(requestSize, aEventOptions.mPriority);
     SuccessOrExit(err);
 
+    head          = mpEventBuffer->QueueHead();
+    entry.mOffset = static_cast<uint32_t>(mpEventBuffer->QueueTail() - mpEventBuffer->GetQueue());
+
     err = ConstructEvent(&ctxt, apDelegate, &opts);
     SuccessOrExit(err);
 
     mBytesWritten += writer.GetLengthWritten();
 
+    if (mpEventBuffer->QueueHead() != head)
+    {
+        // The writer had to evict events on its own, which the index did not account for.
+        RebuildEventIndex(*mpEventBuffer);
+    }
+    else
+    {
+        entry.mLength = writer.GetLengthWritten();
+        if (mpEventBuffer->HasIndex())
+        {
+            // Read the layout of the event back, for it to be copied out as raw bytes.
+            IndexedEventBackingStore backingStore(*mpEventBuffer, entry.mOffset, entry.mLength);
+            TLVReader reader;
+            CHIP_ERROR parseErr = reader.Init(backingStore, entry.mLength);
+            if (parseErr == CHIP_NO_ERROR)
+            {
+                parseErr = reader.Next();
+            }
+            if (parseErr == CHIP_NO_ERROR)
+            {
+                parseErr = ParseEventIndexEntry(reader, entry);
+            }
+            if (parseErr != CHIP_NO_ERROR)
+            {
+                RebuildEventIndex(*mpEventBuffer);
+            }
+            else
+            {
+                mpEventBuffer->AppendIndexEntry(entry);
+            }
+        }
+        else
+        {
+            mpEventBuffer->AppendIndexEntry(entry);
+        }
+    }
+
 exit:
     if (err != CHIP_NO_ERROR)
     {
@@ -531,28 +670,14 @@ CHIP_ERROR EventManagement::CheckEventContext(EventLoadOutContext * eventLoadOut
         return CHIP_ERROR_UNEXPECTED_EVENT;
     }
 
-    if (event.mFabricIndex.HasValue() &&
-        (event.mFabricIndex.Value() == kUndefinedFabricIndex ||
-         eventLoadOutContext->mSubjectDescriptor.fabricIndex != event.mFabricIndex.Value()))
-    {
-        return CHIP_ERROR_UNEXPECTED_EVENT;
-    }
-
     ConcreteEventPath path(event.mEndpointId, event.mClusterId, event.mEventId);
-    CHIP_ERROR ret = CHIP_ERROR_UNEXPECTED_EVENT;
+    CHIP_ERROR ret = CHIP_NO_ERROR;
 
-    for (auto * interestedPath = eventLoadOutContext->mpInterestedEventPaths; interestedPath != nullptr;
-         interestedPath        = interestedPath->mpNext)
+    if (!IsInterestedEvent(eventLoadOutContext, path, event.mFabricIndex))
     {
-        if (interestedPath->mValue.IsEventPathSupersetOf(path))
-        {
-            ret = CHIP_NO_ERROR;
-            break;
-        }
+        return CHIP_ERROR_UNEXPECTED_EVENT;
     }
 
-    ReturnErrorOnFailure(ret);
-
     Access::RequestPath requestPath{ .cluster = event.mClusterId, .endpoint = event.mEndpointId };
     Access::Privilege requestPrivilege = RequiredPrivilege::ForReadEvent(path);
     CHIP_ERROR accessControlError =
@@ -566,6 +691,26 @@ CHIP_ERROR EventManagement::CheckEventContext(EventLoadOutContext * eventLoadOut
     return ret;
 }
 
+bool EventManagement::IsInterestedEvent(const EventLoadOutContext * apContext, const ConcreteEventPath & aPath,
+                                        const Optional<FabricIndex> & aFabricIndex)
+{
+    if (aFabricIndex.HasValue() &&
+        (aFabricIndex.Value() == kUndefinedFabricIndex || apContext->mSubjectDescriptor.fabricIndex != aFabricIndex.Value()))
+    {
+        return false;
+    }
+
+    for (auto * interestedPath = apContext->mpInterestedEventPaths; interestedPath != nullptr;
+         interestedPath        = interestedPath->mpNext)
+    {
+        if (interestedPath->mValue.IsEventPathSupersetOf(aPath))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 CHIP_ERROR EventManagement::EventIterator(const TLVReader & aReader, size_t aDepth, EventLoadOutContext * apEventLoadOutContext,
                                           EventEnvelopeContext * event)
 {
@@ -651,7 +796,20 @@ CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, const ObjectLi
 
     context.mSubjectDescriptor     = aSubjectDescriptor;
     context.mpInterestedEventPaths = apEventPathList;
-    err                            = GetEventReader(reader, PriorityLevel::Critical, &bufWrapper);
+
+    if (mUseEventIndex)
+    {
+        // Same order as the reader below: from the oldest events in the critical buffer to the newest in the debug buffer.
+        for (CircularEventBuffer * buffer = GetPriorityBuffer(PriorityLevel::Critical); buffer != nullptr;
+             buffer                       = buffer->GetPreviousCircularEventBuffer())
+        {
+            err = FetchEventsSince(*buffer, context);
+            SuccessOrExit(err);
+        }
+        ExitNow();
+    }
+
+    err = GetEventReader(reader, PriorityLevel::Critical, &bufWrapper);
     SuccessOrExit(err);
 
     err = TLV::Utilities::Iterate(reader, CopyEventsSince, &context, recurse);
@@ -675,6 +833,204 @@ exit:
     return err;
 }
 
+CHIP_ERROR EventManagement::FetchEventsSince(CircularEventBuffer & aBuffer, EventLoadOutContext & aContext)
+{
+    if (aBuffer.GetUnindexedEventCount() == 0 && aBuffer.GetIndexEntryCount() != 0 &&
+        aBuffer.GetIndexEntry(0).mOffset != static_cast<uint32_t>(aBuffer.QueueHead() - aBuffer.GetQueue()))
+    {
+        ChipLogError(EventLogging, "Event index out of sync with buffer of priority %u",
+                     static_cast<unsigned>(aBuffer.GetPriority()));
+        RebuildEventIndex(aBuffer);
+    }
+
+    if (aBuffer.GetUnindexedEventCount() != 0)
+    {
+        CircularTLVReader reader;
+        reader.Init(aBuffer);
+        for (uint32_t i = 0; i < aBuffer.GetUnindexedEventCount(); i++)
+        {
+            ReturnErrorOnFailure(reader.Next());
+            ReturnErrorOnFailure(CopyEventsSince(reader, 0, &aContext));
+        }
+    }
+
+    // Indexed events are sorted by event number, so skip straight to the first one that was not fetched yet.
+    uint32_t low  = 0;
+    uint32_t high = aBuffer.GetIndexEntryCount();
+    while (low < high)
+    {
+        uint32_t middle = low + (high - low) / 2;
+        if (aBuffer.GetIndexEntry(middle).mEventNumber < aContext.mStartingEventNumber)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    if (low > 0)
+    {
+        aContext.mCurrentEventNumber = aBuffer.GetIndexEntry(low - 1).mEventNumber;
+    }
+
+    for (uint32_t i = low; i < aBuffer.GetIndexEntryCount(); i++)
+    {
+        const EventIndexEntry & entry = aBuffer.GetIndexEntry(i);
+        aContext.mCurrentEventNumber  = entry.mEventNumber;
+        if (!IsInterestedEvent(&aContext, ConcreteEventPath(entry.mEndpointId, entry.mClusterId, entry.mEventId),
+                               entry.mFabricIndex))
+        {
+            continue;
+        }
+
+        ReturnErrorOnFailure(CopyIndexedEvent(aBuffer, entry, aContext));
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR EventManagement::CopyIndexedEvent(const CircularEventBuffer & aBuffer, const EventIndexEntry & aEntry,
+                                             EventLoadOutContext & aContext)
+{
+    EventEnvelopeContext event;
+    event.mEndpointId  = aEntry.mEndpointId;
+    event.mClusterId   = aEntry.mClusterId;
+    event.mEventId     = aEntry.mEventId;
+    event.mFabricIndex = aEntry.mFabricIndex;
+
+    aContext.mCurrentTime = aEntry.mTimestamp;
+    CHIP_ERROR err        = CheckEventContext(&aContext, event);
+    VerifyOrReturnError(err != CHIP_ERROR_UNEXPECTED_EVENT, CHIP_NO_ERROR);
+    ReturnErrorOnFailure(err);
+
+    // Same encoding as CopyEvent, which re-encodes the event element by element.
+    TLVWriter checkpoint = aContext.mWriter;
+    TLVWriter & writer   = aContext.mWriter;
+    TLVType containerType;
+    TLVType containerType1;
+    const bool adjustTimestamp = aEntry.mTimestampLength != 0 && !aContext.mFirst &&
+        aContext.mCurrentTime.mType == aContext.mPreviousTime.mType;
+
+    SuccessOrExit(err = writer.StartContainer(AnonymousTag(), kTLVType_Structure, containerType));
+    SuccessOrExit(
+        err = writer.StartContainer(TLV::ContextTag(EventReportIB::Tag::kEventData), kTLVType_Structure, containerType1));
+    if (adjustTimestamp)
+    {
+        const Tag deltaTag = aContext.mCurrentTime.IsSystem() ? TLV::ContextTag(EventDataIB::Tag::kDeltaSystemTimestamp)
+                                                              : TLV::ContextTag(EventDataIB::Tag::kDeltaEpochTimestamp);
+        const uint32_t timestampEnd = aEntry.mTimestampOffset + aEntry.mTimestampLength;
+        SuccessOrExit(err = CopyIndexedEventBytes(aBuffer, aEntry, aEntry.mFieldsOffset, aEntry.mTimestampOffset, writer));
+        SuccessOrExit(err = writer.Put(deltaTag, aContext.mCurrentTime.mValue - aContext.mPreviousTime.mValue));
+        SuccessOrExit(err = CopyIndexedEventBytes(aBuffer, aEntry, timestampEnd, aEntry.mFieldsEnd, writer));
+    }
+    else
+    {
+        SuccessOrExit(err = CopyIndexedEventBytes(aBuffer, aEntry, aEntry.mFieldsOffset, aEntry.mFieldsEnd, writer));
+    }
+    SuccessOrExit(err = writer.EndContainer(containerType1));
+    SuccessOrExit(err = writer.EndContainer(containerType));
+    SuccessOrExit(err = writer.Finalize());
+
+    aContext.mPreviousTime.mValue = aContext.mCurrentTime.mValue;
+    aContext.mFirst               = false;
+    aContext.mEventCount++;
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        writer = checkpoint;
+    }
+    return err;
+}
+
+CHIP_ERROR EventManagement::ParseEventIndexEntry(const TLVReader & aReader, EventIndexEntry & aEntry)
+{
+    TLVReader reader;
+    TLVType containerType;
+    TLVType containerType1;
+    EventEnvelopeContext event;
+    CHIP_ERROR err        = CHIP_NO_ERROR;
+    bool fabricIndexFound = false;
+
+    // Events are anonymous structures, whose one byte head the reader has already read.
+    VerifyOrReturnError(aReader.GetType() == kTLVType_Structure && aReader.GetTag() == AnonymousTag(),
+                        CHIP_ERROR_WRONG_TLV_TYPE);
+    const uint32_t eventStart = aReader.GetLengthRead() - 1;
+
+    reader.Init(aReader);
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+    ReturnErrorOnFailure(reader.Next());
+    ReturnErrorOnFailure(reader.EnterContainer(containerType1));
+
+    uint32_t fieldStart = reader.GetLengthRead();
+    VerifyOrReturnError(CanCastTo<uint16_t>(fieldStart - eventStart), CHIP_ERROR_BUFFER_TOO_SMALL);
+    aEntry.mFieldsOffset    = static_cast<uint16_t>(fieldStart - eventStart);
+    aEntry.mFieldsEnd       = aEntry.mFieldsOffset;
+    aEntry.mTimestampOffset = 0;
+    aEntry.mTimestampLength = 0;
+    while (CHIP_NO_ERROR == (err = reader.Next()))
+    {
+        // The fabric index goes last, so that it can be left out when the event is copied out.
+        VerifyOrReturnError(!fabricIndexFound, CHIP_ERROR_INVALID_TLV_ELEMENT);
+        ReturnErrorOnFailure(FetchEventParameters(reader, 0, &event));
+
+        const Tag tag = reader.GetTag();
+        ReturnErrorOnFailure(reader.Skip());
+        VerifyOrReturnError(CanCastTo<uint16_t>(reader.GetLengthRead() - eventStart), CHIP_ERROR_BUFFER_TOO_SMALL);
+        if (tag == TLV::ContextTag(EventDataIB::Tag::kSystemTimestamp) || tag == TLV::ContextTag(EventDataIB::Tag::kEpochTimestamp))
+        {
+            aEntry.mTimestampOffset = static_cast<uint16_t>(fieldStart - eventStart);
+            aEntry.mTimestampLength = static_cast<uint16_t>(reader.GetLengthRead() - fieldStart);
+        }
+        else if (tag == TLV::ProfileTag(kEventManagementProfile, kFabricIndexTag))
+        {
+            fabricIndexFound = true;
+            continue;
+        }
+        fieldStart        = reader.GetLengthRead();
+        aEntry.mFieldsEnd = static_cast<uint16_t>(fieldStart - eventStart);
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    VerifyOrReturnError(event.mFieldsToRead == kRequiredEventField, CHIP_ERROR_INVALID_ARGUMENT);
+
+    aEntry.mEventNumber = event.mEventNumber;
+    aEntry.mTimestamp   = event.mCurrentTime;
+    aEntry.mEndpointId  = event.mEndpointId;
+    aEntry.mClusterId   = event.mClusterId;
+    aEntry.mEventId     = event.mEventId;
+    aEntry.mFabricIndex = event.mFabricIndex;
+    return CHIP_NO_ERROR;
+}
+
+void EventManagement::RebuildEventIndex(CircularEventBuffer & aBuffer)
+{
+    CircularTLVReader reader;
+    uint32_t eventCount = 0;
+    const uint32_t head = static_cast<uint32_t>(aBuffer.QueueHead() - aBuffer.GetQueue());
+
+    aBuffer.ResetIndex(0);
+    reader.Init(aBuffer);
+    while (true)
+    {
+        EventIndexEntry entry;
+        const uint32_t lengthRead = reader.GetLengthRead();
+        VerifyOrReturn(reader.Next() == CHIP_NO_ERROR);
+        eventCount++;
+
+        CHIP_ERROR err = aBuffer.HasIndex() ? ParseEventIndexEntry(reader, entry) : CHIP_ERROR_NO_MEMORY;
+        VerifyOrReturn(reader.Skip() == CHIP_NO_ERROR);
+        if (err != CHIP_NO_ERROR)
+        {
+            // Events that cannot be indexed stay unindexed, along with all the events before them.
+            aBuffer.ResetIndex(eventCount);
+            continue;
+        }
+        entry.mOffset = (head + lengthRead) % aBuffer.GetTotalDataLength();
+        entry.mLength = reader.GetLengthRead() - lengthRead;
+        aBuffer.AppendIndexEntry(entry);
+    }
+}
+
 CHIP_ERROR EventManagement::FabricRemovedCB(const TLV::TLVReader & aReader, size_t aDepth, void * apContext)
 {
     // the function does not actually remove the event, instead, it sets the fabric index to an invalid value.
@@ -731,6 +1087,18 @@ CHIP_ERROR EventManagement::FabricRemoved(FabricIndex aFabricIndex)
     {
         err = CHIP_NO_ERROR;
     }
+
+    for (CircularEventBuffer * buffer = mpEventBuffer; buffer != nullptr; buffer = buffer->GetNextCircularEventBuffer())
+    {
+        for (uint32_t i = 0; i < buffer->GetIndexEntryCount(); i++)
+        {
+            Optional<FabricIndex> & fabricIndex = buffer->GetIndexEntry(i).mFabricIndex;
+            if (fabricIndex.HasValue() && fabricIndex.Value() == aFabricIndex)
+            {
+                fabricIndex.SetValue(kUndefinedFabricIndex);
+            }
+        }
+    }
     return err;
 }
 
@@ -850,12 +1218,57 @@ void EventManagement::SetScheduledEventInfo(EventNumber & aEventNumber, uint32_t
 }
 
 void CircularEventBuffer::Init(uint8_t * apBuffer, uint32_t aBufferLength, CircularEventBuffer * apPrev,
-                               CircularEventBuffer * apNext, PriorityLevel aPriorityLevel)
+                               CircularEventBuffer * apNext, PriorityLevel aPriorityLevel, EventIndexEntry * apIndex,
+                               uint32_t aIndexSize)
 {
     TLVCircularBuffer::Init(apBuffer, aBufferLength);
-    mpPrev    = apPrev;
-    mpNext    = apNext;
-    mPriority = aPriorityLevel;
+    mpPrev     = apPrev;
+    mpNext     = apNext;
+    mPriority  = aPriorityLevel;
+    mpIndex    = aIndexSize != 0 ? apIndex : nullptr;
+    mIndexSize = mpIndex != nullptr ? aIndexSize : 0;
+    ResetIndex(0);
+}
+
+void CircularEventBuffer::AppendIndexEntry(const EventIndexEntry & aEntry)
+{
+    if (mIndexEntryCount == mIndexSize)
+    {
+        // Keep the newest events indexed; the oldest one becomes unindexed.
+        mUnindexedEventCount++;
+        VerifyOrReturn(mIndexSize != 0);
+        mIndexStart = (mIndexStart + 1) % mIndexSize;
+        mIndexEntryCount--;
+    }
+    mpIndex[(mIndexStart + mIndexEntryCount) % mIndexSize] = aEntry;
+    mIndexEntryCount++;
+}
+
+void CircularEventBuffer::RemoveHeadIndexEntry()
+{
+    if (mUnindexedEventCount != 0)
+    {
+        mUnindexedEventCount--;
+    }
+    else if (mIndexEntryCount != 0)
+    {
+        mIndexStart = (mIndexStart + 1) % mIndexSize;
+        mIndexEntryCount--;
+    }
+}
+
+bool CircularEventBuffer::GetHeadIndexEntry(EventIndexEntry & aEntry)
+{
+    VerifyOrReturnValue(mUnindexedEventCount == 0 && mIndexEntryCount != 0, false);
+    aEntry = GetIndexEntry(0);
+    return true;
+}
+
+void CircularEventBuffer::ResetIndex(uint32_t aUnindexedEventCount)
+{
+    mIndexStart          = 0;
+    mIndexEntryCount     = 0;
+    mUnindexedEventCount = aUnindexedEventCount;
 }
 
 bool CircularEventBuffer::IsFinalDestinationForPriority(PriorityLevel aPriority) const
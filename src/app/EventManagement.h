@@ -76,6 +76,30 @@ constexpr size_t kMaxEventSizeReserve            = 512;
 constexpr uint16_t kRequiredEventField =
     (1 << to_underlying(EventDataIB::Tag::kPriority)) | (1 << to_underlying(EventDataIB::Tag::kPath));
 
+/**
+ * @brief
+ *   An entry of the index of the events stored in a CircularEventBuffer.
+ *
+ * The index lets EventManagement::FetchEventsSince skip the events a reader has already fetched, or is not interested in,
+ * without parsing them, and copy the others into the report as raw bytes.
+ */
+struct EventIndexEntry
+{
+    EventNumber mEventNumber = 0;
+    Timestamp mTimestamp;
+    uint32_t mOffset       = 0; ///< Offset of the event in the queue of the buffer.
+    uint32_t mLength       = 0; ///< Length of the event, which may wrap around the end of the queue.
+    ClusterId mClusterId   = 0;
+    EventId mEventId       = 0;
+    EndpointId mEndpointId = 0;
+    Optional<FabricIndex> mFabricIndex; ///< Set for fabric-sensitive events, kUndefinedFabricIndex once the fabric is removed.
+    // Layout of the EventDataIB fields, relative to mOffset.
+    uint16_t mFieldsOffset    = 0; ///< Offset of the first field.
+    uint16_t mFieldsEnd       = 0; ///< End of the fields that go on the wire, which excludes the fabric index.
+    uint16_t mTimestampOffset = 0; ///< Offset of the timestamp, which is reported as a delta to the previous event.
+    uint16_t mTimestampLength = 0; ///< Length of the timestamp, 0 if the event has none.
+};
+
 /**
  * @brief
  *   Internal event buffer, built around the TLV::TLVCircularBuffer
@@ -105,9 +129,14 @@ public:
      *                           events of greater priority.
      *
      * @param[in] aPriorityLevel CircularEventBuffer priority level
+     *
+     * @param[in] apIndex        Optional storage for the index of the events in
+     *                           the buffer.
+     *
+     * @param[in] aIndexSize     The number of entries of \c apIndex.
      */
     void Init(uint8_t * apBuffer, uint32_t aBufferLength, CircularEventBuffer * apPrev, CircularEventBuffer * apNext,
-              PriorityLevel aPriorityLevel);
+              PriorityLevel aPriorityLevel, EventIndexEntry * apIndex = nullptr, uint32_t aIndexSize = 0);
 
     /**
      * @brief
@@ -128,6 +157,36 @@ public:
     void SetRequiredSpaceforEvicted(size_t aRequiredSpace) { mRequiredSpaceForEvicted = aRequiredSpace; }
     size_t GetRequiredSpaceforEvicted() const { return mRequiredSpaceForEvicted; }
 
+    /**
+     * The index holds entries for the newest events in the buffer.  The oldest events, for which the index had no room,
+     * are counted as unindexed events and are always at the head of the buffer.  Without index storage, all events are
+     * unindexed.
+     */
+    bool HasIndex() const { return mpIndex != nullptr; }
+    uint32_t GetUnindexedEventCount() const { return mUnindexedEventCount; }
+    uint32_t GetIndexEntryCount() const { return mIndexEntryCount; }
+    EventIndexEntry & GetIndexEntry(uint32_t aIndex) { return mpIndex[(mIndexStart + aIndex) % mIndexSize]; }
+
+    /**
+     * @brief Add the index entry of an event appended to the buffer.
+     */
+    void AppendIndexEntry(const EventIndexEntry & aEntry);
+
+    /**
+     * @brief Remove the index entry of the event evicted from the head of the buffer.
+     */
+    void RemoveHeadIndexEntry();
+
+    /**
+     * @brief Get the index entry of the event at the head of the buffer, if it is indexed.
+     */
+    bool GetHeadIndexEntry(EventIndexEntry & aEntry);
+
+    /**
+     * @brief Remove all index entries, and count the given number of events as unindexed.
+     */
+    void ResetIndex(uint32_t aUnindexedEventCount);
+
     ~CircularEventBuffer() override = default;
 
 private:
@@ -139,6 +198,12 @@ private:
 
     size_t mRequiredSpaceForEvicted = 0; ///< Required space for previous buffer to evict event to new buffer
 
+    EventIndexEntry * mpIndex     = nullptr; ///< Index entries, used as a ring starting at mIndexStart
+    uint32_t mIndexSize           = 0;
+    uint32_t mIndexStart          = 0;
+    uint32_t mIndexEntryCount     = 0;
+    uint32_t mUnindexedEventCount = 0;
+
     CHIP_ERROR OnInit(TLV::TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override;
 };
 
@@ -187,6 +252,8 @@ struct LogStorageResources
     uint32_t mBufferSize = 0; ///< The size, in bytes, of the `mBuffer`.
     PriorityLevel mPriority =
         PriorityLevel::Invalid; // Log priority level associated with the resources provided in this structure.
+    EventIndexEntry * mpIndex = nullptr; ///< Optional storage for the index of the events in `mpBuffer`, see EventIndexEntry.
+    uint32_t mIndexSize       = 0;       ///< The number of entries of `mpIndex`.
 };
 
 /**
@@ -456,6 +523,33 @@ private:
      */
     CHIP_ERROR EnsureSpaceInCircularBuffer(size_t aRequiredSpace, PriorityLevel aPriority);
 
+    /**
+     * @brief Internal API used to implement #FetchEventsSince with the event index.
+     *
+     * Unindexed events are parsed and filtered as usual.  Indexed events are filtered through their index entry, and copied
+     * by #CopyIndexedEvent without being parsed.
+     */
+    CHIP_ERROR FetchEventsSince(CircularEventBuffer & aBuffer, EventLoadOutContext & aContext);
+
+    /**
+     * @brief Copy an indexed event into the report being generated, if the reader has access to it.
+     *
+     * The event is copied as raw bytes straight from the buffer.  Only its timestamp is re-encoded, as a delta to the previous
+     * event of the report, and its fabric index, which does not go on the wire, is left out.
+     */
+    static CHIP_ERROR CopyIndexedEvent(const CircularEventBuffer & aBuffer, const EventIndexEntry & aEntry,
+                                       EventLoadOutContext & aContext);
+
+    /**
+     * @brief Rebuild the index of a buffer by parsing its events.
+     */
+    void RebuildEventIndex(CircularEventBuffer & aBuffer);
+
+    /**
+     * @brief Fill in an index entry, except for the location of the event, from the event the reader is positioned on.
+     */
+    static CHIP_ERROR ParseEventIndexEntry(const TLV::TLVReader & aReader, EventIndexEntry & aEntry);
+
     /**
      * @brief Iterate the event elements inside event tlv and mark the fabric index as kUndefinedFabricIndex if
      * it matches the FabricIndex apFabricIndex points to.
@@ -530,6 +624,12 @@ private:
      */
     static CHIP_ERROR CheckEventContext(EventLoadOutContext * eventLoadOutContext, const EventEnvelopeContext & event);
 
+    /**
+     * @brief Check whether an event is on one of the paths, and for the fabric, of the report being generated.
+     */
+    static bool IsInterestedEvent(const EventLoadOutContext * apContext, const ConcreteEventPath & aPath,
+                                  const Optional<FabricIndex> & aFabricIndex);
+
     /**
      * @brief copy event from circular buffer to target buffer for report
      */
@@ -550,6 +650,7 @@ private:
     Messaging::ExchangeManager * mpExchangeMgr = nullptr;
     EventManagementStates mState               = EventManagementStates::Shutdown;
     uint32_t mBytesWritten                     = 0;
+    bool mUseEventIndex                        = false;
 
     // The counter we're going to use for event numbers.
     MonotonicallyIncreasingCounter<EventNumber> * mpEventNumberCounter = nullptr;
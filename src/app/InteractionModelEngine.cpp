@@ -316,13 +316,6 @@ void InteractionModelEngine::OnDone(CommandHandler & apCommandObj)
 
 void InteractionModelEngine::OnDone(ReadHandler & apReadObj)
 {
-    //
-    // Deleting an item can shift down the contents of the underlying pool storage,
-    // rendering any tracker using positional indexes invalid. Let's reset it,
-    // based on which readHandler we are getting rid of.
-    //
-    mReportingEngine.ResetReadHandlerTracker(&apReadObj);
-
     mReadHandlers.ReleaseObject(&apReadObj);
 }
 
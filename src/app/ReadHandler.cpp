@@ -95,6 +95,11 @@ void ReadHandler::ResumeSubscription(CASESessionManager & caseSessionManager,
             return;
         }
     }
+    if (InteractionModelEngine::GetInstance()->GetReportingEngine().IndexAttributePaths(*this) != CHIP_NO_ERROR)
+    {
+        Close();
+        return;
+    }
     for (size_t i = 0; i < subscriptionInfo.mEventPaths.AllocatedSize(); i++)
     {
         EventPathParams eventPathParams = subscriptionInfo.mEventPaths[i].GetParams();
@@ -121,14 +126,7 @@ ReadHandler::~ReadHandler()
         appCallback->OnSubscriptionTerminated(*this);
     }
 
-    if (IsType(InteractionType::Subscribe))
-    {
-        InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->CancelTimer(
-            OnUnblockHoldReportCallback, this);
-
-        InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->CancelTimer(
-            OnRefreshSubscribeTimerSyncCallback, this);
-    }
+    InteractionModelEngine::GetInstance()->GetReportingEngine().OnReadHandlerDestroyed(*this);
 
     if (IsAwaitingReportResponse())
     {
@@ -472,7 +470,7 @@ CHIP_ERROR ReadHandler::ProcessAttributePaths(AttributePathIBs::Parser & aAttrib
     {
         InteractionModelEngine::GetInstance()->RemoveDuplicateConcreteAttributePath(mpAttributePathList);
         mAttributePathExpandIterator = AttributePathExpandIterator(mpAttributePathList);
-        err                          = CHIP_NO_ERROR;
+        err                          = InteractionModelEngine::GetInstance()->GetReportingEngine().IndexAttributePaths(*this);
     }
     return err;
 }
@@ -592,7 +590,7 @@ void ReadHandler::MoveToState(const HandlerState aTargetState)
     //
     if (aTargetState == HandlerState::GeneratingReports && IsReportable())
     {
-        InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleRun();
+        InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleReport(*this);
     }
 }
 
@@ -752,42 +750,37 @@ void ReadHandler::PersistSubscription()
     }
 }
 
-void ReadHandler::OnUnblockHoldReportCallback(System::Layer * apSystemLayer, void * apAppState)
+void ReadHandler::OnIntervalDeadline(System::Clock::Timestamp aNow)
 {
-    VerifyOrReturn(apAppState != nullptr);
-    ReadHandler * readHandler = static_cast<ReadHandler *>(apAppState);
-    ChipLogDetail(DataManagement, "Unblock report hold after min %d seconds", readHandler->mMinIntervalFloorSeconds);
-    readHandler->ClearStateFlag(ReadHandlerFlags::HoldReport);
-    InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->StartTimer(
-        System::Clock::Seconds16(readHandler->mMaxInterval - readHandler->mMinIntervalFloorSeconds),
-        OnRefreshSubscribeTimerSyncCallback, readHandler);
-}
+    if (mFlags.Has(ReadHandlerFlags::HoldReport) && aNow >= mMinIntervalDeadline)
+    {
+        ChipLogDetail(DataManagement, "Unblock report hold after min %d seconds", mMinIntervalFloorSeconds);
+        ClearStateFlag(ReadHandlerFlags::HoldReport);
+    }
 
-void ReadHandler::OnRefreshSubscribeTimerSyncCallback(System::Layer * apSystemLayer, void * apAppState)
-{
-    VerifyOrReturn(apAppState != nullptr);
-    ReadHandler * readHandler = static_cast<ReadHandler *>(apAppState);
-    readHandler->ClearStateFlag(ReadHandlerFlags::HoldSync);
-    ChipLogProgress(DataManagement, "Refresh subscribe timer sync after %d seconds",
-                    readHandler->mMaxInterval - readHandler->mMinIntervalFloorSeconds);
+    if (mFlags.Has(ReadHandlerFlags::HoldSync) && aNow >= mMaxIntervalDeadline)
+    {
+        ClearStateFlag(ReadHandlerFlags::HoldSync);
+        ChipLogProgress(DataManagement, "Refresh subscribe timer sync after %d seconds", mMaxInterval - mMinIntervalFloorSeconds);
+    }
 }
 
 CHIP_ERROR ReadHandler::RefreshSubscribeSyncTimer()
 {
-    InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->CancelTimer(
-        OnUnblockHoldReportCallback, this);
-    InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->CancelTimer(
-        OnRefreshSubscribeTimerSyncCallback, this);
+    reporting::Engine & reportingEngine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+
+    reportingEngine.CancelIntervalDeadline(*this);
 
     if (!IsChunkedReport())
     {
         ChipLogProgress(DataManagement, "Refresh Subscribe Sync Timer with min %d seconds and max %d seconds",
                         mMinIntervalFloorSeconds, mMaxInterval);
+        System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+        mMinIntervalDeadline         = now + System::Clock::Seconds16(mMinIntervalFloorSeconds);
+        mMaxIntervalDeadline         = now + System::Clock::Seconds16(mMaxInterval);
         SetStateFlag(ReadHandlerFlags::HoldReport);
         SetStateFlag(ReadHandlerFlags::HoldSync);
-        ReturnErrorOnFailure(
-            InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->StartTimer(
-                System::Clock::Seconds16(mMinIntervalFloorSeconds), OnUnblockHoldReportCallback, this));
+        ReturnErrorOnFailure(reportingEngine.ScheduleIntervalDeadline(*this));
     }
 
     return CHIP_NO_ERROR;
@@ -830,7 +823,7 @@ void ReadHandler::SetDirty(const AttributePathParams & aAttributeChanged)
 
     if (IsReportable())
     {
-        InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleRun();
+        InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleReport(*this);
     }
 }
 
@@ -855,7 +848,7 @@ void ReadHandler::SetStateFlag(ReadHandlerFlags aFlag, bool aValue)
     // If we became reportable, schedule a reporting run.
     if (!oldReportable && IsReportable())
     {
-        InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleRun();
+        InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleReport(*this);
     }
 }
 
@@ -44,11 +44,13 @@
 #include <lib/core/TLVDebug.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DLLUtil.h>
+#include <lib/support/IntrusiveList.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <messaging/ExchangeHolder.h>
 #include <messaging/ExchangeMgr.h>
 #include <messaging/Flags.h>
 #include <protocols/Protocols.h>
+#include <system/SystemClock.h>
 #include <system/SystemPacketBuffer.h>
 
 // https://github.com/CHIP-Specifications/connectedhomeip-spec/blob/61a9d19e6af12fdfb0872bcff26d19de6c680a1a/src/Ch02_Architecture.adoc#1122-subscribe-interaction-limits
@@ -74,8 +76,10 @@ class InteractionModelEngine;
  *  @brief The read handler is responsible for processing a read request, asking the attribute/event store
  *         for the relevant data, and sending a reply.
  *
+ *         The list node links the handler into the reporting engine's queue of handlers waiting to generate a report.
+ *
  */
-class ReadHandler : public Messaging::ExchangeDelegate
+class ReadHandler : public Messaging::ExchangeDelegate, public IntrusiveListNodeBase<>
 {
 public:
     using SubjectDescriptor = Access::SubjectDescriptor;
@@ -293,8 +297,9 @@ private:
     bool IsReportable() const
     {
         // Important: Anything that changes the state IsReportable depends on in
-        // a way that causes IsReportable to become true must call ScheduleRun
-        // on the reporting engine.
+        // a way that causes IsReportable to become true must call
+        // ScheduleReport(*this) on the reporting engine, which only services
+        // the handlers in its report queue.
         return mState == HandlerState::GeneratingReports && !mFlags.Has(ReadHandlerFlags::HoldReport) &&
             (IsDirty() || !mFlags.Has(ReadHandlerFlags::HoldSync));
     }
@@ -396,9 +401,34 @@ private:
      */
     void Close(CloseOptions options = CloseOptions::kDropPersistedSubscription);
 
-    static void OnUnblockHoldReportCallback(System::Layer * apSystemLayer, void * apAppState);
-    static void OnRefreshSubscribeTimerSyncCallback(System::Layer * apSystemLayer, void * apAppState);
+    /**
+     * Restart the min and max reporting intervals of a subscription.  The reporting engine lifts HoldReport and HoldSync
+     * when the corresponding deadline passes.
+     */
     CHIP_ERROR RefreshSubscribeSyncTimer();
+
+    /**
+     * The earliest reporting interval deadline the reporting engine still has to enforce for this handler, or
+     * Timestamp::max() if neither HoldReport nor HoldSync is set.
+     */
+    System::Clock::Timestamp GetNextIntervalDeadline() const
+    {
+        if (mFlags.Has(ReadHandlerFlags::HoldReport))
+        {
+            return mMinIntervalDeadline;
+        }
+        if (mFlags.Has(ReadHandlerFlags::HoldSync))
+        {
+            return mMaxIntervalDeadline;
+        }
+        return System::Clock::Timestamp::max();
+    }
+
+    /**
+     * Called by the reporting engine when the deadline returned by GetNextIntervalDeadline() has passed.
+     */
+    void OnIntervalDeadline(System::Clock::Timestamp aNow);
+
     CHIP_ERROR SendSubscribeResponse();
     CHIP_ERROR ProcessSubscribeRequest(System::PacketBufferHandle && aPayload);
     CHIP_ERROR ProcessReadRequest(System::PacketBufferHandle && aPayload);
@@ -471,6 +501,17 @@ private:
     uint16_t mMinIntervalFloorSeconds = 0;
     uint16_t mMaxInterval             = 0;
 
+    // Ends of the current min and max reporting intervals, set by RefreshSubscribeSyncTimer.
+    System::Clock::Timestamp mMinIntervalDeadline = System::Clock::kZero;
+    System::Clock::Timestamp mMaxIntervalDeadline = System::Clock::kZero;
+
+    // Reporting engine scheduler state: the deadline this handler is queued under and its position in the engine's interval
+    // deadline queue, and the time it was added to the engine's report queue.
+    static constexpr size_t kIntervalNotScheduled = SIZE_MAX;
+    System::Clock::Timestamp mScheduledIntervalDeadline = System::Clock::kZero;
+    size_t mIntervalQueueIndex                          = kIntervalNotScheduled;
+    System::Clock::Timestamp mReportQueuedTime          = System::Clock::kZero;
+
     EventNumber mEventMin = 0;
 
     // The last schedule event number snapshoted in the beginning when preparing to fill new events to reports
@@ -92,6 +92,7 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Init(PersistentStorageDelegate *
     VerifyOrReturnError(storage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     mStorage = storage;
 
+    PersistentStorageBatch batch(mStorage);
     uint16_t countMax;
     uint16_t len = sizeof(countMax);
     CHIP_ERROR err =
@@ -111,7 +112,7 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Init(PersistentStorageDelegate *
     ReturnErrorOnFailure(mStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::SubscriptionResumptionMaxCount().KeyName(),
                                                    &countMaxToSave, sizeof(uint16_t)));
 
-    return CHIP_NO_ERROR;
+    return batch.End();
 }
 
 SubscriptionResumptionStorage::SubscriptionInfoIterator * SimpleSubscriptionResumptionStorage::IterateSubscriptions()
@@ -315,6 +316,9 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Save(TLV::TLVWriter & writer, Su
 
 CHIP_ERROR SimpleSubscriptionResumptionStorage::Save(SubscriptionInfo & subscriptionInfo)
 {
+    // Replacing a duplicate deletes it first, so keep both updates in one storage batch.
+    PersistentStorageBatch batch(mStorage);
+
     // Find empty index or duplicate if exists
     uint16_t subscriptionIndex;
     uint16_t firstEmptySubscriptionIndex = CHIP_IM_MAX_NUM_SUBSCRIPTIONS; // initialize to out of bounds as "not set"
@@ -370,13 +374,14 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Save(SubscriptionInfo & subscrip
         mStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::SubscriptionResumption(firstEmptySubscriptionIndex).KeyName(),
                                   backingBuffer.Get(), static_cast<uint16_t>(len)));
 
-    return CHIP_NO_ERROR;
+    return batch.End();
 }
 
 CHIP_ERROR SimpleSubscriptionResumptionStorage::Delete(NodeId nodeId, FabricIndex fabricIndex, SubscriptionId subscriptionId)
 {
     bool subscriptionFound   = false;
     CHIP_ERROR lastDeleteErr = CHIP_NO_ERROR;
+    PersistentStorageBatch batch(mStorage);
 
     uint16_t remainingSubscriptionsCount = 0;
     for (uint16_t subscriptionIndex = 0; subscriptionIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; subscriptionIndex++)
@@ -410,6 +415,8 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Delete(NodeId nodeId, FabricInde
         DeleteMaxCount();
     }
 
+    CHIP_ERROR batchErr = batch.End();
+    lastDeleteErr       = (lastDeleteErr != CHIP_NO_ERROR) ? lastDeleteErr : batchErr;
     if (lastDeleteErr != CHIP_NO_ERROR)
     {
         return lastDeleteErr;
@@ -426,6 +433,7 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::DeleteMaxCount()
 CHIP_ERROR SimpleSubscriptionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
 {
     CHIP_ERROR deleteErr = CHIP_NO_ERROR;
+    PersistentStorageBatch batch(mStorage);
 
     uint16_t count = 0;
     for (uint16_t subscriptionIndex = 0; subscriptionIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; subscriptionIndex++)
@@ -461,7 +469,8 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::DeleteAll(FabricIndex fabricInde
         }
     }
 
-    return deleteErr;
+    CHIP_ERROR batchErr = batch.End();
+    return (deleteErr != CHIP_NO_ERROR) ? deleteErr : batchErr;
 }
 
 } // namespace app
@@ -0,0 +1,102 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/EncodedReportCache.h>
+
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+#if CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+
+const EncodedReportCache::Entry * EncodedReportCache::FindEntry(const Key & aKey) const
+{
+    for (size_t i = 0; i < mEntryCount; i++)
+    {
+        if (mEntries[i].mKey == aKey)
+        {
+            return &mEntries[i];
+        }
+    }
+    return nullptr;
+}
+
+EncodedReportCache::LookupResult EncodedReportCache::Find(const Key & aKey, ByteSpan & aEncoding) const
+{
+    const Entry * entry = FindEntry(aKey);
+    VerifyOrReturnValue(entry != nullptr, LookupResult::kNotFound);
+    VerifyOrReturnValue(entry->mLength != 0, LookupResult::kUncacheable);
+
+    aEncoding = ByteSpan(&mBuffer[entry->mOffset], entry->mLength);
+    return LookupResult::kFound;
+}
+
+bool EncodedReportCache::BeginEncoding(TLV::TLVWriter & aWriter)
+{
+    VerifyOrReturnValue(mEntryCount < ArraySize(mEntries), false);
+
+    aWriter.Init(&mBuffer[mUsedBytes], sizeof(mBuffer) - mUsedBytes);
+    return true;
+}
+
+void EncodedReportCache::Commit(const Key & aKey, const TLV::TLVWriter & aWriter)
+{
+    size_t length = aWriter.GetLengthWritten();
+    AddEntry(aKey, length);
+    mUsedBytes += length;
+}
+
+void EncodedReportCache::MarkUncacheable(const Key & aKey)
+{
+    AddEntry(aKey, 0);
+}
+
+void EncodedReportCache::AddEntry(const Key & aKey, size_t aLength)
+{
+    VerifyOrReturn(mEntryCount < ArraySize(mEntries));
+
+    Entry & entry = mEntries[mEntryCount++];
+    entry.mKey    = aKey;
+    entry.mOffset = mUsedBytes;
+    entry.mLength = aLength;
+}
+
+CHIP_ERROR EncodedReportCache::CopyReports(const ByteSpan & aEncoding, TLV::TLVWriter & aWriter)
+{
+    TLV::TLVReader reader;
+    TLV::TLVType outerContainerType;
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    reader.Init(aEncoding);
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Array, TLV::AnonymousTag()));
+    ReturnErrorOnFailure(reader.EnterContainer(outerContainerType));
+    while (CHIP_NO_ERROR == (err = reader.Next()))
+    {
+        ReturnErrorOnFailure(aWriter.CopyElement(reader));
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    return reader.ExitContainer(outerContainerType);
+}
+
+#endif // CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
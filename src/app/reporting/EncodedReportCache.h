@@ -0,0 +1,147 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a cache of encoded attribute reports, shared by the read handlers serviced in one run of the
+ *      reporting engine.
+ *
+ */
+
+#pragma once
+
+#include <app/ConcreteAttributePath.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/TLVReader.h>
+#include <lib/core/TLVWriter.h>
+#include <lib/support/Span.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+#if CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+
+/**
+ * Holds the AttributeReportIBs encoded for an attribute path so that other read handlers reading the same path in the
+ * same run of the reporting engine can copy the encoded bytes instead of reading and encoding the attribute again.
+ *
+ * An encoding only depends on the attribute value and data version, the accessing fabric and whether the read is fabric
+ * filtered, provided the subject was granted access.  Attribute values and data versions cannot change while the engine
+ * runs, so the cache is not keyed on the data version: Engine::Run clears it at the start and end of every run, so that it
+ * never holds encodings of values that may have changed since.
+ */
+class EncodedReportCache
+{
+public:
+    struct Statistics
+    {
+        uint32_t hits        = 0; /**< Reports copied from the cache. */
+        uint32_t misses      = 0; /**< Reports encoded into the cache. */
+        uint32_t uncacheable = 0; /**< Reports that did not fit into the cache, or failed to encode. */
+    };
+
+    struct Key
+    {
+        Key() = default;
+        Key(const ConcreteAttributePath & aPath, FabricIndex aAccessingFabricIndex, bool aIsFabricFiltered) :
+            mPath(aPath), mAccessingFabricIndex(aAccessingFabricIndex), mIsFabricFiltered(aIsFabricFiltered)
+        {}
+
+        bool operator==(const Key & aOther) const
+        {
+            return mPath == aOther.mPath && mPath.mExpanded == aOther.mPath.mExpanded &&
+                mAccessingFabricIndex == aOther.mAccessingFabricIndex && mIsFabricFiltered == aOther.mIsFabricFiltered;
+        }
+
+        ConcreteAttributePath mPath;
+        FabricIndex mAccessingFabricIndex = kUndefinedFabricIndex;
+        bool mIsFabricFiltered            = false;
+    };
+
+    enum class LookupResult : uint8_t
+    {
+        kNotFound,    ///< Nothing is known about the key.
+        kFound,       ///< The encoding for the key is cached.
+        kUncacheable, ///< The encoding for the key was found not to fit into the cache earlier in this run.
+    };
+
+    /**
+     * Look up the encoding for a key.  On kFound, aEncoding is set to an anonymous TLV array holding the AttributeReportIBs.
+     */
+    LookupResult Find(const Key & aKey, ByteSpan & aEncoding) const;
+
+    /**
+     * Initialize a writer over the free space of the cache, for encoding an anonymous TLV array of AttributeReportIBs that
+     * is then added with Commit().  Returns false if no entry is left.
+     */
+    bool BeginEncoding(TLV::TLVWriter & aWriter);
+
+    /**
+     * Add the encoding for a key written with the writer initialized by BeginEncoding(), which must have been finalized.
+     */
+    void Commit(const Key & aKey, const TLV::TLVWriter & aWriter);
+
+    /**
+     * Remember that the encoding for a key does not fit into the cache, so it is not attempted again in this run.
+     */
+    void MarkUncacheable(const Key & aKey);
+
+    /**
+     * Copy the AttributeReportIBs of a cached encoding into the array of AttributeReportIBs being written by aWriter.
+     */
+    static CHIP_ERROR CopyReports(const ByteSpan & aEncoding, TLV::TLVWriter & aWriter);
+
+    void Clear()
+    {
+        mEntryCount = 0;
+        mUsedBytes  = 0;
+    }
+
+    Statistics & GetStatistics() { return mStatistics; }
+    const Statistics & GetStatistics() const { return mStatistics; }
+    void ResetStatistics() { mStatistics = Statistics(); }
+
+private:
+    struct Entry
+    {
+        Key mKey;
+        size_t mOffset = 0;
+        size_t mLength = 0; // Zero for a key that was found to be uncacheable.
+    };
+
+    const Entry * FindEntry(const Key & aKey) const;
+    void AddEntry(const Key & aKey, size_t aLength);
+
+    Entry mEntries[CHIP_IM_SERVER_REPORT_CACHE_ENTRIES];
+    size_t mEntryCount = 0;
+    uint8_t mBuffer[CHIP_IM_SERVER_REPORT_CACHE_SIZE];
+    size_t mUsedBytes = 0;
+    Statistics mStatistics;
+};
+
+#endif // CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
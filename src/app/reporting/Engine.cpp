@@ -28,16 +28,34 @@
 #include <app/RequiredPrivilege.h>
 #include <app/reporting/Engine.h>
 #include <app/util/MatterCallbacks.h>
+#include <lib/support/CHIPMem.h>
+
+#include <algorithm>
 
 using namespace chip::Access;
 
 namespace chip {
 namespace app {
 namespace reporting {
+namespace {
+
+void RecordLag(System::Clock::Milliseconds64 aLag, System::Clock::Milliseconds64 & aTotalLag,
+               System::Clock::Milliseconds64 & aMaxLag)
+{
+    aTotalLag += aLag;
+    aMaxLag = std::max(aMaxLag, aLag);
+}
+
+} // namespace
+
 CHIP_ERROR Engine::Init()
 {
-    mNumReportsInFlight = 0;
-    mCurReadHandlerIdx  = 0;
+    mNumReportsInFlight  = 0;
+    mSchedulerStatistics = SchedulerStatistics();
+#if CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+    mReportCache.Clear();
+    mReportCache.ResetStatistics();
+#endif // CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
     return CHIP_NO_ERROR;
 }
 
@@ -47,7 +65,25 @@ void Engine::Shutdown()
     ScheduleUrgentEventDeliverySync();
 
     mNumReportsInFlight = 0;
-    mCurReadHandlerIdx  = 0;
+    while (!mReportQueue.Empty())
+    {
+        DequeueReport(*mReportQueue.begin());
+    }
+    while (mIntervalQueueSize > 0)
+    {
+        UnscheduleIntervalDeadline(*mIntervalQueue[0]);
+    }
+    ArmIntervalTimer();
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    Platform::MemoryFree(mIntervalQueue);
+    mIntervalQueue         = nullptr;
+    mIntervalQueueCapacity = 0;
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    for (auto & bucket : mAttributeInterestIndex)
+    {
+        bucket = nullptr;
+    }
+    mAttributeInterestPool.ReleaseAll();
     mGlobalDirtySet.ReleaseAll();
 }
 
@@ -84,6 +120,68 @@ Engine::RetrieveClusterData(const SubjectDescriptor & aSubjectDescriptor, bool a
     return CHIP_NO_ERROR;
 }
 
+#if CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+CHIP_ERROR Engine::RetrieveCachedClusterData(const SubjectDescriptor & aSubjectDescriptor, bool aIsFabricFiltered,
+                                             AttributeReportIBs::Builder & aAttributeReportIBs,
+                                             const ConcreteReadAttributePath & aPath, bool & aEncoded)
+{
+    aEncoded = false;
+
+    // Reports for a subject without access depend on whether the path was expanded, and list item reads are rare: leave both
+    // to RetrieveClusterData.
+    VerifyOrReturnError(!aPath.mListIndex.HasValue(), CHIP_NO_ERROR);
+    Access::RequestPath requestPath{ .cluster = aPath.mClusterId, .endpoint = aPath.mEndpointId };
+    Access::Privilege requestPrivilege = RequiredPrivilege::ForReadAttribute(aPath);
+    VerifyOrReturnError(Access::GetAccessControl().Check(aSubjectDescriptor, requestPath, requestPrivilege) == CHIP_NO_ERROR,
+                        CHIP_NO_ERROR);
+
+    EncodedReportCache::Statistics & statistics = mReportCache.GetStatistics();
+    EncodedReportCache::Key key(aPath, aSubjectDescriptor.fabricIndex, aIsFabricFiltered);
+    ByteSpan encoding;
+    switch (mReportCache.Find(key, encoding))
+    {
+    case EncodedReportCache::LookupResult::kFound:
+        statistics.hits++;
+        break;
+    case EncodedReportCache::LookupResult::kUncacheable:
+        statistics.uncacheable++;
+        return CHIP_NO_ERROR;
+    case EncodedReportCache::LookupResult::kNotFound:
+        if (EncodeIntoReportCache(aSubjectDescriptor, aIsFabricFiltered, aPath, key) != CHIP_NO_ERROR)
+        {
+            // An attribute that does not fit (e.g. a long list that needs chunking) is left to RetrieveClusterData for the
+            // rest of this run.
+            mReportCache.MarkUncacheable(key);
+            statistics.uncacheable++;
+            return CHIP_NO_ERROR;
+        }
+        statistics.misses++;
+        VerifyOrDie(mReportCache.Find(key, encoding) == EncodedReportCache::LookupResult::kFound);
+        break;
+    }
+
+    aEncoded = true;
+    return EncodedReportCache::CopyReports(encoding, *aAttributeReportIBs.GetWriter());
+}
+
+CHIP_ERROR Engine::EncodeIntoReportCache(const SubjectDescriptor & aSubjectDescriptor, bool aIsFabricFiltered,
+                                         const ConcreteReadAttributePath & aPath, const EncodedReportCache::Key & aKey)
+{
+    TLV::TLVWriter writer;
+    AttributeReportIBs::Builder attributeReportIBs;
+    AttributeValueEncoder::AttributeEncodeState encodeState;
+
+    VerifyOrReturnError(mReportCache.BeginEncoding(writer), CHIP_ERROR_NO_MEMORY);
+    ReturnErrorOnFailure(attributeReportIBs.Init(&writer));
+    ReturnErrorOnFailure(RetrieveClusterData(aSubjectDescriptor, aIsFabricFiltered, attributeReportIBs, aPath, &encodeState));
+    ReturnErrorOnFailure(attributeReportIBs.EndOfAttributeReportIBs().GetError());
+    ReturnErrorOnFailure(writer.Finalize());
+
+    mReportCache.Commit(aKey, writer);
+    return CHIP_NO_ERROR;
+}
+#endif // CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+
 CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Builder & aReportDataBuilder,
                                                            ReadHandler * apReadHandler, bool * apHasMoreChunks,
                                                            bool * apHasEncodedData)
@@ -177,8 +275,28 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
             ConcreteReadAttributePath pathForRetrieval(readPath);
             // Load the saved state from previous encoding session for chunking of one single attribute (list chunking).
             AttributeValueEncoder::AttributeEncodeState encodeState = apReadHandler->GetAttributeEncodeState();
-            err = RetrieveClusterData(apReadHandler->GetSubjectDescriptor(), apReadHandler->IsFabricFiltered(), attributeReportIBs,
-                                      pathForRetrieval, &encodeState);
+            bool encoded                                            = false;
+#if CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+            // Change reports of subscriptions to the same attributes are generated back to back, so they share their encoding.
+            // A list that is in the middle of being chunked cannot be shared.
+            if (apReadHandler->IsType(ReadHandler::InteractionType::Subscribe) && !apReadHandler->IsPriming() &&
+                !encodeState.AllowPartialData())
+            {
+                err = RetrieveCachedClusterData(apReadHandler->GetSubjectDescriptor(), apReadHandler->IsFabricFiltered(),
+                                                attributeReportIBs, pathForRetrieval, encoded);
+                if (encoded && err != CHIP_NO_ERROR)
+                {
+                    // The shared encoding did not fit; encode it again so that a list can be chunked.
+                    attributeReportIBs.Rollback(attributeBackup);
+                    encoded = false;
+                }
+            }
+#endif // CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+            if (!encoded)
+            {
+                err = RetrieveClusterData(apReadHandler->GetSubjectDescriptor(), apReadHandler->IsFabricFiltered(),
+                                          attributeReportIBs, pathForRetrieval, &encodeState);
+            }
             if (err != CHIP_NO_ERROR)
             {
                 ChipLogError(DataManagement,
@@ -452,6 +570,8 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     uint16_t reservedSize                      = 0;
     bool hasMoreChunks                         = false;
     bool needCloseReadHandler                  = false;
+    // Attributes of a cluster usually require the same privilege, so checks are repeated across the report.
+    Access::AccessControl::DecisionCache accessDecisionCache(Access::GetAccessControl());
 
     // Reserved size for the MoreChunks boolean flag, which takes up 1 byte for the control tag and 1 byte for the context tag.
     const uint32_t kReservedSizeForMoreChunksFlag = 1 + 1;
@@ -557,8 +677,8 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     VerifyOrExit(err == CHIP_NO_ERROR,
                  ChipLogError(DataManagement, "<RE> Error sending out report data with %" CHIP_ERROR_FORMAT "!", err.Format()));
 
-    ChipLogDetail(DataManagement, "<RE> ReportsInFlight = %" PRIu32 " with readHandler %" PRIu32 ", RE has %s", mNumReportsInFlight,
-                  mCurReadHandlerIdx, hasMoreChunks ? "more messages" : "no more messages");
+    ChipLogDetail(DataManagement, "<RE> ReportsInFlight = %" PRIu32 " with readHandler %p, RE has %s", mNumReportsInFlight,
+                  apReadHandler, hasMoreChunks ? "more messages" : "no more messages");
 
 exit:
     if (err != CHIP_NO_ERROR || (apReadHandler->IsType(ReadHandler::InteractionType::Read) && !hasMoreChunks) ||
@@ -589,17 +709,7 @@ CHIP_ERROR Engine::ScheduleRun()
         return CHIP_NO_ERROR;
     }
 
-    Messaging::ExchangeManager * exchangeManager = InteractionModelEngine::GetInstance()->GetExchangeManager();
-    if (exchangeManager == nullptr)
-    {
-        return CHIP_ERROR_INCORRECT_STATE;
-    }
-    SessionManager * sessionManager = exchangeManager->GetSessionManager();
-    if (sessionManager == nullptr)
-    {
-        return CHIP_ERROR_INCORRECT_STATE;
-    }
-    System::Layer * systemLayer = sessionManager->SystemLayer();
+    System::Layer * systemLayer = GetSystemLayer();
     if (systemLayer == nullptr)
     {
         return CHIP_ERROR_INCORRECT_STATE;
@@ -609,48 +719,85 @@ CHIP_ERROR Engine::ScheduleRun()
     return CHIP_NO_ERROR;
 }
 
+SessionManager * Engine::GetSessionManager() const
+{
+    Messaging::ExchangeManager * exchangeManager = InteractionModelEngine::GetInstance()->GetExchangeManager();
+    if (exchangeManager == nullptr)
+    {
+        return nullptr;
+    }
+    return exchangeManager->GetSessionManager();
+}
+
+System::Layer * Engine::GetSystemLayer() const
+{
+    SessionManager * sessionManager = GetSessionManager();
+    if (sessionManager == nullptr)
+    {
+        return nullptr;
+    }
+    return sessionManager->SystemLayer();
+}
+
+void Engine::ClearReportCache()
+{
+#if CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+    mReportCache.Clear();
+#endif // CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+}
+
 void Engine::Run()
 {
-    uint32_t numReadHandled = 0;
+    InteractionModelEngine * imEngine  = InteractionModelEngine::GetInstance();
+    const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+
+    // Attribute values may have changed since the last run.
+    ClearReportCache();
 
-    InteractionModelEngine * imEngine = InteractionModelEngine::GetInstance();
+    // Only service the handlers that were queued when this run started.  A handler that is queued again while we generate
+    // its report (e.g. because it was marked dirty) has scheduled another run, which will pick it up.
+    size_t numToService = mReportQueueLength;
 
-    // We may be deallocating read handlers as we go.  Track how many we had
-    // initially, so we make sure to go through all of them.
-    size_t initialAllocated = imEngine->mReadHandlers.Allocated();
-    while ((mNumReportsInFlight < CHIP_IM_MAX_REPORTS_IN_FLIGHT) && (numReadHandled < initialAllocated))
+    // Hand the reports of this run to the transport together, so that the reports of a fan-out go out in a few system calls.
+    SessionManager * sessionManager = GetSessionManager();
+    if (sessionManager != nullptr)
     {
-        ReadHandler * readHandler = imEngine->ActiveHandlerAt(mCurReadHandlerIdx % (uint32_t) imEngine->mReadHandlers.Allocated());
-        VerifyOrDie(readHandler != nullptr);
+        sessionManager->BeginSendBatch();
+    }
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    while ((mNumReportsInFlight < CHIP_IM_MAX_REPORTS_IN_FLIGHT) && (numToService > 0) && !mReportQueue.Empty())
+    {
+        ReadHandler * readHandler = &*mReportQueue.begin();
+        DequeueReport(*readHandler);
+        numToService--;
 
-        if (readHandler->IsReportable())
+        // A handler can stop being reportable after it was queued, e.g. when it starts waiting for its min interval again.
+        if (!readHandler->IsReportable())
         {
-            mRunningReadHandler = readHandler;
-            CHIP_ERROR err      = BuildAndSendSingleReportData(readHandler);
-            mRunningReadHandler = nullptr;
-            if (err != CHIP_NO_ERROR)
-            {
-                return;
-            }
+            continue;
         }
 
-        numReadHandled++;
-        // If readHandler removed itself from our list, we also decremented
-        // mCurReadHandlerIdx to account for that removal, so it's safe to
-        // increment here.
-        mCurReadHandlerIdx++;
+        mSchedulerStatistics.reportsGenerated++;
+        RecordLag(now - readHandler->mReportQueuedTime, mSchedulerStatistics.totalReportLag, mSchedulerStatistics.maxReportLag);
+
+        // BuildAndSendSingleReportData may release readHandler, so it must not be used after this call.
+        err = BuildAndSendSingleReportData(readHandler);
+        if (err != CHIP_NO_ERROR)
+        {
+            break;
+        }
     }
 
-    //
-    // If our tracker has exceeded the bounds of the handler list, reset it back to 0.
-    // This isn't strictly necessary, but does make it easier to debug issues in this code if they
-    // do arise.
-    //
-    if (mCurReadHandlerIdx >= imEngine->mReadHandlers.Allocated())
+    if (sessionManager != nullptr)
     {
-        mCurReadHandlerIdx = 0;
+        sessionManager->EndSendBatch();
     }
 
+    // Attribute values may change before the next run, so do not hold on to encodings of them.
+    ClearReportCache();
+    VerifyOrReturn(err == CHIP_NO_ERROR);
+
     bool allReadClean = true;
 
     imEngine->mReadHandlers.ForEachActiveObject([&allReadClean](ReadHandler * handler) {
@@ -671,6 +818,254 @@ void Engine::Run()
     }
 }
 
+void Engine::ScheduleReport(ReadHandler & aReadHandler)
+{
+    if (!aReadHandler.IsInList())
+    {
+        aReadHandler.mReportQueuedTime = System::SystemClock().GetMonotonicTimestamp();
+        mReportQueue.PushBack(&aReadHandler);
+        mReportQueueLength++;
+    }
+    ScheduleRun();
+}
+
+void Engine::DequeueReport(ReadHandler & aReadHandler)
+{
+    mReportQueue.Remove(&aReadHandler);
+    mReportQueueLength--;
+}
+
+void Engine::OnReadHandlerDestroyed(ReadHandler & aReadHandler)
+{
+    if (aReadHandler.IsInList())
+    {
+        DequeueReport(aReadHandler);
+    }
+    CancelIntervalDeadline(aReadHandler);
+    RemoveAttributePathsFromIndex(aReadHandler);
+}
+
+CHIP_ERROR Engine::IndexAttributePaths(ReadHandler & aReadHandler)
+{
+    RemoveAttributePathsFromIndex(aReadHandler);
+
+    for (auto * path = aReadHandler.GetAttributePathList(); path != nullptr; path = path->mpNext)
+    {
+        AttributeInterest * interest = mAttributeInterestPool.CreateObject(aReadHandler, path->mValue);
+        VerifyOrReturnError(interest != nullptr, CHIP_ERROR_NO_MEMORY);
+
+        size_t bucket                   = AttributeInterestBucket(path->mValue.mEndpointId, path->mValue.mClusterId);
+        interest->mpNext                = mAttributeInterestIndex[bucket];
+        mAttributeInterestIndex[bucket] = interest;
+    }
+    return CHIP_NO_ERROR;
+}
+
+void Engine::RemoveAttributePathsFromIndex(ReadHandler & aReadHandler)
+{
+    // Handlers come and go far less often than attributes change, so a scan of the pool is fine here.
+    mAttributeInterestPool.ForEachActiveObject([&](auto * interest) {
+        if (interest->mpReadHandler != &aReadHandler)
+        {
+            return Loop::Continue;
+        }
+        AttributeInterest ** link =
+            &mAttributeInterestIndex[AttributeInterestBucket(interest->mPath.mEndpointId, interest->mPath.mClusterId)];
+        while (*link != interest)
+        {
+            link = &(*link)->mpNext;
+        }
+        *link = interest->mpNext;
+        mAttributeInterestPool.ReleaseObject(interest);
+        return Loop::Continue;
+    });
+}
+
+bool Engine::MarkInterestDirty(AttributeInterest & aInterest, const AttributePathParams & aAttributePath)
+{
+    ReadHandler * handler = aInterest.mpReadHandler;
+
+    // We call SetDirty for both read interactions and subscribe interactions, since we may send inconsistent attribute data
+    // between two chunks. SetDirty will be ignored automatically by read handlers which are waiting for a response to the
+    // last message chunk for read interactions.
+    VerifyOrReturnValue(handler->IsGeneratingReports() || handler->IsAwaitingReportResponse(), false);
+    VerifyOrReturnValue(aInterest.mPath.Intersects(aAttributePath), false);
+
+    // A handler with several paths intersecting the change only needs to be marked dirty once.
+    if (handler->mDirtyGeneration != GetDirtySetGeneration())
+    {
+        handler->SetDirty(aAttributePath);
+    }
+    return true;
+}
+
+CHIP_ERROR Engine::ScheduleIntervalDeadline(ReadHandler & aReadHandler)
+{
+    System::Clock::Timestamp deadline = aReadHandler.GetNextIntervalDeadline();
+    if (deadline == System::Clock::Timestamp::max())
+    {
+        CancelIntervalDeadline(aReadHandler);
+        return CHIP_NO_ERROR;
+    }
+
+    if (aReadHandler.mIntervalQueueIndex == ReadHandler::kIntervalNotScheduled)
+    {
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+        ReturnErrorOnFailure(ReserveIntervalQueue(mIntervalQueueSize + 1));
+#else
+        VerifyOrReturnError(mIntervalQueueSize < ArraySize(mIntervalQueue), CHIP_ERROR_NO_MEMORY);
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+        PlaceInIntervalQueue(&aReadHandler, mIntervalQueueSize++);
+    }
+    aReadHandler.mScheduledIntervalDeadline = deadline;
+    SiftUpIntervalQueue(aReadHandler.mIntervalQueueIndex);
+    SiftDownIntervalQueue(aReadHandler.mIntervalQueueIndex);
+
+    ArmIntervalTimer();
+    return CHIP_NO_ERROR;
+}
+
+void Engine::CancelIntervalDeadline(ReadHandler & aReadHandler)
+{
+    VerifyOrReturn(aReadHandler.mIntervalQueueIndex != ReadHandler::kIntervalNotScheduled);
+    UnscheduleIntervalDeadline(aReadHandler);
+    ArmIntervalTimer();
+}
+
+void Engine::UnscheduleIntervalDeadline(ReadHandler & aReadHandler)
+{
+    VerifyOrReturn(aReadHandler.mIntervalQueueIndex != ReadHandler::kIntervalNotScheduled);
+
+    size_t index                     = aReadHandler.mIntervalQueueIndex;
+    aReadHandler.mIntervalQueueIndex = ReadHandler::kIntervalNotScheduled;
+
+    // Fill the hole with the last entry and restore the heap order around it
+    ReadHandler * last = mIntervalQueue[--mIntervalQueueSize];
+    if (last != &aReadHandler)
+    {
+        PlaceInIntervalQueue(last, index);
+        SiftUpIntervalQueue(index);
+        SiftDownIntervalQueue(last->mIntervalQueueIndex);
+    }
+}
+
+void Engine::PlaceInIntervalQueue(ReadHandler * apReadHandler, size_t aIndex)
+{
+    mIntervalQueue[aIndex]             = apReadHandler;
+    apReadHandler->mIntervalQueueIndex = aIndex;
+}
+
+void Engine::SiftUpIntervalQueue(size_t aIndex)
+{
+    ReadHandler * readHandler = mIntervalQueue[aIndex];
+    while (aIndex > 0)
+    {
+        size_t parent = (aIndex - 1) / 2;
+        if (mIntervalQueue[parent]->mScheduledIntervalDeadline <= readHandler->mScheduledIntervalDeadline)
+        {
+            break;
+        }
+        PlaceInIntervalQueue(mIntervalQueue[parent], aIndex);
+        aIndex = parent;
+    }
+    PlaceInIntervalQueue(readHandler, aIndex);
+}
+
+void Engine::SiftDownIntervalQueue(size_t aIndex)
+{
+    ReadHandler * readHandler = mIntervalQueue[aIndex];
+    while (2 * aIndex + 1 < mIntervalQueueSize)
+    {
+        size_t child = 2 * aIndex + 1;
+        if (child + 1 < mIntervalQueueSize &&
+            mIntervalQueue[child + 1]->mScheduledIntervalDeadline < mIntervalQueue[child]->mScheduledIntervalDeadline)
+        {
+            child++;
+        }
+        if (readHandler->mScheduledIntervalDeadline <= mIntervalQueue[child]->mScheduledIntervalDeadline)
+        {
+            break;
+        }
+        PlaceInIntervalQueue(mIntervalQueue[child], aIndex);
+        aIndex = child;
+    }
+    PlaceInIntervalQueue(readHandler, aIndex);
+}
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+CHIP_ERROR Engine::ReserveIntervalQueue(size_t aCount)
+{
+    VerifyOrReturnError(aCount > mIntervalQueueCapacity, CHIP_NO_ERROR);
+
+    size_t capacity =
+        std::max(aCount, std::max<size_t>(mIntervalQueueCapacity * 2, CHIP_IM_MAX_NUM_READS + CHIP_IM_MAX_NUM_SUBSCRIPTIONS));
+    auto * queue = static_cast<ReadHandler **>(Platform::MemoryRealloc(mIntervalQueue, capacity * sizeof(*mIntervalQueue)));
+    VerifyOrReturnError(queue != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    mIntervalQueue         = queue;
+    mIntervalQueueCapacity = capacity;
+    return CHIP_NO_ERROR;
+}
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+void Engine::ArmIntervalTimer()
+{
+    System::Clock::Timestamp deadline =
+        (mIntervalQueueSize > 0) ? mIntervalQueue[0]->mScheduledIntervalDeadline : System::Clock::Timestamp::max();
+    VerifyOrReturn(deadline != mIntervalTimerDeadline);
+
+    System::Layer * systemLayer = GetSystemLayer();
+    VerifyOrReturn(systemLayer != nullptr);
+
+    if (deadline == System::Clock::Timestamp::max())
+    {
+        systemLayer->CancelTimer(OnIntervalTimer, this);
+    }
+    else
+    {
+        System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+        System::Clock::Timeout delay = (deadline > now) ? std::chrono::duration_cast<System::Clock::Timeout>(deadline - now)
+                                                        : System::Clock::Timeout(0);
+
+        CHIP_ERROR err = systemLayer->StartTimer(delay, OnIntervalTimer, this);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(DataManagement, "<RE> Failed to arm interval timer: %" CHIP_ERROR_FORMAT, err.Format());
+            return;
+        }
+    }
+    mIntervalTimerDeadline = deadline;
+}
+
+void Engine::OnIntervalTimer(System::Layer * aSystemLayer, void * apAppState)
+{
+    Engine * const pEngine          = reinterpret_cast<Engine *>(apAppState);
+    pEngine->mIntervalTimerDeadline = System::Clock::Timestamp::max();
+    pEngine->ProcessIntervalDeadlines();
+}
+
+void Engine::ProcessIntervalDeadlines()
+{
+    const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+
+    while (mIntervalQueueSize > 0 && mIntervalQueue[0]->mScheduledIntervalDeadline <= now)
+    {
+        ReadHandler * readHandler = mIntervalQueue[0];
+
+        mSchedulerStatistics.intervalDeadlines++;
+        RecordLag(now - readHandler->mScheduledIntervalDeadline, mSchedulerStatistics.totalIntervalLag,
+                  mSchedulerStatistics.maxIntervalLag);
+
+        // Lifting HoldReport leaves the max interval deadline to enforce, so requeue the handler for whatever remains.
+        // Its slot in the queue was just freed, so this cannot fail for lack of memory.
+        UnscheduleIntervalDeadline(*readHandler);
+        readHandler->OnIntervalDeadline(now);
+        ScheduleIntervalDeadline(*readHandler);
+    }
+
+    ArmIntervalTimer();
+}
+
 bool Engine::MergeOverlappedAttributePath(const AttributePathParams & aAttributePath)
 {
     return Loop::Break == mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
@@ -696,6 +1091,41 @@ bool Engine::MergeOverlappedAttributePath(const AttributePathParams & aAttribute
     });
 }
 
+bool Engine::ClearReportedPaths()
+{
+    // Find the newest generation that no read handler will look at again: a handler only reports dirty paths of a generation
+    // newer than the one its last completed report began at.
+    uint64_t reportedGeneration = UINT64_MAX;
+    bool hasReadHandler         = false;
+    InteractionModelEngine::GetInstance()->mReadHandlers.ForEachActiveObject([&](ReadHandler * handler) {
+        hasReadHandler = true;
+        if (handler->IsPriming())
+        {
+            // Priming reports ignore the dirty set, and only the paths dirtied after they began matter once they complete.
+            if (handler->IsReporting())
+            {
+                reportedGeneration = std::min(reportedGeneration, handler->mCurrentReportsBeginGeneration);
+            }
+            return Loop::Continue;
+        }
+        reportedGeneration = std::min(reportedGeneration, handler->mPreviousReportsBeginGeneration);
+        return Loop::Continue;
+    });
+    // Without read handlers there is nothing to go by; Run() releases the whole set once all handlers are clean.
+    VerifyOrReturnValue(hasReadHandler, false);
+
+    bool pathReleased = false;
+    mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
+        if (path->mGeneration <= reportedGeneration)
+        {
+            mGlobalDirtySet.ReleaseObject(path);
+            pathReleased = true;
+        }
+        return Loop::Continue;
+    });
+    return pathReleased;
+}
+
 bool Engine::ClearTombPaths()
 {
     bool pathReleased = false;
@@ -782,7 +1212,8 @@ CHIP_ERROR Engine::InsertPathIntoDirtySet(const AttributePathParams & aAttribute
 {
     ReturnErrorCodeIf(MergeOverlappedAttributePath(aAttributePath), CHIP_NO_ERROR);
 
-    if (mGlobalDirtySet.Exhausted() && !MergeDirtyPathsUnderSameCluster() && !MergeDirtyPathsUnderSameEndpoint())
+    if (mGlobalDirtySet.Exhausted() && !ClearReportedPaths() && !MergeDirtyPathsUnderSameCluster() &&
+        !MergeDirtyPathsUnderSameEndpoint())
     {
         ChipLogDetail(DataManagement, "Global dirty set pool exhausted, merge all paths.");
         mGlobalDirtySet.ReleaseAll();
@@ -811,26 +1242,35 @@ CHIP_ERROR Engine::SetDirty(AttributePathParams & aAttributePath)
     BumpDirtySetGeneration();
 
     bool intersectsInterestPath = false;
-    InteractionModelEngine::GetInstance()->mReadHandlers.ForEachActiveObject(
-        [&aAttributePath, &intersectsInterestPath](ReadHandler * handler) {
-            // We call SetDirty for both read interactions and subscribe interactions, since we may send inconsistent attribute data
-            // between two chunks. SetDirty will be ignored automatically by read handlers which are waiting for a response to the
-            // last message chunk for read interactions.
-            if (handler->IsGeneratingReports() || handler->IsAwaitingReportResponse())
+    if (aAttributePath.HasWildcardEndpointId() || aAttributePath.HasWildcardClusterId())
+    {
+        // A change with a wildcard endpoint or cluster may intersect paths in any bucket.
+        mAttributeInterestPool.ForEachActiveObject([&](auto * interest) {
+            intersectsInterestPath = MarkInterestDirty(*interest, aAttributePath) || intersectsInterestPath;
+            return Loop::Continue;
+        });
+    }
+    else
+    {
+        // A concrete change can only intersect paths indexed under its own endpoint and cluster, or under a wildcard of either.
+        const EndpointId endpointIds[] = { aAttributePath.mEndpointId, kInvalidEndpointId };
+        const ClusterId clusterIds[]   = { aAttributePath.mClusterId, kInvalidClusterId };
+        for (EndpointId endpointId : endpointIds)
+        {
+            for (ClusterId clusterId : clusterIds)
             {
-                for (auto object = handler->GetAttributePathList(); object != nullptr; object = object->mpNext)
+                AttributeInterest * interest = mAttributeInterestIndex[AttributeInterestBucket(endpointId, clusterId)];
+                while (interest != nullptr)
                 {
-                    if (object->mValue.Intersects(aAttributePath))
+                    if (interest->mPath.mEndpointId == endpointId && interest->mPath.mClusterId == clusterId)
                     {
-                        handler->SetDirty(aAttributePath);
-                        intersectsInterestPath = true;
-                        break;
+                        intersectsInterestPath = MarkInterestDirty(*interest, aAttributePath) || intersectsInterestPath;
                     }
+                    interest = interest->mpNext;
                 }
             }
-
-            return Loop::Continue;
-        });
+        }
+    }
 
     if (!intersectsInterestPath)
     {
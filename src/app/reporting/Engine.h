@@ -27,13 +27,16 @@
 #include <access/AccessControl.h>
 #include <app/MessageDef/ReportDataMessage.h>
 #include <app/ReadHandler.h>
+#include <app/reporting/EncodedReportCache.h>
 #include <app/util/basic-types.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/IntrusiveList.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ExchangeMgr.h>
 #include <protocols/Protocols.h>
+#include <system/SystemClock.h>
 #include <system/SystemPacketBuffer.h>
 #include <system/TLVPacketBufferBackingStore.h>
 
@@ -52,10 +55,30 @@ namespace reporting {
  *
  *         At its core, it  tries to gather and pack as much relevant attributes changes and/or events as possible into a report
  * message before sending that to the reader. It continues to do so until it has no more work to do.
+ *
+ *         Read handlers are scheduled rather than polled: a handler that becomes reportable is appended to a report queue
+ * that Run() services in order, and the min/max interval deadlines of subscriptions are kept in a min-heap for which a
+ * single System::Layer timer is armed.
  */
 class Engine
 {
 public:
+    /**
+     * Counters describing how promptly the scheduler serviced read handlers since Init() or the last
+     * ResetSchedulerStatistics().
+     */
+    struct SchedulerStatistics
+    {
+        uint32_t reportsGenerated  = 0; /**< Reports generated for handlers taken from the report queue. */
+        uint32_t intervalDeadlines = 0; /**< Min/max interval deadlines enforced. */
+        /** Sum and maximum of the time between a handler being queued as reportable and its report being generated. */
+        System::Clock::Milliseconds64 totalReportLag = System::Clock::Milliseconds64(0);
+        System::Clock::Milliseconds64 maxReportLag   = System::Clock::Milliseconds64(0);
+        /** Sum and maximum of the time between a min/max interval deadline and the scheduler enforcing it. */
+        System::Clock::Milliseconds64 totalIntervalLag = System::Clock::Milliseconds64(0);
+        System::Clock::Milliseconds64 maxIntervalLag   = System::Clock::Milliseconds64(0);
+    };
+
     /**
      * Initializes the reporting engine. Should only be called once.
      *
@@ -96,27 +119,42 @@ public:
      */
     CHIP_ERROR ScheduleEventDelivery(ConcreteEventPath & aPath, uint32_t aBytesWritten);
 
-    /*
-     * Resets the tracker that tracks the currently serviced read handler.
-     * apReadHandler can be non-null to indicate that the reset is due to a
-     * specific ReadHandler being deallocated.
+    /**
+     * Queue a read handler that has become reportable for the next run of the engine, and schedule that run.
      */
-    void ResetReadHandlerTracker(ReadHandler * apReadHandlerBeingDeleted)
-    {
-        if (apReadHandlerBeingDeleted == mRunningReadHandler)
-        {
-            // Just decrement, so our increment after we finish running it will
-            // do the right thing.
-            --mCurReadHandlerIdx;
-        }
-        else
-        {
-            // No idea what to do here to make the indexing sane.  Just start at
-            // the beginning.  We need to do better here; see
-            // https://github.com/project-chip/connectedhomeip/issues/13809
-            mCurReadHandlerIdx = 0;
-        }
-    }
+    void ScheduleReport(ReadHandler & aReadHandler);
+
+    /**
+     * (Re)schedule the next min/max interval deadline of a subscription, as returned by
+     * ReadHandler::GetNextIntervalDeadline().
+     */
+    CHIP_ERROR ScheduleIntervalDeadline(ReadHandler & aReadHandler);
+
+    /**
+     * Stop enforcing the min/max interval deadlines of a subscription.
+     */
+    void CancelIntervalDeadline(ReadHandler & aReadHandler);
+
+    /**
+     * Index the attribute paths of a read handler, so that SetDirty() finds it when one of them changes.  Must be called
+     * again whenever the attribute path list of the handler changes.
+     */
+    CHIP_ERROR IndexAttributePaths(ReadHandler & aReadHandler);
+
+    /**
+     * Remove a read handler that is being destroyed from the scheduler and the attribute path index.
+     */
+    void OnReadHandlerDestroyed(ReadHandler & aReadHandler);
+
+    const SchedulerStatistics & GetSchedulerStatistics() const { return mSchedulerStatistics; }
+
+    void ResetSchedulerStatistics() { mSchedulerStatistics = SchedulerStatistics(); }
+
+#if CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+    const EncodedReportCache::Statistics & GetReportCacheStatistics() const { return mReportCache.GetStatistics(); }
+
+    void ResetReportCacheStatistics() { mReportCache.ResetStatistics(); }
+#endif // CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
 
     uint32_t GetNumReportsInFlight() const { return mNumReportsInFlight; }
 
@@ -140,6 +178,11 @@ private:
      */
     void Run();
 
+    /**
+     * Drop the attribute encodings shared between the read handlers serviced by a run.
+     */
+    void ClearReportCache();
+
     friend class TestReportingEngine;
     friend class ::chip::app::TestReadInteraction;
 
@@ -152,6 +195,39 @@ private:
         uint64_t mGeneration = 0;
     };
 
+    /**
+     * An attribute path a read handler is interested in, chained into the bucket of its (endpoint, cluster) in
+     * mAttributeInterestIndex.  Wildcard endpoint and cluster ids are indexed as-is.
+     */
+    struct AttributeInterest
+    {
+        AttributeInterest(ReadHandler & aReadHandler, const AttributePathParams & aPath) :
+            mpReadHandler(&aReadHandler), mPath(aPath)
+        {}
+        ReadHandler * mpReadHandler;
+        AttributePathParams mPath;
+        AttributeInterest * mpNext = nullptr;
+    };
+
+    static constexpr size_t kAttributeInterestIndexBuckets = CHIP_IM_SERVER_ATTRIBUTE_INTEREST_INDEX_BUCKETS;
+    static_assert(kAttributeInterestIndexBuckets > 0 &&
+                      (kAttributeInterestIndexBuckets & (kAttributeInterestIndexBuckets - 1)) == 0,
+                  "CHIP_IM_SERVER_ATTRIBUTE_INTEREST_INDEX_BUCKETS must be a power of two");
+
+    static size_t AttributeInterestBucket(EndpointId aEndpointId, ClusterId aClusterId)
+    {
+        return (static_cast<size_t>(aClusterId) ^ (static_cast<size_t>(aEndpointId) << 5)) & (kAttributeInterestIndexBuckets - 1);
+    }
+
+    void RemoveAttributePathsFromIndex(ReadHandler & aReadHandler);
+
+    /**
+     * Mark the read handler of an indexed attribute path dirty if the path intersects the changed path.
+     *
+     * Returns whether the read handler was marked dirty.
+     */
+    bool MarkInterestDirty(AttributeInterest & aInterest, const AttributePathParams & aAttributePath);
+
     /**
      * Build Single Report Data including attribute changes and event data stream, and send out
      *
@@ -166,6 +242,17 @@ private:
                                    AttributeReportIBs::Builder & aAttributeReportIBs,
                                    const ConcreteReadAttributePath & aClusterInfo,
                                    AttributeValueEncoder::AttributeEncodeState * apEncoderState);
+#if CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+    /**
+     * Encode the AttributeReportIBs for a path from mReportCache, filling the cache on a miss.  aEncoded is left false if the
+     * reports cannot be shared, e.g. because the subject is denied access, in which case RetrieveClusterData() must be used.
+     */
+    CHIP_ERROR RetrieveCachedClusterData(const Access::SubjectDescriptor & aSubjectDescriptor, bool aIsFabricFiltered,
+                                         AttributeReportIBs::Builder & aAttributeReportIBs, const ConcreteReadAttributePath & aPath,
+                                         bool & aEncoded);
+    CHIP_ERROR EncodeIntoReportCache(const Access::SubjectDescriptor & aSubjectDescriptor, bool aIsFabricFiltered,
+                                     const ConcreteReadAttributePath & aPath, const EncodedReportCache::Key & aKey);
+#endif // CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
     CHIP_ERROR CheckAccessDeniedEventPaths(TLV::TLVWriter & aWriter, bool & aHasEncodedData, ReadHandler * apReadHandler);
 
     // If version match, it means don't send, if version mismatch, it means send.
@@ -214,6 +301,14 @@ private:
      */
     bool MergeDirtyPathsUnderSameEndpoint();
 
+    /**
+     * If we are running out of ObjectPool for the global dirty set, release the paths that every read handler has already
+     * reported, before resorting to merging paths and losing precision.
+     *
+     * Returns whether we have released any paths.
+     */
+    bool ClearReportedPaths();
+
     /**
      * During the iterating of the paths, releasing the object in the inner loop will cause undefined behavior of the ObjectPool, so
      * we replace the items to be cleared by a tomb first, then clear all the tombs after the iteration.
@@ -224,6 +319,22 @@ private:
 
     CHIP_ERROR InsertPathIntoDirtySet(const AttributePathParams & aAttributePath);
 
+    SessionManager * GetSessionManager() const;
+    System::Layer * GetSystemLayer() const;
+
+    void DequeueReport(ReadHandler & aReadHandler);
+
+    // Interval deadline queue: a binary min-heap of subscriptions ordered by ReadHandler::mScheduledIntervalDeadline.
+    void UnscheduleIntervalDeadline(ReadHandler & aReadHandler);
+    void PlaceInIntervalQueue(ReadHandler * apReadHandler, size_t aIndex);
+    void SiftUpIntervalQueue(size_t aIndex);
+    void SiftDownIntervalQueue(size_t aIndex);
+
+    // Arm the interval timer for the earliest deadline in the queue, or cancel it if the queue is empty.
+    void ArmIntervalTimer();
+    static void OnIntervalTimer(System::Layer * aSystemLayer, void * apAppState);
+    void ProcessIntervalDeadlines();
+
     inline void BumpDirtySetGeneration() { mDirtyGeneration++; }
 
     /**
@@ -240,15 +351,42 @@ private:
     uint32_t mNumReportsInFlight = 0;
 
     /**
-     *  Current read handler index
-     *
+     * Read handlers that became reportable and are waiting for a run of the engine, in the order they became reportable.
+     */
+    IntrusiveList<ReadHandler> mReportQueue;
+    size_t mReportQueueLength = 0;
+
+    /**
+     * Subscriptions with a pending min/max interval deadline, and the deadline the interval timer is armed for.
+     */
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    // Grown in ScheduleIntervalDeadline() as subscriptions are added, and released in Shutdown().
+    CHIP_ERROR ReserveIntervalQueue(size_t aCount);
+
+    ReadHandler ** mIntervalQueue = nullptr;
+    size_t mIntervalQueueCapacity = 0;
+#else
+    ReadHandler * mIntervalQueue[CHIP_IM_MAX_NUM_READS + CHIP_IM_MAX_NUM_SUBSCRIPTIONS];
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    size_t mIntervalQueueSize                       = 0;
+    System::Clock::Timestamp mIntervalTimerDeadline = System::Clock::Timestamp::max();
+
+    SchedulerStatistics mSchedulerStatistics;
+
+#if CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+    /**
+     * Attribute reports encoded during the current run, shared by the subscriptions it services.
      */
-    uint32_t mCurReadHandlerIdx = 0;
+    EncodedReportCache mReportCache;
+#endif // CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
 
     /**
-     * The read handler we're calling BuildAndSendSingleReportData on right now.
+     * Index from (endpoint, cluster) to the attribute paths read handlers are interested in.
      */
-    ReadHandler * mRunningReadHandler = nullptr;
+    AttributeInterest * mAttributeInterestIndex[kAttributeInterestIndexBuckets] = {};
+    ObjectPool<AttributeInterest,
+               CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS + CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS>
+        mAttributeInterestPool;
 
     /**
      *  mGlobalDirtySet is used to track the set of attribute/event paths marked dirty for reporting purposes.
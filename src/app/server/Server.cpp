@@ -90,6 +90,14 @@ Server Server::sServer;
 static uint8_t sInfoEventBuffer[CHIP_DEVICE_CONFIG_EVENT_LOGGING_INFO_BUFFER_SIZE];
 static uint8_t sDebugEventBuffer[CHIP_DEVICE_CONFIG_EVENT_LOGGING_DEBUG_BUFFER_SIZE];
 static uint8_t sCritEventBuffer[CHIP_DEVICE_CONFIG_EVENT_LOGGING_CRIT_BUFFER_SIZE];
+#if CHIP_DEVICE_CONFIG_EVENT_LOGGING_INDEX_BYTES_PER_ENTRY > 0
+static ::chip::app::EventIndexEntry
+    sInfoEventIndex[CHIP_DEVICE_CONFIG_EVENT_LOGGING_INFO_BUFFER_SIZE / CHIP_DEVICE_CONFIG_EVENT_LOGGING_INDEX_BYTES_PER_ENTRY];
+static ::chip::app::EventIndexEntry
+    sDebugEventIndex[CHIP_DEVICE_CONFIG_EVENT_LOGGING_DEBUG_BUFFER_SIZE / CHIP_DEVICE_CONFIG_EVENT_LOGGING_INDEX_BYTES_PER_ENTRY];
+static ::chip::app::EventIndexEntry
+    sCritEventIndex[CHIP_DEVICE_CONFIG_EVENT_LOGGING_CRIT_BUFFER_SIZE / CHIP_DEVICE_CONFIG_EVENT_LOGGING_INDEX_BYTES_PER_ENTRY];
+#endif // CHIP_DEVICE_CONFIG_EVENT_LOGGING_INDEX_BYTES_PER_ENTRY > 0
 static ::chip::PersistedCounter<chip::EventNumber> sGlobalEventIdCounter;
 static ::chip::app::CircularEventBuffer sLoggingBuffer[CHIP_NUM_EVENT_LOGGING_BUFFERS];
 #endif // CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
@@ -233,6 +241,14 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
             { &sInfoEventBuffer[0], sizeof(sInfoEventBuffer), ::chip::app::PriorityLevel::Info },
             { &sCritEventBuffer[0], sizeof(sCritEventBuffer), ::chip::app::PriorityLevel::Critical }
         };
+#if CHIP_DEVICE_CONFIG_EVENT_LOGGING_INDEX_BYTES_PER_ENTRY > 0
+        logStorageResources[0].mpIndex    = &sDebugEventIndex[0];
+        logStorageResources[0].mIndexSize = ArraySize(sDebugEventIndex);
+        logStorageResources[1].mpIndex    = &sInfoEventIndex[0];
+        logStorageResources[1].mIndexSize = ArraySize(sInfoEventIndex);
+        logStorageResources[2].mpIndex    = &sCritEventIndex[0];
+        logStorageResources[2].mIndexSize = ArraySize(sCritEventIndex);
+#endif // CHIP_DEVICE_CONFIG_EVENT_LOGGING_INDEX_BYTES_PER_ENTRY > 0
 
         chip::app::EventManagement::GetInstance().Init(&mExchangeMgr, CHIP_NUM_EVENT_LOGGING_BUFFERS, &sLoggingBuffer[0],
                                                        &logStorageResources[0], &sGlobalEventIdCounter,
@@ -532,6 +548,10 @@ void Server::ResumeSubscriptions()
 #endif
 
 KvsPersistentStorageDelegate CommonCaseDeviceServerInitParams::sKvsPersistenStorageDelegate;
+#if CHIP_CONFIG_PERSISTENT_STORAGE_BATCH_BUFFER_SIZE > 0
+BatchingPersistentStorageDelegate CommonCaseDeviceServerInitParams::sBatchingStorageDelegate;
+uint8_t CommonCaseDeviceServerInitParams::sBatchingStorageBuffer[CHIP_CONFIG_PERSISTENT_STORAGE_BATCH_BUFFER_SIZE];
+#endif
 PersistentStorageOperationalKeystore CommonCaseDeviceServerInitParams::sPersistentStorageOperationalKeystore;
 Credentials::PersistentStorageOpCertStore CommonCaseDeviceServerInitParams::sPersistentStorageOpCertStore;
 Credentials::GroupDataProviderImpl CommonCaseDeviceServerInitParams::sGroupDataProvider;
@@ -43,6 +43,7 @@
 #include <crypto/PersistentStorageOperationalKeystore.h>
 #include <inet/InetConfig.h>
 #include <lib/core/CHIPConfig.h>
+#include <lib/support/BatchingPersistentStorageDelegate.h>
 #include <lib/support/SafeInt.h>
 #include <messaging/ExchangeMgr.h>
 #include <platform/KeyValueStoreManager.h>
@@ -226,6 +227,12 @@ struct CommonCaseDeviceServerInitParams : public ServerInitParams
                 DeviceLayer::PersistedStorage::KeyValueStoreMgr();
             ReturnErrorOnFailure(sKvsPersistenStorageDelegate.Init(&kvsManager));
             this->persistentStorageDelegate = &sKvsPersistenStorageDelegate;
+#if CHIP_CONFIG_PERSISTENT_STORAGE_BATCH_BUFFER_SIZE > 0
+            // Coalesce the updates of storage batches (e.g. fabric commits) into single atomic writes.
+            ReturnErrorOnFailure(sBatchingStorageDelegate.Init(&sKvsPersistenStorageDelegate, sBatchingStorageBuffer,
+                                                               sizeof(sBatchingStorageBuffer)));
+            this->persistentStorageDelegate = &sBatchingStorageDelegate;
+#endif
         }
 
         // PersistentStorageDelegate "software-based" operational key access injection
@@ -286,6 +293,10 @@ struct CommonCaseDeviceServerInitParams : public ServerInitParams
 
 private:
     static KvsPersistentStorageDelegate sKvsPersistenStorageDelegate;
+#if CHIP_CONFIG_PERSISTENT_STORAGE_BATCH_BUFFER_SIZE > 0
+    static BatchingPersistentStorageDelegate sBatchingStorageDelegate;
+    static uint8_t sBatchingStorageBuffer[CHIP_CONFIG_PERSISTENT_STORAGE_BATCH_BUFFER_SIZE];
+#endif
     static PersistentStorageOperationalKeystore sPersistentStorageOperationalKeystore;
     static Credentials::PersistentStorageOpCertStore sPersistentStorageOpCertStore;
     static Credentials::GroupDataProviderImpl sGroupDataProvider;
@@ -27,12 +27,18 @@
 #include <app/data-model/DecodableList.h>
 #include <app/data-model/Decode.h>
 #include <app/tests/AppTestContext.h>
+#include <lib/support/TypeTraits.h>
 #include <lib/support/UnitTestContext.h>
 #include <lib/support/UnitTestRegistration.h>
 #include <nlunit-test.h>
 #include <string.h>
+#include <system/SystemClock.h>
 #include <vector>
 
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
 using TestContext = chip::Test::AppContext;
 using namespace chip::app;
 using namespace chip;
@@ -614,10 +620,452 @@ void TestCache(nlTestSuite * apSuite, void * apContext)
                              AttributeInstruction(AttributeInstruction::kAttributeB, 0, AttributeInstruction::kData) });
 }
 
+class EvictionCallback : public ClusterStateCache::Callback
+{
+public:
+    void OnDone(ReadClient *) override {}
+    void OnClusterEvicted(ClusterStateCache * cache, EndpointId endpointId, ClusterId clusterId) override
+    {
+        mEvicted.push_back(ConcreteClusterPath(endpointId, clusterId));
+    }
+
+    std::vector<ConcreteClusterPath> mEvicted;
+};
+
+// Report the Int16u attribute of the UnitTesting cluster on each of the given endpoints, with the endpoint as its value, and
+// an event with each of the given event numbers.
+void GenerateBoundedReport(ReadClient::Callback & callback, std::initializer_list<EndpointId> endpoints,
+                           std::initializer_list<EventNumber> eventNumbers = {})
+{
+    callback.OnReportBegin();
+    for (EndpointId endpoint : endpoints)
+    {
+        uint8_t buffer[16];
+        TLV::TLVWriter writer;
+        writer.Init(buffer);
+        NL_TEST_ASSERT(gSuite, DataModel::Encode(writer, TLV::AnonymousTag(), static_cast<uint16_t>(endpoint)) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(gSuite, writer.Finalize() == CHIP_NO_ERROR);
+
+        TLV::TLVReader reader;
+        reader.Init(buffer, writer.GetLengthWritten());
+        NL_TEST_ASSERT(gSuite, reader.Next() == CHIP_NO_ERROR);
+
+        ConcreteDataAttributePath path(endpoint, Clusters::UnitTesting::Id, Clusters::UnitTesting::Attributes::Int16u::Id);
+        path.mDataVersion.SetValue(1);
+        callback.OnAttributeData(path, &reader, StatusIB());
+    }
+    for (EventNumber eventNumber : eventNumbers)
+    {
+        uint8_t buffer[16];
+        TLV::TLVWriter writer;
+        writer.Init(buffer);
+        NL_TEST_ASSERT(gSuite, DataModel::Encode(writer, TLV::AnonymousTag(), static_cast<uint32_t>(eventNumber)) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(gSuite, writer.Finalize() == CHIP_NO_ERROR);
+
+        TLV::TLVReader reader;
+        reader.Init(buffer, writer.GetLengthWritten());
+        NL_TEST_ASSERT(gSuite, reader.Next() == CHIP_NO_ERROR);
+
+        EventHeader header;
+        header.mPath        = ConcreteEventPath(1, Clusters::UnitTesting::Id, 1);
+        header.mEventNumber = eventNumber;
+        callback.OnEventData(header, &reader, nullptr);
+    }
+    callback.OnReportEnd();
+}
+
+void TestBoundedCache(nlTestSuite * apSuite, void * apContext)
+{
+    using Int16u = Clusters::UnitTesting::Attributes::Int16u::TypeInfo;
+
+    EvictionCallback callback;
+    ClusterStateCache cache(callback);
+    Int16u::DecodableType value = 0;
+
+    // Each value is encoded in 2 bytes, so the cache holds two clusters.
+    cache.SetMaxCachedBytes(4, 0);
+    GenerateBoundedReport(cache.GetBufferedCallback(), { 1, 2 });
+    NL_TEST_ASSERT(apSuite, callback.mEvicted.empty());
+    NL_TEST_ASSERT(apSuite, cache.GetAttributeDataSize() == 4);
+
+    // Reading endpoint 1 leaves endpoint 2 as the least recently read cluster.
+    NL_TEST_ASSERT(apSuite, cache.Get<Int16u>(ConcreteAttributePath(1, Int16u::GetClusterId(), Int16u::GetAttributeId()), value) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, value == 1);
+
+    GenerateBoundedReport(cache.GetBufferedCallback(), { 3 });
+    NL_TEST_ASSERT(apSuite, callback.mEvicted.size() == 1);
+    NL_TEST_ASSERT(apSuite, !callback.mEvicted.empty() && callback.mEvicted[0] == ConcreteClusterPath(2, Int16u::GetClusterId()));
+    NL_TEST_ASSERT(apSuite, cache.GetAttributeDataSize() == 4);
+    NL_TEST_ASSERT(apSuite, cache.Get<Int16u>(ConcreteAttributePath(2, Int16u::GetClusterId(), Int16u::GetAttributeId()), value) ==
+                       CHIP_ERROR_KEY_NOT_FOUND);
+    NL_TEST_ASSERT(apSuite, cache.Get<Int16u>(ConcreteAttributePath(3, Int16u::GetClusterId(), Int16u::GetAttributeId()), value) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, value == 3);
+
+    // An evicted cluster has no data version, so it is read again in full.
+    Optional<DataVersion> version;
+    NL_TEST_ASSERT(apSuite, cache.GetVersion(ConcreteClusterPath(2, Int16u::GetClusterId()), version) == CHIP_ERROR_KEY_NOT_FOUND);
+
+    // Each event is encoded in 2 bytes, so the cache holds the two latest events.
+    std::vector<EventNumber> eventNumbers;
+    cache.SetMaxCachedBytes(0, 4);
+    GenerateBoundedReport(cache.GetBufferedCallback(), {}, { 1, 2, 3 });
+    NL_TEST_ASSERT(apSuite, cache.ForEachEventData([&eventNumbers](const EventHeader & header) {
+        eventNumbers.push_back(header.mEventNumber);
+        return CHIP_NO_ERROR;
+    }) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, eventNumbers == std::vector<EventNumber>({ 2, 3 }));
+    NL_TEST_ASSERT(apSuite, cache.GetEventDataSize() == 4);
+
+    cache.ClearEventCache();
+    NL_TEST_ASSERT(apSuite, cache.GetEventDataSize() == 0);
+}
+
+// Request a wildcard read of the UnitTesting cluster from a cache, returning whether any DataVersionFilters were encoded.
+bool RequestUnitTestingCluster(ClusterStateCache & cache)
+{
+    uint8_t buffer[256];
+    TLV::TLVWriter writer;
+    writer.Init(buffer);
+    DataVersionFilterIBs::Builder builder;
+    NL_TEST_ASSERT(gSuite, builder.Init(&writer) == CHIP_NO_ERROR);
+
+    AttributePathParams paths[] = { AttributePathParams(Clusters::UnitTesting::Id, kInvalidAttributeId) };
+    bool encodedDataVersionList = false;
+    NL_TEST_ASSERT(gSuite,
+                   cache.GetBufferedCallback().OnUpdateDataVersionFilterList(builder, Span<AttributePathParams>(paths),
+                                                                             encodedDataVersionList) == CHIP_NO_ERROR);
+    return encodedDataVersionList;
+}
+
+void TestSnapshot(nlTestSuite * apSuite, void * apContext)
+{
+    using Int16u  = Clusters::UnitTesting::Attributes::Int16u::TypeInfo;
+    using Boolean = Clusters::UnitTesting::Attributes::Boolean::TypeInfo;
+
+    EvictionCallback callback;
+    ClusterStateCache cache(callback);
+    Int16u::DecodableType value = 0;
+    Optional<DataVersion> version;
+    Optional<EventNumber> eventNumber;
+    StatusIB status;
+    const ConcreteAttributePath int16uPath(2, Int16u::GetClusterId(), Int16u::GetAttributeId());
+    const ConcreteDataAttributePath booleanPath(3, Boolean::GetClusterId(), Boolean::GetAttributeId());
+
+    // The first read has nothing to filter on.  Endpoints 1 and 2 are reported in full, endpoint 3 only partially.
+    NL_TEST_ASSERT(apSuite, !RequestUnitTestingCluster(cache));
+    GenerateBoundedReport(cache.GetBufferedCallback(), { 1, 2 }, { 7 });
+    cache.GetBufferedCallback().OnReportBegin();
+    cache.GetBufferedCallback().OnAttributeData(booleanPath, nullptr, StatusIB(Protocols::InteractionModel::Status::Failure, 5));
+    cache.GetBufferedCallback().OnReportEnd();
+
+    uint8_t snapshot[512];
+    TLV::TLVWriter writer;
+    writer.Init(snapshot);
+    NL_TEST_ASSERT(apSuite, cache.SaveSnapshot(writer) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.Finalize() == CHIP_NO_ERROR);
+    const uint32_t snapshotLength = writer.GetLengthWritten();
+
+    EvictionCallback restoredCallback;
+    ClusterStateCache restored(restoredCallback);
+    TLV::TLVReader reader;
+    reader.Init(snapshot, snapshotLength);
+    NL_TEST_ASSERT(apSuite, reader.Next() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, restored.LoadSnapshot(reader) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(apSuite, restored.Get<Int16u>(int16uPath, value) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, value == 2);
+    NL_TEST_ASSERT(apSuite, restored.GetVersion(int16uPath, version) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, version.HasValue() && version.Value() == 1);
+    NL_TEST_ASSERT(apSuite, restored.GetStatus(booleanPath, status) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, status.mStatus == Protocols::InteractionModel::Status::Failure && status.mClusterStatus.HasValue() &&
+                       status.mClusterStatus.Value() == 5);
+    NL_TEST_ASSERT(apSuite, restored.GetVersion(booleanPath, version) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, !version.HasValue());
+    NL_TEST_ASSERT(apSuite, restored.GetBufferedCallback().GetHighestReceivedEventNumber(eventNumber) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, eventNumber.HasValue() && eventNumber.Value() == 7);
+
+    // The first read after loading the snapshot filters out the clusters that were complete.
+    NL_TEST_ASSERT(apSuite, RequestUnitTestingCluster(restored));
+
+    // Saving the restored cache reproduces the snapshot.
+    uint8_t resaved[512];
+    writer.Init(resaved);
+    NL_TEST_ASSERT(apSuite, restored.SaveSnapshot(writer) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.Finalize() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.GetLengthWritten() == snapshotLength && memcmp(resaved, snapshot, snapshotLength) == 0);
+
+    // A snapshot is not merged into a cache that already holds attributes.
+    reader.Init(snapshot, snapshotLength);
+    NL_TEST_ASSERT(apSuite, reader.Next() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, cache.LoadSnapshot(reader) == CHIP_ERROR_INCORRECT_STATE);
+
+    // Snapshots written in another format are rejected.
+    EvictionCallback failedCallback;
+    ClusterStateCache failed(failedCallback);
+    TLV::TLVType container;
+    writer.Init(snapshot);
+    NL_TEST_ASSERT(apSuite, writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, container) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.Put(TLV::ContextTag(1), static_cast<uint8_t>(2)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.EndContainer(container) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.Finalize() == CHIP_NO_ERROR);
+    reader.Init(snapshot, writer.GetLengthWritten());
+    NL_TEST_ASSERT(apSuite, reader.Next() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, failed.LoadSnapshot(reader) == CHIP_ERROR_VERSION_MISMATCH);
+
+    // A snapshot that fails to load after loading some attributes of a cluster leaves that cluster without a data version,
+    // and does not set the event number.
+    TLV::TLVType clusters, cluster, attributes, attribute;
+    writer.Init(snapshot);
+    NL_TEST_ASSERT(apSuite, writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, container) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.Put(TLV::ContextTag(1), static_cast<uint8_t>(1)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.Put(TLV::ContextTag(2), static_cast<EventNumber>(100)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.StartContainer(TLV::ContextTag(3), TLV::kTLVType_Array, clusters) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, cluster) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.Put(TLV::ContextTag(4), int16uPath.mEndpointId) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.Put(TLV::ContextTag(5), int16uPath.mClusterId) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.Put(TLV::ContextTag(6), static_cast<DataVersion>(9)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.StartContainer(TLV::ContextTag(7), TLV::kTLVType_Array, attributes) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, attribute) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.Put(TLV::ContextTag(8), int16uPath.mAttributeId) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.Put(TLV::ContextTag(9), static_cast<uint16_t>(42)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.EndContainer(attribute) == CHIP_NO_ERROR);
+    // An attribute with neither data nor a status.
+    NL_TEST_ASSERT(apSuite, writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, attribute) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.Put(TLV::ContextTag(8), Boolean::GetAttributeId()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.EndContainer(attribute) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.EndContainer(attributes) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.EndContainer(cluster) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.EndContainer(clusters) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.EndContainer(container) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.Finalize() == CHIP_NO_ERROR);
+    reader.Init(snapshot, writer.GetLengthWritten());
+    NL_TEST_ASSERT(apSuite, reader.Next() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, failed.LoadSnapshot(reader) != CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(apSuite, failed.Get<Int16u>(int16uPath, value) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, value == 42);
+    NL_TEST_ASSERT(apSuite, failed.GetVersion(int16uPath, version) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, !version.HasValue());
+    NL_TEST_ASSERT(apSuite, failed.GetBufferedCallback().GetHighestReceivedEventNumber(eventNumber) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, !eventNumber.HasValue());
+}
+
+// Encode a value as the context-tagged data of a structure (as in an AttributeDataIB) and store it in the storage.
+template <class Storage, typename T>
+CHIP_ERROR SetStorageValue(Storage & storage, const ConcreteAttributePath & path, const T & value)
+{
+    uint8_t buffer[64];
+    TLV::TLVWriter writer;
+    TLV::TLVType outerContainerType;
+    writer.Init(buffer);
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outerContainerType));
+    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(2), value));
+    ReturnErrorOnFailure(writer.EndContainer(outerContainerType));
+    ReturnErrorOnFailure(writer.Finalize());
+
+    TLV::TLVReader reader;
+    reader.Init(buffer, writer.GetLengthWritten());
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag()));
+    ReturnErrorOnFailure(reader.EnterContainer(outerContainerType));
+    ReturnErrorOnFailure(reader.Next(TLV::ContextTag(2)));
+    return storage.SetAttributeData(path, reader);
+}
+
+// Apply a pseudo-random sequence of updates to a storage and append everything it then holds to a checksum.
+template <class Storage>
+void RunStorageSequence(nlTestSuite * apSuite, Storage & storage, uint64_t & checksum)
+{
+    uint32_t seed = 12345;
+    for (uint32_t i = 0; i < 5000; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        const ConcreteAttributePath path(static_cast<EndpointId>((seed >> 8) % 4), (seed >> 12) % 3, (seed >> 16) % 16);
+        if ((seed >> 24) % 5 == 0)
+        {
+            StatusIB status(Protocols::InteractionModel::Status::UnsupportedAttribute);
+            NL_TEST_ASSERT(apSuite, storage.SetAttributeStatus(path, status) == CHIP_NO_ERROR);
+        }
+        else
+        {
+            NL_TEST_ASSERT(apSuite, SetStorageValue(storage, path, i) == CHIP_NO_ERROR);
+        }
+
+        CachedAttributeState state;
+        NL_TEST_ASSERT(apSuite, storage.GetAttribute(path, state) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, state.IsStatus() == ((seed >> 24) % 5 == 0));
+    }
+
+    CachedClusterInfo & versions = storage.GetOrAddCluster(7, 1);
+    versions.mCommittedDataVersion.SetValue(42);
+
+    checksum = 0;
+    CHIP_ERROR err =
+        storage.ForEachCluster([&](EndpointId endpointId, ClusterId clusterId, const CachedClusterInfo & clusterVersions) {
+            checksum = checksum * 31 + endpointId;
+            checksum = checksum * 31 + clusterId;
+            checksum = checksum * 31 + clusterVersions.mCommittedDataVersion.ValueOr(0);
+            return storage.ForEachAttribute(endpointId, clusterId, [&](AttributeId attributeId,
+                                                                       const CachedAttributeState & state) {
+                checksum = checksum * 31 + attributeId;
+                if (state.IsStatus())
+                {
+                    checksum = checksum * 31 + to_underlying(state.GetStatus().mStatus);
+                    return CHIP_NO_ERROR;
+                }
+
+                TLV::TLVReader reader;
+                uint32_t value = 0;
+                reader.Init(state.GetData());
+                ReturnErrorOnFailure(reader.Next());
+                NL_TEST_ASSERT(apSuite, reader.GetTag() == TLV::AnonymousTag());
+                ReturnErrorOnFailure(reader.Get(value));
+                checksum = checksum * 31 + value;
+                return CHIP_NO_ERROR;
+            });
+        });
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(apSuite, storage.HasEndpoint(3));
+    NL_TEST_ASSERT(apSuite, storage.HasEndpoint(7));
+    NL_TEST_ASSERT(apSuite, !storage.HasEndpoint(5));
+    NL_TEST_ASSERT(apSuite, storage.FindCluster(7, 1) != nullptr);
+    NL_TEST_ASSERT(apSuite, storage.FindCluster(7, 2) == nullptr);
+    NL_TEST_ASSERT(apSuite, storage.ForEachAttribute(7, 2, [](AttributeId, const CachedAttributeState &) {
+        return CHIP_NO_ERROR;
+    }) == CHIP_ERROR_KEY_NOT_FOUND);
+
+    size_t clusterCount = 0;
+    NL_TEST_ASSERT(apSuite, storage.ForEachCluster(2, [&clusterCount](ClusterId) {
+        clusterCount++;
+        return CHIP_NO_ERROR;
+    }) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, clusterCount == 3);
+
+    CachedAttributeState state;
+    NL_TEST_ASSERT(apSuite, storage.GetAttribute(ConcreteAttributePath(7, 1, 0), state) == CHIP_ERROR_KEY_NOT_FOUND);
+
+    // The data size covers exactly the values of the remaining clusters.
+    size_t dataSize = 0;
+    storage.RemoveCluster(2, 1);
+    storage.RemoveCluster(7, 1);
+    err = storage.ForEachCluster([&](EndpointId endpointId, ClusterId clusterId, const CachedClusterInfo &) {
+        return storage.ForEachAttribute(endpointId, clusterId,
+                                        [&dataSize](AttributeId, const CachedAttributeState & attributeState) {
+                                            dataSize += attributeState.IsStatus() ? 0 : attributeState.GetData().size();
+                                            return CHIP_NO_ERROR;
+                                        });
+    });
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, dataSize == storage.GetAttributeDataSize());
+    NL_TEST_ASSERT(apSuite, storage.FindCluster(2, 1) == nullptr);
+    NL_TEST_ASSERT(apSuite, storage.HasEndpoint(2));
+    NL_TEST_ASSERT(apSuite, !storage.HasEndpoint(7));
+    NL_TEST_ASSERT(apSuite, storage.GetAttribute(ConcreteAttributePath(2, 1, 0), state) == CHIP_ERROR_KEY_NOT_FOUND);
+}
+
+void TestStorageBackends(nlTestSuite * apSuite, void * apContext)
+{
+    MapClusterStateStorage mapStorage;
+    FlatClusterStateStorage flatStorage;
+    uint64_t mapChecksum  = 0;
+    uint64_t flatChecksum = 0;
+
+    RunStorageSequence(apSuite, mapStorage, mapChecksum);
+    RunStorageSequence(apSuite, flatStorage, flatChecksum);
+
+    // Both storages must end up with the same state.
+    NL_TEST_ASSERT(apSuite, mapChecksum == flatChecksum);
+}
+
+// Populate kBenchmarkNodes storages as a controller caching the state of many nodes would, then look up every attribute.
+template <class Storage>
+void RunStorageBenchmark(nlTestSuite * apSuite, const char * name)
+{
+    static constexpr size_t kBenchmarkNodes    = 200;
+    static constexpr EndpointId kEndpoints     = 4;
+    static constexpr ClusterId kClusters       = 8;
+    static constexpr AttributeId kAttributes   = 16;
+    static constexpr size_t kLookupRepetitions = 10;
+    static const uint8_t kOctetString[]        = { 'h', 'e', 'l', 'l', 'o', ' ', 'w', 'o', 'r', 'l', 'd' };
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    const size_t heapBefore = mallinfo2().uordblks;
+#endif
+    const System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+
+    std::vector<Storage> nodes(kBenchmarkNodes);
+    for (auto & node : nodes)
+    {
+        for (EndpointId endpoint = 0; endpoint < kEndpoints; endpoint++)
+        {
+            for (ClusterId cluster = 0; cluster < kClusters; cluster++)
+            {
+                node.GetOrAddCluster(endpoint, cluster).mCommittedDataVersion.SetValue(1);
+                for (AttributeId attribute = 0; attribute < kAttributes; attribute++)
+                {
+                    const ConcreteAttributePath path(endpoint, cluster, attribute);
+                    CHIP_ERROR err = (attribute % 4 == 0) ? SetStorageValue(node, path, ByteSpan(kOctetString))
+                                                          : SetStorageValue(node, path, attribute);
+                    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+                }
+            }
+        }
+    }
+
+    const System::Clock::Microseconds64 populated = System::SystemClock().GetMonotonicMicroseconds64();
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    const size_t heapUsed = mallinfo2().uordblks - heapBefore;
+#else
+    const size_t heapUsed = 0;
+#endif
+
+    size_t found = 0;
+    for (size_t i = 0; i < kLookupRepetitions; i++)
+    {
+        for (auto & node : nodes)
+        {
+            for (EndpointId endpoint = 0; endpoint < kEndpoints; endpoint++)
+            {
+                for (ClusterId cluster = 0; cluster < kClusters; cluster++)
+                {
+                    for (AttributeId attribute = 0; attribute < kAttributes; attribute++)
+                    {
+                        CachedAttributeState state;
+                        if (node.GetAttribute(ConcreteAttributePath(endpoint, cluster, attribute), state) == CHIP_NO_ERROR)
+                        {
+                            found++;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    const System::Clock::Microseconds64 done = System::SystemClock().GetMonotonicMicroseconds64();
+    NL_TEST_ASSERT(apSuite, found == kLookupRepetitions * kBenchmarkNodes * kEndpoints * kClusters * kAttributes);
+
+    ChipLogProgress(DataManagement,
+                    "%s %u nodes x %u attributes: heap %u bytes, populate %" PRIu64 " us, %u lookups %" PRIu64 " us", name,
+                    static_cast<unsigned>(kBenchmarkNodes), static_cast<unsigned>(kEndpoints * kClusters * kAttributes),
+                    static_cast<unsigned>(heapUsed), (populated - start).count(), static_cast<unsigned>(found),
+                    (done - populated).count());
+}
+
+void BenchmarkStorageBackends(nlTestSuite * apSuite, void * apContext)
+{
+    RunStorageBenchmark<MapClusterStateStorage>(apSuite, "MapClusterStateStorage");
+    RunStorageBenchmark<FlatClusterStateStorage>(apSuite, "FlatClusterStateStorage");
+}
+
 // clang-format off
 const nlTest sTests[] =
 {
     NL_TEST_DEF("TestCache", TestCache),
+    NL_TEST_DEF("TestBoundedCache", TestBoundedCache),
+    NL_TEST_DEF("TestSnapshot", TestSnapshot),
+    NL_TEST_DEF("TestStorageBackends", TestStorageBackends),
+    NL_TEST_DEF("BenchmarkStorageBackends", BenchmarkStorageBackends),
     NL_TEST_SENTINEL()
 };
 
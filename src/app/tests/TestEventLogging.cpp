@@ -307,12 +307,141 @@ static void CheckLogEventWithDiscardLowEvent(nlTestSuite * apSuite, void * apCon
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
     CheckLogState(apSuite, logMgmt, 3, chip::app::PriorityLevel::Debug);
 }
+
+constexpr uint32_t kBenchmarkBufferSize        = 2048;
+constexpr size_t kBenchmarkSubscribers         = 50;
+constexpr size_t kBenchmarkRounds              = 20;
+constexpr chip::EndpointId kBenchmarkEndpoints = 10;
+constexpr chip::FabricIndex kBenchmarkFabric   = 1;
+
+static uint8_t gBenchmarkEventBuffers[3][kBenchmarkBufferSize];
+static chip::app::EventIndexEntry gBenchmarkDebugIndex[kBenchmarkBufferSize / 32];
+static chip::app::EventIndexEntry gBenchmarkInfoIndex[kBenchmarkBufferSize / 32];
+// Too small for all the critical events, so that part of them is fetched without the index.
+static chip::app::EventIndexEntry gBenchmarkCritIndex[kBenchmarkBufferSize / 128];
+static chip::app::CircularEventBuffer gBenchmarkCircularEventBuffer[3];
+static chip::MonotonicallyIncreasingCounter<chip::EventNumber> gBenchmarkEventCounter;
+
+// Fetch the events of one endpoint for each subscriber, and hash what was fetched so that runs can be compared.
+static uint64_t FetchSubscriberEvents(nlTestSuite * apSuite, chip::EventNumber aEventMin, chip::FabricIndex aFabricIndex)
+{
+    uint8_t backingStore[1024];
+    uint64_t checksum = 0;
+    chip::Access::SubjectDescriptor subjectDescriptor;
+    subjectDescriptor.fabricIndex = aFabricIndex;
+
+    for (size_t subscriber = 0; subscriber < kBenchmarkSubscribers; subscriber++)
+    {
+        chip::app::ObjectList<chip::app::EventPathParams> path;
+        path.mValue.mEndpointId = static_cast<chip::EndpointId>(subscriber % kBenchmarkEndpoints);
+        path.mValue.mClusterId  = kLivenessClusterId;
+
+        chip::TLV::TLVWriter writer;
+        chip::EventNumber eventMin = aEventMin;
+        size_t eventCount          = 0;
+        writer.Init(backingStore, sizeof(backingStore));
+        CHIP_ERROR err =
+            chip::app::EventManagement::GetInstance().FetchEventsSince(writer, &path, eventMin, eventCount, subjectDescriptor);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV);
+        checksum = checksum * 31 + eventCount;
+        checksum = checksum * 31 + eventMin;
+        for (uint32_t i = 0; i < writer.GetLengthWritten(); i++)
+        {
+            checksum = checksum * 31 + backingStore[i];
+        }
+    }
+    return checksum;
+}
+
+// Fill all the buffers with events of several endpoints and priorities, then fetch them for many subscribers at once.
+static uint64_t RunFetchEventsBenchmark(nlTestSuite * apSuite, TestContext * apContext, bool aUseIndex)
+{
+    chip::app::LogStorageResources logStorageResources[] = {
+        { gBenchmarkEventBuffers[0], kBenchmarkBufferSize, chip::app::PriorityLevel::Debug },
+        { gBenchmarkEventBuffers[1], kBenchmarkBufferSize, chip::app::PriorityLevel::Info },
+        { gBenchmarkEventBuffers[2], kBenchmarkBufferSize, chip::app::PriorityLevel::Critical },
+    };
+    if (aUseIndex)
+    {
+        logStorageResources[0].mpIndex    = gBenchmarkDebugIndex;
+        logStorageResources[0].mIndexSize = ArraySize(gBenchmarkDebugIndex);
+        logStorageResources[1].mpIndex    = gBenchmarkInfoIndex;
+        logStorageResources[1].mIndexSize = ArraySize(gBenchmarkInfoIndex);
+        logStorageResources[2].mpIndex    = gBenchmarkCritIndex;
+        logStorageResources[2].mIndexSize = ArraySize(gBenchmarkCritIndex);
+    }
+
+    // Log the events at the same times in every run, for their encoding to be the same.
+    chip::System::Clock::Internal::MockClock mockClock;
+    chip::System::Clock::ClockBase * realClock = &chip::System::SystemClock();
+    chip::System::Clock::Internal::SetSystemClockForTesting(&mockClock);
+
+    chip::app::EventManagement::DestroyEventManagement();
+    NL_TEST_ASSERT(apSuite, gBenchmarkEventCounter.Init(0) == CHIP_NO_ERROR);
+    chip::app::EventManagement::CreateEventManagement(&apContext->GetExchangeManager(), ArraySize(logStorageResources),
+                                                      gBenchmarkCircularEventBuffer, logStorageResources, &gBenchmarkEventCounter);
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+
+    const chip::app::PriorityLevel priorities[] = { chip::app::PriorityLevel::Debug, chip::app::PriorityLevel::Info,
+                                                    chip::app::PriorityLevel::Debug, chip::app::PriorityLevel::Critical };
+    TestEventGenerator testEventGenerator;
+    for (uint32_t i = 0; i < 3 * kBenchmarkBufferSize / 8; i++)
+    {
+        chip::app::EventOptions options;
+        chip::EventNumber eventNumber;
+        options.mPath     = { static_cast<chip::EndpointId>(i % kBenchmarkEndpoints), kLivenessClusterId, kLivenessChangeEvent };
+        options.mPriority = priorities[i % ArraySize(priorities)];
+        if (i % 3 == 0)
+        {
+            options.mFabricIndex = kBenchmarkFabric;
+        }
+        testEventGenerator.SetStatus(static_cast<int32_t>(i));
+        NL_TEST_ASSERT(apSuite, logMgmt.LogEvent(&testEventGenerator, options, eventNumber) == CHIP_NO_ERROR);
+        mockClock.AdvanceMonotonic(chip::System::Clock::Milliseconds64(i % 3));
+        mockClock.AdvanceRealTime(chip::System::Clock::Milliseconds64(i % 3));
+    }
+    chip::System::Clock::Internal::SetSystemClockForTesting(realClock);
+
+    // Subscribers catching up from the start, subscribers waiting for the latest events, and one of another fabric.
+    const chip::EventNumber latestEventMin = logMgmt.GetLastEventNumber() - 40;
+    uint64_t checksum                      = FetchSubscriberEvents(apSuite, 0, kBenchmarkFabric);
+    checksum                               = checksum * 31 + FetchSubscriberEvents(apSuite, latestEventMin, kBenchmarkFabric);
+    checksum = checksum * 31 + FetchSubscriberEvents(apSuite, latestEventMin, static_cast<chip::FabricIndex>(kBenchmarkFabric + 1));
+
+    const chip::System::Clock::Microseconds64 start = chip::System::SystemClock().GetMonotonicMicroseconds64();
+    for (size_t round = 0; round < kBenchmarkRounds; round++)
+    {
+        FetchSubscriberEvents(apSuite, latestEventMin, kBenchmarkFabric);
+    }
+    const chip::System::Clock::Microseconds64 done  = chip::System::SystemClock().GetMonotonicMicroseconds64();
+    ChipLogProgress(EventLogging, "%u subscribers, %s event index: %" PRIu64 " us/run",
+                    static_cast<unsigned>(kBenchmarkSubscribers), aUseIndex ? "with" : "without",
+                    (done - start).count() / kBenchmarkRounds);
+
+    NL_TEST_ASSERT(apSuite, logMgmt.FabricRemoved(kBenchmarkFabric) == CHIP_NO_ERROR);
+    checksum = checksum * 31 + FetchSubscriberEvents(apSuite, 0, kBenchmarkFabric);
+
+    chip::app::EventManagement::DestroyEventManagement();
+    return checksum;
+}
+
+static void BenchmarkFetchEventsWithIndex(nlTestSuite * apSuite, void * apContext)
+{
+    auto * ctx = static_cast<TestContext *>(apContext);
+
+    // The index must not change which events are fetched.
+    uint64_t withoutIndex = RunFetchEventsBenchmark(apSuite, ctx, false);
+    uint64_t withIndex    = RunFetchEventsBenchmark(apSuite, ctx, true);
+    NL_TEST_ASSERT(apSuite, withoutIndex == withIndex);
+}
+
 /**
  *   Test Suite. It lists all the test functions.
  */
 
 const nlTest sTests[] = { NL_TEST_DEF("CheckLogEventWithEvictToNextBuffer", CheckLogEventWithEvictToNextBuffer),
-                          NL_TEST_DEF("CheckLogEventWithDiscardLowEvent", CheckLogEventWithDiscardLowEvent), NL_TEST_SENTINEL() };
+                          NL_TEST_DEF("CheckLogEventWithDiscardLowEvent", CheckLogEventWithDiscardLowEvent),
+                          NL_TEST_DEF("BenchmarkFetchEventsWithIndex", BenchmarkFetchEventsWithIndex), NL_TEST_SENTINEL() };
 
 // clang-format off
 nlTestSuite sSuite =
@@ -56,6 +56,15 @@ public:
     static void TestBuildAndSendSingleReportData(nlTestSuite * apSuite, void * apContext);
     static void TestMergeOverlappedAttributePath(nlTestSuite * apSuite, void * apContext);
     static void TestMergeAttributePathWhenDirtySetPoolExhausted(nlTestSuite * apSuite, void * apContext);
+    static void TestIntervalDeadlineScheduling(nlTestSuite * apSuite, void * apContext);
+    static void TestSetDirtyUsesAttributeInterestIndex(nlTestSuite * apSuite, void * apContext);
+#if CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+    //
+    // This measures the cost of encoding the same attributes for 50 subscribers on one endpoint, with and without sharing
+    // the encoded reports between them.
+    //
+    static void BenchmarkSharedReportCache(nlTestSuite * apSuite, void * apContext);
+#endif // CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
 
 private:
     static bool InsertToDirtySet(const AttributePathParams & aPath);
@@ -321,6 +330,213 @@ void TestReportingEngine::TestMergeAttributePathWhenDirtySetPoolExhausted(nlTest
     InteractionModelEngine::GetInstance()->GetReportingEngine().Shutdown();
 }
 
+void TestReportingEngine::TestIntervalDeadlineScheduling(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+    DummyDelegate dummy;
+    TestExchangeDelegate delegate;
+
+    err = InteractionModelEngine::GetInstance()->Init(&ctx.GetExchangeManager(), &ctx.GetFabricTable());
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    Engine & engine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    engine.ResetSchedulerStatistics();
+
+    {
+        app::ReadHandler readHandler1(dummy, ctx.NewExchangeToAlice(&delegate), chip::app::ReadHandler::InteractionType::Read);
+        app::ReadHandler readHandler2(dummy, ctx.NewExchangeToAlice(&delegate), chip::app::ReadHandler::InteractionType::Read);
+        app::ReadHandler readHandler3(dummy, ctx.NewExchangeToAlice(&delegate), chip::app::ReadHandler::InteractionType::Read);
+
+        System::Clock::Timestamp now      = System::SystemClock().GetMonotonicTimestamp();
+        readHandler1.mMinIntervalDeadline = now + System::Clock::Seconds16(3);
+        readHandler2.mMinIntervalDeadline = now + System::Clock::Seconds16(1);
+        readHandler3.mMinIntervalDeadline = now + System::Clock::Seconds16(2);
+        for (ReadHandler * readHandler : { &readHandler1, &readHandler2, &readHandler3 })
+        {
+            readHandler->mFlags.Set(ReadHandler::ReadHandlerFlags::HoldReport);
+            NL_TEST_ASSERT(apSuite, engine.ScheduleIntervalDeadline(*readHandler) == CHIP_NO_ERROR);
+        }
+
+        // The earliest deadline is at the top of the queue.
+        NL_TEST_ASSERT(apSuite, engine.mIntervalQueueSize == 3);
+        NL_TEST_ASSERT(apSuite, engine.mIntervalQueue[0] == &readHandler2);
+        NL_TEST_ASSERT(apSuite, engine.mIntervalTimerDeadline == readHandler2.mMinIntervalDeadline);
+
+        engine.CancelIntervalDeadline(readHandler2);
+        NL_TEST_ASSERT(apSuite, engine.mIntervalQueueSize == 2);
+        NL_TEST_ASSERT(apSuite, engine.mIntervalQueue[0] == &readHandler3);
+
+        // Moving a deadline into the past has it processed on the next pass, which lifts HoldReport.
+        readHandler3.mMinIntervalDeadline = now;
+        NL_TEST_ASSERT(apSuite, engine.ScheduleIntervalDeadline(readHandler3) == CHIP_NO_ERROR);
+        engine.ProcessIntervalDeadlines();
+        NL_TEST_ASSERT(apSuite, !readHandler3.mFlags.Has(ReadHandler::ReadHandlerFlags::HoldReport));
+        NL_TEST_ASSERT(apSuite, readHandler3.mIntervalQueueIndex == ReadHandler::kIntervalNotScheduled);
+        NL_TEST_ASSERT(apSuite, engine.mIntervalQueueSize == 1);
+        NL_TEST_ASSERT(apSuite, engine.mIntervalQueue[0] == &readHandler1);
+        NL_TEST_ASSERT(apSuite, engine.GetSchedulerStatistics().intervalDeadlines == 1);
+    }
+
+    // Destroyed handlers leave the queue and the timer is disarmed.
+    NL_TEST_ASSERT(apSuite, engine.mIntervalQueueSize == 0);
+    NL_TEST_ASSERT(apSuite, engine.mIntervalTimerDeadline == System::Clock::Timestamp::max());
+
+    ctx.DrainAndServiceIO();
+    engine.Shutdown();
+}
+
+void TestReportingEngine::TestSetDirtyUsesAttributeInterestIndex(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+    DummyDelegate dummy;
+    TestExchangeDelegate delegate;
+
+    err = InteractionModelEngine::GetInstance()->Init(&ctx.GetExchangeManager(), &ctx.GetFabricTable());
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    Engine & engine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+
+    {
+        app::ReadHandler readHandler1(dummy, ctx.NewExchangeToAlice(&delegate), chip::app::ReadHandler::InteractionType::Read);
+        app::ReadHandler readHandler2(dummy, ctx.NewExchangeToAlice(&delegate), chip::app::ReadHandler::InteractionType::Read);
+        app::ReadHandler readHandler3(dummy, ctx.NewExchangeToAlice(&delegate), chip::app::ReadHandler::InteractionType::Read);
+
+        AttributePathParams concretePath(kTestEndpointId, kTestClusterId, kTestFieldId1);
+        AttributePathParams wildcardEndpointPath;
+        wildcardEndpointPath.mClusterId = kTestClusterId;
+        AttributePathParams otherClusterPath(kTestEndpointId, kTestClusterId + 1, kTestFieldId1);
+
+        InteractionModelEngine::GetInstance()->PushFrontAttributePathList(readHandler1.mpAttributePathList, concretePath);
+        InteractionModelEngine::GetInstance()->PushFrontAttributePathList(readHandler2.mpAttributePathList, wildcardEndpointPath);
+        InteractionModelEngine::GetInstance()->PushFrontAttributePathList(readHandler3.mpAttributePathList, otherClusterPath);
+        for (ReadHandler * readHandler : { &readHandler1, &readHandler2, &readHandler3 })
+        {
+            NL_TEST_ASSERT(apSuite, engine.IndexAttributePaths(*readHandler) == CHIP_NO_ERROR);
+            readHandler->mState = ReadHandler::HandlerState::GeneratingReports;
+        }
+        NL_TEST_ASSERT(apSuite, engine.mAttributeInterestPool.Allocated() == 3);
+
+        // Re-indexing a handler replaces its entries.
+        NL_TEST_ASSERT(apSuite, engine.IndexAttributePaths(readHandler1) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, engine.mAttributeInterestPool.Allocated() == 3);
+
+        // Only the handlers whose paths intersect the change are marked dirty.
+        AttributePathParams changedPath(kTestEndpointId, kTestClusterId, kTestFieldId1);
+        NL_TEST_ASSERT(apSuite, engine.SetDirty(changedPath) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, readHandler1.IsDirty());
+        NL_TEST_ASSERT(apSuite, readHandler2.IsDirty());
+        NL_TEST_ASSERT(apSuite, !readHandler3.IsDirty());
+
+        // A change to a wildcard cluster reaches every handler on the endpoint.
+        AttributePathParams changedEndpoint(kTestEndpointId, kInvalidClusterId, kInvalidAttributeId);
+        NL_TEST_ASSERT(apSuite, engine.SetDirty(changedEndpoint) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, readHandler3.IsDirty());
+    }
+
+    // Destroyed handlers are removed from the index.
+    NL_TEST_ASSERT(apSuite, engine.mAttributeInterestPool.Allocated() == 0);
+
+    ctx.DrainAndServiceIO();
+    engine.Shutdown();
+}
+
+#if CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+void TestReportingEngine::BenchmarkSharedReportCache(nlTestSuite * apSuite, void * apContext)
+{
+    static constexpr size_t kSubscribers     = 50;
+    static constexpr AttributeId kAttributes = 8;
+    static constexpr size_t kRounds          = 100;
+
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = InteractionModelEngine::GetInstance()->Init(&ctx.GetExchangeManager(), &ctx.GetFabricTable());
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    Engine & engine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    engine.ResetReportCacheStatistics();
+
+    Access::SubjectDescriptor subjects[kSubscribers];
+    for (size_t i = 0; i < kSubscribers; i++)
+    {
+        subjects[i].fabricIndex = 1;
+        subjects[i].authMode    = Access::AuthMode::kCase;
+        subjects[i].subject     = 0x1000 + i;
+    }
+
+    uint8_t buffer[1024];
+    size_t encodedLength = 0;
+    auto encodeReports   = [&](const Access::SubjectDescriptor & subject, bool shared) {
+        TLV::TLVWriter writer;
+        AttributeReportIBs::Builder attributeReportIBs;
+        writer.Init(buffer);
+        NL_TEST_ASSERT(apSuite, attributeReportIBs.Init(&writer) == CHIP_NO_ERROR);
+        for (AttributeId attributeId = 1; attributeId <= kAttributes; attributeId++)
+        {
+            ConcreteReadAttributePath path(kTestEndpointId, kTestClusterId, attributeId);
+            AttributeValueEncoder::AttributeEncodeState encodeState;
+            bool encoded = false;
+            if (shared)
+            {
+                NL_TEST_ASSERT(apSuite,
+                               engine.RetrieveCachedClusterData(subject, false, attributeReportIBs, path, encoded) == CHIP_NO_ERROR);
+                NL_TEST_ASSERT(apSuite, encoded);
+            }
+            else
+            {
+                NL_TEST_ASSERT(apSuite,
+                               engine.RetrieveClusterData(subject, false, attributeReportIBs, path, &encodeState) == CHIP_NO_ERROR);
+            }
+        }
+        attributeReportIBs.EndOfAttributeReportIBs();
+        NL_TEST_ASSERT(apSuite, writer.Finalize() == CHIP_NO_ERROR);
+        encodedLength = writer.GetLengthWritten();
+    };
+
+    // Shared encodings are identical to the ones each subscriber would get on its own.
+    encodeReports(subjects[0], false);
+    uint8_t expected[sizeof(buffer)];
+    size_t expectedLength = encodedLength;
+    memcpy(expected, buffer, expectedLength);
+    engine.mReportCache.Clear();
+    for (auto & subject : subjects)
+    {
+        encodeReports(subject, true);
+        NL_TEST_ASSERT(apSuite, encodedLength == expectedLength && memcmp(buffer, expected, expectedLength) == 0);
+    }
+    NL_TEST_ASSERT(apSuite, engine.GetReportCacheStatistics().misses == kAttributes);
+    NL_TEST_ASSERT(apSuite, engine.GetReportCacheStatistics().hits == (kSubscribers - 1) * kAttributes);
+    NL_TEST_ASSERT(apSuite, engine.GetReportCacheStatistics().uncacheable == 0);
+
+    const System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+    for (size_t round = 0; round < kRounds; round++)
+    {
+        for (auto & subject : subjects)
+        {
+            encodeReports(subject, false);
+        }
+    }
+    const System::Clock::Microseconds64 encodeDone = System::SystemClock().GetMonotonicMicroseconds64();
+    for (size_t round = 0; round < kRounds; round++)
+    {
+        // Every run of the engine starts with an empty cache.
+        engine.mReportCache.Clear();
+        for (auto & subject : subjects)
+        {
+            encodeReports(subject, true);
+        }
+    }
+    const System::Clock::Microseconds64 sharedDone = System::SystemClock().GetMonotonicMicroseconds64();
+
+    printf("%zu subscribers x %u attributes: encoded per subscriber %7.1f us/run, shared %7.1f us/run\n", kSubscribers,
+           static_cast<unsigned>(kAttributes), static_cast<double>((encodeDone - start).count()) / kRounds,
+           static_cast<double>((sharedDone - encodeDone).count()) / kRounds);
+
+    engine.mReportCache.Clear();
+    engine.Shutdown();
+}
+#endif // CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+
 } // namespace reporting
 } // namespace app
 } // namespace chip
@@ -332,6 +548,11 @@ const nlTest sTests[] =
     NL_TEST_DEF("CheckBuildAndSendSingleReportData", chip::app::reporting::TestReportingEngine::TestBuildAndSendSingleReportData),
     NL_TEST_DEF("TestMergeOverlappedAttributePath", chip::app::reporting::TestReportingEngine::TestMergeOverlappedAttributePath),
     NL_TEST_DEF("TestMergeAttributePathWhenDirtySetPoolExhausted", chip::app::reporting::TestReportingEngine::TestMergeAttributePathWhenDirtySetPoolExhausted),
+    NL_TEST_DEF("TestIntervalDeadlineScheduling", chip::app::reporting::TestReportingEngine::TestIntervalDeadlineScheduling),
+    NL_TEST_DEF("TestSetDirtyUsesAttributeInterestIndex", chip::app::reporting::TestReportingEngine::TestSetDirtyUsesAttributeInterestIndex),
+#if CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
+    NL_TEST_DEF("BenchmarkSharedReportCache", chip::app::reporting::TestReportingEngine::BenchmarkSharedReportCache),
+#endif // CHIP_IM_SERVER_REPORT_CACHE_SIZE > 0
     NL_TEST_SENTINEL()
 };
 // clang-format on
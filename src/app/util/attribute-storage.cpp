@@ -66,6 +66,13 @@ uint8_t singletonAttributeData[ACTUAL_SINGLETONS_SIZE];
 
 uint16_t emberEndpointCount = 0;
 
+// Indices into emAfEndpoints of the endpoints with a valid endpoint id, ordered
+// by endpoint id and then by index, so that the index of an endpoint is found
+// with a binary search rather than a scan of all (possibly hundreds of dynamic)
+// endpoints.  Enabling or disabling an endpoint does not change the order.
+uint16_t sortedEndpointIndices[MAX_ENDPOINT_COUNT];
+uint16_t sortedEndpointCount = 0;
+
 // If we have attributes that are more than 4 bytes, then
 // we need this data block for the defaults
 #if (defined(GENERATED_DEFAULTS) && GENERATED_DEFAULTS_COUNT)
@@ -127,6 +134,14 @@ app::AttributeAccessInterface * gAttributeAccessOverrides = nullptr;
 // Returns endpoint index within a given cluster
 static uint16_t findClusterEndpointIndex(EndpointId endpoint, ClusterId clusterId, uint8_t mask);
 
+// Maintain sortedEndpointIndices for the endpoint at the given index of emAfEndpoints.
+static void addToEndpointIndex(uint16_t index);
+static void removeFromEndpointIndex(uint16_t index);
+
+// Returns the position in sortedEndpointIndices of the first index with the given endpoint id, or of the first index with a
+// larger endpoint id if there is none.
+static uint16_t findFirstSortedEndpointPosition(EndpointId endpoint);
+
 //------------------------------------------------------------------------------
 
 // Initial configuration
@@ -158,6 +173,7 @@ void emberAfEndpointConfigure()
 #endif // ZAP_FIXED_ENDPOINT_DATA_VERSION_COUNT > 0
 
     emberEndpointCount                = FIXED_ENDPOINT_COUNT;
+    sortedEndpointCount               = 0;
     DataVersion * currentDataVersions = fixedEndpointDataVersions;
     for (ep = 0; ep < FIXED_ENDPOINT_COUNT; ep++)
     {
@@ -166,6 +182,7 @@ void emberAfEndpointConfigure()
         emAfEndpoints[ep].endpointType   = endpointTypeMacro(ep);
         emAfEndpoints[ep].dataVersions   = currentDataVersions;
         emAfEndpoints[ep].bitmask        = EMBER_AF_ENDPOINT_ENABLED;
+        addToEndpointIndex(ep);
 
         // Increment currentDataVersions by 1 (slot) for every server cluster
         // this endpoint has.
@@ -198,10 +215,14 @@ uint16_t emberAfGetDynamicIndexFromEndpoint(EndpointId id)
         return kEmberInvalidEndpointIndex;
     }
 
-    uint16_t index;
-    for (index = FIXED_ENDPOINT_COUNT; index < MAX_ENDPOINT_COUNT; index++)
+    for (uint16_t pos = findFirstSortedEndpointPosition(id); pos < sortedEndpointCount; pos++)
     {
-        if (emAfEndpoints[index].endpoint == id)
+        uint16_t index = sortedEndpointIndices[pos];
+        if (emAfEndpoints[index].endpoint != id)
+        {
+            break;
+        }
+        if (index >= FIXED_ENDPOINT_COUNT)
         {
             return static_cast<uint8_t>(index - FIXED_ENDPOINT_COUNT);
         }
@@ -231,14 +252,15 @@ EmberAfStatus emberAfSetDynamicEndpoint(uint16_t index, EndpointId id, const Emb
     }
 
     index = static_cast<uint16_t>(realIndex);
-    for (uint16_t i = FIXED_ENDPOINT_COUNT; i < MAX_ENDPOINT_COUNT; i++)
+    if (emberAfGetDynamicIndexFromEndpoint(id) != kEmberInvalidEndpointIndex)
     {
-        if (emAfEndpoints[i].endpoint == id)
-        {
-            return EMBER_ZCL_STATUS_DUPLICATE_EXISTS;
-        }
+        return EMBER_ZCL_STATUS_DUPLICATE_EXISTS;
     }
 
+    if (emAfEndpoints[index].endpoint != kInvalidEndpointId)
+    {
+        removeFromEndpointIndex(index);
+    }
     emAfEndpoints[index].endpoint       = id;
     emAfEndpoints[index].deviceTypeList = deviceTypeList;
     emAfEndpoints[index].endpointType   = ep;
@@ -246,6 +268,7 @@ EmberAfStatus emberAfSetDynamicEndpoint(uint16_t index, EndpointId id, const Emb
     // Start the endpoint off as disabled.
     emAfEndpoints[index].bitmask          = EMBER_AF_ENDPOINT_DISABLED;
     emAfEndpoints[index].parentEndpointId = parentEndpointId;
+    addToEndpointIndex(index);
 
     emberAfSetDynamicEndpointCount(MAX_ENDPOINT_COUNT - FIXED_ENDPOINT_COUNT);
 
@@ -277,6 +300,7 @@ EndpointId emberAfClearDynamicEndpoint(uint16_t index)
     {
         ep = emAfEndpoints[index].endpoint;
         emberAfEndpointEnableDisable(ep, false);
+        removeFromEndpointIndex(index);
         emAfEndpoints[index].endpoint = kInvalidEndpointId;
     }
 
@@ -567,117 +591,109 @@ EmberAfStatus emAfReadOrWriteAttribute(EmberAfAttributeSearchRecord * attRecord,
 {
     assertChipStackLockedByCurrentThread();
 
-    uint16_t attributeOffsetIndex = 0;
+    uint16_t ep = emberAfIndexFromEndpoint(attRecord->endpoint);
+    if (ep == kEmberInvalidEndpointIndex)
+    {
+        return EMBER_ZCL_STATUS_UNSUPPORTED_ENDPOINT; // Sorry, endpoint was not found.
+    }
+
+    // Is this a dynamic endpoint?
+    bool isDynamicEndpoint = (ep >= emberAfFixedEndpointCount());
 
-    for (uint16_t ep = 0; ep < emberAfEndpointCount(); ep++)
+    // Attributes of fixed endpoints are stored after those of the preceding fixed endpoints.
+    // Dynamic endpoints are external and don't factor into storage size
+    uint16_t attributeOffsetIndex = 0;
+    for (uint16_t i = 0; i < ep && !isDynamicEndpoint; i++)
     {
-        // Is this a dynamic endpoint?
-        bool isDynamicEndpoint = (ep >= emberAfFixedEndpointCount());
+        attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emAfEndpoints[i].endpointType->endpointSize);
+    }
 
-        if (emAfEndpoints[ep].endpoint == attRecord->endpoint)
-        {
-            const EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
-            uint8_t clusterIndex;
-            if (!emberAfEndpointIndexIsEnabled(ep))
-            {
-                continue;
-            }
-            for (clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+    const EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
+    uint8_t clusterIndex;
+    for (clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+    {
+        const EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
+        if (emAfMatchCluster(cluster, attRecord))
+        { // Got the cluster
+            uint16_t attrIndex;
+            for (attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
             {
-                const EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
-                if (emAfMatchCluster(cluster, attRecord))
-                { // Got the cluster
-                    uint16_t attrIndex;
-                    for (attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
+                const EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
+                if (emAfMatchAttribute(cluster, am, attRecord))
+                { // Got the attribute
+                    // If passed metadata location is not null, populate
+                    if (metadata != nullptr)
                     {
-                        const EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
-                        if (emAfMatchAttribute(cluster, am, attRecord))
-                        { // Got the attribute
-                            // If passed metadata location is not null, populate
-                            if (metadata != nullptr)
-                            {
-                                *metadata = am;
-                            }
+                        *metadata = am;
+                    }
 
+                    {
+                        uint8_t * attributeLocation =
+                            (am->mask & ATTRIBUTE_MASK_SINGLETON ? singletonAttributeLocation(am)
+                                                                 : attributeData + attributeOffsetIndex);
+                        uint8_t *src, *dst;
+                        if (write)
+                        {
+                            src = buffer;
+                            dst = attributeLocation;
+                            if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId, am->attributeId))
                             {
-                                uint8_t * attributeLocation =
-                                    (am->mask & ATTRIBUTE_MASK_SINGLETON ? singletonAttributeLocation(am)
-                                                                         : attributeData + attributeOffsetIndex);
-                                uint8_t *src, *dst;
-                                if (write)
-                                {
-                                    src = buffer;
-                                    dst = attributeLocation;
-                                    if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                             am->attributeId))
-                                    {
-                                        return EMBER_ZCL_STATUS_UNSUPPORTED_ACCESS;
-                                    }
-                                }
-                                else
-                                {
-                                    if (buffer == nullptr)
-                                    {
-                                        return EMBER_ZCL_STATUS_SUCCESS;
-                                    }
-
-                                    src = attributeLocation;
-                                    dst = buffer;
-                                    if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                            am->attributeId))
-                                    {
-                                        return EMBER_ZCL_STATUS_UNSUPPORTED_ACCESS;
-                                    }
-                                }
-
-                                // Is the attribute externally stored?
-                                if (am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE)
-                                {
-                                    return (write ? emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                                          am, buffer)
-                                                  : emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                                         am, buffer, emberAfAttributeSize(am)));
-                                }
-
-                                // Internal storage is only supported for fixed endpoints
-                                if (!isDynamicEndpoint)
-                                {
-                                    return typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength);
-                                }
-
-                                return EMBER_ZCL_STATUS_FAILURE;
+                                return EMBER_ZCL_STATUS_UNSUPPORTED_ACCESS;
                             }
                         }
                         else
-                        { // Not the attribute we are looking for
-                            // Increase the index if attribute is not externally stored
-                            if (!(am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE) && !(am->mask & ATTRIBUTE_MASK_SINGLETON))
+                        {
+                            if (buffer == nullptr)
                             {
-                                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emberAfAttributeSize(am));
+                                return EMBER_ZCL_STATUS_SUCCESS;
+                            }
+
+                            src = attributeLocation;
+                            dst = buffer;
+                            if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId, am->attributeId))
+                            {
+                                return EMBER_ZCL_STATUS_UNSUPPORTED_ACCESS;
                             }
                         }
-                    }
 
-                    // Attribute is not in the cluster.
-                    return EMBER_ZCL_STATUS_UNSUPPORTED_ATTRIBUTE;
-                }
+                        // Is the attribute externally stored?
+                        if (am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE)
+                        {
+                            return (write ? emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId, am,
+                                                                                  buffer)
+                                          : emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId, am,
+                                                                                 buffer, emberAfAttributeSize(am)));
+                        }
+
+                        // Internal storage is only supported for fixed endpoints
+                        if (!isDynamicEndpoint)
+                        {
+                            return typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength);
+                        }
 
-                // Not the cluster we are looking for
-                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + cluster->clusterSize);
+                        return EMBER_ZCL_STATUS_FAILURE;
+                    }
+                }
+                else
+                { // Not the attribute we are looking for
+                    // Increase the index if attribute is not externally stored
+                    if (!(am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE) && !(am->mask & ATTRIBUTE_MASK_SINGLETON))
+                    {
+                        attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emberAfAttributeSize(am));
+                    }
+                }
             }
 
-            // Cluster is not in the endpoint.
-            return EMBER_ZCL_STATUS_UNSUPPORTED_CLUSTER;
+            // Attribute is not in the cluster.
+            return EMBER_ZCL_STATUS_UNSUPPORTED_ATTRIBUTE;
         }
 
-        // Not the endpoint we are looking for
-        // Dynamic endpoints are external and don't factor into storage size
-        if (!isDynamicEndpoint)
-        {
-            attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emAfEndpoints[ep].endpointType->endpointSize);
-        }
+        // Not the cluster we are looking for
+        attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + cluster->clusterSize);
     }
-    return EMBER_ZCL_STATUS_UNSUPPORTED_ENDPOINT; // Sorry, endpoint was not found.
+
+    // Cluster is not in the endpoint.
+    return EMBER_ZCL_STATUS_UNSUPPORTED_CLUSTER;
 }
 
 const EmberAfEndpointType * emberAfFindEndpointType(chip::EndpointId endpointId)
@@ -722,18 +738,30 @@ const EmberAfCluster * emberAfFindClusterInType(const EmberAfEndpointType * endp
 
 uint8_t emberAfClusterIndex(EndpointId endpoint, ClusterId clusterId, EmberAfClusterMask mask)
 {
-    for (uint16_t ep = 0; ep < emberAfEndpointCount(); ep++)
+    if (endpoint == kInvalidEndpointId)
     {
-        // Check the endpoint id first, because that way we avoid examining the
-        // endpoint type for endpoints that are not actually defined.
-        if (emAfEndpoints[ep].endpoint == endpoint)
+        return 0xFF;
+    }
+
+    // Only endpoints with the endpoint id are visited, because that way we avoid
+    // examining the endpoint type for endpoints that are not actually defined.
+    for (uint16_t pos = findFirstSortedEndpointPosition(endpoint); pos < sortedEndpointCount; pos++)
+    {
+        uint16_t ep = sortedEndpointIndices[pos];
+        if (emAfEndpoints[ep].endpoint != endpoint)
         {
-            const EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
-            uint8_t index                            = 0xFF;
-            if (emberAfFindClusterInType(endpointType, clusterId, mask, &index) != nullptr)
-            {
-                return index;
-            }
+            break;
+        }
+        if (ep >= emberAfEndpointCount())
+        {
+            continue;
+        }
+
+        const EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
+        uint8_t index                            = 0xFF;
+        if (emberAfFindClusterInType(endpointType, clusterId, mask, &index) != nullptr)
+        {
+            return index;
         }
     }
     return 0xFF;
@@ -866,11 +894,15 @@ static uint16_t findIndexFromEndpoint(EndpointId endpoint, bool ignoreDisabledEn
         return kEmberInvalidEndpointIndex;
     }
 
-    uint16_t epi;
-    for (epi = 0; epi < emberAfEndpointCount(); epi++)
+    // Indices with the same endpoint id are sorted, so the first acceptable one is the lowest.
+    for (uint16_t pos = findFirstSortedEndpointPosition(endpoint); pos < sortedEndpointCount; pos++)
     {
-        if (emAfEndpoints[epi].endpoint == endpoint &&
-            (!ignoreDisabledEndpoints || emAfEndpoints[epi].bitmask & EMBER_AF_ENDPOINT_ENABLED))
+        uint16_t epi = sortedEndpointIndices[pos];
+        if (emAfEndpoints[epi].endpoint != endpoint)
+        {
+            break;
+        }
+        if (epi < emberAfEndpointCount() && (!ignoreDisabledEndpoints || emAfEndpoints[epi].bitmask & EMBER_AF_ENDPOINT_ENABLED))
         {
             return epi;
         }
@@ -878,6 +910,57 @@ static uint16_t findIndexFromEndpoint(EndpointId endpoint, bool ignoreDisabledEn
     return kEmberInvalidEndpointIndex;
 }
 
+static bool endpointSortsBefore(uint16_t index, EndpointId endpoint, uint16_t otherIndex)
+{
+    EndpointId otherEndpoint = emAfEndpoints[otherIndex].endpoint;
+    return (endpoint < otherEndpoint) || (endpoint == otherEndpoint && index < otherIndex);
+}
+
+static uint16_t findFirstSortedEndpointPosition(EndpointId endpoint)
+{
+    uint16_t low  = 0;
+    uint16_t high = sortedEndpointCount;
+    while (low < high)
+    {
+        uint16_t mid = static_cast<uint16_t>(low + (high - low) / 2);
+        if (emAfEndpoints[sortedEndpointIndices[mid]].endpoint < endpoint)
+        {
+            low = static_cast<uint16_t>(mid + 1);
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+static void addToEndpointIndex(uint16_t index)
+{
+    EndpointId endpoint = emAfEndpoints[index].endpoint;
+    uint16_t pos        = sortedEndpointCount;
+    for (; pos > 0 && endpointSortsBefore(index, endpoint, sortedEndpointIndices[pos - 1]); pos--)
+    {
+        sortedEndpointIndices[pos] = sortedEndpointIndices[pos - 1];
+    }
+    sortedEndpointIndices[pos] = index;
+    sortedEndpointCount++;
+}
+
+static void removeFromEndpointIndex(uint16_t index)
+{
+    for (uint16_t pos = findFirstSortedEndpointPosition(emAfEndpoints[index].endpoint); pos < sortedEndpointCount; pos++)
+    {
+        if (sortedEndpointIndices[pos] == index)
+        {
+            memmove(&sortedEndpointIndices[pos], &sortedEndpointIndices[pos + 1],
+                    sizeof(sortedEndpointIndices[0]) * static_cast<size_t>(sortedEndpointCount - pos - 1));
+            sortedEndpointCount--;
+            return;
+        }
+    }
+}
+
 bool emberAfEndpointIsEnabled(EndpointId endpoint)
 {
     uint16_t index = findIndexFromEndpoint(endpoint,
@@ -0,0 +1,230 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Tests the resolution of endpoint ids by attribute-storage as dynamic endpoints are added, removed, re-added,
+ *      enabled and disabled.
+ */
+
+#include <app-common/zap-generated/ids/Attributes.h>
+#include <app-common/zap-generated/ids/Clusters.h>
+#include <app/tests/AppTestContext.h>
+#include <app/util/DataModelHandler.h>
+#include <app/util/af.h>
+#include <app/util/attribute-storage.h>
+#include <lib/support/UnitTestContext.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters;
+
+namespace {
+
+using TestContext = chip::Test::AppContext;
+
+constexpr AttributeId kTestAttributeId = 0x00000001;
+
+// Endpoint ids registered out of order with respect to their dynamic indices.
+constexpr EndpointId kEndpointA = 10;
+constexpr EndpointId kEndpointB = 5;
+constexpr EndpointId kEndpointC = 20;
+
+// Endpoint ids that are never registered, below, between and above the registered ones.
+constexpr EndpointId kMissingEndpoints[] = { 2, 7, 15, 0xFFFE };
+
+DECLARE_DYNAMIC_ATTRIBUTE_LIST_BEGIN(unitTestingAttrs)
+DECLARE_DYNAMIC_ATTRIBUTE(kTestAttributeId, INT8U, 1, 0), DECLARE_DYNAMIC_ATTRIBUTE_LIST_END();
+
+DECLARE_DYNAMIC_ATTRIBUTE_LIST_BEGIN(onOffAttrs)
+DECLARE_DYNAMIC_ATTRIBUTE(OnOff::Attributes::OnOff::Id, BOOLEAN, 1, 0), DECLARE_DYNAMIC_ATTRIBUTE_LIST_END();
+
+DECLARE_DYNAMIC_CLUSTER_LIST_BEGIN(unitTestingClusters)
+DECLARE_DYNAMIC_CLUSTER(UnitTesting::Id, unitTestingAttrs, nullptr, nullptr), DECLARE_DYNAMIC_CLUSTER_LIST_END;
+
+DECLARE_DYNAMIC_CLUSTER_LIST_BEGIN(onOffClusters)
+DECLARE_DYNAMIC_CLUSTER(OnOff::Id, onOffAttrs, nullptr, nullptr),
+    DECLARE_DYNAMIC_CLUSTER(UnitTesting::Id, unitTestingAttrs, nullptr, nullptr), DECLARE_DYNAMIC_CLUSTER_LIST_END;
+
+DECLARE_DYNAMIC_ENDPOINT(unitTestingEndpoint, unitTestingClusters);
+DECLARE_DYNAMIC_ENDPOINT(onOffEndpoint, onOffClusters);
+
+DataVersion dataVersions[CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT][ArraySize(onOffClusters)];
+
+EmberAfStatus SetDynamicEndpoint(uint16_t index, EndpointId id, EmberAfEndpointType & endpointType)
+{
+    return emberAfSetDynamicEndpoint(index, id, &endpointType, Span<DataVersion>(dataVersions[index]));
+}
+
+uint16_t DynamicIndex(uint16_t index)
+{
+    return static_cast<uint16_t>(emberAfFixedEndpointCount() + index);
+}
+
+void CheckEndpointMissing(nlTestSuite * apSuite, EndpointId endpoint)
+{
+    uint8_t value;
+
+    NL_TEST_ASSERT(apSuite, emberAfIndexFromEndpoint(endpoint) == kEmberInvalidEndpointIndex);
+    NL_TEST_ASSERT(apSuite, emberAfIndexFromEndpointIncludingDisabledEndpoints(endpoint) == kEmberInvalidEndpointIndex);
+    NL_TEST_ASSERT(apSuite, emberAfGetDynamicIndexFromEndpoint(endpoint) == kEmberInvalidEndpointIndex);
+    NL_TEST_ASSERT(apSuite, emberAfClusterIndex(endpoint, UnitTesting::Id, CLUSTER_MASK_SERVER) == 0xFF);
+    NL_TEST_ASSERT(apSuite, emberAfFindServerCluster(endpoint, UnitTesting::Id) == nullptr);
+    NL_TEST_ASSERT(apSuite, emberAfLocateAttributeMetadata(endpoint, UnitTesting::Id, kTestAttributeId) == nullptr);
+    NL_TEST_ASSERT(apSuite,
+                   emberAfReadAttribute(endpoint, UnitTesting::Id, kTestAttributeId, &value, sizeof(value)) ==
+                       EMBER_ZCL_STATUS_UNSUPPORTED_ENDPOINT);
+}
+
+void TestAddRemoveEndpoints(nlTestSuite * apSuite, void * apContext)
+{
+    InitDataModelHandler();
+
+    NL_TEST_ASSERT(apSuite, SetDynamicEndpoint(0, kEndpointA, unitTestingEndpoint) == EMBER_ZCL_STATUS_SUCCESS);
+    NL_TEST_ASSERT(apSuite, SetDynamicEndpoint(1, kEndpointB, onOffEndpoint) == EMBER_ZCL_STATUS_SUCCESS);
+    NL_TEST_ASSERT(apSuite, SetDynamicEndpoint(2, kEndpointC, unitTestingEndpoint) == EMBER_ZCL_STATUS_SUCCESS);
+
+    NL_TEST_ASSERT(apSuite, emberAfIndexFromEndpoint(kEndpointA) == DynamicIndex(0));
+    NL_TEST_ASSERT(apSuite, emberAfIndexFromEndpoint(kEndpointB) == DynamicIndex(1));
+    NL_TEST_ASSERT(apSuite, emberAfIndexFromEndpoint(kEndpointC) == DynamicIndex(2));
+    NL_TEST_ASSERT(apSuite, emberAfGetDynamicIndexFromEndpoint(kEndpointB) == 1);
+    NL_TEST_ASSERT(apSuite, emberAfEndpointFromIndex(DynamicIndex(2)) == kEndpointC);
+
+    // Clusters and attributes are looked up in the endpoint type of the endpoint that was found.
+    NL_TEST_ASSERT(apSuite, emberAfClusterIndex(kEndpointA, UnitTesting::Id, CLUSTER_MASK_SERVER) == 0);
+    NL_TEST_ASSERT(apSuite, emberAfClusterIndex(kEndpointA, OnOff::Id, CLUSTER_MASK_SERVER) == 0xFF);
+    NL_TEST_ASSERT(apSuite, emberAfClusterIndex(kEndpointB, UnitTesting::Id, CLUSTER_MASK_SERVER) == 1);
+    NL_TEST_ASSERT(apSuite, emberAfLocateAttributeMetadata(kEndpointB, OnOff::Id, OnOff::Attributes::OnOff::Id) != nullptr);
+    NL_TEST_ASSERT(apSuite, emberAfLocateAttributeMetadata(kEndpointC, OnOff::Id, OnOff::Attributes::OnOff::Id) == nullptr);
+    NL_TEST_ASSERT(apSuite, emberAfLocateAttributeMetadata(kEndpointC, UnitTesting::Id, kTestAttributeId) != nullptr);
+    NL_TEST_ASSERT(apSuite, emberAfLocateAttributeMetadata(kEndpointC, UnitTesting::Id, kTestAttributeId + 1) == nullptr);
+
+    for (EndpointId endpoint : kMissingEndpoints)
+    {
+        CheckEndpointMissing(apSuite, endpoint);
+    }
+    CheckEndpointMissing(apSuite, kInvalidEndpointId);
+
+    // An id can only be used by one dynamic endpoint at a time.
+    NL_TEST_ASSERT(apSuite, SetDynamicEndpoint(3, kEndpointB, unitTestingEndpoint) == EMBER_ZCL_STATUS_DUPLICATE_EXISTS);
+    NL_TEST_ASSERT(apSuite, emberAfIndexFromEndpoint(kEndpointB) == DynamicIndex(1));
+
+    // Removing an endpoint leaves the others where they were.
+    NL_TEST_ASSERT(apSuite, emberAfClearDynamicEndpoint(1) == kEndpointB);
+    CheckEndpointMissing(apSuite, kEndpointB);
+    NL_TEST_ASSERT(apSuite, emberAfIndexFromEndpoint(kEndpointA) == DynamicIndex(0));
+    NL_TEST_ASSERT(apSuite, emberAfIndexFromEndpoint(kEndpointC) == DynamicIndex(2));
+
+    // The id can then be re-added, at another index and with another endpoint type.
+    NL_TEST_ASSERT(apSuite, SetDynamicEndpoint(3, kEndpointB, unitTestingEndpoint) == EMBER_ZCL_STATUS_SUCCESS);
+    NL_TEST_ASSERT(apSuite, emberAfIndexFromEndpoint(kEndpointB) == DynamicIndex(3));
+    NL_TEST_ASSERT(apSuite, emberAfGetDynamicIndexFromEndpoint(kEndpointB) == 3);
+    NL_TEST_ASSERT(apSuite, emberAfClusterIndex(kEndpointB, UnitTesting::Id, CLUSTER_MASK_SERVER) == 0);
+    NL_TEST_ASSERT(apSuite, emberAfClusterIndex(kEndpointB, OnOff::Id, CLUSTER_MASK_SERVER) == 0xFF);
+
+    // Reusing the index of an endpoint for another id replaces it.
+    NL_TEST_ASSERT(apSuite, emberAfClearDynamicEndpoint(0) == kEndpointA);
+    NL_TEST_ASSERT(apSuite, SetDynamicEndpoint(0, kMissingEndpoints[2], onOffEndpoint) == EMBER_ZCL_STATUS_SUCCESS);
+    CheckEndpointMissing(apSuite, kEndpointA);
+    NL_TEST_ASSERT(apSuite, emberAfIndexFromEndpoint(kMissingEndpoints[2]) == DynamicIndex(0));
+    NL_TEST_ASSERT(apSuite, emberAfClusterIndex(kMissingEndpoints[2], OnOff::Id, CLUSTER_MASK_SERVER) == 0);
+
+    NL_TEST_ASSERT(apSuite, emberAfClearDynamicEndpoint(0) == kMissingEndpoints[2]);
+    NL_TEST_ASSERT(apSuite, emberAfClearDynamicEndpoint(2) == kEndpointC);
+    NL_TEST_ASSERT(apSuite, emberAfClearDynamicEndpoint(3) == kEndpointB);
+    CheckEndpointMissing(apSuite, kMissingEndpoints[2]);
+    CheckEndpointMissing(apSuite, kEndpointC);
+    CheckEndpointMissing(apSuite, kEndpointB);
+}
+
+void TestDisabledEndpoints(nlTestSuite * apSuite, void * apContext)
+{
+    InitDataModelHandler();
+
+    NL_TEST_ASSERT(apSuite, SetDynamicEndpoint(0, kEndpointA, unitTestingEndpoint) == EMBER_ZCL_STATUS_SUCCESS);
+    NL_TEST_ASSERT(apSuite, SetDynamicEndpoint(1, kEndpointB, onOffEndpoint) == EMBER_ZCL_STATUS_SUCCESS);
+
+    // A disabled endpoint is only found by the lookups that include disabled endpoints.
+    emberAfEndpointEnableDisable(kEndpointA, false);
+    NL_TEST_ASSERT(apSuite, !emberAfEndpointIsEnabled(kEndpointA));
+    NL_TEST_ASSERT(apSuite, emberAfIndexFromEndpoint(kEndpointA) == kEmberInvalidEndpointIndex);
+    NL_TEST_ASSERT(apSuite, emberAfIndexFromEndpointIncludingDisabledEndpoints(kEndpointA) == DynamicIndex(0));
+    NL_TEST_ASSERT(apSuite, emberAfGetDynamicIndexFromEndpoint(kEndpointA) == 0);
+    NL_TEST_ASSERT(apSuite, emberAfFindServerCluster(kEndpointA, UnitTesting::Id) == nullptr);
+    NL_TEST_ASSERT(apSuite,
+                   emberAfFindClusterIncludingDisabledEndpoints(kEndpointA, UnitTesting::Id, CLUSTER_MASK_SERVER) != nullptr);
+    NL_TEST_ASSERT(apSuite, emberAfLocateAttributeMetadata(kEndpointA, UnitTesting::Id, kTestAttributeId) == nullptr);
+
+    // Other endpoints are not affected.
+    NL_TEST_ASSERT(apSuite, emberAfEndpointIsEnabled(kEndpointB));
+    NL_TEST_ASSERT(apSuite, emberAfIndexFromEndpoint(kEndpointB) == DynamicIndex(1));
+
+    // A disabled endpoint keeps its id, so the id can't be added again.
+    NL_TEST_ASSERT(apSuite, SetDynamicEndpoint(2, kEndpointA, onOffEndpoint) == EMBER_ZCL_STATUS_DUPLICATE_EXISTS);
+
+    emberAfEndpointEnableDisable(kEndpointA, true);
+    NL_TEST_ASSERT(apSuite, emberAfEndpointIsEnabled(kEndpointA));
+    NL_TEST_ASSERT(apSuite, emberAfIndexFromEndpoint(kEndpointA) == DynamicIndex(0));
+    NL_TEST_ASSERT(apSuite, emberAfLocateAttributeMetadata(kEndpointA, UnitTesting::Id, kTestAttributeId) != nullptr);
+
+    NL_TEST_ASSERT(apSuite, emberAfClearDynamicEndpoint(0) == kEndpointA);
+    NL_TEST_ASSERT(apSuite, emberAfClearDynamicEndpoint(1) == kEndpointB);
+    CheckEndpointMissing(apSuite, kEndpointA);
+    CheckEndpointMissing(apSuite, kEndpointB);
+
+    // Fixed endpoints are disabled and enabled the same way.
+    if (emberAfFixedEndpointCount() > 0)
+    {
+        EndpointId fixedEndpoint = emberAfEndpointFromIndex(0);
+        emberAfEndpointEnableDisable(fixedEndpoint, false);
+        NL_TEST_ASSERT(apSuite, emberAfIndexFromEndpoint(fixedEndpoint) == kEmberInvalidEndpointIndex);
+        NL_TEST_ASSERT(apSuite, emberAfIndexFromEndpointIncludingDisabledEndpoints(fixedEndpoint) == 0);
+        NL_TEST_ASSERT(apSuite, emberAfGetDynamicIndexFromEndpoint(fixedEndpoint) == kEmberInvalidEndpointIndex);
+
+        emberAfEndpointEnableDisable(fixedEndpoint, true);
+        NL_TEST_ASSERT(apSuite, emberAfIndexFromEndpoint(fixedEndpoint) == 0);
+    }
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("TestAddRemoveEndpoints", TestAddRemoveEndpoints),
+    NL_TEST_DEF("TestDisabledEndpoints", TestDisabledEndpoints),
+    NL_TEST_SENTINEL()
+};
+
+nlTestSuite sSuite =
+{
+    "TestDynamicEndpoints",
+    &sTests[0],
+    TestContext::Initialize,
+    TestContext::Finalize
+};
+// clang-format on
+
+} // namespace
+
+int TestDynamicEndpoints()
+{
+    return chip::ExecuteTestsWithContext<TestContext>(&sSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestDynamicEndpoints)
@@ -277,6 +277,89 @@ CHIP_ERROR ChipCertificateSet::ValidateCert(const ChipCertificateData * cert, Va
     return ValidateCert(cert, context, 0);
 }
 
+CHIP_ERROR ChipCertificateSet::CheckValidityPeriod(const ChipCertificateData * cert, uint8_t depth,
+                                                   const ValidationContext & context)
+{
+    // Verify NotBefore and NotAfter validity of the certificates.
+    //
+    // See also ASN1ToChipEpochTime().
+    //
+    // X.509/RFC5280 defines the special time 99991231235959Z to mean 'no
+    // well-defined expiration date'.  In CHIP TLV-encoded certificates, this
+    // special value is represented as a CHIP Epoch time value of 0 sec
+    // (2000-01-01 00:00:00 UTC).
+    CertificateValidityResult validityResult;
+    if (context.mEffectiveTime.Is<CurrentChipEpochTime>())
+    {
+        if (context.mEffectiveTime.Get<CurrentChipEpochTime>().count() < cert->mNotBeforeTime)
+        {
+            ChipLogDetail(SecureChannel, "Certificate's mNotBeforeTime (%" PRIu32 ") is after current time (%" PRIu32 ")",
+                          cert->mNotBeforeTime, context.mEffectiveTime.Get<CurrentChipEpochTime>().count());
+            validityResult = CertificateValidityResult::kNotYetValid;
+        }
+        else if (cert->mNotAfterTime != kNullCertTime &&
+                 context.mEffectiveTime.Get<CurrentChipEpochTime>().count() > cert->mNotAfterTime)
+        {
+            ChipLogDetail(SecureChannel, "Certificate's mNotAfterTime (%" PRIu32 ") is before current time (%" PRIu32 ")",
+                          cert->mNotAfterTime, context.mEffectiveTime.Get<CurrentChipEpochTime>().count());
+            validityResult = CertificateValidityResult::kExpired;
+        }
+        else
+        {
+            validityResult = CertificateValidityResult::kValid;
+        }
+    }
+    else if (context.mEffectiveTime.Is<LastKnownGoodChipEpochTime>())
+    {
+        // Last Known Good Time may not be moved forward except at the time of
+        // commissioning or firmware update, so we can't use it to validate
+        // NotBefore.  However, so long as firmware build times are properly
+        // recorded and certificates loaded during commissioning are in fact
+        // valid at the time of commissioning, observing a NotAfter that falls
+        // before Last Known Good Time is a reliable indicator that the
+        // certificate in question is expired.  Check for this.
+        if (cert->mNotAfterTime != 0 && context.mEffectiveTime.Get<LastKnownGoodChipEpochTime>().count() > cert->mNotAfterTime)
+        {
+            ChipLogDetail(SecureChannel, "Certificate's mNotAfterTime (%" PRIu32 ") is before last known good time (%" PRIu32 ")",
+                          cert->mNotAfterTime, context.mEffectiveTime.Get<LastKnownGoodChipEpochTime>().count());
+            validityResult = CertificateValidityResult::kExpiredAtLastKnownGoodTime;
+        }
+        else
+        {
+            validityResult = CertificateValidityResult::kNotExpiredAtLastKnownGoodTime;
+        }
+    }
+    else
+    {
+        validityResult = CertificateValidityResult::kTimeUnknown;
+    }
+
+    if (context.mValidityPolicy != nullptr)
+    {
+        return context.mValidityPolicy->ApplyCertificateValidityPolicy(cert, depth, validityResult);
+    }
+
+    switch (validityResult)
+    {
+    case CertificateValidityResult::kValid:
+    case CertificateValidityResult::kNotExpiredAtLastKnownGoodTime:
+    // By default, we do not enforce certificate validity based upon a Last
+    // Known Good Time source.  However, implementations may always inject a
+    // policy that does enforce based upon this.
+    case CertificateValidityResult::kExpiredAtLastKnownGoodTime:
+    case CertificateValidityResult::kTimeUnknown:
+        break;
+    case CertificateValidityResult::kNotYetValid:
+        return CHIP_ERROR_CERT_NOT_VALID_YET;
+    case CertificateValidityResult::kExpired:
+        return CHIP_ERROR_CERT_EXPIRED;
+    default:
+        return CHIP_ERROR_INTERNAL;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR ChipCertificateSet::FindValidCert(const ChipDN & subjectDN, const CertificateKeyId & subjectKeyId,
                                              ValidationContext & context, const ChipCertificateData ** certData)
 {
@@ -371,87 +454,7 @@ CHIP_ERROR ChipCertificateSet::ValidateCert(const ChipCertificateData * cert, Va
         }
     }
 
-    // Verify NotBefore and NotAfter validity of the certificates.
-    //
-    // See also ASN1ToChipEpochTime().
-    //
-    // X.509/RFC5280 defines the special time 99991231235959Z to mean 'no
-    // well-defined expiration date'.  In CHIP TLV-encoded certificates, this
-    // special value is represented as a CHIP Epoch time value of 0 sec
-    // (2000-01-01 00:00:00 UTC).
-    CertificateValidityResult validityResult;
-    if (context.mEffectiveTime.Is<CurrentChipEpochTime>())
-    {
-        if (context.mEffectiveTime.Get<CurrentChipEpochTime>().count() < cert->mNotBeforeTime)
-        {
-            ChipLogDetail(SecureChannel, "Certificate's mNotBeforeTime (%" PRIu32 ") is after current time (%" PRIu32 ")",
-                          cert->mNotBeforeTime, context.mEffectiveTime.Get<CurrentChipEpochTime>().count());
-            validityResult = CertificateValidityResult::kNotYetValid;
-        }
-        else if (cert->mNotAfterTime != kNullCertTime &&
-                 context.mEffectiveTime.Get<CurrentChipEpochTime>().count() > cert->mNotAfterTime)
-        {
-            ChipLogDetail(SecureChannel, "Certificate's mNotAfterTime (%" PRIu32 ") is before current time (%" PRIu32 ")",
-                          cert->mNotAfterTime, context.mEffectiveTime.Get<CurrentChipEpochTime>().count());
-            validityResult = CertificateValidityResult::kExpired;
-        }
-        else
-        {
-            validityResult = CertificateValidityResult::kValid;
-        }
-    }
-    else if (context.mEffectiveTime.Is<LastKnownGoodChipEpochTime>())
-    {
-        // Last Known Good Time may not be moved forward except at the time of
-        // commissioning or firmware update, so we can't use it to validate
-        // NotBefore.  However, so long as firmware build times are properly
-        // recorded and certificates loaded during commissioning are in fact
-        // valid at the time of commissioning, observing a NotAfter that falls
-        // before Last Known Good Time is a reliable indicator that the
-        // certificate in question is expired.  Check for this.
-        if (cert->mNotAfterTime != 0 && context.mEffectiveTime.Get<LastKnownGoodChipEpochTime>().count() > cert->mNotAfterTime)
-        {
-            ChipLogDetail(SecureChannel, "Certificate's mNotAfterTime (%" PRIu32 ") is before last known good time (%" PRIu32 ")",
-                          cert->mNotAfterTime, context.mEffectiveTime.Get<LastKnownGoodChipEpochTime>().count());
-            validityResult = CertificateValidityResult::kExpiredAtLastKnownGoodTime;
-        }
-        else
-        {
-            validityResult = CertificateValidityResult::kNotExpiredAtLastKnownGoodTime;
-        }
-    }
-    else
-    {
-        validityResult = CertificateValidityResult::kTimeUnknown;
-    }
-
-    if (context.mValidityPolicy != nullptr)
-    {
-        SuccessOrExit(err = context.mValidityPolicy->ApplyCertificateValidityPolicy(cert, depth, validityResult));
-    }
-    else
-    {
-        switch (validityResult)
-        {
-        case CertificateValidityResult::kValid:
-        case CertificateValidityResult::kNotExpiredAtLastKnownGoodTime:
-        // By default, we do not enforce certificate validity based upon a Last
-        // Known Good Time source.  However, implementations may always inject a
-        // policy that does enforce based upon this.
-        case CertificateValidityResult::kExpiredAtLastKnownGoodTime:
-        case CertificateValidityResult::kTimeUnknown:
-            break;
-        case CertificateValidityResult::kNotYetValid:
-            ExitNow(err = CHIP_ERROR_CERT_NOT_VALID_YET);
-            break;
-        case CertificateValidityResult::kExpired:
-            ExitNow(err = CHIP_ERROR_CERT_EXPIRED);
-            break;
-        default:
-            ExitNow(err = CHIP_ERROR_INTERNAL);
-            break;
-        }
-    }
+    SuccessOrExit(err = CheckValidityPeriod(cert, depth, context));
 
     // If the certificate itself is trusted, then it is implicitly valid.  Record this certificate as the trust
     // anchor and return success.
@@ -256,6 +256,21 @@ public:
      **/
     static CHIP_ERROR VerifySignature(const ChipCertificateData * cert, const ChipCertificateData * caCert);
 
+    /**
+     * @brief Check the validity period of a CHIP certificate against the effective time of a validation
+     *        context, and apply the context's validity policy (or the default policy) to the result.
+     *
+     * This is the part of the certificate validation that depends on time, and is what needs to be
+     * re-evaluated when a certificate chain that was already validated is presented again.
+     *
+     * @param cert     Pointer to the CHIP certificate which validity period should be checked.
+     * @param depth    Depth of the certificate in the certificate validation chain, where the leaf is at depth 0.
+     * @param context  Certificate validation context.
+     *
+     * @return Returns a CHIP_ERROR if the certificate is rejected, CHIP_NO_ERROR otherwise
+     **/
+    static CHIP_ERROR CheckValidityPeriod(const ChipCertificateData * cert, uint8_t depth, const ValidationContext & context);
+
 private:
     ChipCertificateData * mCerts; /**< Pointer to an array of certificate data. */
     uint8_t mCertCount;           /**< Number of certificates in mCerts
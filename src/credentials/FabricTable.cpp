@@ -354,7 +354,7 @@ CHIP_ERROR FabricTable::VerifyCredentials(FabricIndex fabricIndex, const ByteSpa
 CHIP_ERROR FabricTable::VerifyCredentials(const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac,
                                           ValidationContext & context, CompressedFabricId & outCompressedFabricId,
                                           FabricId & outFabricId, NodeId & outNodeId, Crypto::P256PublicKey & outNocPubkey,
-                                          Crypto::P256PublicKey * outRootPublicKey)
+                                          Crypto::P256PublicKey * outRootPublicKey, bool chainSignaturesVerified)
 {
     // TODO - Optimize credentials verification logic
     //        The certificate chain construction and verification is a compute and memory intensive operation.
@@ -365,22 +365,44 @@ CHIP_ERROR FabricTable::VerifyCredentials(const ByteSpan & noc, const ByteSpan &
     ChipCertificateSet certificates;
     ReturnErrorOnFailure(certificates.Init(kMaxNumCertsInOpCreds));
 
+    // The TBS hashes are only needed to verify the signatures.
+    BitFlags<CertDecodeFlags> decodeFlags;
+    if (!chainSignaturesVerified)
+    {
+        decodeFlags.Set(CertDecodeFlags::kGenerateTBSHash);
+    }
+
     ReturnErrorOnFailure(certificates.LoadCert(rcac, BitFlags<CertDecodeFlags>(CertDecodeFlags::kIsTrustAnchor)));
 
     if (!icac.empty())
     {
-        ReturnErrorOnFailure(certificates.LoadCert(icac, BitFlags<CertDecodeFlags>(CertDecodeFlags::kGenerateTBSHash)));
+        ReturnErrorOnFailure(certificates.LoadCert(icac, decodeFlags));
     }
 
-    ReturnErrorOnFailure(certificates.LoadCert(noc, BitFlags<CertDecodeFlags>(CertDecodeFlags::kGenerateTBSHash)));
+    ReturnErrorOnFailure(certificates.LoadCert(noc, decodeFlags));
 
-    const ChipDN & nocSubjectDN              = certificates.GetLastCert()[0].mSubjectDN;
-    const CertificateKeyId & nocSubjectKeyId = certificates.GetLastCert()[0].mSubjectKeyId;
+    if (chainSignaturesVerified)
+    {
+        // Only the validity periods may have changed since the chain was verified: check them from
+        // the leaf up, as FindValidCert() would.
+        const uint8_t certCount = certificates.GetCertCount();
+        for (uint8_t depth = 0; depth < certCount; depth++)
+        {
+            const ChipCertificateData & cert = certificates.GetCertSet()[certCount - 1 - depth];
+            ReturnErrorOnFailure(ChipCertificateSet::CheckValidityPeriod(&cert, depth, context));
+        }
+        context.mTrustAnchor = &certificates.GetCertSet()[0];
+    }
+    else
+    {
+        const ChipDN & nocSubjectDN              = certificates.GetLastCert()[0].mSubjectDN;
+        const CertificateKeyId & nocSubjectKeyId = certificates.GetLastCert()[0].mSubjectKeyId;
 
-    const ChipCertificateData * resultCert = nullptr;
-    // FindValidCert() checks the certificate set constructed by loading noc, icac and rcac.
-    // It confirms that the certs link correctly (noc -> icac -> rcac), and have been correctly signed.
-    ReturnErrorOnFailure(certificates.FindValidCert(nocSubjectDN, nocSubjectKeyId, context, &resultCert));
+        const ChipCertificateData * resultCert = nullptr;
+        // FindValidCert() checks the certificate set constructed by loading noc, icac and rcac.
+        // It confirms that the certs link correctly (noc -> icac -> rcac), and have been correctly signed.
+        ReturnErrorOnFailure(certificates.FindValidCert(nocSubjectDN, nocSubjectKeyId, context, &resultCert));
+    }
 
     ReturnErrorOnFailure(ExtractNodeIdFabricIdFromOpCert(certificates.GetLastCert()[0], &outNodeId, &outFabricId));
 
@@ -740,6 +762,8 @@ public:
 
 CHIP_ERROR FabricTable::NotifyFabricUpdated(FabricIndex fabricIndex)
 {
+    mVerifiedCertChainCache.Clear();
+
     FabricTable::Delegate * delegate = mDelegateListRoot;
     while (delegate)
     {
@@ -754,6 +778,8 @@ CHIP_ERROR FabricTable::NotifyFabricUpdated(FabricIndex fabricIndex)
 
 CHIP_ERROR FabricTable::NotifyFabricCommitted(FabricIndex fabricIndex)
 {
+    mVerifiedCertChainCache.Clear();
+
     FabricTable::Delegate * delegate = mDelegateListRoot;
     while (delegate)
     {
@@ -913,6 +939,8 @@ CHIP_ERROR FabricTable::Delete(FabricIndex fabricIndex)
     VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(IsValidFabricIndex(fabricIndex), CHIP_ERROR_INVALID_ARGUMENT);
 
+    mVerifiedCertChainCache.Clear();
+
     {
         FabricTable::Delegate * delegate = mDelegateListRoot;
         while (delegate)
@@ -1590,6 +1618,7 @@ CHIP_ERROR FabricTable::AddNewPendingTrustedRootCert(const ByteSpan & rcac)
     VerifyOrReturnError(IsValidFabricIndex(fabricIndexToUse), CHIP_ERROR_INVALID_FABRIC_INDEX);
     VerifyOrReturnError(SetPendingDataFabricIndex(fabricIndexToUse), CHIP_ERROR_INCORRECT_STATE);
     ReturnErrorOnFailure(mOpCertStore->AddNewTrustedRootCertForFabric(fabricIndexToUse, rcac));
+    mVerifiedCertChainCache.Clear();
 
     mStateFlags.Set(StateFlags::kIsPendingFabricDataPresent);
     mStateFlags.Set(StateFlags::kIsTrustedRootPending);
@@ -1865,6 +1894,9 @@ CHIP_ERROR FabricTable::CommitPendingFabricData()
     }
 
     // ==== Start of actual commit transaction after pre-flight checks ====
+    // Group the storage updates of the commit so that batching storage can apply them atomically.
+    PersistentStorageBatch storageBatch(mStorage);
+
     CHIP_ERROR stickyError  = StoreCommitMarker(CommitMarker{ fabricIndexBeingCommitted, isAdding });
     bool failedCommitMarker = (stickyError != CHIP_NO_ERROR);
     if (failedCommitMarker)
@@ -1994,11 +2026,14 @@ CHIP_ERROR FabricTable::CommitPendingFabricData()
     // did their job.
     ClearCommitMarker();
 
-    return stickyError;
+    CHIP_ERROR batchError = storageBatch.End();
+    return (stickyError != CHIP_NO_ERROR) ? stickyError : batchError;
 }
 
 void FabricTable::RevertPendingFabricData()
 {
+    mVerifiedCertChainCache.Clear();
+
     // Will clear pending UpdateNoc/AddNOC
     RevertPendingOpCertsExceptRoot();
 
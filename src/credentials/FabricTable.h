@@ -29,6 +29,7 @@
 #include <credentials/CertificateValidityPolicy.h>
 #include <credentials/LastKnownGoodTime.h>
 #include <credentials/OperationalCertificateStore.h>
+#include <credentials/VerifiedCertChainCache.h>
 #include <crypto/CHIPCryptoPAL.h>
 #include <crypto/OperationalKeystore.h>
 #include <lib/core/CHIPPersistentStorageDelegate.h>
@@ -919,10 +920,21 @@ public:
                                  Crypto::P256PublicKey * outRootPublicKey = nullptr) const;
 
     // Verifies credentials, using the provided root certificate.
+    //
+    // If chainSignaturesVerified is true, the chain is known to have been verified against the same context
+    // requirements before (see GetVerifiedCertChainCache()), and only the validity periods of the certificates
+    // are checked. This may be called from any thread.
     static CHIP_ERROR VerifyCredentials(const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac,
                                         Credentials::ValidationContext & context, CompressedFabricId & outCompressedFabricId,
                                         FabricId & outFabricId, NodeId & outNodeId, Crypto::P256PublicKey & outNocPubkey,
-                                        Crypto::P256PublicKey * outRootPublicKey = nullptr);
+                                        Crypto::P256PublicKey * outRootPublicKey = nullptr, bool chainSignaturesVerified = false);
+
+    /**
+     * Operational certificate chains recently verified against the trusted roots of this table, which
+     * is cleared whenever a fabric or a trusted root is added, updated or removed. Must only be used
+     * with the Matter stack lock held.
+     */
+    Credentials::VerifiedCertChainCache & GetVerifiedCertChainCache() { return mVerifiedCertChainCache; }
     /**
      * @brief Enables FabricInfo instances to collide and reference the same logical fabric (i.e Root Public Key + FabricId).
      *
@@ -1140,6 +1152,8 @@ private:
 
     LastKnownGoodTime mLastKnownGoodTime;
 
+    Credentials::VerifiedCertChainCache mVerifiedCertChainCache;
+
     // We may not have an mNextAvailableFabricIndex if our table is as large as
     // it can go and is full.
     Optional<FabricIndex> mNextAvailableFabricIndex;
@@ -826,6 +826,7 @@ CHIP_ERROR GroupDataProviderImpl::Init()
 
 void GroupDataProviderImpl::Finish()
 {
+    InvalidateSessionIndex();
     mGroupInfoIterators.ReleaseAll();
     mGroupKeyIterators.ReleaseAll();
     mEndpointIterators.ReleaseAll();
@@ -837,9 +838,17 @@ void GroupDataProviderImpl::Finish()
 void GroupDataProviderImpl::SetStorageDelegate(PersistentStorageDelegate * storage)
 {
     VerifyOrDie(storage != nullptr);
+    InvalidateSessionIndex();
     mStorage = storage;
 }
 
+void GroupDataProviderImpl::SetSessionKeystore(Crypto::SessionKeystore * keystore)
+{
+    // The indexed key contexts were derived through the current keystore, release them through it too.
+    InvalidateSessionIndex();
+    mSessionKeystore = keystore;
+}
+
 //
 // Group Info
 //
@@ -895,6 +904,8 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupInfo(chip::FabricIndex fabric_index
 CHIP_ERROR GroupDataProviderImpl::SetGroupInfoAt(chip::FabricIndex fabric_index, size_t index, const GroupInfo & info)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    // Like every update of the linked lists, the records touched here are stored as one batch.
+    PersistentStorageBatch batch(mStorage);
 
     FabricData fabric(fabric_index);
     GroupData group;
@@ -914,7 +925,8 @@ CHIP_ERROR GroupDataProviderImpl::SetGroupInfoAt(chip::FabricIndex fabric_index,
     if (found)
     {
         // Update existing entry
-        return group.Save(mStorage);
+        ReturnErrorOnFailure(group.Save(mStorage));
+        return batch.End();
     }
     if (index < fabric.group_count)
     {
@@ -955,7 +967,7 @@ CHIP_ERROR GroupDataProviderImpl::SetGroupInfoAt(chip::FabricIndex fabric_index,
     // Update fabric
     ReturnErrorOnFailure(fabric.Save(mStorage));
     GroupAdded(fabric_index, group);
-    return CHIP_NO_ERROR;
+    return batch.End();
 }
 
 CHIP_ERROR GroupDataProviderImpl::GetGroupInfoAt(chip::FabricIndex fabric_index, size_t index, GroupInfo & info)
@@ -977,6 +989,7 @@ CHIP_ERROR GroupDataProviderImpl::GetGroupInfoAt(chip::FabricIndex fabric_index,
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupInfoAt(chip::FabricIndex fabric_index, size_t index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    PersistentStorageBatch batch(mStorage);
 
     FabricData fabric(fabric_index);
     GroupData group;
@@ -1018,7 +1031,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupInfoAt(chip::FabricIndex fabric_ind
     // Update fabric info
     ReturnErrorOnFailure(fabric.Save(mStorage));
     GroupRemoved(fabric_index, group);
-    return CHIP_NO_ERROR;
+    return batch.End();
 }
 
 bool GroupDataProviderImpl::HasEndpoint(chip::FabricIndex fabric_index, chip::GroupId group_id, chip::EndpointId endpoint_id)
@@ -1037,6 +1050,7 @@ bool GroupDataProviderImpl::HasEndpoint(chip::FabricIndex fabric_index, chip::Gr
 CHIP_ERROR GroupDataProviderImpl::AddEndpoint(chip::FabricIndex fabric_index, chip::GroupId group_id, chip::EndpointId endpoint_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    PersistentStorageBatch batch(mStorage);
 
     FabricData fabric(fabric_index);
     GroupData group;
@@ -1063,7 +1077,7 @@ CHIP_ERROR GroupDataProviderImpl::AddEndpoint(chip::FabricIndex fabric_index, ch
         fabric.group_count++;
         ReturnErrorOnFailure(fabric.Save(mStorage));
         GroupAdded(fabric_index, group);
-        return CHIP_NO_ERROR;
+        return batch.End();
     }
 
     // Existing group
@@ -1088,13 +1102,15 @@ CHIP_ERROR GroupDataProviderImpl::AddEndpoint(chip::FabricIndex fabric_index, ch
         ReturnErrorOnFailure(prev.Save(mStorage));
     }
     group.endpoint_count++;
-    return group.Save(mStorage);
+    ReturnErrorOnFailure(group.Save(mStorage));
+    return batch.End();
 }
 
 CHIP_ERROR GroupDataProviderImpl::RemoveEndpoint(chip::FabricIndex fabric_index, chip::GroupId group_id,
                                                  chip::EndpointId endpoint_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    PersistentStorageBatch batch(mStorage);
 
     FabricData fabric(fabric_index);
     GroupData group;
@@ -1124,16 +1140,19 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoint(chip::FabricIndex fabric_index,
     if (group.endpoint_count > 1)
     {
         group.endpoint_count--;
-        return group.Save(mStorage);
+        ReturnErrorOnFailure(group.Save(mStorage));
+        return batch.End();
     }
 
     // No more endpoints, remove the group
-    return RemoveGroupInfoAt(fabric_index, group.index);
+    ReturnErrorOnFailure(RemoveGroupInfoAt(fabric_index, group.index));
+    return batch.End();
 }
 
 CHIP_ERROR GroupDataProviderImpl::RemoveEndpoint(chip::FabricIndex fabric_index, chip::EndpointId endpoint_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    PersistentStorageBatch batch(mStorage);
 
     FabricData fabric(fabric_index);
 
@@ -1160,7 +1179,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoint(chip::FabricIndex fabric_index,
         group_index++;
     }
 
-    return CHIP_NO_ERROR;
+    return batch.End();
 }
 
 GroupDataProvider::GroupInfoIterator * GroupDataProviderImpl::IterateGroupInfo(chip::FabricIndex fabric_index)
@@ -1319,6 +1338,7 @@ void GroupDataProviderImpl::EndpointIteratorImpl::Release()
 CHIP_ERROR GroupDataProviderImpl::RemoveEndpoints(chip::FabricIndex fabric_index, chip::GroupId group_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    PersistentStorageBatch batch(mStorage);
 
     FabricData fabric(fabric_index);
     GroupData group;
@@ -1339,7 +1359,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoints(chip::FabricIndex fabric_index
     group.endpoint_count = 0;
     ReturnErrorOnFailure(group.Save(mStorage));
 
-    return CHIP_NO_ERROR;
+    return batch.End();
 }
 
 //
@@ -1349,6 +1369,8 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoints(chip::FabricIndex fabric_index
 CHIP_ERROR GroupDataProviderImpl::SetGroupKeyAt(chip::FabricIndex fabric_index, size_t index, const GroupKey & in_map)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateSessionIndex();
+    PersistentStorageBatch batch(mStorage);
 
     FabricData fabric(fabric_index);
     KeyMapData map(fabric_index);
@@ -1368,7 +1390,8 @@ CHIP_ERROR GroupDataProviderImpl::SetGroupKeyAt(chip::FabricIndex fabric_index,
     if (found)
     {
         // Update existing map
-        return map.Save(mStorage);
+        ReturnErrorOnFailure(map.Save(mStorage));
+        return batch.End();
     }
 
     // Insert last
@@ -1393,7 +1416,8 @@ CHIP_ERROR GroupDataProviderImpl::SetGroupKeyAt(chip::FabricIndex fabric_index,
     }
     // Update fabric
     fabric.map_count++;
-    return fabric.Save(mStorage);
+    ReturnErrorOnFailure(fabric.Save(mStorage));
+    return batch.End();
 }
 
 CHIP_ERROR GroupDataProviderImpl::GetGroupKeyAt(chip::FabricIndex fabric_index, size_t index, GroupKey & out_map)
@@ -1415,6 +1439,8 @@ CHIP_ERROR GroupDataProviderImpl::GetGroupKeyAt(chip::FabricIndex fabric_index,
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_index, size_t index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateSessionIndex();
+    PersistentStorageBatch batch(mStorage);
 
     FabricData fabric(fabric_index);
     KeyMapData map;
@@ -1441,12 +1467,15 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_inde
         fabric.map_count--;
     }
     // Update fabric
-    return fabric.Save(mStorage);
+    ReturnErrorOnFailure(fabric.Save(mStorage));
+    return batch.End();
 }
 
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeys(chip::FabricIndex fabric_index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateSessionIndex();
+    PersistentStorageBatch batch(mStorage);
 
     FabricData fabric(fabric_index);
     VerifyOrReturnError(CHIP_NO_ERROR == fabric.Load(mStorage), CHIP_ERROR_INVALID_FABRIC_INDEX);
@@ -1466,7 +1495,8 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeys(chip::FabricIndex fabric_index
     // Update fabric
     fabric.first_map = 0;
     fabric.map_count = 0;
-    return fabric.Save(mStorage);
+    ReturnErrorOnFailure(fabric.Save(mStorage));
+    return batch.End();
 }
 
 GroupDataProvider::GroupKeyIterator * GroupDataProviderImpl::IterateGroupKeys(chip::FabricIndex fabric_index)
@@ -1523,6 +1553,8 @@ CHIP_ERROR GroupDataProviderImpl::SetKeySet(chip::FabricIndex fabric_index, cons
                                             const KeySet & in_keyset)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateSessionIndex();
+    PersistentStorageBatch batch(mStorage);
 
     FabricData fabric(fabric_index);
     KeySetData keyset;
@@ -1553,7 +1585,8 @@ CHIP_ERROR GroupDataProviderImpl::SetKeySet(chip::FabricIndex fabric_index, cons
     if (found)
     {
         // Update existing keyset info, keep next
-        return keyset.Save(mStorage);
+        ReturnErrorOnFailure(keyset.Save(mStorage));
+        return batch.End();
     }
 
     // New keyset
@@ -1565,7 +1598,8 @@ CHIP_ERROR GroupDataProviderImpl::SetKeySet(chip::FabricIndex fabric_index, cons
     // Update fabric
     fabric.keyset_count++;
     fabric.first_keyset = in_keyset.keyset_id;
-    return fabric.Save(mStorage);
+    ReturnErrorOnFailure(fabric.Save(mStorage));
+    return batch.End();
 }
 
 CHIP_ERROR GroupDataProviderImpl::GetKeySet(chip::FabricIndex fabric_index, uint16_t target_id, KeySet & out_keyset)
@@ -1594,6 +1628,8 @@ CHIP_ERROR GroupDataProviderImpl::GetKeySet(chip::FabricIndex fabric_index, uint
 CHIP_ERROR GroupDataProviderImpl::RemoveKeySet(chip::FabricIndex fabric_index, uint16_t target_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateSessionIndex();
+    PersistentStorageBatch batch(mStorage);
 
     FabricData fabric(fabric_index);
     KeySetData keyset;
@@ -1638,7 +1674,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveKeySet(chip::FabricIndex fabric_index, u
         // open to suggestsions for the correct behavior.
         RemoveGroupKeyAt(fabric_index, idx);
     }
-    return CHIP_NO_ERROR;
+    return batch.End();
 }
 
 GroupDataProvider::KeySetIterator * GroupDataProviderImpl::IterateKeySets(chip::FabricIndex fabric_index)
@@ -1695,6 +1731,9 @@ void GroupDataProviderImpl::KeySetIteratorImpl::Release()
 
 CHIP_ERROR GroupDataProviderImpl::RemoveFabric(chip::FabricIndex fabric_index)
 {
+    InvalidateSessionIndex();
+    PersistentStorageBatch batch(mStorage);
+
     FabricData fabric(fabric_index);
 
     // Fabric data defaults to zero, so if not entry is found, no mappings, or keys are removed
@@ -1734,7 +1773,8 @@ CHIP_ERROR GroupDataProviderImpl::RemoveFabric(chip::FabricIndex fabric_index)
     }
 
     // Remove fabric
-    return fabric.Delete(mStorage);
+    ReturnErrorOnFailure(fabric.Delete(mStorage));
+    return batch.End();
 }
 
 //
@@ -1839,12 +1879,102 @@ CHIP_ERROR GroupDataProviderImpl::GroupKeyContext::PrivacyDecrypt(const ByteSpan
 GroupDataProviderImpl::GroupSessionIterator * GroupDataProviderImpl::IterateGroupSessions(uint16_t session_id)
 {
     VerifyOrReturnError(IsInitialized(), nullptr);
+    UpdateSessionIndex();
     return mGroupSessionsIterator.CreateObject(*this, session_id);
 }
 
+bool GroupDataProviderImpl::UpdateSessionIndex()
+{
+    if (SessionIndexState::kStale == mSessionIndexState)
+    {
+        CHIP_ERROR err = BuildSessionIndex();
+        if (CHIP_NO_ERROR == err)
+        {
+            mSessionIndexState = SessionIndexState::kValid;
+        }
+        else
+        {
+            ChipLogError(Crypto, "Group session index unavailable, using storage: %" CHIP_ERROR_FORMAT, err.Format());
+            InvalidateSessionIndex();
+            mSessionIndexState = SessionIndexState::kUnavailable;
+        }
+    }
+    return SessionIndexState::kValid == mSessionIndexState;
+}
+
+CHIP_ERROR GroupDataProviderImpl::BuildSessionIndex()
+{
+    FabricList fabric_list;
+    CHIP_ERROR err = fabric_list.Load(mStorage);
+    // No fabric has group data, the index is empty
+    VerifyOrReturnError(CHIP_ERROR_NOT_FOUND != err, CHIP_NO_ERROR);
+    ReturnErrorOnFailure(err);
+
+    FabricData fabric(fabric_list.first_entry);
+    for (size_t i = 0; i < fabric_list.entry_count; i++, fabric.fabric_index = fabric.next)
+    {
+        ReturnErrorOnFailure(fabric.Load(mStorage));
+
+        KeyMapData mapping(fabric.fabric_index, fabric.first_map);
+        for (uint16_t j = 0; j < fabric.map_count; ++j, mapping.id = mapping.next)
+        {
+            ReturnErrorOnFailure(mapping.Load(mStorage));
+
+            KeySetData keyset;
+            VerifyOrReturnError(keyset.Find(mStorage, fabric, mapping.keyset_id), CHIP_ERROR_NOT_FOUND);
+
+            for (uint16_t k = 0; k < keyset.keys_count; ++k)
+            {
+                Crypto::GroupOperationalCredentials & creds = keyset.operational_keys[k];
+
+                GroupSessionEntry * entry = mSessionIndexPool.CreateObject(*this);
+                VerifyOrReturnError(nullptr != entry, CHIP_ERROR_NO_MEMORY);
+                entry->fabric_index    = fabric.fabric_index;
+                entry->group_id        = mapping.group_id;
+                entry->security_policy = keyset.policy;
+                entry->session_id      = creds.hash;
+                entry->keyContext.Initialize(creds.encryption_key, creds.hash, creds.privacy_key);
+
+                // Append, so that candidates are returned in the same order as when reading them from storage
+                GroupSessionEntry ** link = &mSessionIndex[SessionIndexBucket(creds.hash)];
+                while (nullptr != *link)
+                {
+                    link = &(*link)->next;
+                }
+                *link = entry;
+            }
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
+void GroupDataProviderImpl::InvalidateSessionIndex()
+{
+    for (GroupSessionEntry *& head : mSessionIndex)
+    {
+        while (nullptr != head)
+        {
+            GroupSessionEntry * entry = head;
+            head                      = entry->next;
+            entry->keyContext.ReleaseKeys();
+            mSessionIndexPool.ReleaseObject(entry);
+        }
+    }
+    mSessionIndexState = SessionIndexState::kStale;
+    mSessionIndexGeneration++;
+}
+
 GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupDataProviderImpl & provider, uint16_t session_id) :
     mProvider(provider), mSessionId(session_id), mGroupKeyContext(provider)
 {
+    if (SessionIndexState::kValid == provider.mSessionIndexState)
+    {
+        mUseIndex        = true;
+        mIndexGeneration = provider.mSessionIndexGeneration;
+        mIndexEntry      = provider.mSessionIndex[SessionIndexBucket(session_id)];
+        return;
+    }
+
     FabricList fabric_list;
     ReturnOnFailure(fabric_list.Load(provider.mStorage));
     mFirstFabric = fabric_list.first_entry;
@@ -1860,6 +1990,21 @@ size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
     FabricData fabric(mFirstFabric);
     size_t count = 0;
 
+    if (mUseIndex)
+    {
+        VerifyOrReturnError(mIndexGeneration == mProvider.mSessionIndexGeneration, 0);
+        GroupSessionEntry * entry = mProvider.mSessionIndex[SessionIndexBucket(mSessionId)];
+        while (nullptr != entry)
+        {
+            if (entry->session_id == mSessionId)
+            {
+                count++;
+            }
+            entry = entry->next;
+        }
+        return count;
+    }
+
     for (size_t i = 0; i < mFabricTotal; i++, fabric.fabric_index = fabric.next)
     {
         if (CHIP_NO_ERROR != fabric.Load(mProvider.mStorage))
@@ -1898,6 +2043,24 @@ size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
 
 bool GroupDataProviderImpl::GroupSessionIteratorImpl::Next(GroupSession & output)
 {
+    if (mUseIndex)
+    {
+        // Entries are released when the index is invalidated
+        VerifyOrReturnError(mIndexGeneration == mProvider.mSessionIndexGeneration, false);
+        while (nullptr != mIndexEntry && mIndexEntry->session_id != mSessionId)
+        {
+            mIndexEntry = mIndexEntry->next;
+        }
+        VerifyOrReturnError(nullptr != mIndexEntry, false);
+
+        output.fabric_index    = mIndexEntry->fabric_index;
+        output.group_id        = mIndexEntry->group_id;
+        output.security_policy = mIndexEntry->security_policy;
+        output.keyContext      = &mIndexEntry->keyContext;
+        mIndexEntry            = mIndexEntry->next;
+        return true;
+    }
+
     while (mFabricCount < mFabricTotal)
     {
         FabricData fabric(mFabric);
@@ -33,7 +33,7 @@ public:
     GroupDataProviderImpl(uint16_t maxGroupsPerFabric, uint16_t maxGroupKeysPerFabric) :
         GroupDataProvider(maxGroupsPerFabric, maxGroupKeysPerFabric)
     {}
-    ~GroupDataProviderImpl() override {}
+    ~GroupDataProviderImpl() override { mSessionIndexPool.ReleaseAll(); }
 
     /**
      * @brief Set the storage implementation used for non-volatile storage of configuration data.
@@ -43,7 +43,7 @@ public:
      */
     void SetStorageDelegate(PersistentStorageDelegate * storage);
 
-    void SetSessionKeystore(Crypto::SessionKeystore * keystore) { mSessionKeystore = keystore; }
+    void SetSessionKeystore(Crypto::SessionKeystore * keystore);
     Crypto::SessionKeystore * GetSessionKeystore() const { return mSessionKeystore; }
 
     CHIP_ERROR Init() override;
@@ -205,6 +205,23 @@ protected:
         Crypto::Aes128KeyHandle mPrivacyKey;
     };
 
+    /**
+     * Entry of the in-memory group session index: one operational key of a group-keyset mapping, with its key handles
+     * already created, chained with the other entries of the same session ID bucket.
+     */
+    class GroupSessionEntry
+    {
+    public:
+        GroupSessionEntry(GroupDataProviderImpl & provider) : keyContext(provider) {}
+
+        FabricIndex fabric_index       = kUndefinedFabricIndex;
+        GroupId group_id               = kUndefinedGroupId;
+        SecurityPolicy security_policy = SecurityPolicy::kTrustFirst;
+        uint16_t session_id            = 0;
+        GroupSessionEntry * next       = nullptr;
+        GroupKeyContext keyContext;
+    };
+
     class KeySetIteratorImpl : public KeySetIterator
     {
     public:
@@ -242,10 +259,35 @@ protected:
         uint16_t mKeyCount       = 0;
         bool mFirstMap           = true;
         GroupKeyContext mGroupKeyContext;
+        // Set when the candidates are taken from the session index rather than read from storage
+        bool mUseIndex                  = false;
+        uint32_t mIndexGeneration       = 0;
+        GroupSessionEntry * mIndexEntry = nullptr;
     };
+
+    enum class SessionIndexState : uint8_t
+    {
+        kStale,      // Must be rebuilt from storage before use
+        kValid,      // Mirrors the keys in storage
+        kUnavailable // Could not be built (e.g. too many keys), use storage until the next change
+    };
+
+    static constexpr uint16_t kSessionIndexBuckets = 16;
+    static_assert((kSessionIndexBuckets & (kSessionIndexBuckets - 1)) == 0, "Bucket count must be a power of two");
+
     bool IsInitialized() { return (mStorage != nullptr); }
     CHIP_ERROR RemoveEndpoints(FabricIndex fabric_index, GroupId group_id);
 
+    static uint16_t SessionIndexBucket(uint16_t session_id)
+    {
+        return static_cast<uint16_t>(session_id & (kSessionIndexBuckets - 1));
+    }
+    // Rebuilds the group session index if stale. Returns true if the index can be used.
+    bool UpdateSessionIndex();
+    CHIP_ERROR BuildSessionIndex();
+    // Drops the group session index; it is rebuilt on the next incoming group message.
+    void InvalidateSessionIndex();
+
     PersistentStorageDelegate * mStorage       = nullptr;
     Crypto::SessionKeystore * mSessionKeystore = nullptr;
     ObjectPool<GroupInfoIteratorImpl, kIteratorsMax> mGroupInfoIterators;
@@ -254,6 +296,11 @@ protected:
     ObjectPool<KeySetIteratorImpl, kIteratorsMax> mKeySetIterators;
     ObjectPool<GroupSessionIteratorImpl, kIteratorsMax> mGroupSessionsIterator;
     ObjectPool<GroupKeyContext, kIteratorsMax> mGroupKeyContexPool;
+    ObjectPool<GroupSessionEntry, CHIP_CONFIG_MAX_GROUP_SESSION_INDEX_ENTRIES> mSessionIndexPool;
+    GroupSessionEntry * mSessionIndex[kSessionIndexBuckets] = {};
+    SessionIndexState mSessionIndexState                   = SessionIndexState::kStale;
+    // Incremented on invalidation, so that live iterators stop using released entries
+    uint32_t mSessionIndexGeneration = 0;
 };
 
 } // namespace Credentials
@@ -334,6 +334,8 @@ CHIP_ERROR PersistentStorageOpCertStore::CommitOpCertsForFabric(FabricIndex fabr
     }
 
     // TODO: Handle transaction marking to revert partial certs at next boot if we get interrupted by reboot.
+    // Batching storage applies the certificates of the chain together.
+    PersistentStorageBatch storageBatch(mStorage);
 
     // Start committing NOC first so we don't have dangling roots if one was added.
     ByteSpan pendingNocSpan{ mPendingNoc.Get(), mPendingNoc.AllocatedSize() };
@@ -349,11 +351,13 @@ CHIP_ERROR PersistentStorageOpCertStore::CommitOpCertsForFabric(FabricIndex fabr
         ByteSpan pendingRcacSpan{ mPendingRcac.Get(), mPendingRcac.AllocatedSize() };
         rcacErr = SaveCertToStorage(mStorage, mPendingFabricIndex, CertChainElement::kRcac, pendingRcacSpan);
     }
+    CHIP_ERROR batchErr = storageBatch.End();
 
     // Remember which was the first error, and if any error occurred.
     CHIP_ERROR stickyErr = nocErr;
     stickyErr            = (stickyErr != CHIP_NO_ERROR) ? stickyErr : icacErr;
     stickyErr            = (stickyErr != CHIP_NO_ERROR) ? stickyErr : rcacErr;
+    stickyErr            = (stickyErr != CHIP_NO_ERROR) ? stickyErr : batchErr;
 
     if (stickyErr != CHIP_NO_ERROR)
     {
@@ -411,9 +415,11 @@ CHIP_ERROR PersistentStorageOpCertStore::RemoveOpCertsForFabric(FabricIndex fabr
     RevertPendingOpCerts();
 
     // Remove all persisted certs for the given fabric, blindly
-    CHIP_ERROR nocErr  = DeleteCertFromStorage(mStorage, fabricIndex, CertChainElement::kNoc);
-    CHIP_ERROR icacErr = DeleteCertFromStorage(mStorage, fabricIndex, CertChainElement::kIcac);
-    CHIP_ERROR rcacErr = DeleteCertFromStorage(mStorage, fabricIndex, CertChainElement::kRcac);
+    PersistentStorageBatch storageBatch(mStorage);
+    CHIP_ERROR nocErr   = DeleteCertFromStorage(mStorage, fabricIndex, CertChainElement::kNoc);
+    CHIP_ERROR icacErr  = DeleteCertFromStorage(mStorage, fabricIndex, CertChainElement::kIcac);
+    CHIP_ERROR rcacErr  = DeleteCertFromStorage(mStorage, fabricIndex, CertChainElement::kRcac);
+    CHIP_ERROR batchErr = storageBatch.End();
 
     // Ignore missing cert errors
     nocErr  = (nocErr == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND) ? CHIP_NO_ERROR : nocErr;
@@ -424,6 +430,7 @@ CHIP_ERROR PersistentStorageOpCertStore::RemoveOpCertsForFabric(FabricIndex fabr
     CHIP_ERROR stickyErr = nocErr;
     stickyErr            = (stickyErr != CHIP_NO_ERROR) ? stickyErr : icacErr;
     stickyErr            = (stickyErr != CHIP_NO_ERROR) ? stickyErr : rcacErr;
+    stickyErr            = (stickyErr != CHIP_NO_ERROR) ? stickyErr : batchErr;
 
     return stickyErr;
 }
@@ -0,0 +1,118 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <credentials/VerifiedCertChainCache.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+
+#include <string.h>
+
+namespace chip {
+namespace Credentials {
+
+namespace {
+
+CHIP_ERROR AddCertToHash(Crypto::Hash_SHA256_stream & hash, const ByteSpan & cert)
+{
+    // Length-prefix each certificate so that different chains cannot hash the same bytes.
+    uint8_t length[sizeof(uint32_t)];
+    Encoding::LittleEndian::Put32(length, static_cast<uint32_t>(cert.size()));
+    ReturnErrorOnFailure(hash.AddData(ByteSpan(length)));
+    return hash.AddData(cert);
+}
+
+} // namespace
+
+CHIP_ERROR VerifiedCertChainCache::ComputeKey(const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac,
+                                              const ValidationContext & context, Key & outKey)
+{
+    // The requirements on the leaf certificate are part of what was verified.
+    uint8_t requirements[sizeof(uint16_t) + 2 * sizeof(uint8_t)];
+    Encoding::LittleEndian::Put16(requirements, context.mRequiredKeyUsages.Raw());
+    requirements[2] = context.mRequiredKeyPurposes.Raw();
+    requirements[3] = context.mRequiredCertType;
+
+    Crypto::Hash_SHA256_stream hash;
+    ReturnErrorOnFailure(hash.Begin());
+    ReturnErrorOnFailure(hash.AddData(ByteSpan(requirements)));
+    ReturnErrorOnFailure(AddCertToHash(hash, noc));
+    ReturnErrorOnFailure(AddCertToHash(hash, icac));
+    ReturnErrorOnFailure(AddCertToHash(hash, rcac));
+
+    MutableByteSpan digest(outKey.mDigest);
+    return hash.Finish(digest);
+}
+
+bool VerifiedCertChainCache::Lookup(const Key & key)
+{
+    for (auto & entry : mEntries)
+    {
+        if (kSize > 0 && entry.mLastUsed != 0 && memcmp(entry.mKey.mDigest, key.mDigest, sizeof(key.mDigest)) == 0)
+        {
+            entry.mLastUsed = NextUseCount();
+            return true;
+        }
+    }
+    return false;
+}
+
+void VerifiedCertChainCache::Add(const Key & key, uint32_t generation)
+{
+    VerifyOrReturn(kSize > 0 && generation == mGeneration);
+    VerifyOrReturn(!Lookup(key));
+
+    Entry * victim = &mEntries[0];
+    for (auto & entry : mEntries)
+    {
+        if (entry.mLastUsed < victim->mLastUsed)
+        {
+            victim = &entry;
+        }
+    }
+
+    victim->mKey      = key;
+    victim->mLastUsed = NextUseCount();
+}
+
+void VerifiedCertChainCache::Clear()
+{
+    for (auto & entry : mEntries)
+    {
+        entry.mLastUsed = 0;
+    }
+    mUseCount = 0;
+    mGeneration++;
+}
+
+uint32_t VerifiedCertChainCache::NextUseCount()
+{
+    if (mUseCount == UINT32_MAX)
+    {
+        // Rather than wrap around and break the LRU order, start over with an empty cache.
+        for (auto & entry : mEntries)
+        {
+            entry.mLastUsed = 0;
+        }
+        mUseCount = 0;
+    }
+    return ++mUseCount;
+}
+
+} // namespace Credentials
+} // namespace chip
@@ -0,0 +1,104 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <credentials/CHIPCertificateSet.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/support/Span.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Credentials {
+
+/**
+ * Least recently used set of the operational certificate chains (NOC, ICAC, RCAC) whose signatures
+ * were verified, so that a chain presented again, e.g. by a peer that reconnects over CASE, can be
+ * validated without decoding it for signature checks and without verifying its ECDSA signatures.
+ *
+ * Only the time-independent part of the validation is remembered: the chain is keyed by a hash of
+ * the certificates and of the usage, purpose and type requirements of the validation context, and
+ * the validity periods and CertificateValidityPolicy are applied again on every use (see
+ * ChipCertificateSet::CheckValidityPeriod).
+ *
+ * The cache is not thread-safe. FabricTable owns one and clears it whenever its fabrics or trusted
+ * roots change; entries computed against state that has been cleared since are not added.
+ */
+class VerifiedCertChainCache
+{
+public:
+    struct Key
+    {
+        uint8_t mDigest[Crypto::kSHA256_Hash_Length];
+    };
+
+    /**
+     * Compute the key of a certificate chain for the requirements of a validation context.
+     *
+     * @param noc      Node operational certificate, in CHIP TLV format.
+     * @param icac     Intermediate CA certificate, in CHIP TLV format, or empty if there is none.
+     * @param rcac     Root CA certificate trusted to anchor the chain, in CHIP TLV format.
+     * @param context  Validation context that the chain is validated against.
+     * @param outKey   Key of the chain.
+     */
+    static CHIP_ERROR ComputeKey(const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac,
+                                 const ValidationContext & context, Key & outKey);
+
+    /**
+     * @return true if the chain was added and has not been evicted or cleared since, in which case
+     *         it becomes the most recently used one.
+     */
+    bool Lookup(const Key & key);
+
+    /**
+     * Add a chain that was verified, evicting the least recently used one if the cache is full.
+     *
+     * @param key         Key of the chain.
+     * @param generation  Value of GetGeneration() when the trust anchor of the chain was fetched. The
+     *                    chain is not added if the cache was cleared since.
+     */
+    void Add(const Key & key, uint32_t generation);
+
+    /**
+     * Forget all the chains, e.g. because a fabric or a trusted root was added, updated or removed.
+     */
+    void Clear();
+
+    uint32_t GetGeneration() const { return mGeneration; }
+
+private:
+    static constexpr size_t kSize = CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE;
+
+    struct Entry
+    {
+        Key mKey;
+        uint32_t mLastUsed = 0; // 0 for an empty entry
+    };
+
+    uint32_t NextUseCount();
+
+    Entry mEntries[kSize > 0 ? kSize : 1];
+    uint32_t mUseCount   = 0;
+    uint32_t mGeneration = 0;
+};
+
+} // namespace Credentials
+} // namespace chip
@@ -1190,6 +1190,74 @@ void TestGroupDecryption(nlTestSuite * apSuite, void * apContext)
     }
 }
 
+size_t CountGroupSessions(GroupDataProvider * provider, uint16_t session_id, std::set<std::pair<FabricIndex, GroupId>> & found)
+{
+    GroupSession session;
+    size_t count = 0;
+    auto it      = provider->IterateGroupSessions(session_id);
+    VerifyOrReturnError(nullptr != it, 0);
+    while (it->Next(session))
+    {
+        found.insert(std::make_pair(session.fabric_index, session.group_id));
+        count++;
+    }
+    it->Release();
+    return count;
+}
+
+void TestGroupSessionIndex(nlTestSuite * apSuite, void * apContext)
+{
+    GroupDataProvider * provider = GetGroupDataProvider();
+    NL_TEST_ASSERT(apSuite, provider);
+
+    // Reset test
+    ResetProvider(provider);
+
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->SetKeySet(kFabric1, kCompressedFabricId1, kKeySet2));
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->SetGroupKeyAt(kFabric1, 0, kGroup1Keyset2));
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->SetKeySet(kFabric2, kCompressedFabricId2, kKeySet1));
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->SetGroupKeyAt(kFabric2, 0, kGroup2Keyset1));
+
+    Crypto::SymmetricKeyContext * key_context = provider->GetKeyContext(kFabric2, kGroup2);
+    NL_TEST_ASSERT(apSuite, nullptr != key_context);
+    VerifyOrReturn(nullptr != key_context);
+    uint16_t session_id = key_context->GetKeyHash();
+    key_context->Release();
+
+    // Sessions are found through the index
+    std::set<std::pair<FabricIndex, GroupId>> found;
+    NL_TEST_ASSERT(apSuite, 1 == CountGroupSessions(provider, session_id, found));
+    NL_TEST_ASSERT(apSuite, found.count(std::make_pair(kFabric2, kGroup2)) > 0);
+
+    // New mappings are visible on the next lookup
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->SetGroupKeyAt(kFabric2, 1, kGroup3Keyset1));
+    found.clear();
+    NL_TEST_ASSERT(apSuite, 2 == CountGroupSessions(provider, session_id, found));
+    NL_TEST_ASSERT(apSuite, found.count(std::make_pair(kFabric2, kGroup2)) > 0);
+    NL_TEST_ASSERT(apSuite, found.count(std::make_pair(kFabric2, kGroup3)) > 0);
+
+    // Removing the key set ends iterators that are still in use
+    GroupSession session;
+    auto it = provider->IterateGroupSessions(session_id);
+    NL_TEST_ASSERT(apSuite, it);
+    if (it)
+    {
+        NL_TEST_ASSERT(apSuite, 2 == it->Count());
+        NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->RemoveKeySet(kFabric2, kKeysetId1));
+        NL_TEST_ASSERT(apSuite, !it->Next(session));
+        it->Release();
+    }
+    found.clear();
+    NL_TEST_ASSERT(apSuite, 0 == CountGroupSessions(provider, session_id, found));
+
+    // Restored keys are found again, until the fabric is removed
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->SetKeySet(kFabric2, kCompressedFabricId2, kKeySet1));
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->SetGroupKeyAt(kFabric2, 0, kGroup2Keyset1));
+    NL_TEST_ASSERT(apSuite, 1 == CountGroupSessions(provider, session_id, found));
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->RemoveFabric(kFabric2));
+    NL_TEST_ASSERT(apSuite, 0 == CountGroupSessions(provider, session_id, found));
+}
+
 } // namespace TestGroups
 } // namespace app
 } // namespace chip
@@ -1269,6 +1337,7 @@ const nlTest sTests[] = { NL_TEST_DEF("TestStorageDelegate", chip::app::TestGrou
                           NL_TEST_DEF("TestIpk", chip::app::TestGroups::TestIpk),
                           NL_TEST_DEF("TestPerFabricData", chip::app::TestGroups::TestPerFabricData),
                           NL_TEST_DEF("TestGroupDecryption", chip::app::TestGroups::TestGroupDecryption),
+                          NL_TEST_DEF("TestGroupSessionIndex", chip::app::TestGroups::TestGroupSessionIndex),
                           NL_TEST_SENTINEL() };
 } // namespace
 
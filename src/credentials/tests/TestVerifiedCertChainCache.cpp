@@ -0,0 +1,238 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <credentials/CertificateValidityPolicy.h>
+#include <credentials/FabricTable.h>
+#include <credentials/VerifiedCertChainCache.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+
+#include "CHIPCert_test_vectors.h"
+
+#include <string.h>
+
+using namespace chip;
+using namespace chip::Credentials;
+using namespace chip::TestCerts;
+
+namespace {
+
+constexpr size_t kCacheSize = CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE;
+
+// The test certificates are valid from Oct 15 14:23:43 2020 to Oct 15 14:23:42 2040.
+constexpr uint32_t kChipEpochTime2021 = 662774400;
+constexpr uint32_t kChipEpochTime2041 = 1293926400;
+
+class RecordingValidityPolicy : public CertificateValidityPolicy
+{
+public:
+    CHIP_ERROR ApplyCertificateValidityPolicy(const ChipCertificateData * cert, uint8_t depth,
+                                              CertificateValidityResult result) override
+    {
+        mCalls++;
+        mMaxDepth = depth > mMaxDepth ? depth : mMaxDepth;
+        return (result == CertificateValidityResult::kValid) ? CHIP_NO_ERROR : CHIP_ERROR_CERT_EXPIRED;
+    }
+
+    unsigned mCalls   = 0;
+    uint8_t mMaxDepth = 0;
+};
+
+VerifiedCertChainCache::Key MakeKey(uint8_t value)
+{
+    VerifiedCertChainCache::Key key;
+    memset(key.mDigest, value, sizeof(key.mDigest));
+    return key;
+}
+
+CHIP_ERROR GetChain01(ByteSpan & noc, ByteSpan & icac, ByteSpan & rcac)
+{
+    const BitFlags<TestCertLoadFlags> loadFlags;
+    ReturnErrorOnFailure(GetTestCert(TestCert::kNode01_01, loadFlags, noc));
+    ReturnErrorOnFailure(GetTestCert(TestCert::kICA01, loadFlags, icac));
+    return GetTestCert(TestCert::kRoot01, loadFlags, rcac);
+}
+
+CHIP_ERROR VerifyChain01(ValidationContext & context, bool chainSignaturesVerified, NodeId & outNodeId,
+                         Crypto::P256PublicKey & outNocPubkey)
+{
+    ByteSpan noc, icac, rcac;
+    ReturnErrorOnFailure(GetChain01(noc, icac, rcac));
+
+    CompressedFabricId compressedFabricId;
+    FabricId fabricId;
+    return FabricTable::VerifyCredentials(noc, icac, rcac, context, compressedFabricId, fabricId, outNodeId, outNocPubkey,
+                                          nullptr, chainSignaturesVerified);
+}
+
+void TestLookupAndEviction(nlTestSuite * inSuite, void * inContext)
+{
+    if (kCacheSize == 0)
+    {
+        return;
+    }
+
+    VerifiedCertChainCache cache;
+    NL_TEST_ASSERT(inSuite, !cache.Lookup(MakeKey(1)));
+
+    // Fill the cache, then make the first chain the most recently used one.
+    for (size_t i = 0; i < kCacheSize; i++)
+    {
+        cache.Add(MakeKey(static_cast<uint8_t>(i + 1)), cache.GetGeneration());
+    }
+    for (size_t i = 0; i < kCacheSize; i++)
+    {
+        NL_TEST_ASSERT(inSuite, cache.Lookup(MakeKey(static_cast<uint8_t>(i + 1))));
+    }
+    NL_TEST_ASSERT(inSuite, cache.Lookup(MakeKey(1)));
+
+    // The next chain evicts the least recently used one, which is now the second.
+    cache.Add(MakeKey(0xFF), cache.GetGeneration());
+    NL_TEST_ASSERT(inSuite, cache.Lookup(MakeKey(0xFF)));
+    NL_TEST_ASSERT(inSuite, cache.Lookup(MakeKey(1)));
+    NL_TEST_ASSERT(inSuite, (kCacheSize == 1) || !cache.Lookup(MakeKey(2)));
+}
+
+void TestClear(nlTestSuite * inSuite, void * inContext)
+{
+    if (kCacheSize == 0)
+    {
+        return;
+    }
+
+    VerifiedCertChainCache cache;
+    uint32_t generation = cache.GetGeneration();
+    cache.Add(MakeKey(1), generation);
+    NL_TEST_ASSERT(inSuite, cache.Lookup(MakeKey(1)));
+
+    cache.Clear();
+    NL_TEST_ASSERT(inSuite, !cache.Lookup(MakeKey(1)));
+
+    // A chain verified against a trust anchor fetched before the cache was cleared is not added.
+    cache.Add(MakeKey(2), generation);
+    NL_TEST_ASSERT(inSuite, !cache.Lookup(MakeKey(2)));
+
+    cache.Add(MakeKey(2), cache.GetGeneration());
+    NL_TEST_ASSERT(inSuite, cache.Lookup(MakeKey(2)));
+}
+
+void TestComputeKey(nlTestSuite * inSuite, void * inContext)
+{
+    ByteSpan noc, icac, rcac;
+    NL_TEST_ASSERT(inSuite, GetChain01(noc, icac, rcac) == CHIP_NO_ERROR);
+
+    ValidationContext context;
+    context.Reset();
+    context.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+
+    VerifiedCertChainCache::Key key1, key2;
+    NL_TEST_ASSERT(inSuite, VerifiedCertChainCache::ComputeKey(noc, icac, rcac, context, key1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, VerifiedCertChainCache::ComputeKey(noc, icac, rcac, context, key2) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, memcmp(key1.mDigest, key2.mDigest, sizeof(key1.mDigest)) == 0);
+
+    // The effective time is checked on every use, so it is not part of the key.
+    context.SetEffectiveTime<CurrentChipEpochTime>(System::Clock::Seconds32(kChipEpochTime2021));
+    NL_TEST_ASSERT(inSuite, VerifiedCertChainCache::ComputeKey(noc, icac, rcac, context, key2) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, memcmp(key1.mDigest, key2.mDigest, sizeof(key1.mDigest)) == 0);
+
+    NL_TEST_ASSERT(inSuite, VerifiedCertChainCache::ComputeKey(noc, ByteSpan(), rcac, context, key2) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, memcmp(key1.mDigest, key2.mDigest, sizeof(key1.mDigest)) != 0);
+
+    context.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+    NL_TEST_ASSERT(inSuite, VerifiedCertChainCache::ComputeKey(noc, icac, rcac, context, key2) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, memcmp(key1.mDigest, key2.mDigest, sizeof(key1.mDigest)) != 0);
+}
+
+void TestVerifyPreviouslyVerifiedChain(nlTestSuite * inSuite, void * inContext)
+{
+    ValidationContext context;
+    context.Reset();
+    context.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+    context.SetEffectiveTime<CurrentChipEpochTime>(System::Clock::Seconds32(kChipEpochTime2021));
+
+    NodeId nodeId, cachedNodeId;
+    Crypto::P256PublicKey nocPubkey, cachedNocPubkey;
+    NL_TEST_ASSERT(inSuite, VerifyChain01(context, false, nodeId, nocPubkey) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, VerifyChain01(context, true, cachedNodeId, cachedNocPubkey) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, nodeId == cachedNodeId);
+    NL_TEST_ASSERT(inSuite, nocPubkey.Matches(cachedNocPubkey));
+
+    // Validity periods are still enforced once the signatures are known to be good.
+    context.SetEffectiveTime<CurrentChipEpochTime>(System::Clock::Seconds32(kChipEpochTime2041));
+    NL_TEST_ASSERT(inSuite, VerifyChain01(context, false, nodeId, nocPubkey) == CHIP_ERROR_CERT_EXPIRED);
+    NL_TEST_ASSERT(inSuite, VerifyChain01(context, true, nodeId, nocPubkey) == CHIP_ERROR_CERT_EXPIRED);
+
+    // So is the validity policy, which sees every certificate of the chain.
+    RecordingValidityPolicy policy;
+    context.mValidityPolicy = &policy;
+    context.SetEffectiveTime<CurrentChipEpochTime>(System::Clock::Seconds32(kChipEpochTime2021));
+    NL_TEST_ASSERT(inSuite, VerifyChain01(context, true, nodeId, nocPubkey) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, policy.mCalls == 3);
+    NL_TEST_ASSERT(inSuite, policy.mMaxDepth == 2);
+
+    context.SetEffectiveTime<CurrentChipEpochTime>(System::Clock::Seconds32(kChipEpochTime2041));
+    NL_TEST_ASSERT(inSuite, VerifyChain01(context, true, nodeId, nocPubkey) == CHIP_ERROR_CERT_EXPIRED);
+}
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+const nlTest sTests[] = {
+    NL_TEST_DEF("Test lookup and LRU eviction of verified chains", TestLookupAndEviction),
+    NL_TEST_DEF("Test clearing the verified chains", TestClear),
+    NL_TEST_DEF("Test keys of verified chains", TestComputeKey),
+    NL_TEST_DEF("Test verifying a previously verified chain", TestVerifyPreviouslyVerifiedChain),
+    NL_TEST_SENTINEL()
+};
+
+/**
+ *  Set up the test suite.
+ */
+int Test_Setup(void * inContext)
+{
+    CHIP_ERROR error = chip::Platform::MemoryInit();
+    VerifyOrReturnError(error == CHIP_NO_ERROR, FAILURE);
+    return SUCCESS;
+}
+
+/**
+ *  Tear down the test suite.
+ */
+int Test_Teardown(void * inContext)
+{
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+} // namespace
+
+/**
+ *  Main
+ */
+int TestVerifiedCertChainCache()
+{
+    nlTestSuite theSuite = { "VerifiedCertChainCache tests", &sTests[0], Test_Setup, Test_Teardown };
+
+    // Run test suite againt one context.
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestVerifiedCertChainCache)
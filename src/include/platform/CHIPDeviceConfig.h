@@ -136,6 +136,20 @@
 #define CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE 1
 #endif
 
+/**
+ * CHIP_DEVICE_CONFIG_BG_TASK_COUNT
+ *
+ * The number of threads serving the chip background event queue, on platforms
+ * based on GenericPlatformManagerImpl_POSIX.
+ *
+ * With more than one thread, background work items may run concurrently, e.g.
+ * the public-key cryptography of several session establishments, so the crypto
+ * backend must be thread-safe.
+ */
+#ifndef CHIP_DEVICE_CONFIG_BG_TASK_COUNT
+#define CHIP_DEVICE_CONFIG_BG_TASK_COUNT 1
+#endif
+
 /**
  * CHIP_DEVICE_CONFIG_ENABLE_SED
  *
@@ -1000,6 +1014,23 @@
 #define CHIP_DEVICE_CONFIG_EVENT_LOGGING_DEBUG_BUFFER_SIZE (512)
 #endif
 
+/**
+ * @def CHIP_DEVICE_CONFIG_EVENT_LOGGING_INDEX_BYTES_PER_ENTRY
+ *
+ * @brief
+ *   The number of bytes of each event buffer for which an entry of the event
+ *   index is reserved.  The index lets a report skip the events a subscriber
+ *   already received or is not interested in without parsing them, and copy the
+ *   others as raw bytes.  Each entry takes about 56 bytes, and events beyond the
+ *   capacity of the index are still reported, by parsing them, so this should be
+ *   about the size of the smaller events logged by the device.
+ *
+ *   Note: set to 0 to disable the event index.
+ */
+#ifndef CHIP_DEVICE_CONFIG_EVENT_LOGGING_INDEX_BYTES_PER_ENTRY
+#define CHIP_DEVICE_CONFIG_EVENT_LOGGING_INDEX_BYTES_PER_ENTRY 0
+#endif
+
 /**
  *  @def CHIP_DEVICE_CONFIG_EVENT_ID_COUNTER_EPOCH
  *
@@ -170,10 +170,35 @@ public:
      */
     CHIP_ERROR Delete(const char * key);
 
+    /**
+     * @brief
+     *   Start a batch of updates. Until the matching EndBatch(), the KVS may defer committing the
+     *   effect of Put and Delete to the underlying medium, e.g. to rewrite a file once rather than
+     *   once per update, but Get must always observe them. Batches nest, and only the outermost
+     *   EndBatch() commits the deferred updates.
+     *
+     *   The default implementation commits every update immediately.
+     */
+    void BeginBatch();
+
+    /**
+     * @brief
+     *   End the batch started by the matching BeginBatch().
+     *
+     * @return CHIP_NO_ERROR the deferred updates, if any, were committed
+     *         CHIP_ERROR_PERSISTED_STORAGE_FAILED failed to commit the deferred updates.
+     *         CHIP_ERROR_INCORRECT_STATE no batch was started
+     */
+    CHIP_ERROR EndBatch();
+
 private:
     using ImplClass = ::chip::DeviceLayer::PersistedStorage::KeyValueStoreManagerImpl;
 
 protected:
+    // Batch hooks for implementations that commit every update immediately.
+    void _BeginBatch() {}
+    CHIP_ERROR _EndBatch() { return CHIP_NO_ERROR; }
+
     // Construction/destruction limited to subclasses.
     KeyValueStoreManager()  = default;
     ~KeyValueStoreManager() = default;
@@ -233,6 +258,16 @@ inline CHIP_ERROR KeyValueStoreManager::Delete(const char * key)
     return static_cast<ImplClass *>(this)->_Delete(key);
 }
 
+inline void KeyValueStoreManager::BeginBatch()
+{
+    static_cast<ImplClass *>(this)->_BeginBatch();
+}
+
+inline CHIP_ERROR KeyValueStoreManager::EndBatch()
+{
+    return static_cast<ImplClass *>(this)->_EndBatch();
+}
+
 } // namespace PersistedStorage
 } // namespace DeviceLayer
 } // namespace chip
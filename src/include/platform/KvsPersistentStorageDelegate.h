@@ -103,6 +103,20 @@ public:
         return mKvsManager->Delete(key);
     }
 
+    void BeginBatch() override
+    {
+        if (mKvsManager != nullptr)
+        {
+            mKvsManager->BeginBatch();
+        }
+    }
+
+    CHIP_ERROR EndBatch() override
+    {
+        VerifyOrReturnError(mKvsManager != nullptr, CHIP_ERROR_INCORRECT_STATE);
+        return mKvsManager->EndBatch();
+    }
+
 protected:
     DeviceLayer::PersistedStorage::KeyValueStoreManager * mKvsManager = nullptr;
 };
@@ -90,6 +90,13 @@ protected:
     CHIP_ERROR _StartChipTimer(System::Clock::Timeout duration);
     void _Shutdown();
 
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    CHIP_ERROR _PostBackgroundEvent(const ChipDeviceEvent * event);
+    void _RunBackgroundEventLoop();
+    CHIP_ERROR _StartBackgroundEventLoopTask();
+    CHIP_ERROR _StopBackgroundEventLoopTask();
+#endif
+
 #if CHIP_STACK_LOCK_TRACKING_ENABLED
     bool _IsChipStackLockedByCurrentThread() const;
 #endif
@@ -106,6 +113,24 @@ private:
     DeviceSafeQueue mChipEventQueue;
     std::atomic<bool> mShouldRunEventLoop{ true };
     static void * EventLoopTaskMain(void * arg);
+
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    static_assert(CHIP_DEVICE_CONFIG_BG_TASK_COUNT > 0, "The background event queue needs at least one task");
+    static_assert(CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE > 0, "The background event queue needs at least one entry");
+
+    static void * BackgroundEventLoopTaskMain(void * arg);
+
+    // The background event queue is a ring buffer served by a pool of
+    // CHIP_DEVICE_CONFIG_BG_TASK_COUNT threads, all guarded by mBackgroundEventLock.
+    pthread_mutex_t mBackgroundEventLock = PTHREAD_MUTEX_INITIALIZER;
+    pthread_cond_t mBackgroundEventCond  = PTHREAD_COND_INITIALIZER;
+    bool mShouldRunBackgroundEventLoop   = false;
+    size_t mBackgroundEventHead          = 0;
+    size_t mBackgroundEventCount         = 0;
+    size_t mBackgroundEventLoopTaskCount = 0;
+    pthread_t mBackgroundEventLoopTasks[CHIP_DEVICE_CONFIG_BG_TASK_COUNT];
+    ChipDeviceEvent mBackgroundEventQueue[CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE];
+#endif
 };
 
 // Instruct the compiler to instantiate the template only when explicitly told to do so.
@@ -301,9 +301,158 @@ exit:
     return CHIP_ERROR_POSIX(err);
 }
 
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_PostBackgroundEvent(const ChipDeviceEvent * event)
+{
+    VerifyOrReturnError(event->Type == DeviceEventType::kCallWorkFunct || event->Type == DeviceEventType::kNoOp,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    pthread_mutex_lock(&mBackgroundEventLock);
+
+    //
+    // Until StartBackgroundEventLoopTask() is called, background events are processed by the CHIP
+    // thread, as on platforms without background event processing.
+    //
+    if (!mShouldRunBackgroundEventLoop)
+    {
+        pthread_mutex_unlock(&mBackgroundEventLock);
+        return Impl()->PostEvent(event);
+    }
+
+    if (mBackgroundEventCount == ArraySize(mBackgroundEventQueue))
+    {
+        pthread_mutex_unlock(&mBackgroundEventLock);
+        ChipLogError(DeviceLayer, "Failed to post event to CHIP background event queue");
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    mBackgroundEventQueue[(mBackgroundEventHead + mBackgroundEventCount) % ArraySize(mBackgroundEventQueue)] = *event;
+    mBackgroundEventCount++;
+    pthread_cond_signal(&mBackgroundEventCond);
+
+    pthread_mutex_unlock(&mBackgroundEventLock);
+    return CHIP_NO_ERROR;
+}
+
+template <class ImplClass>
+void GenericPlatformManagerImpl_POSIX<ImplClass>::_RunBackgroundEventLoop()
+{
+    pthread_mutex_lock(&mBackgroundEventLock);
+
+    if (!mShouldRunBackgroundEventLoop)
+    {
+        ChipLogError(DeviceLayer, "Error trying to run the background event loop before StartBackgroundEventLoopTask");
+    }
+
+    while (mShouldRunBackgroundEventLoop)
+    {
+        if (mBackgroundEventCount == 0)
+        {
+            pthread_cond_wait(&mBackgroundEventCond, &mBackgroundEventLock);
+            continue;
+        }
+
+        const ChipDeviceEvent event = mBackgroundEventQueue[mBackgroundEventHead];
+        mBackgroundEventHead        = (mBackgroundEventHead + 1) % ArraySize(mBackgroundEventQueue);
+        mBackgroundEventCount--;
+
+        pthread_mutex_unlock(&mBackgroundEventLock);
+        Impl()->DispatchEvent(&event);
+        pthread_mutex_lock(&mBackgroundEventLock);
+    }
+
+    pthread_mutex_unlock(&mBackgroundEventLock);
+}
+
+template <class ImplClass>
+void * GenericPlatformManagerImpl_POSIX<ImplClass>::BackgroundEventLoopTaskMain(void * arg)
+{
+    ChipLogDetail(DeviceLayer, "CHIP background task running");
+    static_cast<GenericPlatformManagerImpl_POSIX<ImplClass> *>(arg)->Impl()->RunBackgroundEventLoop();
+    return nullptr;
+}
+
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StartBackgroundEventLoopTask()
+{
+    int err = 0;
+
+    pthread_mutex_lock(&mBackgroundEventLock);
+    VerifyOrExit(!mShouldRunBackgroundEventLoop, err = EALREADY);
+
+    mShouldRunBackgroundEventLoop = true;
+    while (mBackgroundEventLoopTaskCount < ArraySize(mBackgroundEventLoopTasks))
+    {
+        err = pthread_create(&mBackgroundEventLoopTasks[mBackgroundEventLoopTaskCount], nullptr, BackgroundEventLoopTaskMain, this);
+        if (err != 0)
+        {
+            ChipLogError(DeviceLayer, "Failed to create CHIP background task: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(err).Format());
+            break;
+        }
+        mBackgroundEventLoopTaskCount++;
+    }
+
+exit:
+    // Make do with the tasks that could be created, if any.
+    if (mBackgroundEventLoopTaskCount > 0)
+    {
+        err = 0;
+    }
+    else if (err != EALREADY)
+    {
+        mShouldRunBackgroundEventLoop = false;
+    }
+
+    pthread_mutex_unlock(&mBackgroundEventLock);
+    return CHIP_ERROR_POSIX(err);
+}
+
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StopBackgroundEventLoopTask()
+{
+    int err = 0;
+
+    pthread_mutex_lock(&mBackgroundEventLock);
+    mShouldRunBackgroundEventLoop = false;
+    pthread_cond_broadcast(&mBackgroundEventCond);
+    const size_t taskCount        = mBackgroundEventLoopTaskCount;
+    mBackgroundEventLoopTaskCount = 0;
+    pthread_mutex_unlock(&mBackgroundEventLock);
+
+    for (size_t i = 0; i < taskCount; i++)
+    {
+        // A background task stopping the pool cannot wait for itself.
+        int ret = (pthread_equal(pthread_self(), mBackgroundEventLoopTasks[i]) != 0)
+            ? pthread_detach(mBackgroundEventLoopTasks[i])
+            : pthread_join(mBackgroundEventLoopTasks[i], nullptr);
+        err = (err == 0) ? ret : err;
+    }
+
+    //
+    // Hand the events that were still queued over to the CHIP thread, so that the work they carry,
+    // and the completions it posts back, still happen.
+    //
+    pthread_mutex_lock(&mBackgroundEventLock);
+    while (mBackgroundEventCount > 0)
+    {
+        Impl()->PostEventOrDie(&mBackgroundEventQueue[mBackgroundEventHead]);
+        mBackgroundEventHead = (mBackgroundEventHead + 1) % ArraySize(mBackgroundEventQueue);
+        mBackgroundEventCount--;
+    }
+    pthread_mutex_unlock(&mBackgroundEventLock);
+
+    return CHIP_ERROR_POSIX(err);
+}
+#endif // CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+
 template <class ImplClass>
 void GenericPlatformManagerImpl_POSIX<ImplClass>::_Shutdown()
 {
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    _StopBackgroundEventLoopTask();
+#endif
+
     //
     // We cannot shutdown the stack while the event loop is still running. This can lead
     // to use after free errors - here we are destroying mutex and condition variable that
@@ -272,4 +272,43 @@
 #endif
 #endif // INET_CONFIG_UDP_SOCKET_PKTINFO
 
+/**
+ *  @def INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE
+ *
+ *  @brief
+ *    Maximum number of datagrams moved by a single system call in the
+ *    socket-based implementation of UDP endpoints.
+ *
+ *  @details
+ *    When greater than 1, a readable UDP socket is drained of up to this many
+ *    datagrams per wakeup with recvmmsg(), and UDPEndPoint::SendMsgs() hands
+ *    up to this many datagrams to the kernel per sendmmsg() call, e.g. for the
+ *    reports of a reporting engine run, which SessionManager holds back in a
+ *    send batch. Both system calls are Linux-specific. When 1, every datagram
+ *    uses its own recvmsg() or sendmsg() call.
+ */
+#ifndef INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE
+#define INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE 1
+#endif // INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE
+
+/**
+ *  @def INET_CONFIG_SOCKET_SEND_MAX_IOVECS
+ *
+ *  @brief
+ *    Maximum number of packet buffers of a chain handed to the kernel by a
+ *    single send in the socket-based implementations of UDP and TCP endpoints.
+ *
+ *  @details
+ *    Chained packet buffers are sent with sendmsg() and one iovec per buffer,
+ *    without first being copied into a single buffer. A UDP datagram must fit
+ *    in this many buffers; a TCP endpoint sends longer chains in several calls.
+ *
+ *    Secure messages are encrypted from a single payload buffer, so their
+ *    chains are at most two buffers long: the payload and its message
+ *    integrity check.
+ */
+#ifndef INET_CONFIG_SOCKET_SEND_MAX_IOVECS
+#define INET_CONFIG_SOCKET_SEND_MAX_IOVECS 8
+#endif // INET_CONFIG_SOCKET_SEND_MAX_IOVECS
+
 // clang-format on
@@ -484,9 +484,29 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
 
     while (!mSendQueue.IsNull())
     {
-        uint16_t bufLen = mSendQueue->DataLength();
+        // Gather as many queued buffers as fit into a single sendmsg() call, keeping the total within what Consume() accepts.
+        struct iovec sendIOVs[INET_CONFIG_SOCKET_SEND_MAX_IOVECS];
+        size_t iovCount = 0;
+        uint16_t bufLen = 0;
+        for (System::PacketBufferHandle buffer = mSendQueue.Retain(); !buffer.IsNull() && iovCount < ArraySize(sendIOVs);
+             buffer.Advance())
+        {
+            if (iovCount > 0 && buffer->DataLength() > UINT16_MAX - bufLen)
+            {
+                break;
+            }
+            sendIOVs[iovCount].iov_base = buffer->Start();
+            sendIOVs[iovCount].iov_len  = buffer->DataLength();
+            bufLen                      = static_cast<uint16_t>(bufLen + buffer->DataLength());
+            iovCount++;
+        }
+
+        struct msghdr sendHeader;
+        memset(&sendHeader, 0, sizeof(sendHeader));
+        sendHeader.msg_iov    = sendIOVs;
+        sendHeader.msg_iovlen = static_cast<decltype(sendHeader.msg_iovlen)>(iovCount);
 
-        ssize_t lenSentRaw = send(mSocket, mSendQueue->Start(), bufLen, sendFlags);
+        ssize_t lenSentRaw = sendmsg(mSocket, &sendHeader, sendFlags);
 
         if (lenSentRaw == -1)
         {
@@ -509,21 +529,19 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
         // Mark the connection as being active.
         MarkActive();
 
-        if (lenSent < bufLen)
+        // Free the buffers that were sent completely, including any empty ones they are followed by.
+        mSendQueue.Consume(lenSent);
+        while (!mSendQueue.IsNull() && mSendQueue->DataLength() == 0)
         {
-            mSendQueue->ConsumeHead(lenSent);
+            mSendQueue.FreeHead();
         }
-        else
+        if (mSendQueue.IsNull())
         {
-            mSendQueue.FreeHead();
-            if (mSendQueue.IsNull())
+            // Do not wait for ability to write on this endpoint.
+            err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
+            if (err != CHIP_NO_ERROR)
             {
-                // Do not wait for ability to write on this endpoint.
-                err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
-                if (err != CHIP_NO_ERROR)
-                {
-                    break;
-                }
+                break;
             }
         }
 
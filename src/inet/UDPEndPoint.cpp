@@ -121,6 +121,32 @@ CHIP_ERROR UDPEndPoint::SendMsg(const IPPacketInfo * pktInfo, System::PacketBuff
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR UDPEndPoint::SendMsgs(const IPPacketInfo * pktInfos, System::PacketBufferHandle * msgs, size_t count)
+{
+    INET_FAULT_INJECT(FaultInjection::kFault_Send, return INET_ERROR_UNKNOWN_INTERFACE;);
+    INET_FAULT_INJECT(FaultInjection::kFault_SendNonCritical, return CHIP_ERROR_NO_MEMORY;);
+
+    CHIP_ERROR err = SendMsgsImpl(pktInfos, msgs, count);
+    for (size_t i = 0; i < count; i++)
+    {
+        msgs[i] = nullptr;
+    }
+    ReturnErrorOnFailure(err);
+
+    CHIP_SYSTEM_FAULT_INJECT_ASYNC_EVENT();
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR UDPEndPoint::SendMsgsImpl(const IPPacketInfo * pktInfos, System::PacketBufferHandle * msgs, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        ReturnErrorOnFailure(SendMsgImpl(&pktInfos[i], std::move(msgs[i])));
+    }
+    return CHIP_NO_ERROR;
+}
+
 void UDPEndPoint::Close()
 {
     if (mState != State::kClosed)
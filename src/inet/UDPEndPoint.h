@@ -227,6 +227,22 @@ public:
      */
     CHIP_ERROR SendMsg(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle && msg);
 
+    /**
+     * Send several UDP messages, each to its own destination.
+     *
+     *  Equivalent to calling SendMsg() for each (\c pktInfos[i], \c msgs[i]) pair in order, except that the implementation
+     *  may hand the whole batch to the network stack at once. Sending stops at the first message that fails. On return,
+     *  every buffer in \c msgs has been released, whether or not it was sent.
+     *
+     * @param[in]   pktInfos    Source and destination information, one entry per message.
+     * @param[in]   msgs        Packet buffers containing the UDP messages.
+     * @param[in]   count       Number of entries in \c pktInfos and \c msgs.
+     *
+     * @retval  CHIP_NO_ERROR   Success: all messages are queued for transmit.
+     * @retval  other           The error SendMsg() would have returned for the first message that could not be sent.
+     */
+    CHIP_ERROR SendMsgs(const IPPacketInfo * pktInfos, chip::System::PacketBufferHandle * msgs, size_t count);
+
     /**
      * Close the endpoint.
      *
@@ -296,6 +312,9 @@ protected:
     virtual CHIP_ERROR ListenImpl()                                                                                           = 0;
     virtual CHIP_ERROR SendMsgImpl(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle && msg)                     = 0;
     virtual void CloseImpl()                                                                                                  = 0;
+
+    // Sends the messages one at a time; implementations with a batched system call override this.
+    virtual CHIP_ERROR SendMsgsImpl(const IPPacketInfo * pktInfos, chip::System::PacketBufferHandle * msgs, size_t count);
 };
 
 template <>
@@ -34,6 +34,7 @@
 #include <sys/socket.h>
 #endif // HAVE_SYS_SOCKET_H
 
+#include <algorithm>
 #include <cerrno>
 #include <net/if.h>
 #include <netinet/in.h>
@@ -51,6 +52,10 @@
 #define INADDR_ANY 0
 #endif
 
+#if INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE > 1 && !defined(__linux__)
+#error "INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE > 1 requires recvmmsg() and sendmmsg(), which are only available on Linux."
+#endif // INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE > 1 && !defined(__linux__)
+
 #if CHIP_SYSTEM_CONFIG_USE_ZEPHYR_SOCKET_EXTENSIONS
 #include "ZephyrSocket.h"
 #endif // CHIP_SYSTEM_CONFIG_USE_ZEPHYR_SOCKET_EXTENSIONS
@@ -161,8 +166,76 @@ CHIP_ERROR IPv4Bind(int socket, const IPAddress & address, uint16_t port)
 }
 #endif // INET_CONFIG_ENABLE_IPV4
 
+// Fill in the source address and, from IP_PKTINFO/IPV6_PKTINFO control messages, the destination address and interface of
+// a received datagram.
+CHIP_ERROR ParseReceivedMessage(struct msghdr & msgHeader, const SockAddr & peerSockAddr, IPPacketInfo & packetInfo)
+{
+    if (peerSockAddr.any.sa_family == AF_INET6)
+    {
+        packetInfo.SrcAddress = IPAddress(peerSockAddr.in6.sin6_addr);
+        packetInfo.SrcPort    = ntohs(peerSockAddr.in6.sin6_port);
+    }
+#if INET_CONFIG_ENABLE_IPV4
+    else if (peerSockAddr.any.sa_family == AF_INET)
+    {
+        packetInfo.SrcAddress = IPAddress(peerSockAddr.in.sin_addr);
+        packetInfo.SrcPort    = ntohs(peerSockAddr.in.sin_port);
+    }
+#endif // INET_CONFIG_ENABLE_IPV4
+    else
+    {
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
+
+    for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
+         controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
+    {
+#if INET_CONFIG_ENABLE_IPV4
+#ifdef IP_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
+        {
+            auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex))
+            {
+                return CHIP_ERROR_INCORRECT_STATE;
+            }
+            packetInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
+            packetInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
+            continue;
+        }
+#endif // defined(IP_PKTINFO)
+#endif // INET_CONFIG_ENABLE_IPV4
+
+#ifdef IPV6_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
+        {
+            auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex))
+            {
+                return CHIP_ERROR_INCORRECT_STATE;
+            }
+            packetInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
+            packetInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
+            continue;
+        }
+#endif // defined(IPV6_PKTINFO)
+    }
+
+    return CHIP_NO_ERROR;
+}
+
 } // anonymous namespace
 
+struct UDPEndPointImplSockets::OutgoingMessage
+{
+    struct iovec msgIOVs[INET_CONFIG_SOCKET_SEND_MAX_IOVECS];
+    SockAddr peerSockAddr;
+#if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
+    uint8_t controlData[256];
+#endif // defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
+    struct msghdr msgHeader;
+};
+
 #if CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
 UDPEndPointImplSockets::MulticastGroupHandler UDPEndPointImplSockets::sJoinMulticastGroupHandler;
 UDPEndPointImplSockets::MulticastGroupHandler UDPEndPointImplSockets::sLeaveMulticastGroupHandler;
@@ -272,45 +345,49 @@ CHIP_ERROR UDPEndPointImplSockets::ListenImpl()
     return layer->RequestCallbackOnPendingRead(mWatch);
 }
 
-CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, System::PacketBufferHandle && msg)
+CHIP_ERROR UDPEndPointImplSockets::PrepareOutgoingMessage(const IPPacketInfo & aPktInfo, const System::PacketBufferHandle & msg,
+                                                          OutgoingMessage & outgoing)
 {
     // Ensure packet buffer is not null
     VerifyOrReturnError(!msg.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
 
     // Make sure we have the appropriate type of socket based on the
     // destination address.
-    ReturnErrorOnFailure(GetSocket(aPktInfo->DestAddress.Type()));
+    ReturnErrorOnFailure(GetSocket(aPktInfo.DestAddress.Type()));
 
     // Ensure the destination address type is compatible with the endpoint address type.
-    VerifyOrReturnError(mAddrType == aPktInfo->DestAddress.Type(), CHIP_ERROR_INVALID_ARGUMENT);
-
-    // For now the entire message must fit within a single buffer.
-    VerifyOrReturnError(!msg->HasChainedBuffer(), CHIP_ERROR_MESSAGE_TOO_LONG);
+    VerifyOrReturnError(mAddrType == aPktInfo.DestAddress.Type(), CHIP_ERROR_INVALID_ARGUMENT);
 
-    struct iovec msgIOV;
-    msgIOV.iov_base = msg->Start();
-    msgIOV.iov_len  = msg->DataLength();
+    // Gather the buffers of the chain into a single datagram.
+    size_t iovCount = 0;
+    for (System::PacketBufferHandle buffer = msg.Retain(); !buffer.IsNull(); buffer.Advance())
+    {
+        VerifyOrReturnError(iovCount < ArraySize(outgoing.msgIOVs), CHIP_ERROR_MESSAGE_TOO_LONG);
+        outgoing.msgIOVs[iovCount].iov_base = buffer->Start();
+        outgoing.msgIOVs[iovCount].iov_len  = buffer->DataLength();
+        iovCount++;
+    }
 
 #if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-    uint8_t controlData[256];
-    memset(controlData, 0, sizeof(controlData));
+    uint8_t * controlData = outgoing.controlData;
+    memset(controlData, 0, sizeof(outgoing.controlData));
 #endif // defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
 
-    struct msghdr msgHeader;
+    struct msghdr & msgHeader = outgoing.msgHeader;
     memset(&msgHeader, 0, sizeof(msgHeader));
-    msgHeader.msg_iov    = &msgIOV;
-    msgHeader.msg_iovlen = 1;
+    msgHeader.msg_iov    = outgoing.msgIOVs;
+    msgHeader.msg_iovlen = static_cast<decltype(msgHeader.msg_iovlen)>(iovCount);
 
     // Construct a sockaddr_in/sockaddr_in6 structure containing the destination information.
-    SockAddr peerSockAddr;
+    SockAddr & peerSockAddr = outgoing.peerSockAddr;
     memset(&peerSockAddr, 0, sizeof(peerSockAddr));
     msgHeader.msg_name = &peerSockAddr;
     if (mAddrType == IPAddressType::kIPv6)
     {
         peerSockAddr.in6.sin6_family     = AF_INET6;
-        peerSockAddr.in6.sin6_port       = htons(aPktInfo->DestPort);
-        peerSockAddr.in6.sin6_addr       = aPktInfo->DestAddress.ToIPv6();
-        InterfaceId::PlatformType intfId = aPktInfo->Interface.GetPlatformInterface();
+        peerSockAddr.in6.sin6_port       = htons(aPktInfo.DestPort);
+        peerSockAddr.in6.sin6_addr       = aPktInfo.DestAddress.ToIPv6();
+        InterfaceId::PlatformType intfId = aPktInfo.Interface.GetPlatformInterface();
         VerifyOrReturnError(CanCastTo<decltype(peerSockAddr.in6.sin6_scope_id)>(intfId), CHIP_ERROR_INCORRECT_STATE);
         peerSockAddr.in6.sin6_scope_id = static_cast<decltype(peerSockAddr.in6.sin6_scope_id)>(intfId);
         msgHeader.msg_namelen          = sizeof(sockaddr_in6);
@@ -319,8 +396,8 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     else
     {
         peerSockAddr.in.sin_family = AF_INET;
-        peerSockAddr.in.sin_port   = htons(aPktInfo->DestPort);
-        peerSockAddr.in.sin_addr   = aPktInfo->DestAddress.ToIPv4();
+        peerSockAddr.in.sin_port   = htons(aPktInfo.DestPort);
+        peerSockAddr.in.sin_addr   = aPktInfo.DestAddress.ToIPv4();
         msgHeader.msg_namelen      = sizeof(sockaddr_in);
     }
 #endif // INET_CONFIG_ENABLE_IPV4
@@ -331,7 +408,7 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     // for messages to multicast addresses, which under Linux
     // don't seem to get sent out the correct interface, despite
     // the socket being bound.
-    InterfaceId intf = aPktInfo->Interface;
+    InterfaceId intf = aPktInfo.Interface;
     if (!intf.IsPresent())
     {
         intf = mBoundIntfId;
@@ -342,11 +419,11 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     // address, construct an IP_PKTINFO/IPV6_PKTINFO "control message" to that effect
     // add add it to the message header.  If the local OS doesn't support IP_PKTINFO/IPV6_PKTINFO
     // fail with an error.
-    if (intf.IsPresent() || aPktInfo->SrcAddress.Type() != IPAddressType::kAny)
+    if (intf.IsPresent() || aPktInfo.SrcAddress.Type() != IPAddressType::kAny)
     {
 #if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
         msgHeader.msg_control    = controlData;
-        msgHeader.msg_controllen = sizeof(controlData);
+        msgHeader.msg_controllen = sizeof(outgoing.controlData);
 
         struct cmsghdr * controlHdr      = CMSG_FIRSTHDR(&msgHeader);
         InterfaceId::PlatformType intfId = intf.GetPlatformInterface();
@@ -367,7 +444,7 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
             }
 
             pktInfo->ipi_ifindex  = static_cast<decltype(pktInfo->ipi_ifindex)>(intfId);
-            pktInfo->ipi_spec_dst = aPktInfo->SrcAddress.ToIPv4();
+            pktInfo->ipi_spec_dst = aPktInfo.SrcAddress.ToIPv4();
 
             msgHeader.msg_controllen = CMSG_SPACE(sizeof(in_pktinfo));
 #else  // !defined(IP_PKTINFO)
@@ -390,7 +467,7 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
                 return CHIP_ERROR_UNEXPECTED_EVENT;
             }
             pktInfo->ipi6_ifindex = static_cast<decltype(pktInfo->ipi6_ifindex)>(intfId);
-            pktInfo->ipi6_addr    = aPktInfo->SrcAddress.ToIPv6();
+            pktInfo->ipi6_addr    = aPktInfo.SrcAddress.ToIPv6();
 
             msgHeader.msg_controllen = CMSG_SPACE(sizeof(in6_pktinfo));
 #else  // !defined(IPV6_PKTINFO)
@@ -404,19 +481,80 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     }
 #endif // INET_CONFIG_UDP_SOCKET_PKTINFO
 
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, System::PacketBufferHandle && msg)
+{
+    OutgoingMessage outgoing;
+    ReturnErrorOnFailure(PrepareOutgoingMessage(*aPktInfo, msg, outgoing));
+
     // Send IP packet.
-    const ssize_t lenSent = sendmsg(mSocket, &msgHeader, 0);
+    const ssize_t lenSent = sendmsg(mSocket, &outgoing.msgHeader, 0);
     if (lenSent == -1)
     {
         return CHIP_ERROR_POSIX(errno);
     }
-    if (lenSent != msg->DataLength())
+    if (lenSent != msg->TotalLength())
     {
         return CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG;
     }
     return CHIP_NO_ERROR;
 }
 
+#if INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE > 1
+CHIP_ERROR UDPEndPointImplSockets::SendMsgsImpl(const IPPacketInfo * pktInfos, System::PacketBufferHandle * msgs, size_t count)
+{
+    constexpr size_t kBatchSize = INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE;
+
+    OutgoingMessage outgoing[kBatchSize];
+    struct mmsghdr msgHeaders[kBatchSize];
+
+    while (count > 0)
+    {
+        // Prepare as many messages of this batch as possible; a message that cannot be prepared ends the batch, but the
+        // ones before it are still sent so that the outcome matches sending the messages one at a time.
+        const size_t batchSize = std::min(count, kBatchSize);
+        size_t prepared        = 0;
+        CHIP_ERROR err         = CHIP_NO_ERROR;
+        for (; prepared < batchSize; prepared++)
+        {
+            err = PrepareOutgoingMessage(pktInfos[prepared], msgs[prepared], outgoing[prepared]);
+            if (err != CHIP_NO_ERROR)
+            {
+                break;
+            }
+            msgHeaders[prepared].msg_hdr = outgoing[prepared].msgHeader;
+            msgHeaders[prepared].msg_len = 0;
+        }
+
+        // sendmmsg() may stop early (e.g. when the socket buffer fills up); resume after the last datagram it sent.
+        size_t sent = 0;
+        while (sent < prepared)
+        {
+            const int sentNow = sendmmsg(mSocket, &msgHeaders[sent], static_cast<unsigned int>(prepared - sent), 0);
+            if (sentNow < 0)
+            {
+                return CHIP_ERROR_POSIX(errno);
+            }
+            // Not even the first datagram went out, yet no error was reported: treat it as a short send, like SendMsgImpl().
+            VerifyOrReturnError(sentNow > 0, CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG);
+            for (const size_t end = sent + static_cast<size_t>(sentNow); sent < end; sent++)
+            {
+                VerifyOrReturnError(msgHeaders[sent].msg_len == msgs[sent]->TotalLength(), CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG);
+            }
+        }
+        ReturnErrorOnFailure(err);
+
+        pktInfos += batchSize;
+        msgs += batchSize;
+        count -= batchSize;
+    }
+
+    return CHIP_NO_ERROR;
+}
+#endif // INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE > 1
+
 void UDPEndPointImplSockets::CloseImpl()
 {
     if (mSocket != kInvalidSocketFd)
@@ -562,6 +700,110 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
         return;
     }
 
+#if INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE > 1
+    ReceiveMessageBatch();
+#else
+    ReceiveMessage();
+#endif // INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE > 1
+}
+
+#if INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE > 1
+
+void UDPEndPointImplSockets::ReceiveMessageBatch()
+{
+    constexpr size_t kBatchSize = INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE;
+
+    // Datagrams are received straight into packet buffers, and the batch is cut short where they run out.
+    System::PacketBufferHandle buffers[kBatchSize];
+    struct iovec msgIOV[kBatchSize];
+    SockAddr peerSockAddr[kBatchSize];
+    uint8_t controlData[kBatchSize][256];
+    struct mmsghdr msgHeaders[kBatchSize];
+    size_t batchSize = 0;
+
+    memset(peerSockAddr, 0, sizeof(peerSockAddr));
+    memset(msgHeaders, 0, sizeof(msgHeaders));
+
+    for (; batchSize < kBatchSize; batchSize++)
+    {
+        buffers[batchSize] = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+        if (buffers[batchSize].IsNull())
+        {
+            break;
+        }
+
+        msgIOV[batchSize].iov_base = buffers[batchSize]->Start();
+        msgIOV[batchSize].iov_len  = buffers[batchSize]->AvailableDataLength();
+
+        struct msghdr & msgHeader = msgHeaders[batchSize].msg_hdr;
+        msgHeader.msg_name        = &peerSockAddr[batchSize];
+        msgHeader.msg_namelen     = sizeof(peerSockAddr[batchSize]);
+        msgHeader.msg_iov         = &msgIOV[batchSize];
+        msgHeader.msg_iovlen      = 1;
+        msgHeader.msg_control     = controlData[batchSize];
+        msgHeader.msg_controllen  = sizeof(controlData[batchSize]);
+    }
+
+    if (batchSize == 0)
+    {
+        if (OnReceiveError != nullptr)
+        {
+            OnReceiveError(this, CHIP_ERROR_NO_MEMORY, nullptr);
+        }
+        return;
+    }
+
+    const int rcvCount = recvmmsg(mSocket, msgHeaders, static_cast<unsigned int>(batchSize), MSG_DONTWAIT, nullptr);
+    if (rcvCount < 0)
+    {
+        const CHIP_ERROR lStatus = CHIP_ERROR_POSIX(errno);
+        if (OnReceiveError != nullptr && lStatus != CHIP_ERROR_POSIX(EAGAIN))
+        {
+            OnReceiveError(this, lStatus, nullptr);
+        }
+        return;
+    }
+
+    IPPacketInfo packetInfo[kBatchSize];
+    CHIP_ERROR status[kBatchSize];
+
+    for (size_t i = 0; i < static_cast<size_t>(rcvCount); i++)
+    {
+        packetInfo[i].Clear();
+        packetInfo[i].DestPort  = mBoundPort;
+        packetInfo[i].Interface = mBoundIntfId;
+
+        if (msgHeaders[i].msg_hdr.msg_flags & MSG_TRUNC)
+        {
+            status[i] = CHIP_ERROR_INBOUND_MESSAGE_TOO_BIG;
+            continue;
+        }
+
+        buffers[i]->SetDataLength(static_cast<uint16_t>(msgHeaders[i].msg_len));
+        status[i] = ParseReceivedMessage(msgHeaders[i].msg_hdr, peerSockAddr[i], packetInfo[i]);
+    }
+
+    // A callback may close or free this endpoint; keep it alive until the whole batch has been handled, and stop
+    // delivering once it is no longer listening.
+    Retain();
+    for (size_t i = 0; i < static_cast<size_t>(rcvCount) && mState == State::kListening && OnMessageReceived != nullptr; i++)
+    {
+        if (status[i] == CHIP_NO_ERROR)
+        {
+            OnMessageReceived(this, std::move(buffers[i]), &packetInfo[i]);
+        }
+        else if (OnReceiveError != nullptr)
+        {
+            OnReceiveError(this, status[i], nullptr);
+        }
+    }
+    Release();
+}
+
+#else // INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE > 1
+
+void UDPEndPointImplSockets::ReceiveMessage()
+{
     CHIP_ERROR lStatus = CHIP_NO_ERROR;
     IPPacketInfo lPacketInfo;
     System::PacketBufferHandle lBuffer;
@@ -606,62 +848,7 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
         else
         {
             lBuffer->SetDataLength(static_cast<uint16_t>(rcvLen));
-
-            if (lPeerSockAddr.any.sa_family == AF_INET6)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in6.sin6_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in6.sin6_port);
-            }
-#if INET_CONFIG_ENABLE_IPV4
-            else if (lPeerSockAddr.any.sa_family == AF_INET)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in.sin_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in.sin_port);
-            }
-#endif // INET_CONFIG_ENABLE_IPV4
-            else
-            {
-                lStatus = CHIP_ERROR_INCORRECT_STATE;
-            }
-        }
-
-        if (lStatus == CHIP_NO_ERROR)
-        {
-            for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
-                 controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
-            {
-#if INET_CONFIG_ENABLE_IPV4
-#ifdef IP_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
-                {
-                    auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
-                    continue;
-                }
-#endif // defined(IP_PKTINFO)
-#endif // INET_CONFIG_ENABLE_IPV4
-
-#ifdef IPV6_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
-                {
-                    auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
-                    continue;
-                }
-#endif // defined(IPV6_PKTINFO)
-            }
+            lStatus = ParseReceivedMessage(msgHeader, lPeerSockAddr, lPacketInfo);
         }
     }
     else
@@ -683,6 +870,8 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
     }
 }
 
+#endif // INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE > 1
+
 #if IP_MULTICAST_LOOP || IPV6_MULTICAST_LOOP
 static CHIP_ERROR SocketsSetMulticastLoopback(int aSocket, bool aLoopback, int aProtocol, int aOption)
 {
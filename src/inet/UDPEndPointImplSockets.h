@@ -52,11 +52,24 @@ private:
     CHIP_ERROR BindInterfaceImpl(IPAddressType addressType, InterfaceId interfaceId) override;
     CHIP_ERROR ListenImpl() override;
     CHIP_ERROR SendMsgImpl(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle && msg) override;
+#if INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE > 1
+    CHIP_ERROR SendMsgsImpl(const IPPacketInfo * pktInfos, chip::System::PacketBufferHandle * msgs, size_t count) override;
+#endif // INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE > 1
     void CloseImpl() override;
 
+    // Message header and the storage it points to for one outgoing datagram.
+    struct OutgoingMessage;
+
     CHIP_ERROR GetSocket(IPAddressType addressType);
+    CHIP_ERROR PrepareOutgoingMessage(const IPPacketInfo & aPktInfo, const chip::System::PacketBufferHandle & msg,
+                                      OutgoingMessage & outgoing);
     void HandlePendingIO(System::SocketEvents events);
     static void HandlePendingIO(System::SocketEvents events, intptr_t data);
+#if INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE > 1
+    void ReceiveMessageBatch();
+#else
+    void ReceiveMessage();
+#endif // INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE > 1
 
     InterfaceId mBoundIntfId;
     uint16_t mBoundPort;
@@ -197,6 +197,22 @@
 #define CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS 8
 #endif // CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS
 
+/**
+ *  @def CHIP_CONFIG_UNSOLICITED_MESSAGE_HANDLER_INDEX
+ *
+ *  @brief
+ *    Enable (1) or disable (0) a direct-indexed (protocol, message type)
+ *    table for looking up unsolicited message handlers of the standard
+ *    protocols, instead of scanning all registered handlers for every
+ *    unsolicited message.
+ *
+ *    The table costs roughly 1.3KB of RAM.
+ *
+ */
+#ifndef CHIP_CONFIG_UNSOLICITED_MESSAGE_HANDLER_INDEX
+#define CHIP_CONFIG_UNSOLICITED_MESSAGE_HANDLER_INDEX 0
+#endif // CHIP_CONFIG_UNSOLICITED_MESSAGE_HANDLER_INDEX
+
 /**
  *  @def CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS
  *
@@ -208,6 +224,21 @@
 #define CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS 16
 #endif // CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS
 
+/**
+ *  @def CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS
+ *
+ *  @brief
+ *    Number of hash buckets in the index the exchange manager uses to match
+ *    incoming messages to active exchange contexts. Must be a power of two.
+ *
+ *    Each bucket is one pointer; the index should be sized to the number of
+ *    exchanges expected to be active at the same time.
+ *
+ */
+#ifndef CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS
+#define CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS 16
+#endif // CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS
+
 /**
  *  @def CHIP_CONFIG_MCSP_RECEIVE_TABLE_SIZE
  *
@@ -662,9 +693,14 @@
  * message states. The entries in the pool are automatically rotated by LRU. The size
  * of the pool limits how many PASE and CASE pairing sessions can be processed
  * simultaneously.
+ *
+ * Every handshake that CASEServer runs or queues holds one of these sessions, so the
+ * default grows with CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES and
+ * CHIP_CONFIG_CASE_SERVER_SIGMA1_QUEUE_SIZE.
  */
 #ifndef CHIP_CONFIG_UNAUTHENTICATED_CONNECTION_POOL_SIZE
-#define CHIP_CONFIG_UNAUTHENTICATED_CONNECTION_POOL_SIZE 4
+#define CHIP_CONFIG_UNAUTHENTICATED_CONNECTION_POOL_SIZE                                                                           \
+    (CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES + CHIP_CONFIG_CASE_SERVER_SIGMA1_QUEUE_SIZE + 3)
 #endif // CHIP_CONFIG_UNAUTHENTICATED_CONNECTION_POOL_SIZE
 
 /**
@@ -689,6 +725,22 @@
 #define CHIP_CONFIG_SECURE_SESSION_POOL_SIZE (CHIP_CONFIG_MAX_FABRICS * 3 + 2)
 #endif // CHIP_CONFIG_SECURE_SESSION_POOL_SIZE
 
+/**
+ * @def CHIP_CONFIG_SECURE_SESSION_INDEX_BUCKETS
+ *
+ * @brief Defines the number of hash buckets in each of the secure session
+ * table lookup indexes (by local session ID and by peer). Must be a power
+ * of two.
+ *
+ * Lookups cost one bucket walk, so this should be at least as large as the
+ * number of sessions expected to be live at the same time. Each bucket is
+ * one pointer per index.
+ *
+ */
+#ifndef CHIP_CONFIG_SECURE_SESSION_INDEX_BUCKETS
+#define CHIP_CONFIG_SECURE_SESSION_INDEX_BUCKETS 16
+#endif // CHIP_CONFIG_SECURE_SESSION_INDEX_BUCKETS
+
 /**
  * @def CHIP_CONFIG_SECURE_SESSION_REFCOUNT_LOGGING
  *
@@ -874,6 +926,52 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_SERVER_MAX_NUM_DIRTY_SET 8
 #endif
 
+/**
+ * @def CHIP_IM_SERVER_ATTRIBUTE_INTEREST_INDEX_BUCKETS
+ *
+ * @brief Defines the number of hash buckets of the reporting engine's index from (endpoint, cluster) to the attribute paths
+ *        read handlers are interested in, which lets an attribute change find the affected read handlers without visiting
+ *        all of them.  Must be a power of two.
+ */
+#ifndef CHIP_IM_SERVER_ATTRIBUTE_INTEREST_INDEX_BUCKETS
+#define CHIP_IM_SERVER_ATTRIBUTE_INTEREST_INDEX_BUCKETS 16
+#endif
+
+/**
+ * @def CHIP_IM_SERVER_REPORT_CACHE_SIZE
+ *
+ * @brief Defines the number of bytes of attribute reports the reporting engine encodes once and shares between the
+ *        subscriptions it services in a single run, so that subscribers reading the same attributes do not each read and
+ *        encode them again.  Set to 0 to disable the cache.
+ */
+#ifndef CHIP_IM_SERVER_REPORT_CACHE_SIZE
+#define CHIP_IM_SERVER_REPORT_CACHE_SIZE 0
+#endif
+
+/**
+ * @def CHIP_IM_SERVER_REPORT_CACHE_ENTRIES
+ *
+ * @brief Defines the maximum number of attribute paths in the report cache (see CHIP_IM_SERVER_REPORT_CACHE_SIZE).
+ */
+#ifndef CHIP_IM_SERVER_REPORT_CACHE_ENTRIES
+#define CHIP_IM_SERVER_REPORT_CACHE_ENTRIES 32
+#endif
+
+/**
+ * @def CHIP_CONFIG_CLUSTER_STATE_CACHE_FLAT_STORAGE
+ *
+ * @brief Keep the attributes of a ClusterStateCache in sorted vectors, with their values in a single arena per cache,
+ *        rather than in nested maps with a heap allocation per value.  This reduces the memory used by controllers that
+ *        cache the state of many nodes and speeds up lookups.
+ *
+ *        Values move when the arena grows or is compacted, so the buffers that ClusterStateCache::Get() returns are
+ *        invalidated by an update of any path, rather than only of their own.  Only enable this for controllers that
+ *        don't hold decoded values across updates of the cache.
+ */
+#ifndef CHIP_CONFIG_CLUSTER_STATE_CACHE_FLAT_STORAGE
+#define CHIP_CONFIG_CLUSTER_STATE_CACHE_FLAT_STORAGE 0
+#endif
+
 /**
  * @def CHIP_IM_MAX_NUM_WRITE_HANDLER
  *
@@ -1035,6 +1133,18 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_GROUP_CONCURRENT_ITERATORS 2
 #endif
 
+/**
+ * @def CHIP_CONFIG_MAX_GROUP_SESSION_INDEX_ENTRIES
+ *
+ * @brief Defines the number of operational group keys kept in the in-memory group session index
+ *
+ * Each entry holds the pre-derived encryption and privacy keys of one epoch key of a group-keyset mapping. When the
+ * configured group keys do not fit, incoming group messages are matched against persistent storage instead.
+ */
+#ifndef CHIP_CONFIG_MAX_GROUP_SESSION_INDEX_ENTRIES
+#define CHIP_CONFIG_MAX_GROUP_SESSION_INDEX_ENTRIES 8
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_GROUP_NAME_LENGTH
  *
@@ -1134,6 +1244,51 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
     "Please enable at least one of CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_FAST_COPY_SUPPORT or CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_FLEXIBLE_COPY_SUPPORT"
 #endif
 
+/**
+ * @def CHIP_CONFIG_ACCESS_CONTROL_INDEX
+ *
+ * @brief
+ *   Enable (1) or disable (0) the access control entry index.  When enabled,
+ *   AccessControl::Check consults a flattened copy of the access control
+ *   entries, grouped by fabric and auth mode, rather than iterating the entries
+ *   through their delegates on every check.  The index is rebuilt on the first
+ *   check after the entries change.
+ *
+ *   The index holds up to CHIP_CONFIG_ACCESS_CONTROL_INDEX_MAX_ENTRIES entries;
+ *   if the access control list holds more, checks iterate the entries instead.
+ */
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_INDEX
+#define CHIP_CONFIG_ACCESS_CONTROL_INDEX 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_ACCESS_CONTROL_INDEX_MAX_ENTRIES
+ *
+ * @brief
+ *   Maximum number of access control entries held by the access control entry
+ *   index, across all fabrics.  Room is reserved for the maximum number of
+ *   subjects and targets per entry of the example access control code.
+ */
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_INDEX_MAX_ENTRIES
+#define CHIP_CONFIG_ACCESS_CONTROL_INDEX_MAX_ENTRIES                                                                               \
+    (CHIP_CONFIG_MAX_FABRICS * CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_MAX_ENTRIES_PER_FABRIC)
+#endif
+
+/**
+ * @def CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE
+ *
+ * @brief
+ *   Number of access control decisions remembered by an
+ *   AccessControl::DecisionCache, which memoizes AccessControl::Check for the
+ *   subject of an interaction while one of its reports or invoke requests is
+ *   processed (e.g. for all attributes of a cluster in a wildcard read).
+ *
+ *   Set to 0 to disable decision caching.
+ */
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE
+#define CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE 4
+#endif
+
 /**
  * @def CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE
  *
@@ -1144,6 +1299,79 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE (3 * CHIP_CONFIG_MAX_FABRICS)
 #endif
 
+/**
+ * @def CHIP_CONFIG_PERSISTENT_STORAGE_BATCH_BUFFER_SIZE
+ *
+ * @brief
+ *   Size in bytes of the buffer in which BatchingPersistentStorageDelegate holds the updates of a
+ *   batch (see PersistentStorageDelegate::BeginBatch) until they are written to the backing storage
+ *   all at once. When non-zero, CommonCaseDeviceServerInitParams puts a BatchingPersistentStorageDelegate
+ *   in front of the KVS-based storage. Set to 0 to disable batching.
+ */
+#ifndef CHIP_CONFIG_PERSISTENT_STORAGE_BATCH_BUFFER_SIZE
+#define CHIP_CONFIG_PERSISTENT_STORAGE_BATCH_BUFFER_SIZE 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES
+ *
+ * @brief
+ *   Maximum number of CASE handshakes that CASEServer runs concurrently as a responder. Each
+ *   handshake in progress holds a secure session, so CHIP_CONFIG_SECURE_SESSION_POOL_SIZE should
+ *   leave room for them.
+ */
+#ifndef CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES
+#define CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES 1
+#endif
+
+/**
+ * @def CHIP_CONFIG_CASE_SERVER_MAX_HANDSHAKES_PER_FABRIC
+ *
+ * @brief
+ *   Maximum number of the concurrent CASE handshakes of CASEServer that may target the same fabric,
+ *   so that a burst of Sigma1 messages on one fabric does not starve the others.
+ */
+#ifndef CHIP_CONFIG_CASE_SERVER_MAX_HANDSHAKES_PER_FABRIC
+#define CHIP_CONFIG_CASE_SERVER_MAX_HANDSHAKES_PER_FABRIC CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES
+#endif
+
+/**
+ * @def CHIP_CONFIG_CASE_SERVER_SIGMA1_QUEUE_SIZE
+ *
+ * @brief
+ *   Number of Sigma1 messages that CASEServer holds while all of its responders are busy, instead
+ *   of dropping them. Each queued message holds an exchange and a packet buffer. Queued messages
+ *   are dropped once the initiator has stopped waiting for the response.
+ */
+#ifndef CHIP_CONFIG_CASE_SERVER_SIGMA1_QUEUE_SIZE
+#define CHIP_CONFIG_CASE_SERVER_SIGMA1_QUEUE_SIZE 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_CASE_SERVER_EXCHANGE_RESERVE
+ *
+ * @brief
+ *   Number of exchanges that CASEServer leaves free for other traffic, e.g. Interaction Model
+ *   and MRP, when it queues Sigma1 messages. A Sigma1 message that would eat into the reserve
+ *   can only take the place of a queued message of a busier fabric. Should be lower than
+ *   CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS.
+ */
+#ifndef CHIP_CONFIG_CASE_SERVER_EXCHANGE_RESERVE
+#define CHIP_CONFIG_CASE_SERVER_EXCHANGE_RESERVE 4
+#endif
+
+/**
+ * @def CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE
+ *
+ * @brief
+ *   Number of operational certificate chains whose signatures FabricTable remembers having
+ *   verified, so that CASE with a peer that was seen recently does not verify its chain again.
+ *   Each entry takes 36 bytes. Set to 0 to always verify the whole chain.
+ */
+#ifndef CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE
+#define CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE 8
+#endif
+
 /**
  * @def CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD
  *
@@ -110,6 +110,58 @@ public:
         CHIP_ERROR err = SyncGetKeyValue(key, nullptr, size);
         return (err == CHIP_ERROR_BUFFER_TOO_SMALL) || (err == CHIP_NO_ERROR);
     }
+
+    /**
+     * @brief
+     *   Start a batch of updates that belong to one logical change. Until the matching EndBatch(),
+     *   an implementation may defer the effect of SyncSetKeyValue/SyncDeleteKeyValue on the backing
+     *   store and apply them together, but reads must always observe them. Batches nest, and only
+     *   the outermost EndBatch() applies the deferred updates.
+     *
+     *   The default implementation applies every update immediately. Prefer PersistentStorageBatch
+     *   over calling this directly.
+     */
+    virtual void BeginBatch() {}
+
+    /**
+     * @brief
+     *   End the batch started by the matching BeginBatch().
+     *
+     * @return CHIP_NO_ERROR on success, or an error from the implementation if the deferred updates
+     *         could not all be applied.
+     */
+    virtual CHIP_ERROR EndBatch() { return CHIP_NO_ERROR; }
+};
+
+/**
+ * Scoped batch of updates on a PersistentStorageDelegate: the batch starts on construction and ends
+ * either on End(), which reports whether the updates were applied, or on destruction.
+ */
+class PersistentStorageBatch
+{
+public:
+    explicit PersistentStorageBatch(PersistentStorageDelegate * storage) : mStorage(storage)
+    {
+        if (mStorage != nullptr)
+        {
+            mStorage->BeginBatch();
+        }
+    }
+
+    ~PersistentStorageBatch() { End(); }
+
+    PersistentStorageBatch(const PersistentStorageBatch &) = delete;
+    PersistentStorageBatch & operator=(const PersistentStorageBatch &) = delete;
+
+    CHIP_ERROR End()
+    {
+        PersistentStorageDelegate * storage = mStorage;
+        mStorage                            = nullptr;
+        return (storage != nullptr) ? storage->EndBatch() : CHIP_NO_ERROR;
+    }
+
+private:
+    PersistentStorageDelegate * mStorage;
 };
 
 } // namespace chip
@@ -570,6 +570,14 @@ CHIP_ERROR TLVWriter::PutPreEncodedContainer(Tag tag, TLVType containerType, con
     return WriteData(data, dataLen);
 }
 
+CHIP_ERROR TLVWriter::PutPreEncodedElements(const uint8_t * data, uint32_t dataLen)
+{
+    if (IsContainerOpen())
+        return CHIP_ERROR_TLV_CONTAINER_OPEN;
+
+    return WriteData(data, dataLen);
+}
+
 CHIP_ERROR TLVWriter::CopyContainer(TLVReader & container)
 {
     return CopyContainer(container.GetTag(), container);
@@ -999,6 +999,37 @@ public:
      */
     CHIP_ERROR PutPreEncodedContainer(Tag tag, TLVType containerType, const uint8_t * data, uint32_t dataLen);
 
+    /**
+     * Encodes a set of pre-encoded TLV elements
+     *
+     * The PutPreEncodedElements() method writes zero or more full-encoded TLV elements, taken from a pre-encoded
+     * buffer, as members of the container currently being written.  The elements are copied as is, without being
+     * decoded, so their tags must conform to the rules associated with the current container (e.g. structure
+     * members must have tags, while array members must not).
+     *
+     * The elements may be supplied over several calls, for instance when they are read from a circular buffer and
+     * wrap around its end, provided that no other element is written, and the container is not closed, until the
+     * last element is complete.
+     *
+     * @param[in]   data            A pointer to a buffer containing the encoded TLV elements.
+     * @param[in]   dataLen         The number of bytes in the @p data buffer.
+     *
+     * @retval #CHIP_NO_ERROR      If the method succeeded.
+     * @retval #CHIP_ERROR_TLV_CONTAINER_OPEN
+     *                              If a container writer has been opened on the current writer and not
+     *                              yet closed.
+     * @retval #CHIP_ERROR_BUFFER_TOO_SMALL
+     *                              If writing the elements would exceed the limit on the maximum number of
+     *                              bytes specified when the writer was initialized.
+     * @retval #CHIP_ERROR_NO_MEMORY
+     *                              If an attempt to allocate an output buffer failed due to lack of
+     *                              memory.
+     * @retval other                Other CHIP or platform-specific errors returned by the configured
+     *                              TLVBackingStore.
+     *
+     */
+    CHIP_ERROR PutPreEncodedElements(const uint8_t * data, uint32_t dataLen);
+
     /**
      * Copies a TLV container element from TLVReader object
      *
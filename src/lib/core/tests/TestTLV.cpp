@@ -3177,6 +3177,82 @@ void TestTLVWriterCopyElement(nlTestSuite * inSuite)
     NL_TEST_ASSERT(inSuite, memcmpRes == 0);
 }
 
+/**
+ *  Test CHIP TLV Writer Put Pre-Encoded Elements
+ */
+void TestTLVWriterPutPreEncodedElements(nlTestSuite * inSuite)
+{
+    CHIP_ERROR err;
+    uint8_t expectedBuf[2048], testBuf[2048];
+    uint32_t expectedLen, testLen;
+    TLVWriter writer;
+    TLVWriter containerWriter;
+    TLVType outerContainerType;
+    enum
+    {
+        kRepeatCount = 3
+    };
+
+    writer.Init(expectedBuf);
+    writer.ImplicitProfileId = TestProfile_2;
+
+    err = writer.StartContainer(AnonymousTag(), kTLVType_Structure, outerContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    for (int i = 0; i < kRepeatCount; i++)
+    {
+        WriteEncoding1(inSuite, writer);
+    }
+
+    err = writer.EndContainer(outerContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = writer.Finalize();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    expectedLen = writer.GetLengthWritten();
+
+    writer.Init(testBuf);
+    writer.ImplicitProfileId = TestProfile_2;
+
+    err = writer.StartContainer(AnonymousTag(), kTLVType_Structure, outerContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    for (int i = 0; i < kRepeatCount; i++)
+    {
+        // The elements may be split over several calls, e.g. at the end of a circular buffer.
+        const uint32_t splitLen = static_cast<uint32_t>(i * sizeof(Encoding1) / kRepeatCount);
+
+        err = writer.PutPreEncodedElements(Encoding1, splitLen);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+        err = writer.PutPreEncodedElements(Encoding1 + splitLen, static_cast<uint32_t>(sizeof(Encoding1) - splitLen));
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    }
+
+    err = writer.EndContainer(outerContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = writer.Finalize();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    testLen = writer.GetLengthWritten();
+
+    NL_TEST_ASSERT(inSuite, testLen == expectedLen);
+
+    int memcmpRes = memcmp(testBuf, expectedBuf, testLen);
+    NL_TEST_ASSERT(inSuite, memcmpRes == 0);
+
+    // No elements can be written while a container writer is open.
+    writer.Init(testBuf);
+
+    err = writer.OpenContainer(AnonymousTag(), kTLVType_Structure, containerWriter);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = writer.PutPreEncodedElements(Encoding1, sizeof(Encoding1));
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_TLV_CONTAINER_OPEN);
+}
+
 void PreserveSizeWrite(nlTestSuite * inSuite, TLVWriter & writer, bool preserveSize)
 {
     CHIP_ERROR err;
@@ -3353,6 +3429,8 @@ void CheckTLVWriter(nlTestSuite * inSuite, void * inContext)
 
     TestTLVWriterCopyElement(inSuite);
 
+    TestTLVWriterPutPreEncodedElements(inSuite);
+
     TestTLVWriterPreserveSize(inSuite);
 
     TestTLVWriterErrorHandling(inSuite);
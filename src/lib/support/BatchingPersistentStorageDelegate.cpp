@@ -0,0 +1,326 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/BatchingPersistentStorageDelegate.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <string.h>
+
+namespace chip {
+
+namespace {
+
+// Pending updates are stored as consecutive records, which is also the format of the journal:
+//
+//     key length (1) | flags (1) | value length (2, little-endian) | key | value
+constexpr size_t kRecordHeaderSize = 4;
+constexpr size_t kMaxKeyLength     = UINT8_MAX;
+constexpr uint8_t kFlagDeleted     = 0x01;
+constexpr uint8_t kFlagSuperseded  = 0x02;
+
+size_t KeyLength(const uint8_t * record)
+{
+    return record[0];
+}
+
+uint8_t Flags(const uint8_t * record)
+{
+    return record[1];
+}
+
+uint16_t ValueLength(const uint8_t * record)
+{
+    return Encoding::LittleEndian::Get16(record + 2);
+}
+
+size_t RecordSize(const uint8_t * record)
+{
+    return kRecordHeaderSize + KeyLength(record) + ValueLength(record);
+}
+
+} // namespace
+
+CHIP_ERROR BatchingPersistentStorageDelegate::Init(PersistentStorageDelegate * storage, uint8_t * buffer, size_t bufferSize)
+{
+    VerifyOrReturnError(storage != nullptr && buffer != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(bufferSize <= UINT16_MAX, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mStorage        = storage;
+    mBuffer         = buffer;
+    mBufferSize     = bufferSize;
+    mUsedSize       = 0;
+    mLiveRecords    = 0;
+    mBatchDepth     = 0;
+    mJournalPending = false;
+    ApplyJournal();
+    return CHIP_NO_ERROR;
+}
+
+void BatchingPersistentStorageDelegate::ApplyJournal()
+{
+    const StorageKeyName journalKey = DefaultStorageKeyAllocator::PersistentStorageBatchJournal();
+
+    uint16_t size  = static_cast<uint16_t>(mBufferSize);
+    CHIP_ERROR err = mStorage->SyncGetKeyValue(journalKey.KeyName(), mBuffer, size);
+    VerifyOrReturn(err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    if (err == CHIP_NO_ERROR)
+    {
+        ChipLogProgress(Support, "Completing an interrupted storage batch");
+        err = ApplyRecords(mBuffer, size);
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Support, "Failed to complete an interrupted storage batch, dropping it: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+
+    // If the journal cannot be removed now, the next update retries before it could be overwritten.
+    mJournalPending = true;
+    err             = DeleteJournal();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Support, "Failed to delete storage batch journal: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+CHIP_ERROR BatchingPersistentStorageDelegate::DeleteJournal()
+{
+    VerifyOrReturnError(mJournalPending, CHIP_NO_ERROR);
+
+    CHIP_ERROR err = mStorage->SyncDeleteKeyValue(DefaultStorageKeyAllocator::PersistentStorageBatchJournal().KeyName());
+    err            = (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND) ? CHIP_NO_ERROR : err;
+    ReturnErrorOnFailure(err);
+    mJournalPending = false;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BatchingPersistentStorageDelegate::SyncGetKeyValue(const char * key, void * buffer, uint16_t & size)
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    const uint8_t * record = FindRecord(key);
+    if (record == nullptr)
+    {
+        return mStorage->SyncGetKeyValue(key, buffer, size);
+    }
+
+    VerifyOrReturnError(buffer != nullptr || size == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError((Flags(record) & kFlagDeleted) == 0, CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    const uint16_t valueLength = ValueLength(record);
+    const bool truncated       = size < valueLength;
+    size                       = truncated ? size : valueLength;
+    if (size > 0)
+    {
+        memcpy(buffer, record + kRecordHeaderSize + KeyLength(record), size);
+    }
+    return truncated ? CHIP_ERROR_BUFFER_TOO_SMALL : CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BatchingPersistentStorageDelegate::SyncSetKeyValue(const char * key, const void * value, uint16_t size)
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(value != nullptr || size == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    if (mBatchDepth == 0)
+    {
+        ReturnErrorOnFailure(DeleteJournal());
+        return mStorage->SyncSetKeyValue(key, value, size);
+    }
+    return AddRecord(key, value, size, 0);
+}
+
+CHIP_ERROR BatchingPersistentStorageDelegate::SyncDeleteKeyValue(const char * key)
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    if (mBatchDepth == 0)
+    {
+        ReturnErrorOnFailure(DeleteJournal());
+        return mStorage->SyncDeleteKeyValue(key);
+    }
+
+    const uint8_t * record = FindRecord(key);
+    const bool exists      = (record != nullptr) ? (Flags(record) & kFlagDeleted) == 0 : mStorage->SyncDoesKeyExist(key);
+    VerifyOrReturnError(exists, CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    return AddRecord(key, nullptr, 0, kFlagDeleted);
+}
+
+CHIP_ERROR BatchingPersistentStorageDelegate::EndBatch()
+{
+    VerifyOrReturnError(mBatchDepth > 0, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(--mBatchDepth == 0, CHIP_NO_ERROR);
+    return Flush();
+}
+
+uint8_t * BatchingPersistentStorageDelegate::FindRecord(const char * key)
+{
+    const size_t keyLength = strlen(key);
+    for (size_t offset = 0; offset < mUsedSize; offset += RecordSize(mBuffer + offset))
+    {
+        uint8_t * record = mBuffer + offset;
+        if ((Flags(record) & kFlagSuperseded) == 0 && KeyLength(record) == keyLength &&
+            memcmp(record + kRecordHeaderSize, key, keyLength) == 0)
+        {
+            return record;
+        }
+    }
+    return nullptr;
+}
+
+CHIP_ERROR BatchingPersistentStorageDelegate::AddRecord(const char * key, const void * value, uint16_t size, uint8_t flags)
+{
+    const size_t keyLength  = strlen(key);
+    const size_t recordSize = kRecordHeaderSize + keyLength + size;
+
+    uint8_t * previous = FindRecord(key);
+    if (previous != nullptr)
+    {
+        previous[1] |= kFlagSuperseded;
+        mLiveRecords--;
+    }
+
+    if (mUsedSize + recordSize > mBufferSize)
+    {
+        CompactRecords();
+    }
+    if (keyLength > kMaxKeyLength || mUsedSize + recordSize > mBufferSize)
+    {
+        ChipLogError(Support, "Storage batch does not fit in %u bytes, applying it early", static_cast<unsigned>(mBufferSize));
+        ReturnErrorOnFailure(Flush());
+        if (keyLength > kMaxKeyLength || recordSize > mBufferSize)
+        {
+            return (flags & kFlagDeleted) ? mStorage->SyncDeleteKeyValue(key) : mStorage->SyncSetKeyValue(key, value, size);
+        }
+    }
+
+    uint8_t * p = mBuffer + mUsedSize;
+    Encoding::Write8(p, static_cast<uint8_t>(keyLength));
+    Encoding::Write8(p, flags);
+    Encoding::LittleEndian::Write16(p, size);
+    memcpy(p, key, keyLength);
+    if (size > 0)
+    {
+        memcpy(p + keyLength, value, size);
+    }
+
+    mUsedSize += recordSize;
+    mLiveRecords++;
+    return CHIP_NO_ERROR;
+}
+
+void BatchingPersistentStorageDelegate::CompactRecords()
+{
+    size_t liveSize = 0;
+    for (size_t offset = 0; offset < mUsedSize;)
+    {
+        const size_t recordSize = RecordSize(mBuffer + offset);
+        if ((Flags(mBuffer + offset) & kFlagSuperseded) == 0)
+        {
+            memmove(mBuffer + liveSize, mBuffer + offset, recordSize);
+            liveSize += recordSize;
+        }
+        offset += recordSize;
+    }
+    mUsedSize = liveSize;
+}
+
+CHIP_ERROR BatchingPersistentStorageDelegate::Flush()
+{
+    CompactRecords();
+
+    // A single update is as atomic as the backing storage makes it, so only journal batches of several.
+    if (mLiveRecords > 1)
+    {
+        CHIP_ERROR err = mStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::PersistentStorageBatchJournal().KeyName(), mBuffer,
+                                                   static_cast<uint16_t>(mUsedSize));
+        if (err == CHIP_NO_ERROR)
+        {
+            mJournalPending = true;
+        }
+        else
+        {
+            ChipLogError(Support, "Failed to journal storage batch, applying it anyway: %" CHIP_ERROR_FORMAT, err.Format());
+        }
+    }
+
+    CHIP_ERROR err = ApplyRecords(mBuffer, mUsedSize);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Support, "Failed to apply storage batch, retrying: %" CHIP_ERROR_FORMAT, err.Format());
+        err = ApplyRecords(mBuffer, mUsedSize);
+    }
+    mUsedSize    = 0;
+    mLiveRecords = 0;
+
+    // Whether or not the batch made it, its journal must go: replaying it on the next Init() would
+    // overwrite whatever is written after this. If it cannot be deleted now, the next update retries.
+    CHIP_ERROR journalErr = DeleteJournal();
+    if (journalErr != CHIP_NO_ERROR)
+    {
+        ChipLogError(Support, "Failed to delete storage batch journal: %" CHIP_ERROR_FORMAT, journalErr.Format());
+    }
+    return err;
+}
+
+CHIP_ERROR BatchingPersistentStorageDelegate::ApplyRecords(const uint8_t * records, size_t length)
+{
+    CHIP_ERROR firstError = CHIP_NO_ERROR;
+    char key[kMaxKeyLength + 1];
+
+    // Let the backing storage commit the updates together too, e.g. in a single file rewrite.
+    PersistentStorageBatch batch(mStorage);
+
+    for (size_t offset = 0; offset < length;)
+    {
+        const uint8_t * record = records + offset;
+        VerifyOrReturnError(length - offset >= kRecordHeaderSize && length - offset >= RecordSize(record),
+                            CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+        offset += RecordSize(record);
+        VerifyOrReturnError((Flags(record) & kFlagSuperseded) == 0, CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+
+        memcpy(key, record + kRecordHeaderSize, KeyLength(record));
+        key[KeyLength(record)] = '\0';
+
+        CHIP_ERROR err = CHIP_NO_ERROR;
+        if (Flags(record) & kFlagDeleted)
+        {
+            err = mStorage->SyncDeleteKeyValue(key);
+            err = (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND) ? CHIP_NO_ERROR : err;
+        }
+        else
+        {
+            err = mStorage->SyncSetKeyValue(key, record + kRecordHeaderSize + KeyLength(record), ValueLength(record));
+        }
+
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Support, "Failed to apply batched update of %s: %" CHIP_ERROR_FORMAT, key, err.Format());
+            firstError = (firstError == CHIP_NO_ERROR) ? err : firstError;
+        }
+    }
+
+    CHIP_ERROR err = batch.End();
+    return (firstError != CHIP_NO_ERROR) ? firstError : err;
+}
+
+} // namespace chip
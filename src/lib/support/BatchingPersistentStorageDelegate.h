@@ -0,0 +1,83 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+
+/**
+ * PersistentStorageDelegate decorator that holds the updates of a batch (see
+ * PersistentStorageDelegate::BeginBatch) in memory and writes them to the backing storage when the
+ * outermost batch ends. Repeated updates of a key within a batch are coalesced into the last one.
+ *
+ * When a batch touches more than one key, its updates are first written to a journal entry of the
+ * backing storage, then applied, then the journal is removed. Init() applies a journal left behind
+ * by an interrupted batch, so that either all or none of the updates of a batch survive a reboot,
+ * as long as the backing storage writes a single key atomically. The updates are applied within a
+ * batch of the backing storage, so that e.g. KvsPersistentStorageDelegate commits them together.
+ *
+ * A batch that still fails to apply after a retry is given up on, and its journal is removed so
+ * that it cannot be replayed over later updates; so is a journal that Init() fails to apply.
+ *
+ * If the updates of a batch do not fit in the buffer, the ones held so far are applied early and the
+ * batch loses its atomicity, which is the behavior without batching.
+ */
+class BatchingPersistentStorageDelegate : public PersistentStorageDelegate
+{
+public:
+    /**
+     * Initialize with the backing storage and the buffer holding pending updates, and apply the
+     * journal of an interrupted batch, if any. Failing to apply the journal is logged, not returned.
+     *
+     * The buffer should be large enough for the biggest batch expected, plus 4 bytes and the key
+     * length for each update. It must not exceed UINT16_MAX bytes, the largest value the journal
+     * can be stored in.
+     */
+    CHIP_ERROR Init(PersistentStorageDelegate * storage, uint8_t * buffer, size_t bufferSize);
+
+    CHIP_ERROR SyncGetKeyValue(const char * key, void * buffer, uint16_t & size) override;
+    CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override;
+    CHIP_ERROR SyncDeleteKeyValue(const char * key) override;
+
+    void BeginBatch() override { mBatchDepth++; }
+    CHIP_ERROR EndBatch() override;
+
+private:
+    uint8_t * FindRecord(const char * key);
+    CHIP_ERROR AddRecord(const char * key, const void * value, uint16_t size, uint8_t flags);
+    void CompactRecords();
+    CHIP_ERROR Flush();
+    CHIP_ERROR ApplyRecords(const uint8_t * records, size_t length);
+    void ApplyJournal();
+    CHIP_ERROR DeleteJournal();
+
+    PersistentStorageDelegate * mStorage = nullptr;
+    uint8_t * mBuffer                    = nullptr;
+    size_t mBufferSize                   = 0;
+    size_t mUsedSize                     = 0;
+    size_t mLiveRecords                  = 0;
+    unsigned mBatchDepth                 = 0;
+    bool mJournalPending                 = false; // the journal may be in the backing storage
+};
+
+} // namespace chip
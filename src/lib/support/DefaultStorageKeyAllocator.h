@@ -106,6 +106,9 @@ public:
     static StorageKeyName FailSafeCommitMarkerKey() { return StorageKeyName::FromConst("g/fs/c"); }
     static StorageKeyName FailSafeNetworkConfig() { return StorageKeyName::FromConst("g/fs/n"); }
 
+    // Updates of a batch being applied by BatchingPersistentStorageDelegate
+    static StorageKeyName PersistentStorageBatchJournal() { return StorageKeyName::FromConst("g/psb"); }
+
     // LastKnownGoodTime
     static StorageKeyName LastKnownGoodTimeKey() { return StorageKeyName::FromConst("g/lkgt"); }
 
@@ -0,0 +1,334 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/BatchingPersistentStorageDelegate.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/PersistentStorageAudit.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <cstring>
+#include <string>
+
+#include <nlunit-test.h>
+
+using namespace chip;
+
+namespace {
+
+// Backing storage that counts the updates and batches it receives. It can be told to fail the
+// updates of one key a number of times, or to fail every update after a number of them, as if power
+// was lost.
+class CountingStorage : public TestPersistentStorageDelegate
+{
+public:
+    std::string mFailingKey;
+    size_t mFailures    = SIZE_MAX;
+    size_t mUpdatesLeft = SIZE_MAX;
+    size_t mSetCount    = 0;
+    size_t mDeleteCount = 0;
+    size_t mBatchCount  = 0;
+
+    void BeginBatch() override { mBatchCount++; }
+
+protected:
+    CHIP_ERROR SyncSetKeyValueInternal(const char * key, const void * value, uint16_t size) override
+    {
+        mSetCount++;
+        VerifyOrReturnError(!ShouldFail(key), CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+        return TestPersistentStorageDelegate::SyncSetKeyValueInternal(key, value, size);
+    }
+
+    CHIP_ERROR SyncDeleteKeyValueInternal(const char * key) override
+    {
+        mDeleteCount++;
+        VerifyOrReturnError(!ShouldFail(key), CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+        return TestPersistentStorageDelegate::SyncDeleteKeyValueInternal(key);
+    }
+
+private:
+    bool ShouldFail(const char * key)
+    {
+        VerifyOrReturnValue(mUpdatesLeft > 0, true);
+        mUpdatesLeft = (mUpdatesLeft == SIZE_MAX) ? mUpdatesLeft : mUpdatesLeft - 1;
+        VerifyOrReturnValue(mFailingKey == key && mFailures > 0, false);
+        mFailures = (mFailures == SIZE_MAX) ? mFailures : mFailures - 1;
+        return true;
+    }
+};
+
+bool ValueIs(PersistentStorageDelegate & storage, const char * key, const char * expected)
+{
+    char buf[64];
+    uint16_t size = sizeof(buf);
+    VerifyOrReturnValue(storage.SyncGetKeyValue(key, buf, size) == CHIP_NO_ERROR, false);
+    return size == strlen(expected) && memcmp(buf, expected, size) == 0;
+}
+
+CHIP_ERROR SetString(PersistentStorageDelegate & storage, const char * key, const char * value)
+{
+    return storage.SyncSetKeyValue(key, value, static_cast<uint16_t>(strlen(value)));
+}
+
+void TestApiAudit(nlTestSuite * inSuite, void * inContext)
+{
+    CountingStorage backing;
+    BatchingPersistentStorageDelegate storage;
+    uint8_t buffer[4096];
+
+    NL_TEST_ASSERT(inSuite, storage.Init(&backing, buffer, sizeof(buffer)) == CHIP_NO_ERROR);
+
+    // The decorator must behave like any storage, both outside and inside a batch.
+    NL_TEST_ASSERT(inSuite, audit::ExecutePersistentStorageApiAudit(storage));
+
+    storage.BeginBatch();
+    NL_TEST_ASSERT(inSuite, audit::ExecutePersistentStorageApiAudit(storage));
+    NL_TEST_ASSERT(inSuite, storage.EndBatch() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, storage.EndBatch() == CHIP_ERROR_INCORRECT_STATE);
+}
+
+void TestCoalescing(nlTestSuite * inSuite, void * inContext)
+{
+    CountingStorage backing;
+    BatchingPersistentStorageDelegate storage;
+    uint8_t buffer[256];
+
+    NL_TEST_ASSERT(inSuite, storage.Init(&backing, buffer, sizeof(buffer)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, SetString(backing, "old", "value") == CHIP_NO_ERROR);
+    backing.mSetCount = 0;
+
+    {
+        PersistentStorageBatch batch(&storage);
+        NL_TEST_ASSERT(inSuite, SetString(storage, "a", "1") == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, SetString(storage, "a", "22") == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, SetString(storage, "b", "3") == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, SetString(storage, "a", "444") == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, storage.SyncDeleteKeyValue("old") == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, storage.SyncDeleteKeyValue("old") == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+        NL_TEST_ASSERT(inSuite, storage.SyncDeleteKeyValue("missing") == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+        // The value of a key created and deleted within the batch never reaches the backing storage.
+        NL_TEST_ASSERT(inSuite, SetString(storage, "temp", "x") == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, storage.SyncDeleteKeyValue("temp") == CHIP_NO_ERROR);
+
+        // Reads observe the batch, the backing storage does not.
+        NL_TEST_ASSERT(inSuite, ValueIs(storage, "a", "444"));
+        NL_TEST_ASSERT(inSuite, !storage.SyncDoesKeyExist("old"));
+        NL_TEST_ASSERT(inSuite, !storage.SyncDoesKeyExist("temp"));
+        NL_TEST_ASSERT(inSuite, backing.mSetCount == 0 && backing.mDeleteCount == 0);
+        NL_TEST_ASSERT(inSuite, ValueIs(backing, "old", "value"));
+
+        NL_TEST_ASSERT(inSuite, batch.End() == CHIP_NO_ERROR);
+    }
+
+    // Journal, "a", "b", then the deletes of "old", "temp" and the journal. The updates themselves
+    // reach the backing storage as one batch.
+    NL_TEST_ASSERT(inSuite, backing.mBatchCount == 1);
+    NL_TEST_ASSERT(inSuite, backing.mSetCount == 3);
+    NL_TEST_ASSERT(inSuite, backing.mDeleteCount == 3);
+    NL_TEST_ASSERT(inSuite, ValueIs(backing, "a", "444"));
+    NL_TEST_ASSERT(inSuite, ValueIs(backing, "b", "3"));
+    NL_TEST_ASSERT(inSuite, !backing.SyncDoesKeyExist("old"));
+    NL_TEST_ASSERT(inSuite, !backing.SyncDoesKeyExist("temp"));
+    NL_TEST_ASSERT(inSuite, !backing.SyncDoesKeyExist(DefaultStorageKeyAllocator::PersistentStorageBatchJournal().KeyName()));
+}
+
+void TestNestingAndSingleUpdate(nlTestSuite * inSuite, void * inContext)
+{
+    CountingStorage backing;
+    BatchingPersistentStorageDelegate storage;
+    uint8_t buffer[256];
+
+    NL_TEST_ASSERT(inSuite, storage.Init(&backing, buffer, sizeof(buffer)) == CHIP_NO_ERROR);
+
+    storage.BeginBatch();
+    {
+        PersistentStorageBatch inner(&storage);
+        NL_TEST_ASSERT(inSuite, SetString(storage, "k", "first") == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, backing.mSetCount == 0);
+    NL_TEST_ASSERT(inSuite, SetString(storage, "k", "second") == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, storage.EndBatch() == CHIP_NO_ERROR);
+
+    // A batch of a single key is written directly, without a journal.
+    NL_TEST_ASSERT(inSuite, backing.mSetCount == 1);
+    NL_TEST_ASSERT(inSuite, backing.mDeleteCount == 0);
+    NL_TEST_ASSERT(inSuite, ValueIs(backing, "k", "second"));
+
+    // Outside of a batch, updates go straight through.
+    NL_TEST_ASSERT(inSuite, SetString(storage, "k", "third") == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, ValueIs(backing, "k", "third"));
+}
+
+void TestInterruptedBatch(nlTestSuite * inSuite, void * inContext)
+{
+    CountingStorage backing;
+    uint8_t buffer[256];
+
+    {
+        BatchingPersistentStorageDelegate storage;
+        NL_TEST_ASSERT(inSuite, storage.Init(&backing, buffer, sizeof(buffer)) == CHIP_NO_ERROR);
+
+        // Power is lost after the journal and "a" are written.
+        backing.mUpdatesLeft = 2;
+        PersistentStorageBatch batch(&storage);
+        NL_TEST_ASSERT(inSuite, SetString(storage, "a", "new a") == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, SetString(storage, "b", "new b") == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, batch.End() == CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+    }
+
+    // The batch was only partially applied, and its journal is still there.
+    NL_TEST_ASSERT(inSuite, ValueIs(backing, "a", "new a"));
+    NL_TEST_ASSERT(inSuite, !backing.SyncDoesKeyExist("b"));
+    NL_TEST_ASSERT(inSuite, backing.SyncDoesKeyExist(DefaultStorageKeyAllocator::PersistentStorageBatchJournal().KeyName()));
+
+    // After a "reboot", Init completes the batch.
+    backing.mUpdatesLeft = SIZE_MAX;
+    BatchingPersistentStorageDelegate storage;
+    NL_TEST_ASSERT(inSuite, storage.Init(&backing, buffer, sizeof(buffer)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, ValueIs(backing, "a", "new a"));
+    NL_TEST_ASSERT(inSuite, ValueIs(backing, "b", "new b"));
+    NL_TEST_ASSERT(inSuite, !backing.SyncDoesKeyExist(DefaultStorageKeyAllocator::PersistentStorageBatchJournal().KeyName()));
+}
+
+void TestFailedBatch(nlTestSuite * inSuite, void * inContext)
+{
+    CountingStorage backing;
+    uint8_t buffer[256];
+    BatchingPersistentStorageDelegate storage;
+
+    NL_TEST_ASSERT(inSuite, storage.Init(&backing, buffer, sizeof(buffer)) == CHIP_NO_ERROR);
+
+    // A transient failure is overcome by the retry.
+    backing.mFailingKey = "b";
+    backing.mFailures   = 1;
+    {
+        PersistentStorageBatch batch(&storage);
+        NL_TEST_ASSERT(inSuite, SetString(storage, "a", "1") == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, SetString(storage, "b", "1") == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, batch.End() == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, ValueIs(backing, "a", "1"));
+    NL_TEST_ASSERT(inSuite, ValueIs(backing, "b", "1"));
+
+    // A persistent one fails the batch, whose journal is removed anyway.
+    backing.mFailures = SIZE_MAX;
+    {
+        PersistentStorageBatch batch(&storage);
+        NL_TEST_ASSERT(inSuite, SetString(storage, "a", "2") == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, SetString(storage, "b", "2") == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, batch.End() == CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+    }
+    NL_TEST_ASSERT(inSuite, ValueIs(backing, "a", "2"));
+    NL_TEST_ASSERT(inSuite, ValueIs(backing, "b", "1"));
+    NL_TEST_ASSERT(inSuite, !backing.SyncDoesKeyExist(DefaultStorageKeyAllocator::PersistentStorageBatchJournal().KeyName()));
+
+    // So a later update is not overwritten on the next Init.
+    backing.mFailingKey.clear();
+    NL_TEST_ASSERT(inSuite, SetString(storage, "a", "3") == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, storage.Init(&backing, buffer, sizeof(buffer)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, ValueIs(backing, "a", "3"));
+    NL_TEST_ASSERT(inSuite, ValueIs(backing, "b", "1"));
+}
+
+void TestStaleJournal(nlTestSuite * inSuite, void * inContext)
+{
+    CountingStorage backing;
+    uint8_t buffer[256];
+    BatchingPersistentStorageDelegate storage;
+    const StorageKeyName journal = DefaultStorageKeyAllocator::PersistentStorageBatchJournal();
+    const char * journalKey      = journal.KeyName();
+
+    NL_TEST_ASSERT(inSuite, storage.Init(&backing, buffer, sizeof(buffer)) == CHIP_NO_ERROR);
+
+    // The batch is applied, but its journal cannot be removed yet.
+    backing.mUpdatesLeft = 3;
+    {
+        PersistentStorageBatch batch(&storage);
+        NL_TEST_ASSERT(inSuite, SetString(storage, "a", "1") == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, SetString(storage, "b", "1") == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, batch.End() == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, backing.SyncDoesKeyExist(journalKey));
+    backing.mUpdatesLeft = SIZE_MAX;
+
+    // The next update removes it first, so it cannot be replayed over that update.
+    NL_TEST_ASSERT(inSuite, SetString(storage, "a", "2") == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !backing.SyncDoesKeyExist(journalKey));
+    NL_TEST_ASSERT(inSuite, storage.Init(&backing, buffer, sizeof(buffer)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, ValueIs(backing, "a", "2"));
+
+    // A journal that cannot be applied is dropped rather than failing Init.
+    const uint8_t kCorruptJournal[] = { 0xFF, 0x00, 0x01, 0x00, 'a' };
+    NL_TEST_ASSERT(inSuite, backing.SyncSetKeyValue(journalKey, kCorruptJournal, sizeof(kCorruptJournal)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, storage.Init(&backing, buffer, sizeof(buffer)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !backing.SyncDoesKeyExist(journalKey));
+    NL_TEST_ASSERT(inSuite, ValueIs(backing, "a", "2"));
+}
+
+void TestOverflow(nlTestSuite * inSuite, void * inContext)
+{
+    CountingStorage backing;
+    BatchingPersistentStorageDelegate storage;
+    uint8_t buffer[32];
+    const char kLongValue[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+    NL_TEST_ASSERT(inSuite, storage.Init(&backing, buffer, sizeof(buffer)) == CHIP_NO_ERROR);
+
+    PersistentStorageBatch batch(&storage);
+    NL_TEST_ASSERT(inSuite, SetString(storage, "a", "0123456789") == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, SetString(storage, "b", "0123456789") == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, backing.mSetCount == 0);
+
+    // "c" does not fit next to "a" and "b", which get applied early.
+    NL_TEST_ASSERT(inSuite, SetString(storage, "c", "0123456789") == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, ValueIs(backing, "a", "0123456789"));
+    NL_TEST_ASSERT(inSuite, ValueIs(backing, "b", "0123456789"));
+
+    // A value larger than the whole buffer is written through.
+    NL_TEST_ASSERT(inSuite, SetString(storage, "d", kLongValue) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, ValueIs(backing, "c", "0123456789"));
+    NL_TEST_ASSERT(inSuite, ValueIs(backing, "d", kLongValue));
+
+    NL_TEST_ASSERT(inSuite, SetString(storage, "a", "last") == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, batch.End() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, ValueIs(backing, "a", "last"));
+    NL_TEST_ASSERT(inSuite, !backing.SyncDoesKeyExist(DefaultStorageKeyAllocator::PersistentStorageBatchJournal().KeyName()));
+}
+
+const nlTest sTests[] = { NL_TEST_DEF("Test API audit", TestApiAudit),
+                          NL_TEST_DEF("Test coalescing of batched updates", TestCoalescing),
+                          NL_TEST_DEF("Test nested batches and single updates", TestNestingAndSingleUpdate),
+                          NL_TEST_DEF("Test completion of an interrupted batch", TestInterruptedBatch),
+                          NL_TEST_DEF("Test batches that fail to apply", TestFailedBatch),
+                          NL_TEST_DEF("Test removal of stale journals", TestStaleJournal),
+                          NL_TEST_DEF("Test batches larger than the buffer", TestOverflow),
+                          NL_TEST_SENTINEL() };
+
+} // namespace
+
+int TestBatchingPersistentStorageDelegate()
+{
+    nlTestSuite theSuite = { "BatchingPersistentStorageDelegate tests", &sTests[0], nullptr, nullptr };
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestBatchingPersistentStorageDelegate);
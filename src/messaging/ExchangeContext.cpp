@@ -342,6 +342,8 @@ ExchangeContext::ExchangeContext(ExchangeManager * em, uint16_t ExchangeId, cons
     // Do not request Ack for multicast
     SetAutoRequestAck(!session->IsGroupSession());
 
+    mExchangeMgr->AddToExchangeIndex(this);
+
 #if defined(CHIP_EXCHANGE_CONTEXT_DETAIL_LOGGING)
     ChipLogDetail(ExchangeManager, "ec++ id: " ChipLogFormatExchange, ChipLogValueExchange(this));
 #endif
@@ -367,6 +369,7 @@ ExchangeContext::~ExchangeContext()
     // the boolean parameter passed to DoClose() should not matter.
 
     DoClose(false);
+    mExchangeMgr->RemoveFromExchangeIndex(this);
     mExchangeMgr = nullptr;
 
 #if defined(CHIP_EXCHANGE_CONTEXT_DETAIL_LOGGING)
@@ -248,6 +248,9 @@ private:
     ExchangeSessionHolder mSession; // The connection state
     uint16_t mExchangeId;           // Assigned exchange ID.
 
+    // Next exchange in the same ExchangeManager exchange index bucket.
+    ExchangeContext * mNextInExchangeIndex = nullptr;
+
     /**
      *  Track whether we are now expecting a response to a message sent via this exchange (because that
      *  message had the kExpectResponse flag set in its sendFlags).
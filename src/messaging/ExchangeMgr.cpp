@@ -82,6 +82,9 @@ CHIP_ERROR ExchangeManager::Init(SessionManager * sessionManager)
         // then re-initializes without removing registered handlers.
         handler.Reset();
     }
+#if CHIP_CONFIG_UNSOLICITED_MESSAGE_HANDLER_INDEX
+    memset(mUMHIndex, 0, sizeof(mUMHIndex));
+#endif // CHIP_CONFIG_UNSOLICITED_MESSAGE_HANDLER_INDEX
 
     sessionManager->SetMessageDelegate(this);
 
@@ -165,6 +168,14 @@ CHIP_ERROR ExchangeManager::RegisterUMH(Protocols::Id protocolId, int16_t msgTyp
     selected->ProtocolId  = protocolId;
     selected->MessageType = msgType;
 
+#if CHIP_CONFIG_UNSOLICITED_MESSAGE_HANDLER_INDEX
+    uint8_t * indexEntry = UMHIndexEntry(protocolId, msgType);
+    if (indexEntry != nullptr)
+    {
+        *indexEntry = static_cast<uint8_t>(selected - UMHandlerPool + 1);
+    }
+#endif // CHIP_CONFIG_UNSOLICITED_MESSAGE_HANDLER_INDEX
+
     SYSTEM_STATS_INCREMENT(chip::System::Stats::kExchangeMgr_NumUMHandlers);
 
     return CHIP_NO_ERROR;
@@ -177,6 +188,13 @@ CHIP_ERROR ExchangeManager::UnregisterUMH(Protocols::Id protocolId, int16_t msgT
         if (umh.IsInUse() && umh.Matches(protocolId, msgType))
         {
             umh.Reset();
+#if CHIP_CONFIG_UNSOLICITED_MESSAGE_HANDLER_INDEX
+            uint8_t * indexEntry = UMHIndexEntry(protocolId, msgType);
+            if (indexEntry != nullptr)
+            {
+                *indexEntry = 0;
+            }
+#endif // CHIP_CONFIG_UNSOLICITED_MESSAGE_HANDLER_INDEX
             SYSTEM_STATS_DECREMENT(chip::System::Stats::kExchangeMgr_NumUMHandlers);
             return CHIP_NO_ERROR;
         }
@@ -185,6 +203,90 @@ CHIP_ERROR ExchangeManager::UnregisterUMH(Protocols::Id protocolId, int16_t msgT
     return CHIP_ERROR_NO_UNSOLICITED_MESSAGE_HANDLER;
 }
 
+#if CHIP_CONFIG_UNSOLICITED_MESSAGE_HANDLER_INDEX
+uint8_t * ExchangeManager::UMHIndexEntry(Protocols::Id protocolId, int16_t msgType)
+{
+    if (protocolId.GetVendorId() != VendorId::Common || protocolId.GetProtocolId() >= kIndexedProtocolCount)
+    {
+        return nullptr;
+    }
+
+    uint8_t * row = mUMHIndex[protocolId.GetProtocolId()];
+    return (msgType == kAnyMessageType) ? &row[kUMHIndexAnyMessageType] : &row[static_cast<uint8_t>(msgType)];
+}
+#endif // CHIP_CONFIG_UNSOLICITED_MESSAGE_HANDLER_INDEX
+
+ExchangeManager::UnsolicitedMessageHandlerSlot * ExchangeManager::FindUMH(const PayloadHeader & payloadHeader)
+{
+    // Prefer handlers that can explicitly handle the message type over handlers that handle all messages for a protocol.
+#if CHIP_CONFIG_UNSOLICITED_MESSAGE_HANDLER_INDEX
+    const uint8_t * exactEntry = UMHIndexEntry(payloadHeader.GetProtocolID(), payloadHeader.GetMessageType());
+    if (exactEntry != nullptr)
+    {
+        uint8_t slot = *exactEntry;
+        if (slot == 0)
+        {
+            slot = *UMHIndexEntry(payloadHeader.GetProtocolID(), kAnyMessageType);
+        }
+        return (slot != 0) ? &UMHandlerPool[slot - 1] : nullptr;
+    }
+#endif // CHIP_CONFIG_UNSOLICITED_MESSAGE_HANDLER_INDEX
+
+    UnsolicitedMessageHandlerSlot * matchingUMH = nullptr;
+
+    for (auto & umh : UMHandlerPool)
+    {
+        if (umh.IsInUse() && payloadHeader.HasProtocol(umh.ProtocolId))
+        {
+            if (umh.MessageType == payloadHeader.GetMessageType())
+            {
+                return &umh;
+            }
+
+            if (umh.MessageType == kAnyMessageType)
+                matchingUMH = &umh;
+        }
+    }
+
+    return matchingUMH;
+}
+
+void ExchangeManager::AddToExchangeIndex(ExchangeContext * ec)
+{
+    ExchangeContext *& head  = mExchangeIndex[ExchangeIndexBucket(ec->GetExchangeId(), ec->IsInitiator())];
+    ec->mNextInExchangeIndex = head;
+    head                     = ec;
+}
+
+void ExchangeManager::RemoveFromExchangeIndex(ExchangeContext * ec)
+{
+    ExchangeContext ** link = &mExchangeIndex[ExchangeIndexBucket(ec->GetExchangeId(), ec->IsInitiator())];
+    while (*link != nullptr && *link != ec)
+    {
+        link = &(*link)->mNextInExchangeIndex;
+    }
+    if (*link == ec)
+    {
+        *link = ec->mNextInExchangeIndex;
+    }
+    ec->mNextInExchangeIndex = nullptr;
+}
+
+ExchangeContext * ExchangeManager::FindExchange(const SessionHandle & session, const PacketHeader & packetHeader,
+                                                const PayloadHeader & payloadHeader)
+{
+    // A message from the initiator of an exchange is destined to the responder side, and vice versa.
+    const size_t bucket = ExchangeIndexBucket(payloadHeader.GetExchangeID(), !payloadHeader.IsInitiator());
+    for (ExchangeContext * ec = mExchangeIndex[bucket]; ec != nullptr; ec = ec->mNextInExchangeIndex)
+    {
+        if (ec->MatchExchange(session, packetHeader, payloadHeader))
+        {
+            return ec;
+        }
+    }
+    return nullptr;
+}
+
 void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
                                         const SessionHandle & session, DuplicateMessage isDuplicate,
                                         System::PacketBufferHandle && msgBuf)
@@ -238,23 +340,14 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
     if (!packetHeader.IsGroupSession())
     {
         // Search for an existing exchange that the message applies to. If a match is found...
-        bool found = false;
-        mContextPool.ForEachActiveObject([&](auto * ec) {
-            if (ec->MatchExchange(session, packetHeader, payloadHeader))
-            {
-                ChipLogDetail(ExchangeManager, "Found matching exchange: " ChipLogFormatExchange ", Delegate: %p",
-                              ChipLogValueExchange(ec), ec->GetDelegate());
-
-                // Matched ExchangeContext; send to message handler.
-                ec->HandleMessage(packetHeader.GetMessageCounter(), payloadHeader, msgFlags, std::move(msgBuf));
-                found = true;
-                return Loop::Break;
-            }
-            return Loop::Continue;
-        });
-
-        if (found)
+        ExchangeContext * ec = FindExchange(session, packetHeader, payloadHeader);
+        if (ec != nullptr)
         {
+            ChipLogDetail(ExchangeManager, "Found matching exchange: " ChipLogFormatExchange ", Delegate: %p",
+                          ChipLogValueExchange(ec), ec->GetDelegate());
+
+            // Matched ExchangeContext; send to message handler.
+            ec->HandleMessage(packetHeader.GetMessageCounter(), payloadHeader, msgFlags, std::move(msgBuf));
             return;
         }
     }
@@ -277,24 +370,8 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
     // unsolicited messages must be marked as being from an initiator.
     if (!msgFlags.Has(MessageFlagValues::kDuplicateMessage) && payloadHeader.IsInitiator())
     {
-        // Search for an unsolicited message handler that can handle the message. Prefer handlers that can explicitly
-        // handle the message type over handlers that handle all messages for a profile.
-        matchingUMH = nullptr;
-
-        for (auto & umh : UMHandlerPool)
-        {
-            if (umh.IsInUse() && payloadHeader.HasProtocol(umh.ProtocolId))
-            {
-                if (umh.MessageType == payloadHeader.GetMessageType())
-                {
-                    matchingUMH = &umh;
-                    break;
-                }
-
-                if (umh.MessageType == kAnyMessageType)
-                    matchingUMH = &umh;
-            }
-        }
+        // Search for an unsolicited message handler that can handle the message.
+        matchingUMH = FindUMH(payloadHeader);
     }
     // Discard the message if it isn't marked as being sent by an initiator and the message does not need to send
     // an ack to the peer.
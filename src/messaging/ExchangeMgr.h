@@ -222,6 +222,29 @@ private:
         UnsolicitedMessageHandler * Handler;
     };
 
+    static constexpr size_t kExchangeIndexBuckets = CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS;
+    static_assert(kExchangeIndexBuckets > 0 && (kExchangeIndexBuckets & (kExchangeIndexBuckets - 1)) == 0,
+                  "CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS must be a power of two");
+
+    // Exchanges are indexed on their exchange ID and role, which never change over the lifetime of an exchange. The session
+    // is not part of the key because an exchange can lose or re-grab its session; chained entries are still matched in full.
+    static size_t ExchangeIndexBucket(uint16_t exchangeId, bool isInitiator)
+    {
+        return ((static_cast<size_t>(exchangeId) << 1) | (isInitiator ? 1u : 0u)) & (kExchangeIndexBuckets - 1);
+    }
+
+#if CHIP_CONFIG_UNSOLICITED_MESSAGE_HANDLER_INDEX
+    // Handlers for the standard protocols (Common vendor ID, protocol IDs below this bound) are looked up through mUMHIndex.
+    static constexpr uint16_t kIndexedProtocolCount = static_cast<uint16_t>(Protocols::Echo::Id.GetProtocolId() + 1);
+    // Column of mUMHIndex holding the wildcard (kAnyMessageType) handler of a protocol.
+    static constexpr size_t kUMHIndexAnyMessageType = UINT8_MAX + 1;
+    static_assert(CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS < UINT8_MAX,
+                  "Unsolicited message handler slots must be addressable by the uint8_t handler index");
+
+    // Returns the index cell for the given handler key, or nullptr if the protocol is not indexed.
+    uint8_t * UMHIndexEntry(Protocols::Id protocolId, int16_t msgType);
+#endif // CHIP_CONFIG_UNSOLICITED_MESSAGE_HANDLER_INDEX
+
     uint16_t mNextExchangeId;
     uint16_t mNextKeyId;
     State mState;
@@ -230,13 +253,28 @@ private:
 
     ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> mContextPool;
 
+    // Active exchange contexts, chained through ExchangeContext::mNextInExchangeIndex.
+    ExchangeContext * mExchangeIndex[kExchangeIndexBuckets] = {};
+
     SessionManager * mSessionManager;
     ReliableMessageMgr mReliableMessageMgr;
 
     UnsolicitedMessageHandlerSlot UMHandlerPool[CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS];
 
+#if CHIP_CONFIG_UNSOLICITED_MESSAGE_HANDLER_INDEX
+    // For each standard protocol and message type, 1 + the UMHandlerPool index of the registered handler, or 0 if none.
+    uint8_t mUMHIndex[kIndexedProtocolCount][kUMHIndexAnyMessageType + 1];
+#endif // CHIP_CONFIG_UNSOLICITED_MESSAGE_HANDLER_INDEX
+
     CHIP_ERROR RegisterUMH(Protocols::Id protocolId, int16_t msgType, UnsolicitedMessageHandler * handler);
     CHIP_ERROR UnregisterUMH(Protocols::Id protocolId, int16_t msgType);
+    UnsolicitedMessageHandlerSlot * FindUMH(const PayloadHeader & payloadHeader);
+
+    // Called by ExchangeContext on construction and destruction.
+    void AddToExchangeIndex(ExchangeContext * ec);
+    void RemoveFromExchangeIndex(ExchangeContext * ec);
+    ExchangeContext * FindExchange(const SessionHandle & session, const PacketHeader & packetHeader,
+                                   const PayloadHeader & payloadHeader);
 
     void OnMessageReceived(const PacketHeader & packetHeader, const PayloadHeader & payloadHeader, const SessionHandle & session,
                            DuplicateMessage isDuplicate, System::PacketBufferHandle && msgBuf) override;
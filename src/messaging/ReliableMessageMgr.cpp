@@ -21,6 +21,7 @@
  *
  */
 
+#include <algorithm>
 #include <errno.h>
 #include <inttypes.h>
 
@@ -28,6 +29,7 @@
 
 #include <lib/support/BitFlags.h>
 #include <lib/support/CHIPFaultInjection.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <messaging/ErrorCategory.h>
@@ -42,15 +44,17 @@ using namespace chip::System::Clock::Literals;
 namespace chip {
 namespace Messaging {
 
-ReliableMessageMgr::RetransTableEntry::RetransTableEntry(ReliableMessageContext * rc) :
-    ec(*rc->GetExchangeContext()), nextRetransTime(0), sendCount(0)
+RetransTableEntry::RetransTableEntry(ReliableMessageContext * rc) :
+    ec(*rc->GetExchangeContext()), nextRetransTime(0), firstSendTime(0), queueIndex(kNotScheduled), sendCount(0)
 {
     ec->SetMessageNotAcked(true);
+    rc->mRetransEntry = this;
 }
 
-ReliableMessageMgr::RetransTableEntry::~RetransTableEntry()
+RetransTableEntry::~RetransTableEntry()
 {
     ec->SetMessageNotAcked(false);
+    ec->GetReliableMessageContext()->mRetransEntry = nullptr;
 }
 
 ReliableMessageMgr::ReliableMessageMgr(ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool) :
@@ -70,10 +74,16 @@ void ReliableMessageMgr::Shutdown()
 
     // Clear the retransmit table
     mRetransTable.ForEachActiveObject([&](auto * entry) {
-        mRetransTable.ReleaseObject(entry);
+        ReleaseRetransEntry(*entry);
         return Loop::Continue;
     });
 
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    Platform::MemoryFree(mRetransQueue);
+    mRetransQueue         = nullptr;
+    mRetransQueueCapacity = 0;
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
     mSystemLayer = nullptr;
 }
 
@@ -115,10 +125,13 @@ void ReliableMessageMgr::ExecuteActions()
         }
     });
 
-    // Retransmit / cancel anything in the retrans table whose retrans timeout has expired
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
+    // Retransmit / cancel anything in the retrans table whose retrans timeout has expired. Every entry is visited at most
+    // once per call, even if it is rescheduled into the past.
+    for (size_t budget = mRetransQueueSize; budget > 0 && mRetransQueueSize > 0; budget--)
+    {
+        RetransTableEntry * entry = mRetransQueue[0];
         if (entry->nextRetransTime > now)
-            return Loop::Continue;
+            break;
 
         VerifyOrDie(!entry->retainedBuf.IsNull());
 
@@ -151,11 +164,13 @@ void ReliableMessageMgr::ExecuteActions()
             }
 
             // Do not StartTimer, we will schedule the timer at the end of the timer handler.
-            mRetransTable.ReleaseObject(entry);
-            return Loop::Continue;
+            mStatistics.failedMessages++;
+            ReleaseRetransEntry(*entry);
+            continue;
         }
 
         entry->sendCount++;
+        mStatistics.retransmissions++;
         ChipLogDetail(ExchangeManager,
                       "Retransmitting MessageCounter:" ChipLogFormatMessageCounter " on exchange " ChipLogFormatExchange
                       " Send Cnt %d",
@@ -165,10 +180,9 @@ void ReliableMessageMgr::ExecuteActions()
         System::Clock::Timestamp baseTimeout = entry->ec->GetSessionHandle()->GetMRPBaseTimeout();
         System::Clock::Timestamp backoff     = ReliableMessageMgr::GetBackoff(baseTimeout, entry->sendCount);
         entry->nextRetransTime               = System::SystemClock().GetMonotonicTimestamp() + backoff;
+        ScheduleRetransmission(*entry);
         SendFromRetransTable(entry);
-
-        return Loop::Continue;
-    });
+    }
 
     TicklessDebugDumpRetransTable("ReliableMessageMgr::ExecuteActions Dumping mRetransTable entries after processing");
 }
@@ -194,6 +208,10 @@ CHIP_ERROR ReliableMessageMgr::AddToRetransTable(ReliableMessageContext * rc, Re
 {
     VerifyOrDie(!rc->IsMessageNotAcked());
 
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    ReturnErrorOnFailure(ReserveRetransQueue(mStatistics.tableOccupancy + 1));
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
     *rEntry = mRetransTable.CreateObject(rc);
     if (*rEntry == nullptr)
     {
@@ -201,6 +219,8 @@ CHIP_ERROR ReliableMessageMgr::AddToRetransTable(ReliableMessageContext * rc, Re
         return CHIP_ERROR_RETRANS_TABLE_FULL;
     }
 
+    mStatistics.tableOccupancy++;
+    mStatistics.tableHighWaterMark = std::max(mStatistics.tableHighWaterMark, mStatistics.tableOccupancy);
     return CHIP_NO_ERROR;
 }
 
@@ -275,30 +295,36 @@ void ReliableMessageMgr::StartRetransmision(RetransTableEntry * entry)
     // Choose active/idle timeout from PeerActiveMode of session per 4.11.2.1. Retransmissions.
     System::Clock::Timestamp baseTimeout = entry->ec->GetSessionHandle()->GetMRPBaseTimeout();
     System::Clock::Timestamp backoff     = ReliableMessageMgr::GetBackoff(baseTimeout, entry->sendCount);
-    entry->nextRetransTime               = System::SystemClock().GetMonotonicTimestamp() + backoff;
+    entry->firstSendTime                 = System::SystemClock().GetMonotonicTimestamp();
+    entry->nextRetransTime               = entry->firstSendTime + backoff;
+    ScheduleRetransmission(*entry);
     StartTimer();
 }
 
 bool ReliableMessageMgr::CheckAndRemRetransTable(ReliableMessageContext * rc, uint32_t ackMessageCounter)
 {
-    bool removed = false;
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->ec->GetReliableMessageContext() == rc && entry->retainedBuf.GetMessageCounter() == ackMessageCounter)
-        {
-            // Clear the entry from the retransmision table.
-            ClearRetransTable(*entry);
-
-            ChipLogDetail(ExchangeManager,
-                          "Rxd Ack; Removing MessageCounter:" ChipLogFormatMessageCounter
-                          " from Retrans Table on exchange " ChipLogFormatExchange,
-                          ackMessageCounter, ChipLogValueExchange(rc->GetExchangeContext()));
-            removed = true;
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
+    RetransTableEntry * entry = rc->mRetransEntry;
+    if (entry == nullptr || entry->retainedBuf.GetMessageCounter() != ackMessageCounter)
+    {
+        return false;
+    }
 
-    return removed;
+    if (entry->queueIndex != RetransTableEntry::kNotScheduled)
+    {
+        System::Clock::Milliseconds64 latency = System::SystemClock().GetMonotonicTimestamp() - entry->firstSendTime;
+        mStatistics.acks++;
+        mStatistics.totalAckLatency += latency;
+        mStatistics.maxAckLatency = std::max(mStatistics.maxAckLatency, latency);
+    }
+
+    // Clear the entry from the retransmision table.
+    ClearRetransTable(*entry);
+
+    ChipLogDetail(ExchangeManager,
+                  "Rxd Ack; Removing MessageCounter:" ChipLogFormatMessageCounter
+                  " from Retrans Table on exchange " ChipLogFormatExchange,
+                  ackMessageCounter, ChipLogValueExchange(rc->GetExchangeContext()));
+    return true;
 }
 
 CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
@@ -354,23 +380,110 @@ CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
 
 void ReliableMessageMgr::ClearRetransTable(ReliableMessageContext * rc)
 {
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->ec->GetReliableMessageContext() == rc)
-        {
-            ClearRetransTable(*entry);
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
+    if (rc->mRetransEntry != nullptr)
+    {
+        ClearRetransTable(*rc->mRetransEntry);
+    }
 }
 
 void ReliableMessageMgr::ClearRetransTable(RetransTableEntry & entry)
 {
-    mRetransTable.ReleaseObject(&entry);
+    ReleaseRetransEntry(entry);
     // Expire any virtual ticks that have expired so all wakeup sources reflect the current time
     StartTimer();
 }
 
+void ReliableMessageMgr::ReleaseRetransEntry(RetransTableEntry & entry)
+{
+    UnscheduleRetransmission(entry);
+    mStatistics.tableOccupancy--;
+    mRetransTable.ReleaseObject(&entry);
+}
+
+void ReliableMessageMgr::ScheduleRetransmission(RetransTableEntry & entry)
+{
+    if (entry.queueIndex == RetransTableEntry::kNotScheduled)
+    {
+        PlaceInRetransQueue(&entry, mRetransQueueSize++);
+    }
+    SiftUpRetransQueue(entry.queueIndex);
+    SiftDownRetransQueue(entry.queueIndex);
+}
+
+void ReliableMessageMgr::UnscheduleRetransmission(RetransTableEntry & entry)
+{
+    VerifyOrReturn(entry.queueIndex != RetransTableEntry::kNotScheduled);
+
+    size_t index     = entry.queueIndex;
+    entry.queueIndex = RetransTableEntry::kNotScheduled;
+
+    // Fill the hole with the last entry and restore the heap order around it
+    RetransTableEntry * last = mRetransQueue[--mRetransQueueSize];
+    if (last != &entry)
+    {
+        PlaceInRetransQueue(last, index);
+        SiftUpRetransQueue(index);
+        SiftDownRetransQueue(last->queueIndex);
+    }
+}
+
+void ReliableMessageMgr::PlaceInRetransQueue(RetransTableEntry * entry, size_t index)
+{
+    mRetransQueue[index] = entry;
+    entry->queueIndex    = index;
+}
+
+void ReliableMessageMgr::SiftUpRetransQueue(size_t index)
+{
+    RetransTableEntry * entry = mRetransQueue[index];
+    while (index > 0)
+    {
+        size_t parent = (index - 1) / 2;
+        if (mRetransQueue[parent]->nextRetransTime <= entry->nextRetransTime)
+        {
+            break;
+        }
+        PlaceInRetransQueue(mRetransQueue[parent], index);
+        index = parent;
+    }
+    PlaceInRetransQueue(entry, index);
+}
+
+void ReliableMessageMgr::SiftDownRetransQueue(size_t index)
+{
+    RetransTableEntry * entry = mRetransQueue[index];
+    while (2 * index + 1 < mRetransQueueSize)
+    {
+        size_t child = 2 * index + 1;
+        if (child + 1 < mRetransQueueSize && mRetransQueue[child + 1]->nextRetransTime < mRetransQueue[child]->nextRetransTime)
+        {
+            child++;
+        }
+        if (entry->nextRetransTime <= mRetransQueue[child]->nextRetransTime)
+        {
+            break;
+        }
+        PlaceInRetransQueue(mRetransQueue[child], index);
+        index = child;
+    }
+    PlaceInRetransQueue(entry, index);
+}
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+CHIP_ERROR ReliableMessageMgr::ReserveRetransQueue(size_t count)
+{
+    VerifyOrReturnError(count > mRetransQueueCapacity, CHIP_NO_ERROR);
+
+    size_t capacity = std::max(count, std::max<size_t>(mRetransQueueCapacity * 2, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE));
+    auto * queue    = static_cast<RetransTableEntry **>(Platform::MemoryRealloc(mRetransQueue, capacity * sizeof(*mRetransQueue)));
+    VerifyOrReturnError(queue != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    mRetransQueue         = queue;
+    mRetransQueueCapacity = capacity;
+    return CHIP_NO_ERROR;
+}
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
 void ReliableMessageMgr::StartTimer()
 {
     // When do we need to next wake up to send an ACK?
@@ -384,13 +497,10 @@ void ReliableMessageMgr::StartTimer()
     });
 
     // When do we need to next wake up for ReliableMessageProtocol retransmit?
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime < nextWakeTime)
-        {
-            nextWakeTime = entry->nextRetransTime;
-        }
-        return Loop::Continue;
-    });
+    if (mRetransQueueSize > 0 && mRetransQueue[0]->nextRetransTime < nextWakeTime)
+    {
+        nextWakeTime = mRetransQueue[0]->nextRetransTime;
+    }
 
     if (nextWakeTime != System::Clock::Timestamp::max())
     {
@@ -453,6 +563,14 @@ CHIP_ERROR ReliableMessageMgr::MapSendError(CHIP_ERROR error, uint16_t exchangeI
     return error;
 }
 
+void ReliableMessageMgr::ResetStatistics()
+{
+    size_t tableOccupancy          = mStatistics.tableOccupancy;
+    mStatistics                    = Statistics();
+    mStatistics.tableOccupancy     = tableOccupancy;
+    mStatistics.tableHighWaterMark = tableOccupancy;
+}
+
 #if CHIP_CONFIG_TEST
 int ReliableMessageMgr::TestGetCountRetransTable()
 {
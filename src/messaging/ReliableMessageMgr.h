@@ -42,29 +42,50 @@ namespace Messaging {
 enum class SendMessageFlags : uint16_t;
 class ReliableMessageContext;
 
+/**
+ *  @class RetransTableEntry
+ *
+ *  @brief
+ *    This class is part of the CHIP Reliable Messaging Protocol and is used
+ *    to keep track of CHIP messages that have been sent and are expecting an
+ *    acknowledgment back. If the acknowledgment is not received within a
+ *    specific timeout, the message would be retransmitted from this table.
+ *
+ */
+struct RetransTableEntry
+{
+    static constexpr size_t kNotScheduled = SIZE_MAX;
+
+    RetransTableEntry(ReliableMessageContext * rc);
+    ~RetransTableEntry();
+
+    ExchangeHandle ec;                        /**< The context for the stored CHIP message. */
+    EncryptedPacketBufferHandle retainedBuf;  /**< The packet buffer holding the CHIP message. */
+    System::Clock::Timestamp nextRetransTime; /**< A counter representing the next retransmission time for the message. */
+    System::Clock::Timestamp firstSendTime;   /**< The time the message was first sent, used for ack latency statistics. */
+    size_t queueIndex;                        /**< Position in the retransmission deadline queue, or kNotScheduled. */
+    uint8_t sendCount;                        /**< The number of times we have tried to send this entry,
+                                                   including both successfully and failure send. */
+};
+
 class ReliableMessageMgr
 {
 public:
+    using RetransTableEntry = Messaging::RetransTableEntry;
+
     /**
-     *  @class RetransTableEntry
-     *
-     *  @brief
-     *    This class is part of the CHIP Reliable Messaging Protocol and is used
-     *    to keep track of CHIP messages that have been sent and are expecting an
-     *    acknowledgment back. If the acknowledgment is not received within a
-     *    specific timeout, the message would be retransmitted from this table.
-     *
+     *  Counters describing the activity of the retransmission table since Init() or the last ResetStatistics().
      */
-    struct RetransTableEntry
+    struct Statistics
     {
-        RetransTableEntry(ReliableMessageContext * rc);
-        ~RetransTableEntry();
-
-        ExchangeHandle ec;                        /**< The context for the stored CHIP message. */
-        EncryptedPacketBufferHandle retainedBuf;  /**< The packet buffer holding the CHIP message. */
-        System::Clock::Timestamp nextRetransTime; /**< A counter representing the next retransmission time for the message. */
-        uint8_t sendCount;                        /**< The number of times we have tried to send this entry,
-                                                       including both successfully and failure send. */
+        uint32_t retransmissions = 0; /**< Messages resent after their retransmission timeout expired. */
+        uint32_t failedMessages  = 0; /**< Messages dropped after the maximum number of retransmissions. */
+        uint32_t acks            = 0; /**< Messages acknowledged by the peer. */
+        /** Sum and maximum of the time between the first transmission of a message and its acknowledgment. */
+        System::Clock::Milliseconds64 totalAckLatency = System::Clock::Milliseconds64(0);
+        System::Clock::Milliseconds64 maxAckLatency   = System::Clock::Milliseconds64(0);
+        size_t tableOccupancy                         = 0; /**< Messages currently awaiting an acknowledgment. */
+        size_t tableHighWaterMark                     = 0; /**< Highest value reached by tableOccupancy. */
     };
 
     ReliableMessageMgr(ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool);
@@ -191,6 +212,13 @@ public:
      */
     static CHIP_ERROR MapSendError(CHIP_ERROR error, uint16_t exchangeId, bool isInitiator);
 
+    const Statistics & GetStatistics() const { return mStatistics; }
+
+    /**
+     * Reset the counters, except for the current table occupancy, which becomes the new high water mark.
+     */
+    void ResetStatistics();
+
 #if CHIP_CONFIG_TEST
     // Functions for testing
     int TestGetCountRetransTable();
@@ -221,9 +249,32 @@ private:
 
     void TicklessDebugDumpRetransTable(const char * log);
 
+    void ReleaseRetransEntry(RetransTableEntry & entry);
+
+    // Deadline queue: a binary min-heap of the scheduled entries ordered by nextRetransTime, so that the next
+    // retransmission is found without scanning the table.
+    void ScheduleRetransmission(RetransTableEntry & entry);
+    void UnscheduleRetransmission(RetransTableEntry & entry);
+    void PlaceInRetransQueue(RetransTableEntry * entry, size_t index);
+    void SiftUpRetransQueue(size_t index);
+    void SiftDownRetransQueue(size_t index);
+
     // ReliableMessageProtocol Global tables for timer context
     ObjectPool<RetransTableEntry, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE> mRetransTable;
 
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    // Grown in AddToRetransTable() as the table grows, so that scheduling an entry cannot fail.
+    CHIP_ERROR ReserveRetransQueue(size_t count);
+
+    RetransTableEntry ** mRetransQueue = nullptr;
+    size_t mRetransQueueCapacity       = 0;
+#else
+    RetransTableEntry * mRetransQueue[CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE];
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    size_t mRetransQueueSize = 0;
+
+    Statistics mStatistics;
+
     SessionUpdateDelegate * mSessionUpdateDelegate = nullptr;
 };
 
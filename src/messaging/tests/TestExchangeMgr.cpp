@@ -259,6 +259,52 @@ void CheckExchangeMessages(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
 }
 
+void CheckUmhPrefersMessageTypeHandler(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    CHIP_ERROR err;
+
+    MockAppDelegate protocolDelegate;
+    MockAppDelegate typeDelegate;
+    err = ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForProtocol(Protocols::BDX::Id, &protocolDelegate);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1, &typeDelegate);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // A message type with its own handler goes to that handler.
+    MockAppDelegate sendDelegate;
+    ExchangeContext * ec1 = ctx.NewExchangeToAlice(&sendDelegate);
+    ec1->SendMessage(Protocols::BDX::Id, kMsgType_TEST1, System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+                     SendFlags(Messaging::SendMessageFlags::kNoAutoRequestAck));
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(inSuite, typeDelegate.IsOnMessageReceivedCalled);
+    NL_TEST_ASSERT(inSuite, !protocolDelegate.IsOnMessageReceivedCalled);
+
+    // Other message types of the protocol go to the protocol-wide handler.
+    typeDelegate.IsOnMessageReceivedCalled = false;
+    ec1 = ctx.NewExchangeToAlice(&sendDelegate);
+    ec1->SendMessage(Protocols::BDX::Id, kMsgType_TEST2, System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+                     SendFlags(Messaging::SendMessageFlags::kNoAutoRequestAck));
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(inSuite, !typeDelegate.IsOnMessageReceivedCalled);
+    NL_TEST_ASSERT(inSuite, protocolDelegate.IsOnMessageReceivedCalled);
+
+    // Once the message type handler is gone, its messages fall back to the protocol-wide handler.
+    err = ctx.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    protocolDelegate.IsOnMessageReceivedCalled = false;
+    ec1 = ctx.NewExchangeToAlice(&sendDelegate);
+    ec1->SendMessage(Protocols::BDX::Id, kMsgType_TEST1, System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+                     SendFlags(Messaging::SendMessageFlags::kNoAutoRequestAck));
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(inSuite, !typeDelegate.IsOnMessageReceivedCalled);
+    NL_TEST_ASSERT(inSuite, protocolDelegate.IsOnMessageReceivedCalled);
+
+    err = ctx.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForProtocol(Protocols::BDX::Id);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+}
+
 // Test Suite
 
 /**
@@ -270,6 +316,7 @@ const nlTest sTests[] =
     NL_TEST_DEF("Test ExchangeMgr::NewContext",               CheckNewContextTest),
     NL_TEST_DEF("Test ExchangeMgr::CheckUmhRegistrationTest", CheckUmhRegistrationTest),
     NL_TEST_DEF("Test ExchangeMgr::CheckExchangeMessages",    CheckExchangeMessages),
+    NL_TEST_DEF("Test ExchangeMgr::CheckUmhPrefersType",      CheckUmhPrefersMessageTypeHandler),
     NL_TEST_DEF("Test OnConnectionExpired basics",            CheckSessionExpirationBasics),
     NL_TEST_DEF("Test OnConnectionExpired timeout handling",  CheckSessionExpirationTimeout),
     NL_TEST_DEF("Test session eviction in timeout handling",  CheckSessionExpirationDuringTimeout),
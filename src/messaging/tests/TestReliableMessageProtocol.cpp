@@ -289,6 +289,49 @@ void CheckAddClearRetrans(nlTestSuite * inSuite, void * inContext)
     exchange->Close();
 }
 
+void CheckRetransTableScheduling(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    MockAppDelegate mockAppDelegate;
+    ExchangeContext * exchanges[3];
+    ReliableMessageMgr::RetransTableEntry * entries[3];
+
+    ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    NL_TEST_ASSERT(inSuite, rm != nullptr);
+    rm->ResetStatistics();
+
+    for (size_t i = 0; i < ArraySize(exchanges); i++)
+    {
+        exchanges[i] = ctx.NewExchangeToAlice(&mockAppDelegate);
+        NL_TEST_ASSERT(inSuite, exchanges[i] != nullptr);
+        NL_TEST_ASSERT(inSuite, rm->AddToRetransTable(exchanges[i]->GetReliableMessageContext(), &entries[i]) == CHIP_NO_ERROR);
+        rm->StartRetransmision(entries[i]);
+    }
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 3);
+    NL_TEST_ASSERT(inSuite, rm->GetStatistics().tableOccupancy == 3);
+    NL_TEST_ASSERT(inSuite, rm->GetStatistics().tableHighWaterMark == 3);
+
+    // Entries are found through their exchange, whatever their position in the deadline queue
+    rm->ClearRetransTable(exchanges[1]->GetReliableMessageContext());
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 2);
+    NL_TEST_ASSERT(inSuite, !exchanges[1]->GetReliableMessageContext()->IsMessageNotAcked());
+    rm->ClearRetransTable(exchanges[1]->GetReliableMessageContext());
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 2);
+
+    rm->ClearRetransTable(*entries[0]);
+    rm->ClearRetransTable(*entries[2]);
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 0);
+    NL_TEST_ASSERT(inSuite, rm->GetStatistics().tableOccupancy == 0);
+    NL_TEST_ASSERT(inSuite, rm->GetStatistics().tableHighWaterMark == 3);
+    NL_TEST_ASSERT(inSuite, rm->GetStatistics().retransmissions == 0);
+
+    for (auto * exchange : exchanges)
+    {
+        exchange->Close();
+    }
+}
+
 /**
  * Tests MRP retransmission logic with the following scenario:
  *
@@ -349,6 +392,7 @@ void CheckResendApplicationMessage(nlTestSuite * inSuite, void * inContext)
 
     // Ensure the retransmit table is empty right now
     NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 0);
+    rm->ResetStatistics();
 
     // Ensure the exchange stays open after we send (unlike the CheckCloseExchangeAndResendApplicationMessage case), by claiming to
     // expect a response.
@@ -429,6 +473,12 @@ void CheckResendApplicationMessage(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, loopback.mDroppedMessageCount == 4);
     NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 0);
 
+    // Ensure the retransmissions and the final ack were accounted for
+    NL_TEST_ASSERT(inSuite, rm->GetStatistics().retransmissions == 4);
+    NL_TEST_ASSERT(inSuite, rm->GetStatistics().acks == 1);
+    NL_TEST_ASSERT(inSuite, rm->GetStatistics().failedMessages == 0);
+    NL_TEST_ASSERT(inSuite, rm->GetStatistics().tableHighWaterMark == 1);
+
     exchange->Close();
 }
 
@@ -1692,6 +1742,7 @@ int InitializeTestCase(void * inContext)
 const nlTest sTests[] =
 {
     NL_TEST_DEF("Test ReliableMessageMgr::CheckAddClearRetrans", CheckAddClearRetrans),
+    NL_TEST_DEF("Test ReliableMessageMgr::CheckRetransTableScheduling", CheckRetransTableScheduling),
     NL_TEST_DEF("Test ReliableMessageMgr::CheckResendApplicationMessage", CheckResendApplicationMessage),
     NL_TEST_DEF("Test ReliableMessageMgr::CheckCloseExchangeAndResendApplicationMessage", CheckCloseExchangeAndResendApplicationMessage),
     NL_TEST_DEF("Test ReliableMessageMgr::CheckFailedMessageRetainOnSend", CheckFailedMessageRetainOnSend),
@@ -54,6 +54,41 @@
 // These are configuration options that are unique to Linux platforms.
 // These can be overridden by the application as needed.
 
+/**
+ * @def CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STORAGE
+ *
+ * @brief
+ *   Store the KeyValueStoreManager entries in an append-only log (ChipLinuxLogStorage) instead of
+ *   rewriting the whole INI file on every Put or Delete. The log is kept next to the INI file, in
+ *   `<file>.log`, and the INI entries are imported into it the first time it is opened.
+ */
+#ifndef CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STORAGE
+#define CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STORAGE 0
+#endif // CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STORAGE
+
+/**
+ * @def CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_SYNC_INTERVAL_MS
+ *
+ * @brief
+ *   When 0, each Put or Delete on the KVS log is synced to disk before it returns, with concurrent
+ *   writers sharing one sync. Otherwise writes return once they reach the OS and a background thread
+ *   syncs them at most this many milliseconds later.
+ */
+#ifndef CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_SYNC_INTERVAL_MS
+#define CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_SYNC_INTERVAL_MS 1000
+#endif // CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_SYNC_INTERVAL_MS
+
+/**
+ * @def CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_COMPACTION_THRESHOLD
+ *
+ * @brief
+ *   Minimum size in bytes of the KVS log before it is compacted. Above it, the log is rewritten in the
+ *   background once superseded and deleted records take more than half of it.
+ */
+#ifndef CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_COMPACTION_THRESHOLD
+#define CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_COMPACTION_THRESHOLD (64 * 1024)
+#endif // CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_COMPACTION_THRESHOLD
+
 // ========== Platform-specific Configuration Overrides =========
 
 #ifndef CHIP_DEVICE_CONFIG_CHIP_TASK_STACK_SIZE
@@ -64,10 +99,28 @@
 #define CHIP_DEVICE_CONFIG_THREAD_TASK_STACK_SIZE 8192
 #endif // CHIP_DEVICE_CONFIG_THREAD_TASK_STACK_SIZE
 
+// Run session establishment crypto on a pool of background threads, once the application has
+// called PlatformMgr().StartBackgroundEventLoopTask().
+#ifndef CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+#define CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING 1
+#endif // CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+
+#ifndef CHIP_DEVICE_CONFIG_BG_TASK_COUNT
+#define CHIP_DEVICE_CONFIG_BG_TASK_COUNT 2
+#endif // CHIP_DEVICE_CONFIG_BG_TASK_COUNT
+
+#ifndef CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE
+#define CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE 32
+#endif // CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE
+
 #ifndef CHIP_DEVICE_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS
 #define CHIP_DEVICE_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS 1
 #endif // CHIP_DEVICE_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS
 
+#ifndef CHIP_DEVICE_CONFIG_EVENT_LOGGING_INDEX_BYTES_PER_ENTRY
+#define CHIP_DEVICE_CONFIG_EVENT_LOGGING_INDEX_BYTES_PER_ENTRY 32
+#endif // CHIP_DEVICE_CONFIG_EVENT_LOGGING_INDEX_BYTES_PER_ENTRY
+
 #define CHIP_DEVICE_CONFIG_ENABLE_WIFI_TELEMETRY 0
 #define CHIP_DEVICE_CONFIG_ENABLE_THREAD_TELEMETRY 0
 #define CHIP_DEVICE_CONFIG_ENABLE_THREAD_TELEMETRY_FULL 0
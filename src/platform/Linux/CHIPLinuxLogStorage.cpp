@@ -0,0 +1,592 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *         Implements a log-structured key-value store for the Linux
+ *         KeyValueStoreManager.
+ *
+ *         The log starts with an 8-byte magic and is followed by records of the form:
+ *
+ *             crc32 (4) | op (1) | key length (2) | value length (4) | key | value
+ *
+ *         with little-endian integers and a CRC covering everything after it.
+ *         Replay stops at the first incomplete or corrupted record, which can only
+ *         be the tail of an interrupted write, and truncates it away.
+ *
+ */
+
+#include <platform/Linux/CHIPLinuxLogStorage.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <libgen.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceConfig.h>
+#include <platform/Linux/CHIPLinuxStorageIni.h>
+#include <system/SystemError.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+namespace {
+
+constexpr uint8_t kLogMagic[]       = { 'C', 'H', 'I', 'P', 'K', 'V', 'L', 1 };
+constexpr size_t kLogHeaderSize     = sizeof(kLogMagic);
+constexpr size_t kRecordCrcSize     = 4;
+constexpr size_t kRecordHeaderSize  = kRecordCrcSize + 1 + 2 + 4;
+constexpr uint8_t kRecordOpPut      = 1;
+constexpr uint8_t kRecordOpDelete   = 2;
+constexpr uint32_t kCrc32Polynomial = 0xEDB88320;
+
+constexpr std::array<uint32_t, 256> MakeCrc32Table()
+{
+    std::array<uint32_t, 256> table{};
+    for (uint32_t i = 0; i < table.size(); i++)
+    {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 1) ? (crc >> 1) ^ kCrc32Polynomial : (crc >> 1);
+        }
+        table[i] = crc;
+    }
+    return table;
+}
+
+constexpr std::array<uint32_t, 256> kCrc32Table = MakeCrc32Table();
+
+uint32_t Crc32(const uint8_t * data, size_t length)
+{
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < length; i++)
+    {
+        crc = kCrc32Table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFF;
+}
+
+size_t RecordSize(const std::string & key, size_t valueSize)
+{
+    return kRecordHeaderSize + key.size() + valueSize;
+}
+
+void EncodeRecord(std::vector<uint8_t> & out, uint8_t op, const std::string & key, const void * value, size_t valueSize)
+{
+    const size_t start = out.size();
+    out.resize(start + RecordSize(key, valueSize));
+
+    uint8_t * p = out.data() + start + kRecordCrcSize;
+    Encoding::Write8(p, op);
+    Encoding::LittleEndian::Write16(p, static_cast<uint16_t>(key.size()));
+    Encoding::LittleEndian::Write32(p, static_cast<uint32_t>(valueSize));
+    memcpy(p, key.data(), key.size());
+    if (valueSize > 0)
+    {
+        memcpy(p + key.size(), value, valueSize);
+    }
+
+    p = out.data() + start;
+    Encoding::LittleEndian::Put32(p, Crc32(p + kRecordCrcSize, out.size() - start - kRecordCrcSize));
+}
+
+CHIP_ERROR WriteFully(int fd, const uint8_t * data, size_t length, off_t offset)
+{
+    while (length > 0)
+    {
+        ssize_t written = pwrite(fd, data, length, offset);
+        if (written < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        VerifyOrReturnError(written > 0, CHIP_ERROR_POSIX(written < 0 ? errno : EIO));
+        data += written;
+        length -= static_cast<size_t>(written);
+        offset += written;
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ReadFully(int fd, void * buffer, size_t length, off_t offset)
+{
+    uint8_t * data = static_cast<uint8_t *>(buffer);
+    while (length > 0)
+    {
+        ssize_t bytesRead = pread(fd, data, length, offset);
+        if (bytesRead < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        VerifyOrReturnError(bytesRead > 0, bytesRead < 0 ? CHIP_ERROR_POSIX(errno) : CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+        data += bytesRead;
+        length -= static_cast<size_t>(bytesRead);
+        offset += bytesRead;
+    }
+    return CHIP_NO_ERROR;
+}
+
+// Replace the file at `path` with `contents` so that a crash leaves either the old or the new file in place.
+//
+// If `outFd` is not null, it receives a read-write descriptor of the new file, which was opened before the file was put in
+// place: the caller never ends up holding the old file once the new one is visible at `path`.
+CHIP_ERROR ReplaceFile(const std::string & path, const std::vector<uint8_t> & contents, int * outFd = nullptr)
+{
+    std::string tmpPath = path + "-XXXXXX";
+    int fd              = mkostemp(&tmpPath[0], O_CLOEXEC);
+    VerifyOrReturnError(fd >= 0, CHIP_ERROR_POSIX(errno));
+
+    CHIP_ERROR err = WriteFully(fd, contents.data(), contents.size(), 0);
+    if (err == CHIP_NO_ERROR && fsync(fd) != 0)
+    {
+        err = CHIP_ERROR_POSIX(errno);
+    }
+    if (err == CHIP_NO_ERROR && rename(tmpPath.c_str(), path.c_str()) != 0)
+    {
+        err = CHIP_ERROR_POSIX(errno);
+    }
+    if (err != CHIP_NO_ERROR || outFd == nullptr)
+    {
+        close(fd);
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        unlink(tmpPath.c_str());
+        return err;
+    }
+
+    // Sync the directory too, so that the rename itself survives a power loss.
+    std::string dirPath = path;
+    int dirFd           = open(dirname(&dirPath[0]), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (dirFd >= 0)
+    {
+        fsync(dirFd);
+        close(dirFd);
+    }
+
+    if (outFd != nullptr)
+    {
+        *outFd = fd;
+    }
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+ChipLinuxLogStorage::~ChipLinuxLogStorage()
+{
+    Shutdown();
+}
+
+CHIP_ERROR ChipLinuxLogStorage::Init(const char * logFile, const char * iniFile, uint32_t syncIntervalMs)
+{
+    VerifyOrReturnError(logFile != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Shutdown();
+
+    ChipLogDetail(DeviceLayer, "ChipLinuxLogStorage::Init: Using KVS log file: %s", logFile);
+    mLogPath        = logFile;
+    mSyncIntervalMs = syncIntervalMs;
+
+    if (iniFile != nullptr && access(logFile, F_OK) != 0 && access(iniFile, F_OK) == 0)
+    {
+        ReturnErrorOnFailure(ImportIni(iniFile));
+    }
+    ReturnErrorOnFailure(OpenLog());
+
+    mStopWorker = false;
+    mWorker     = std::thread(&ChipLinuxLogStorage::WorkerMain, this);
+    return CHIP_NO_ERROR;
+}
+
+void ChipLinuxLogStorage::Shutdown()
+{
+    {
+        Lock lock(mLock);
+        mStopWorker = true;
+    }
+    mWorkerWakeup.notify_all();
+    if (mWorker.joinable())
+    {
+        mWorker.join();
+    }
+
+    Lock lock(mLock);
+    VerifyOrReturn(mFd >= 0);
+
+    CHIP_ERROR err = SyncLocked(lock, mAppendCount);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Failed to sync %s: %" CHIP_ERROR_FORMAT, mLogPath.c_str(), err.Format());
+    }
+    CloseLog();
+}
+
+void ChipLinuxLogStorage::CloseLog()
+{
+    if (mFd >= 0)
+    {
+        close(mFd);
+        mFd = -1;
+    }
+    mIndex.clear();
+    mLogSize             = 0;
+    mLiveBytes           = 0;
+    mAppendCount         = 0;
+    mSyncedCount         = 0;
+    mCompactionRequested = false;
+}
+
+CHIP_ERROR ChipLinuxLogStorage::OpenLog()
+{
+    mFd = open(mLogPath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    if (mFd < 0)
+    {
+        ChipLogError(DeviceLayer, "Failed to open KVS log %s: %s", mLogPath.c_str(), strerror(errno));
+        return CHIP_ERROR_OPEN_FAILED;
+    }
+
+    CHIP_ERROR err = ReplayLog();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Failed to load KVS log %s: %" CHIP_ERROR_FORMAT, mLogPath.c_str(), err.Format());
+        CloseLog();
+    }
+    return err;
+}
+
+CHIP_ERROR ChipLinuxLogStorage::ReplayLog()
+{
+    struct stat st;
+    VerifyOrReturnError(fstat(mFd, &st) == 0, CHIP_ERROR_POSIX(errno));
+
+    const size_t size = static_cast<size_t>(st.st_size);
+    if (size == 0)
+    {
+        ReturnErrorOnFailure(WriteFully(mFd, kLogMagic, kLogHeaderSize, 0));
+        VerifyOrReturnError(fsync(mFd) == 0, CHIP_ERROR_POSIX(errno));
+        mLogSize = kLogHeaderSize;
+        return CHIP_NO_ERROR;
+    }
+
+    std::vector<uint8_t> contents(size);
+    ReturnErrorOnFailure(ReadFully(mFd, contents.data(), size, 0));
+    VerifyOrReturnError(size >= kLogHeaderSize && memcmp(contents.data(), kLogMagic, kLogHeaderSize) == 0,
+                        CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+
+    size_t offset = kLogHeaderSize;
+    while (size - offset >= kRecordHeaderSize)
+    {
+        const uint8_t * p        = contents.data() + offset;
+        const uint32_t crc       = Encoding::LittleEndian::Read32(p);
+        const uint8_t op         = Encoding::Read8(p);
+        const uint16_t keySize   = Encoding::LittleEndian::Read16(p);
+        const uint32_t valueSize = Encoding::LittleEndian::Read32(p);
+
+        const size_t recordSize = kRecordHeaderSize + keySize + valueSize;
+        if (size - offset < recordSize || (op != kRecordOpPut && op != kRecordOpDelete) ||
+            Crc32(contents.data() + offset + kRecordCrcSize, recordSize - kRecordCrcSize) != crc)
+        {
+            break;
+        }
+
+        ApplyRecord(op, std::string(reinterpret_cast<const char *>(p), keySize), static_cast<off_t>(offset), valueSize);
+        offset += recordSize;
+    }
+
+    if (offset != size)
+    {
+        ChipLogError(DeviceLayer, "Discarding %u bytes of incomplete records at the end of %s",
+                     static_cast<unsigned>(size - offset), mLogPath.c_str());
+        VerifyOrReturnError(ftruncate(mFd, static_cast<off_t>(offset)) == 0, CHIP_ERROR_POSIX(errno));
+    }
+    mLogSize = offset;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxLogStorage::ImportIni(const char * iniFile)
+{
+    ChipLinuxStorageIni ini;
+    std::vector<std::string> keys;
+
+    ReturnErrorOnFailure(ini.Init());
+    ReturnErrorOnFailure(ini.AddConfig(iniFile));
+
+    CHIP_ERROR err = ini.GetKeys(keys);
+    VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_ERROR_KEY_NOT_FOUND, err);
+
+    std::vector<uint8_t> contents(kLogMagic, kLogMagic + kLogHeaderSize);
+    std::vector<uint8_t> value;
+    size_t imported = 0;
+    for (const auto & key : keys)
+    {
+        size_t valueSize = 0;
+        value.clear();
+        err = ini.GetBinaryBlobValue(key.c_str(), value.data(), value.size(), valueSize);
+        if (err == CHIP_ERROR_BUFFER_TOO_SMALL)
+        {
+            value.resize(valueSize);
+            err = ini.GetBinaryBlobValue(key.c_str(), value.data(), value.size(), valueSize);
+        }
+        if (err != CHIP_NO_ERROR || key.size() > UINT16_MAX)
+        {
+            ChipLogError(DeviceLayer, "Skipping KVS entry %s: %" CHIP_ERROR_FORMAT, key.c_str(), err.Format());
+            continue;
+        }
+
+        EncodeRecord(contents, kRecordOpPut, key, value.data(), valueSize);
+        imported++;
+    }
+
+    ReturnErrorOnFailure(ReplaceFile(mLogPath, contents));
+    ChipLogProgress(DeviceLayer, "Imported %u KVS entries from %s into %s", static_cast<unsigned>(imported), iniFile,
+                    mLogPath.c_str());
+    return CHIP_NO_ERROR;
+}
+
+void ChipLinuxLogStorage::ApplyRecord(uint8_t op, const std::string & key, off_t recordOffset, uint32_t valueSize)
+{
+    auto it = mIndex.find(key);
+    if (it != mIndex.end())
+    {
+        mLiveBytes -= RecordSize(key, it->second.mLength);
+    }
+
+    if (op == kRecordOpDelete)
+    {
+        if (it != mIndex.end())
+        {
+            mIndex.erase(it);
+        }
+        return;
+    }
+
+    const ValueLocation location = { static_cast<off_t>(recordOffset + kRecordHeaderSize + key.size()), valueSize };
+    if (it != mIndex.end())
+    {
+        it->second = location;
+    }
+    else
+    {
+        mIndex.emplace(key, location);
+    }
+    mLiveBytes += RecordSize(key, valueSize);
+}
+
+CHIP_ERROR ChipLinuxLogStorage::AppendRecord(uint8_t op, const std::string & key, const void * value, size_t valueSize)
+{
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(key.size() <= UINT16_MAX && valueSize <= UINT32_MAX, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mRecordBuffer.clear();
+    EncodeRecord(mRecordBuffer, op, key, value, valueSize);
+
+    CHIP_ERROR err = WriteFully(mFd, mRecordBuffer.data(), mRecordBuffer.size(), static_cast<off_t>(mLogSize));
+    if (err != CHIP_NO_ERROR)
+    {
+        // Drop whatever part of the record made it to the file; replay would discard it anyway.
+        (void) ftruncate(mFd, static_cast<off_t>(mLogSize));
+        return err;
+    }
+
+    ApplyRecord(op, key, static_cast<off_t>(mLogSize), static_cast<uint32_t>(valueSize));
+    mLogSize += mRecordBuffer.size();
+    mAppendCount++;
+
+    RequestCompactionIfNeeded();
+    if (mSyncIntervalMs != 0)
+    {
+        mWorkerWakeup.notify_one();
+    }
+    return CHIP_NO_ERROR;
+}
+
+void ChipLinuxLogStorage::RequestCompactionIfNeeded()
+{
+    VerifyOrReturn(!mCompactionRequested && mLogSize >= CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_COMPACTION_THRESHOLD);
+    VerifyOrReturn(mLogSize - kLogHeaderSize > 2 * mLiveBytes);
+
+    mCompactionRequested = true;
+    mWorkerWakeup.notify_one();
+}
+
+CHIP_ERROR ChipLinuxLogStorage::Get(const char * key, void * value, size_t valueSize, size_t & readSize, size_t offset)
+{
+    Lock lock(mLock);
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    auto it = mIndex.find(key);
+    VerifyOrReturnError(it != mIndex.end(), CHIP_ERROR_KEY_NOT_FOUND);
+    VerifyOrReturnError(offset <= it->second.mLength, CHIP_ERROR_INVALID_ARGUMENT);
+
+    const size_t remaining = it->second.mLength - offset;
+    readSize               = std::min(valueSize, remaining);
+    ReturnErrorOnFailure(ReadFully(mFd, value, readSize, it->second.mOffset + static_cast<off_t>(offset)));
+
+    return (readSize < remaining) ? CHIP_ERROR_BUFFER_TOO_SMALL : CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxLogStorage::Put(const char * key, const void * value, size_t valueSize)
+{
+    Lock lock(mLock);
+    ReturnErrorOnFailure(AppendRecord(kRecordOpPut, key, value, valueSize));
+    return (mSyncIntervalMs == 0) ? SyncLocked(lock, mAppendCount) : CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxLogStorage::Delete(const char * key)
+{
+    Lock lock(mLock);
+    VerifyOrReturnError(mIndex.find(key) != mIndex.end(), CHIP_ERROR_KEY_NOT_FOUND);
+    ReturnErrorOnFailure(AppendRecord(kRecordOpDelete, key, nullptr, 0));
+    return (mSyncIntervalMs == 0) ? SyncLocked(lock, mAppendCount) : CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxLogStorage::Sync()
+{
+    Lock lock(mLock);
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_INCORRECT_STATE);
+    return SyncLocked(lock, mAppendCount);
+}
+
+CHIP_ERROR ChipLinuxLogStorage::SyncLocked(Lock & lock, uint64_t appendCount)
+{
+    // Group commit: a single fdatasync covers every record appended before it started, so writers that arrive
+    // while one is in flight wait for it and then only issue another one if their own record was not covered.
+    while (mSyncedCount < appendCount)
+    {
+        if (mSyncInProgress)
+        {
+            mSyncDone.wait(lock);
+            continue;
+        }
+
+        const uint64_t target = mAppendCount;
+        const int fd          = mFd;
+        mSyncInProgress       = true;
+
+        lock.unlock();
+        const int result = fdatasync(fd);
+        const int error  = errno;
+        lock.lock();
+
+        mSyncInProgress = false;
+        mSyncDone.notify_all();
+        VerifyOrReturnError(result == 0, CHIP_ERROR_POSIX(error));
+        mSyncedCount = std::max(mSyncedCount, target);
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxLogStorage::Compact()
+{
+    Lock lock(mLock);
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_INCORRECT_STATE);
+    return CompactLocked(lock);
+}
+
+CHIP_ERROR ChipLinuxLogStorage::CompactLocked(Lock & lock)
+{
+    // The descriptor is about to be replaced, so let an in-flight fdatasync on it finish first.
+    mSyncDone.wait(lock, [this] { return !mSyncInProgress; });
+
+    std::vector<uint8_t> contents(kLogMagic, kLogMagic + kLogHeaderSize);
+    std::vector<off_t> offsets;
+    std::vector<uint8_t> value;
+
+    contents.reserve(kLogHeaderSize + mLiveBytes);
+    offsets.reserve(mIndex.size());
+    for (const auto & entry : mIndex)
+    {
+        value.resize(entry.second.mLength);
+        ReturnErrorOnFailure(ReadFully(mFd, value.data(), value.size(), entry.second.mOffset));
+        offsets.push_back(static_cast<off_t>(contents.size() + kRecordHeaderSize + entry.first.size()));
+        EncodeRecord(contents, kRecordOpPut, entry.first, value.data(), value.size());
+    }
+
+    // Take the descriptor of the compacted log from ReplaceFile rather than reopening the path afterwards: should that
+    // fail, appends would keep going to the old log, which is no longer linked at mLogPath.
+    int fd = -1;
+    ReturnErrorOnFailure(ReplaceFile(mLogPath, contents, &fd));
+    close(mFd);
+    mFd = fd;
+
+    // The iteration order of an unmodified unordered_map is stable, so the offsets line up with the entries.
+    size_t i = 0;
+    for (auto & entry : mIndex)
+    {
+        entry.second.mOffset = offsets[i++];
+    }
+
+    ChipLogProgress(DeviceLayer, "Compacted KVS log %s from %" PRIu64 " to %u bytes", mLogPath.c_str(), mLogSize,
+                    static_cast<unsigned>(contents.size()));
+    mLogSize     = contents.size();
+    mLiveBytes   = mLogSize - kLogHeaderSize;
+    mSyncedCount = mAppendCount;
+    return CHIP_NO_ERROR;
+}
+
+uint64_t ChipLinuxLogStorage::GetLogSize()
+{
+    Lock lock(mLock);
+    return mLogSize;
+}
+
+void ChipLinuxLogStorage::WorkerMain()
+{
+    Lock lock(mLock);
+    while (!mStopWorker)
+    {
+        CHIP_ERROR err = CHIP_NO_ERROR;
+
+        if (mCompactionRequested)
+        {
+            mCompactionRequested = false;
+            err                  = CompactLocked(lock);
+        }
+        else if (mSyncIntervalMs != 0 && mSyncedCount < mAppendCount)
+        {
+            // Let the writes of one interval accumulate so that they share a single fdatasync.
+            mWorkerWakeup.wait_for(lock, std::chrono::milliseconds(mSyncIntervalMs), [this] { return mStopWorker; });
+            err = SyncLocked(lock, mAppendCount);
+        }
+        else
+        {
+            mWorkerWakeup.wait(lock);
+        }
+
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(DeviceLayer, "KVS log %s background task failed: %" CHIP_ERROR_FORMAT, mLogPath.c_str(), err.Format());
+        }
+    }
+}
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
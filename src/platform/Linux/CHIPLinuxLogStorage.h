@@ -0,0 +1,133 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *         This file defines a log-structured key-value store for the Linux
+ *         KeyValueStoreManager.
+ *
+ *         Every Put or Delete appends one checksummed record to the log file
+ *         and an in-memory hash index maps each live key to the location of
+ *         its value in the file. Records are made durable according to the
+ *         sync interval: either before the write returns (concurrent writers
+ *         share one fdatasync), or by a background thread at most one interval
+ *         after the write. The same thread rewrites the log once superseded
+ *         records dominate its size.
+ *
+ *         When the log does not exist yet, the entries of the INI file used by
+ *         ChipLinuxStorage are imported into it.
+ *
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <sys/types.h>
+
+#include <lib/core/CHIPError.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+class ChipLinuxLogStorage
+{
+public:
+    ChipLinuxLogStorage() = default;
+    ~ChipLinuxLogStorage();
+
+    /**
+     * Open (or create) the log at @p logFile and start the background thread.
+     *
+     * @param logFile         Path of the log file.
+     * @param iniFile         INI file to import when the log does not exist yet, or nullptr.
+     * @param syncIntervalMs  0 to sync each write before it returns, otherwise the maximum
+     *                        delay before a write is synced by the background thread.
+     */
+    CHIP_ERROR Init(const char * logFile, const char * iniFile, uint32_t syncIntervalMs);
+    void Shutdown();
+
+    /**
+     * Read the value of @p key starting at @p offset. Returns CHIP_ERROR_KEY_NOT_FOUND if the key
+     * does not exist and CHIP_ERROR_BUFFER_TOO_SMALL if the value was truncated to @p valueSize.
+     */
+    CHIP_ERROR Get(const char * key, void * value, size_t valueSize, size_t & readSize, size_t offset);
+    CHIP_ERROR Put(const char * key, const void * value, size_t valueSize);
+    CHIP_ERROR Delete(const char * key);
+
+    /// Make all previous writes durable.
+    CHIP_ERROR Sync();
+
+    /// Rewrite the log so that it only contains the live records.
+    CHIP_ERROR Compact();
+
+    uint64_t GetLogSize();
+
+private:
+    struct ValueLocation
+    {
+        off_t mOffset;
+        uint32_t mLength;
+    };
+
+    using Lock = std::unique_lock<std::mutex>;
+
+    CHIP_ERROR OpenLog();
+    CHIP_ERROR ReplayLog();
+    CHIP_ERROR ImportIni(const char * iniFile);
+    CHIP_ERROR AppendRecord(uint8_t op, const std::string & key, const void * value, size_t valueSize);
+    void ApplyRecord(uint8_t op, const std::string & key, off_t recordOffset, uint32_t valueSize);
+    CHIP_ERROR SyncLocked(Lock & lock, uint64_t appendCount);
+    CHIP_ERROR CompactLocked(Lock & lock);
+    void RequestCompactionIfNeeded();
+    void WorkerMain();
+    void CloseLog();
+
+    std::mutex mLock;
+    std::condition_variable mSyncDone;
+    std::condition_variable mWorkerWakeup;
+    std::thread mWorker;
+
+    std::unordered_map<std::string, ValueLocation> mIndex;
+    std::vector<uint8_t> mRecordBuffer;
+    std::string mLogPath;
+    int mFd = -1;
+
+    // Size of the log file and number of bytes in it held by live records.
+    uint64_t mLogSize   = 0;
+    uint64_t mLiveBytes = 0;
+
+    // Number of records appended since Init, and how many of them are known to be durable.
+    uint64_t mAppendCount = 0;
+    uint64_t mSyncedCount = 0;
+
+    uint32_t mSyncIntervalMs  = 0;
+    bool mSyncInProgress      = false;
+    bool mCompactionRequested = false;
+    bool mStopWorker          = false;
+};
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
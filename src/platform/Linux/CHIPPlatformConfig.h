@@ -52,10 +52,41 @@ using CHIP_CONFIG_PERSISTED_STORAGE_KEY_TYPE = const char *;
 #define CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS 8
 #endif // CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS
 
+// Every handshake that CASEServer runs or queues holds an exchange, on top of those of the other traffic
+// (see CHIP_CONFIG_CASE_SERVER_EXCHANGE_RESERVE).
 #ifndef CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS
-#define CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS 8
+#define CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS                                                                                          \
+    (8 + CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES + CHIP_CONFIG_CASE_SERVER_SIGMA1_QUEUE_SIZE)
 #endif // CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS
 
+#ifndef CHIP_CONFIG_UNSOLICITED_MESSAGE_HANDLER_INDEX
+#define CHIP_CONFIG_UNSOLICITED_MESSAGE_HANDLER_INDEX 1
+#endif // CHIP_CONFIG_UNSOLICITED_MESSAGE_HANDLER_INDEX
+
+#ifndef CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS
+#define CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS 1024
+#endif // CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS
+
+#ifndef CHIP_IM_SERVER_ATTRIBUTE_INTEREST_INDEX_BUCKETS
+#define CHIP_IM_SERVER_ATTRIBUTE_INTEREST_INDEX_BUCKETS 256
+#endif // CHIP_IM_SERVER_ATTRIBUTE_INTEREST_INDEX_BUCKETS
+
+#ifndef CHIP_IM_SERVER_REPORT_CACHE_SIZE
+#define CHIP_IM_SERVER_REPORT_CACHE_SIZE 8192
+#endif // CHIP_IM_SERVER_REPORT_CACHE_SIZE
+
+#ifndef CHIP_IM_SERVER_REPORT_CACHE_ENTRIES
+#define CHIP_IM_SERVER_REPORT_CACHE_ENTRIES 128
+#endif // CHIP_IM_SERVER_REPORT_CACHE_ENTRIES
+
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_INDEX
+#define CHIP_CONFIG_ACCESS_CONTROL_INDEX 1
+#endif // CHIP_CONFIG_ACCESS_CONTROL_INDEX
+
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE
+#define CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE 16
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE
+
 #ifndef CHIP_LOG_FILTERING
 #define CHIP_LOG_FILTERING 0
 #endif // CHIP_LOG_FILTERING
@@ -64,6 +95,38 @@ using CHIP_CONFIG_PERSISTED_STORAGE_KEY_TYPE = const char *;
 #define CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS 1
 #endif // CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
 
+#ifndef CHIP_CONFIG_SECURE_SESSION_INDEX_BUCKETS
+#define CHIP_CONFIG_SECURE_SESSION_INDEX_BUCKETS 1024
+#endif // CHIP_CONFIG_SECURE_SESSION_INDEX_BUCKETS
+
+#ifndef CHIP_CONFIG_PERSISTENT_STORAGE_BATCH_BUFFER_SIZE
+#define CHIP_CONFIG_PERSISTENT_STORAGE_BATCH_BUFFER_SIZE 4096
+#endif // CHIP_CONFIG_PERSISTENT_STORAGE_BATCH_BUFFER_SIZE
+
+#ifndef CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES
+#define CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES 4
+#endif // CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES
+
+#ifndef CHIP_CONFIG_CASE_SERVER_MAX_HANDSHAKES_PER_FABRIC
+#define CHIP_CONFIG_CASE_SERVER_MAX_HANDSHAKES_PER_FABRIC 2
+#endif // CHIP_CONFIG_CASE_SERVER_MAX_HANDSHAKES_PER_FABRIC
+
+#ifndef CHIP_CONFIG_CASE_SERVER_SIGMA1_QUEUE_SIZE
+#define CHIP_CONFIG_CASE_SERVER_SIGMA1_QUEUE_SIZE 8
+#endif // CHIP_CONFIG_CASE_SERVER_SIGMA1_QUEUE_SIZE
+
+#ifndef CHIP_CONFIG_CASE_SERVER_EXCHANGE_RESERVE
+#define CHIP_CONFIG_CASE_SERVER_EXCHANGE_RESERVE 8
+#endif // CHIP_CONFIG_CASE_SERVER_EXCHANGE_RESERVE
+
+// Host unit tests run both ends of each CASE handshake over a loopback, so they need twice the unauthenticated sessions.
+#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
+#ifndef CHIP_CONFIG_UNAUTHENTICATED_CONNECTION_POOL_SIZE
+#define CHIP_CONFIG_UNAUTHENTICATED_CONNECTION_POOL_SIZE                                                                           \
+    (2 * (CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES + CHIP_CONFIG_CASE_SERVER_SIGMA1_QUEUE_SIZE) + 8)
+#endif // CHIP_CONFIG_UNAUTHENTICATED_CONNECTION_POOL_SIZE
+#endif // CONFIG_BUILD_FOR_HOST_UNIT_TEST
+
 // ==================== Security Configuration Overrides ====================
 
 #ifndef CHIP_CONFIG_KVS_PATH
@@ -36,6 +36,41 @@ namespace PersistedStorage {
 
 KeyValueStoreManagerImpl KeyValueStoreManagerImpl::sInstance;
 
+#if CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STORAGE
+
+CHIP_ERROR KeyValueStoreManagerImpl::_Get(const char * key, void * value, size_t value_size, size_t * read_bytes_size,
+                                          size_t offset_bytes)
+{
+    size_t read_size = 0;
+
+    VerifyOrReturnError(value != nullptr || value_size == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The log storage reads straight from the value's offset in the log, so partial and offset reads need no copy.
+    CHIP_ERROR err = mStorage.Get(key, value, value_size, read_size, offset_bytes);
+    if (err == CHIP_ERROR_KEY_NOT_FOUND)
+    {
+        return CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND;
+    }
+    if (read_bytes_size != nullptr && (err == CHIP_NO_ERROR || err == CHIP_ERROR_BUFFER_TOO_SMALL))
+    {
+        *read_bytes_size = read_size;
+    }
+    return err;
+}
+
+CHIP_ERROR KeyValueStoreManagerImpl::_Put(const char * key, const void * value, size_t value_size)
+{
+    return mStorage.Put(key, value, value_size);
+}
+
+CHIP_ERROR KeyValueStoreManagerImpl::_Delete(const char * key)
+{
+    CHIP_ERROR err = mStorage.Delete(key);
+    return (err == CHIP_ERROR_KEY_NOT_FOUND) ? CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND : err;
+}
+
+#else
+
 CHIP_ERROR KeyValueStoreManagerImpl::_Get(const char * key, void * value, size_t value_size, size_t * read_bytes_size,
                                           size_t offset_bytes)
 {
@@ -83,8 +118,8 @@ CHIP_ERROR KeyValueStoreManagerImpl::_Put(const char * key, const void * value,
     err = mStorage.WriteValueBin(key, reinterpret_cast<const uint8_t *>(value), value_size);
     SuccessOrExit(err);
 
-    // Commit the value to the persistent store.
-    err = mStorage.Commit();
+    // Commit the value to the persistent store, or at the end of the batch.
+    err = CommitOrDefer();
     SuccessOrExit(err);
 
 exit:
@@ -102,14 +137,35 @@ CHIP_ERROR KeyValueStoreManagerImpl::_Delete(const char * key)
     }
     SuccessOrExit(err);
 
-    // Commit the value to the persistent store.
-    err = mStorage.Commit();
+    // Commit the value to the persistent store, or at the end of the batch.
+    err = CommitOrDefer();
     SuccessOrExit(err);
 
 exit:
     return err;
 }
 
+CHIP_ERROR KeyValueStoreManagerImpl::_EndBatch()
+{
+    VerifyOrReturnError(mBatchDepth > 0, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(--mBatchDepth == 0 && mCommitPending, CHIP_NO_ERROR);
+
+    mCommitPending = false;
+    return mStorage.Commit();
+}
+
+CHIP_ERROR KeyValueStoreManagerImpl::CommitOrDefer()
+{
+    if (mBatchDepth > 0)
+    {
+        mCommitPending = true;
+        return CHIP_NO_ERROR;
+    }
+    return mStorage.Commit();
+}
+
+#endif // CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STORAGE
+
 } // namespace PersistedStorage
 } // namespace DeviceLayer
 } // namespace chip
@@ -23,8 +23,13 @@
 
 #pragma once
 
+#include <platform/CHIPDeviceConfig.h>
 #include <platform/Linux/CHIPLinuxStorage.h>
 
+#if CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STORAGE
+#include <platform/Linux/CHIPLinuxLogStorage.h>
+#endif
+
 namespace chip {
 namespace DeviceLayer {
 namespace PersistedStorage {
@@ -36,14 +41,35 @@ public:
      * @brief
      * Initalize the KVS, must be called before using.
      */
+#if CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STORAGE
+    CHIP_ERROR Init(const char * file)
+    {
+        return mStorage.Init((std::string(file) + ".log").c_str(), file, CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_SYNC_INTERVAL_MS);
+    }
+#else
     CHIP_ERROR Init(const char * file) { return mStorage.Init(file); }
+#endif
 
     CHIP_ERROR _Get(const char * key, void * value, size_t value_size, size_t * read_bytes_size = nullptr, size_t offset = 0);
     CHIP_ERROR _Delete(const char * key);
     CHIP_ERROR _Put(const char * key, const void * value, size_t value_size);
 
+#if !CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STORAGE
+    // Every commit rewrites the whole INI file, so the updates of a batch are committed together.
+    void _BeginBatch() { mBatchDepth++; }
+    CHIP_ERROR _EndBatch();
+#endif
+
 private:
+#if CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STORAGE
+    DeviceLayer::Internal::ChipLinuxLogStorage mStorage;
+#else
+    CHIP_ERROR CommitOrDefer();
+
     DeviceLayer::Internal::ChipLinuxStorage mStorage;
+    unsigned mBatchDepth = 0;
+    bool mCommitPending  = false;
+#endif
 
     // ===== Members for internal use by the following friends.
     friend KeyValueStoreManager & KeyValueStoreMgr();
@@ -39,5 +39,7 @@ struct ChipDeviceEvent;
 #define CHIP_SYSTEM_CONFIG_NO_LOCKING 0
 #define CHIP_SYSTEM_CONFIG_PLATFORM_PROVIDES_TIME 1
 #define CHIP_SYSTEM_CONFIG_POOL_USE_HEAP 1
+#define CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL 1
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES 1
 
 // ========== Platform-specific Configuration Overrides =========
@@ -0,0 +1,372 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the log-structured
+ *      key-value store used by the Linux KeyValueStoreManager.
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+
+#include <platform/Linux/CHIPLinuxLogStorage.h>
+#include <platform/Linux/CHIPLinuxStorage.h>
+
+using namespace chip;
+using namespace chip::DeviceLayer::Internal;
+
+namespace {
+
+std::string sTestDir;
+std::vector<std::string> sTestFiles;
+
+std::string TestPath(const char * name)
+{
+    std::string path = sTestDir + "/" + name;
+    unlink(path.c_str());
+    sTestFiles.push_back(path);
+    return path;
+}
+
+bool ValueMatches(ChipLinuxLogStorage & storage, const char * key, const void * expected, size_t expectedSize)
+{
+    uint8_t value[256];
+    size_t readSize = 0;
+
+    VerifyOrReturnValue(storage.Get(key, value, sizeof(value), readSize, 0) == CHIP_NO_ERROR, false);
+    return readSize == expectedSize && memcmp(value, expected, expectedSize) == 0;
+}
+
+double MicrosecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+// =================================
+//      Unit tests
+// =================================
+
+void TestLogStorage_PutGetDelete(nlTestSuite * inSuite, void * inContext)
+{
+    ChipLinuxLogStorage storage;
+    const uint8_t kValue[] = { 0x00, 0x01, 0x02, 0x03, 0xFF };
+    uint8_t value[sizeof(kValue)];
+    size_t readSize = 0;
+
+    NL_TEST_ASSERT(inSuite, storage.Init(TestPath("basic.log").c_str(), nullptr, 0) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, storage.Get("key", value, sizeof(value), readSize, 0) == CHIP_ERROR_KEY_NOT_FOUND);
+
+    NL_TEST_ASSERT(inSuite, storage.Put("key", kValue, sizeof(kValue)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, ValueMatches(storage, "key", kValue, sizeof(kValue)));
+
+    // Offset and truncated reads.
+    NL_TEST_ASSERT(inSuite, storage.Get("key", value, 2, readSize, 1) == CHIP_ERROR_BUFFER_TOO_SMALL);
+    NL_TEST_ASSERT(inSuite, readSize == 2 && memcmp(value, &kValue[1], 2) == 0);
+    NL_TEST_ASSERT(inSuite, storage.Get("key", value, sizeof(value), readSize, sizeof(kValue)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, readSize == 0);
+    NL_TEST_ASSERT(inSuite, storage.Get("key", value, sizeof(value), readSize, sizeof(kValue) + 1) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Overwrite with an empty value, then delete.
+    NL_TEST_ASSERT(inSuite, storage.Put("key", nullptr, 0) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, storage.Get("key", nullptr, 0, readSize, 0) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, readSize == 0);
+    NL_TEST_ASSERT(inSuite, storage.Delete("key") == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, storage.Delete("key") == CHIP_ERROR_KEY_NOT_FOUND);
+    NL_TEST_ASSERT(inSuite, storage.Get("key", value, sizeof(value), readSize, 0) == CHIP_ERROR_KEY_NOT_FOUND);
+}
+
+void TestLogStorage_Reopen(nlTestSuite * inSuite, void * inContext)
+{
+    const std::string path = TestPath("reopen.log");
+    const char kFirst[]    = "first";
+    const char kSecond[]   = "second value";
+
+    {
+        ChipLinuxLogStorage storage;
+        NL_TEST_ASSERT(inSuite, storage.Init(path.c_str(), nullptr, 1000) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, storage.Put("a", kFirst, sizeof(kFirst)) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, storage.Put("b", kFirst, sizeof(kFirst)) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, storage.Put("a", kSecond, sizeof(kSecond)) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, storage.Delete("b") == CHIP_NO_ERROR);
+    }
+
+    // Simulate a write interrupted half-way through a record.
+    const uint8_t kTornRecord[] = { 0x12, 0x34, 0x56, 0x78, 0x01, 0x03, 0x00 };
+    {
+        std::ofstream log(path, std::ios::binary | std::ios::app);
+        log.write(reinterpret_cast<const char *>(kTornRecord), sizeof(kTornRecord));
+    }
+
+    ChipLinuxLogStorage storage;
+    uint8_t value[16];
+    size_t readSize = 0;
+
+    NL_TEST_ASSERT(inSuite, storage.Init(path.c_str(), nullptr, 0) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, ValueMatches(storage, "a", kSecond, sizeof(kSecond)));
+    NL_TEST_ASSERT(inSuite, storage.Get("b", value, sizeof(value), readSize, 0) == CHIP_ERROR_KEY_NOT_FOUND);
+
+    // The torn tail is dropped, so new records land after the last complete one.
+    const uint64_t logSize = storage.GetLogSize();
+    NL_TEST_ASSERT(inSuite, storage.Put("c", kFirst, sizeof(kFirst)) == CHIP_NO_ERROR);
+    storage.Shutdown();
+    NL_TEST_ASSERT(inSuite, storage.Init(path.c_str(), nullptr, 0) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, storage.GetLogSize() > logSize);
+    NL_TEST_ASSERT(inSuite, ValueMatches(storage, "c", kFirst, sizeof(kFirst)));
+}
+
+void TestLogStorage_Compact(nlTestSuite * inSuite, void * inContext)
+{
+    const std::string path = TestPath("compact.log");
+    ChipLinuxLogStorage storage;
+    uint8_t value[64];
+    char key[16];
+
+    NL_TEST_ASSERT(inSuite, storage.Init(path.c_str(), nullptr, 1000) == CHIP_NO_ERROR);
+    for (uint8_t round = 0; round < 20; round++)
+    {
+        memset(value, round, sizeof(value));
+        for (int i = 0; i < 10; i++)
+        {
+            snprintf(key, sizeof(key), "k%d", i);
+            NL_TEST_ASSERT(inSuite, storage.Put(key, value, sizeof(value)) == CHIP_NO_ERROR);
+        }
+    }
+    NL_TEST_ASSERT(inSuite, storage.Delete("k9") == CHIP_NO_ERROR);
+
+    const uint64_t sizeBefore = storage.GetLogSize();
+    NL_TEST_ASSERT(inSuite, storage.Compact() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, storage.GetLogSize() < sizeBefore / 10);
+
+    for (int i = 0; i < 9; i++)
+    {
+        snprintf(key, sizeof(key), "k%d", i);
+        NL_TEST_ASSERT(inSuite, ValueMatches(storage, key, value, sizeof(value)));
+    }
+
+    // Writes after the compaction go to the new file and survive a reopen.
+    NL_TEST_ASSERT(inSuite, storage.Put("k0", "x", 1) == CHIP_NO_ERROR);
+    storage.Shutdown();
+    NL_TEST_ASSERT(inSuite, storage.Init(path.c_str(), nullptr, 0) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, ValueMatches(storage, "k0", "x", 1));
+    NL_TEST_ASSERT(inSuite, ValueMatches(storage, "k8", value, sizeof(value)));
+}
+
+void TestLogStorage_ImportIni(nlTestSuite * inSuite, void * inContext)
+{
+    const std::string iniPath = TestPath("import.ini");
+    const std::string logPath = TestPath("import.log");
+    const uint8_t kBinary[]   = { 0x00, 0x3D, 0x0A, 0x5B, 0xFF };
+
+    {
+        ChipLinuxStorage ini;
+        NL_TEST_ASSERT(inSuite, ini.Init(iniPath.c_str()) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, ini.WriteValueBin("f/1/n", kBinary, sizeof(kBinary)) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, ini.WriteValueBin("key with = and spaces", kBinary, 2) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, ini.Commit() == CHIP_NO_ERROR);
+    }
+
+    ChipLinuxLogStorage storage;
+    NL_TEST_ASSERT(inSuite, storage.Init(logPath.c_str(), iniPath.c_str(), 0) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, ValueMatches(storage, "f/1/n", kBinary, sizeof(kBinary)));
+    NL_TEST_ASSERT(inSuite, ValueMatches(storage, "key with = and spaces", kBinary, 2));
+
+    // Once the log exists, it is the only source of truth.
+    NL_TEST_ASSERT(inSuite, storage.Delete("f/1/n") == CHIP_NO_ERROR);
+    storage.Shutdown();
+    NL_TEST_ASSERT(inSuite, storage.Init(logPath.c_str(), iniPath.c_str(), 0) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !ValueMatches(storage, "f/1/n", kBinary, sizeof(kBinary)));
+    NL_TEST_ASSERT(inSuite, ValueMatches(storage, "key with = and spaces", kBinary, 2));
+}
+
+void TestLogStorage_ConcurrentWriters(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr int kThreads         = 4;
+    constexpr int kWritesPerThread = 50;
+    const std::string path         = TestPath("concurrent.log");
+
+    ChipLinuxLogStorage storage;
+    NL_TEST_ASSERT(inSuite, storage.Init(path.c_str(), nullptr, 0) == CHIP_NO_ERROR);
+
+    std::vector<std::thread> threads;
+    std::vector<int> failures(kThreads, 0);
+    for (int t = 0; t < kThreads; t++)
+    {
+        threads.emplace_back([&storage, &failures, t] {
+            char key[16];
+            for (int i = 0; i < kWritesPerThread; i++)
+            {
+                snprintf(key, sizeof(key), "t%d/%d", t, i);
+                failures[t] += (storage.Put(key, &i, sizeof(i)) != CHIP_NO_ERROR);
+            }
+        });
+    }
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    storage.Shutdown();
+    NL_TEST_ASSERT(inSuite, storage.Init(path.c_str(), nullptr, 0) == CHIP_NO_ERROR);
+    char key[16];
+    for (int t = 0; t < kThreads; t++)
+    {
+        NL_TEST_ASSERT(inSuite, failures[t] == 0);
+        for (int i = 0; i < kWritesPerThread; i++)
+        {
+            snprintf(key, sizeof(key), "t%d/%d", t, i);
+            NL_TEST_ASSERT(inSuite, ValueMatches(storage, key, &i, sizeof(i)));
+        }
+    }
+}
+
+void TestLogStorage_Benchmark(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr int kKeys   = 64;
+    constexpr int kRounds = 8;
+    uint8_t value[128]    = {};
+    uint8_t readValue[sizeof(value)];
+    char key[16];
+    bool ok = true;
+
+    ChipLinuxLogStorage logStorage;
+    NL_TEST_ASSERT(inSuite, logStorage.Init(TestPath("bench.log").c_str(), nullptr, 1000) == CHIP_NO_ERROR);
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < kRounds; round++)
+    {
+        for (int i = 0; i < kKeys; i++)
+        {
+            snprintf(key, sizeof(key), "bench/%d", i);
+            value[0] = static_cast<uint8_t>(round);
+            ok       = ok && logStorage.Put(key, value, sizeof(value)) == CHIP_NO_ERROR;
+        }
+    }
+    const double logPutUs = MicrosecondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    for (int round = 0; round < kRounds; round++)
+    {
+        for (int i = 0; i < kKeys; i++)
+        {
+            size_t readSize = 0;
+            snprintf(key, sizeof(key), "bench/%d", i);
+            ok = ok && logStorage.Get(key, readValue, sizeof(readValue), readSize, 0) == CHIP_NO_ERROR;
+        }
+    }
+    const double logGetUs = MicrosecondsSince(start);
+
+    ChipLinuxStorage iniStorage;
+    NL_TEST_ASSERT(inSuite, iniStorage.Init(TestPath("bench.ini").c_str()) == CHIP_NO_ERROR);
+    start = std::chrono::steady_clock::now();
+    for (int round = 0; round < kRounds; round++)
+    {
+        for (int i = 0; i < kKeys; i++)
+        {
+            snprintf(key, sizeof(key), "bench/%d", i);
+            value[0] = static_cast<uint8_t>(round);
+            ok       = ok && iniStorage.WriteValueBin(key, value, sizeof(value)) == CHIP_NO_ERROR;
+            ok       = ok && iniStorage.Commit() == CHIP_NO_ERROR;
+        }
+    }
+    const double iniPutUs = MicrosecondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    for (int round = 0; round < kRounds; round++)
+    {
+        for (int i = 0; i < kKeys; i++)
+        {
+            size_t readSize = 0;
+            snprintf(key, sizeof(key), "bench/%d", i);
+            ok = ok && iniStorage.ReadValueBin(key, readValue, sizeof(readValue), readSize) == CHIP_NO_ERROR;
+        }
+    }
+    const double iniGetUs = MicrosecondsSince(start);
+    NL_TEST_ASSERT(inSuite, ok);
+
+    const double divisor = kKeys * kRounds;
+    printf("KVS log: put %8.2f us, get %6.2f us; INI: put %8.2f us, get %6.2f us\n", logPutUs / divisor, logGetUs / divisor,
+           iniPutUs / divisor, iniGetUs / divisor);
+}
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+const nlTest sTests[] = {
+    NL_TEST_DEF("Test LogStorage::PutGetDelete", TestLogStorage_PutGetDelete),
+    NL_TEST_DEF("Test LogStorage::Reopen", TestLogStorage_Reopen),
+    NL_TEST_DEF("Test LogStorage::Compact", TestLogStorage_Compact),
+    NL_TEST_DEF("Test LogStorage::ImportIni", TestLogStorage_ImportIni),
+    NL_TEST_DEF("Test LogStorage::ConcurrentWriters", TestLogStorage_ConcurrentWriters),
+    NL_TEST_DEF("Test LogStorage::Benchmark", TestLogStorage_Benchmark),
+    NL_TEST_SENTINEL()
+};
+
+/**
+ *  Set up the test suite.
+ */
+int TestLinuxLogStorage_Setup(void * inContext)
+{
+    char dir[] = "/tmp/chip-kvs-log-XXXXXX";
+    VerifyOrReturnValue(mkdtemp(dir) != nullptr, FAILURE);
+    sTestDir = dir;
+
+    CHIP_ERROR error = chip::Platform::MemoryInit();
+    if (error != CHIP_NO_ERROR)
+        return FAILURE;
+    return SUCCESS;
+}
+
+/**
+ *  Tear down the test suite.
+ */
+int TestLinuxLogStorage_Teardown(void * inContext)
+{
+    for (const auto & path : sTestFiles)
+    {
+        unlink(path.c_str());
+    }
+    rmdir(sTestDir.c_str());
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+} // namespace
+
+int TestLinuxLogStorage()
+{
+    nlTestSuite theSuite = { "LinuxLogStorage tests", &sTests[0], TestLinuxLogStorage_Setup, TestLinuxLogStorage_Teardown };
+
+    // Run test suite against one context.
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestLinuxLogStorage)
@@ -118,6 +118,37 @@ static void TestPlatformMgr_RunEventLoopTwoTasks(nlTestSuite * inSuite, void * i
     PlatformMgr().Shutdown();
 }
 
+static void SleepThenStopTheLoop(intptr_t arg)
+{
+    // Runs on a background task where there is one, so the stop has to go through the CHIP thread.
+    SleepSome(arg);
+    PlatformMgr().ScheduleWork(StopTheLoop);
+}
+
+static void TestPlatformMgr_BackgroundWork(nlTestSuite * inSuite, void * inContext)
+{
+    stopRan  = false;
+    sleepRan = false;
+
+    CHIP_ERROR err = PlatformMgr().InitChipStack();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = PlatformMgr().StartBackgroundEventLoopTask();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = PlatformMgr().ScheduleBackgroundWork(SleepThenStopTheLoop);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    PlatformMgr().RunEventLoop();
+    NL_TEST_ASSERT(inSuite, stopRan);
+    NL_TEST_ASSERT(inSuite, sleepRan);
+
+    err = PlatformMgr().StopBackgroundEventLoopTask();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    PlatformMgr().Shutdown();
+}
+
 void StopAndSleep(intptr_t arg)
 {
     // Ensure that we don't proceed after stopping until the sleep is done too.
@@ -216,6 +247,7 @@ static const nlTest sTests[] = {
     NL_TEST_DEF("Test basic PlatformMgr::RunEventLoop", TestPlatformMgr_BasicRunEventLoop),
     NL_TEST_DEF("Test PlatformMgr::RunEventLoop with two tasks", TestPlatformMgr_RunEventLoopTwoTasks),
     NL_TEST_DEF("Test PlatformMgr::RunEventLoop with stop before sleep", TestPlatformMgr_RunEventLoopStopBeforeSleep),
+    NL_TEST_DEF("Test PlatformMgr::ScheduleBackgroundWork", TestPlatformMgr_BackgroundWork),
     NL_TEST_DEF("Test PlatformMgr::TryLockChipStack", TestPlatformMgr_TryLockChipStack),
     NL_TEST_DEF("Test PlatformMgr::AddEventHandler", TestPlatformMgr_AddEventHandler),
     NL_TEST_DEF("Test mock System::Layer", TestPlatformMgr_MockSystemLayer),
@@ -29,6 +29,47 @@ using namespace ::chip::Credentials;
 
 namespace chip {
 
+namespace {
+
+System::Clock::Milliseconds64 Since(System::Clock::Timestamp start)
+{
+    return std::chrono::duration_cast<System::Clock::Milliseconds64>(System::SystemClock().GetMonotonicTimestamp() - start);
+}
+
+} // namespace
+
+void CASEServer::Shutdown()
+{
+    if (mExchangeManager != nullptr)
+    {
+        mExchangeManager->UnregisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1);
+        mExchangeManager = nullptr;
+    }
+
+    if (mSessionManager != nullptr && mSessionManager->SystemLayer() != nullptr)
+    {
+        mSessionManager->SystemLayer()->CancelTimer(ServeQueuedSigma1, this);
+    }
+    mSessionManager = nullptr;
+
+    for (auto & entry : mQueue)
+    {
+        if (entry.mExchange != nullptr)
+        {
+            DropQueuedSigma1(entry);
+        }
+    }
+
+    for (auto & responder : mResponders)
+    {
+        responder.mSession.Clear();
+        responder.mPinnedSecureSession.ClearValue();
+        responder.mBusy = false;
+    }
+    mArmedResponder              = nullptr;
+    mStatistics.activeHandshakes = 0;
+}
+
 CHIP_ERROR CASEServer::ListenForSessionEstablishment(Messaging::ExchangeManager * exchangeManager, SessionManager * sessionManager,
                                                      FabricTable * fabrics, SessionResumptionStorage * sessionResumptionStorage,
                                                      Credentials::CertificateValidityPolicy * certificateValidityPolicy,
@@ -36,6 +77,7 @@ CHIP_ERROR CASEServer::ListenForSessionEstablishment(Messaging::ExchangeManager
 {
     VerifyOrReturnError(exchangeManager != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(sessionManager != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(fabrics != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(responderGroupDataProvider != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
     mSessionManager            = sessionManager;
@@ -44,28 +86,33 @@ CHIP_ERROR CASEServer::ListenForSessionEstablishment(Messaging::ExchangeManager
     mFabrics                   = fabrics;
     mExchangeManager           = exchangeManager;
     mGroupDataProvider         = responderGroupDataProvider;
+    ResetStatistics();
 
     // Set up the group state provider that persists across all handshakes.
-    GetSession().SetGroupDataProvider(mGroupDataProvider);
-
-    PrepareForSessionEstablishment();
-
-    return CHIP_NO_ERROR;
-}
+    for (auto & responder : mResponders)
+    {
+        responder.mServer = this;
+        responder.mSession.SetGroupDataProvider(mGroupDataProvider);
+    }
 
-CHIP_ERROR CASEServer::InitCASEHandshake(Messaging::ExchangeContext * ec)
-{
-    ReturnErrorCodeIf(ec == nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    ChipLogProgress(Inet, "CASE Server enabling CASE session setups (%u concurrent)", static_cast<unsigned>(kMaxHandshakes));
+    ReturnErrorOnFailure(
+        mExchangeManager->RegisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1, this));
 
-    // Hand over the exchange context to the CASE session.
-    ec->SetDelegate(&GetSession());
+    // A responder armed by an earlier call was prepared with the previous parameters.
+    if (mArmedResponder != nullptr)
+    {
+        mArmedResponder->mSession.Clear();
+        mArmedResponder->mPinnedSecureSession.ClearValue();
+        mArmedResponder = nullptr;
+    }
+    ArmResponder();
 
     return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR CASEServer::OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader, ExchangeDelegate *& newDelegate)
 {
-    // TODO: assign newDelegate to CASESession, let CASESession handle future messages.
     newDelegate = this;
     return CHIP_NO_ERROR;
 }
@@ -79,33 +126,108 @@ CHIP_ERROR CASEServer::OnMessageReceived(Messaging::ExchangeContext * ec, const
         return CHIP_ERROR_INCORRECT_STATE;
     }
 
+    // The exchange of a queued Sigma1 message stays open, anything else received on it has nothing to add.
+    VerifyOrReturnError(FindQueuedSigma1(ec) == nullptr, CHIP_NO_ERROR);
+
+    const System::Clock::Timestamp receivedTime = System::SystemClock().GetMonotonicTimestamp();
+
+    // Fairness between fabrics only matters when there is more than one responder to share.
+    FabricIndex fabricIndex = kUndefinedFabricIndex;
+    if (kMaxHandshakes > 1)
+    {
+        fabricIndex = CASESession::FindFabricForSigma1(payload, *mFabrics, *mGroupDataProvider, mSessionResumptionStorage);
+    }
+
+    if (!CanStartHandshake(fabricIndex))
+    {
+        return QueueSigma1(ec, payloadHeader, std::move(payload), receivedTime, fabricIndex);
+    }
+
     ChipLogProgress(Inet, "CASE Server received Sigma1 message %s EC %p", ". Starting handshake.", ec);
+    return StartHandshake(ec, payloadHeader, std::move(payload), receivedTime, fabricIndex);
+}
 
-    CHIP_ERROR err = InitCASEHandshake(ec);
-    SuccessOrExit(err);
+void CASEServer::OnExchangeClosing(Messaging::ExchangeContext * ec)
+{
+    // The exchange of a queued Sigma1 message is closing under us (e.g. its session got released).
+    QueuedSigma1 * entry = FindQueuedSigma1(ec);
+    if (entry != nullptr)
+    {
+        DropQueuedSigma1(*entry);
+    }
+}
 
-    // TODO - Enable multiple concurrent CASE session establishment
-    // https://github.com/project-chip/connectedhomeip/issues/8342
-    ChipLogProgress(Inet, "CASE Server disabling CASE session setups");
-    mExchangeManager->UnregisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1);
+void CASEServer::ResetStatistics()
+{
+    const size_t activeHandshakes = mStatistics.activeHandshakes;
+    const size_t queueDepth       = mStatistics.queueDepth;
+
+    mStatistics                     = Statistics();
+    mStatistics.activeHandshakes    = activeHandshakes;
+    mStatistics.activeHighWaterMark = activeHandshakes;
+    mStatistics.queueDepth          = queueDepth;
+    mStatistics.queueHighWaterMark  = queueDepth;
+}
 
-    err = GetSession().OnMessageReceived(ec, payloadHeader, std::move(payload));
-    SuccessOrExit(err);
+bool CASEServer::CanStartHandshake(FabricIndex fabricIndex) const
+{
+    return mArmedResponder != nullptr && ActiveHandshakes(fabricIndex) < kMaxHandshakesPerFabric;
+}
+
+size_t CASEServer::ActiveHandshakes(FabricIndex fabricIndex) const
+{
+    size_t count = 0;
+    for (const auto & responder : mResponders)
+    {
+        count += (responder.mBusy && responder.mFabricIndex == fabricIndex) ? 1 : 0;
+    }
+    return count;
+}
+
+CHIP_ERROR CASEServer::StartHandshake(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                      System::PacketBufferHandle && payload, System::Clock::Timestamp receivedTime,
+                                      FabricIndex fabricIndex)
+{
+    Responder & responder = *mArmedResponder;
+    mArmedResponder       = nullptr;
+
+    responder.mBusy               = true;
+    responder.mFabricIndex        = fabricIndex;
+    responder.mSigma1ReceivedTime = receivedTime;
+
+    mStatistics.handshakesStarted++;
+    mStatistics.activeHandshakes++;
+    mStatistics.activeHighWaterMark = std::max(mStatistics.activeHighWaterMark, mStatistics.activeHandshakes);
+
+    // Hand over the exchange context to the CASE session.
+    ec->SetDelegate(&responder.mSession);
+
+    // Get the next responder ready before this one starts the handshake, which may end synchronously.
+    ArmResponder();
 
-exit:
     // CASESession::OnMessageReceived guarantees that it will call
     // OnSessionEstablishmentError if it returns error, so nothing else to do here.
-    return err;
+    return responder.mSession.OnMessageReceived(ec, payloadHeader, std::move(payload));
 }
 
-void CASEServer::PrepareForSessionEstablishment(const ScopedNodeId & previouslyEstablishedPeer)
+void CASEServer::ArmResponder(const ScopedNodeId & previouslyEstablishedPeer)
 {
-    // Let's re-register for CASE Sigma1 message, so that the next CASE session setup request can be processed.
-    // https://github.com/project-chip/connectedhomeip/issues/8342
-    ChipLogProgress(Inet, "CASE Server enabling CASE session setups");
-    mExchangeManager->RegisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1, this);
+    VerifyOrReturn(mArmedResponder == nullptr && mExchangeManager != nullptr);
+
+    Responder * responder = nullptr;
+    for (auto & candidate : mResponders)
+    {
+        if (!candidate.mBusy)
+        {
+            responder = &candidate;
+            break;
+        }
+    }
 
-    GetSession().Clear();
+    // All responders are busy, the next one to finish its handshake will be armed.
+    VerifyOrReturn(responder != nullptr);
+
+    responder->mSession.Clear();
 
     //
     // This releases our reference to a previously pinned session. If that was a successfully established session and is now
@@ -116,7 +238,7 @@ void CASEServer::PrepareForSessionEstablishment(const ScopedNodeId & previouslyE
     // de-allocated since no one else is holding onto this session. This will mean that when we get to allocating a session below,
     // we'll at least have one free session available in the session table, and won't need to evict an arbitrary session.
     //
-    mPinnedSecureSession.ClearValue();
+    responder->mPinnedSecureSession.ClearValue();
 
     //
     // Indicate to the underlying CASE session to prepare for session establishment requests coming its way. This will
@@ -127,16 +249,23 @@ void CASEServer::PrepareForSessionEstablishment(const ScopedNodeId & previouslyE
     // slot (and thereby free'ing up the slot for the next session attempt). However, this transfer isn't necessary - just
     // evicting a session will ensure it is available for the next attempt.
     //
-    // This call can fail if we have run out memory to allocate SecureSessions. Continuing without taking any action
-    // however will render this node deaf to future handshake requests, so it's better to die here to raise attention to the problem
-    // / facilitate recovery.
+    // This call can fail if we have run out memory to allocate SecureSessions. While other handshakes are in progress, the
+    // sessions they hold get released as they end, and the next one to end will try again. Otherwise, continuing without taking
+    // any action would render this node deaf to future handshake requests, so it's better to die here to raise attention to the
+    // problem / facilitate recovery.
     //
     // TODO(#17568): Once session eviction is actually in place, this call should NEVER fail and if so, is a logic bug.
     // Dying here on failure is even more appropriate then.
     //
-    VerifyOrDie(GetSession().PrepareForSessionEstablishment(*mSessionManager, mFabrics, mSessionResumptionStorage,
-                                                            mCertificateValidityPolicy, this, previouslyEstablishedPeer,
-                                                            GetLocalMRPConfig()) == CHIP_NO_ERROR);
+    CHIP_ERROR err = responder->mSession.PrepareForSessionEstablishment(*mSessionManager, mFabrics, mSessionResumptionStorage,
+                                                                        mCertificateValidityPolicy, responder,
+                                                                        previouslyEstablishedPeer, GetLocalMRPConfig());
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Inet, "CASE Server failed to prepare a responder: %" CHIP_ERROR_FORMAT, err.Format());
+        VerifyOrDie(mStatistics.activeHandshakes > 0);
+        return;
+    }
 
     //
     // PairingSession::mSecureSessionHolder is a weak-reference. If MarkForEviction is called on this session, the session is
@@ -148,26 +277,244 @@ void CASEServer::PrepareForSessionEstablishment(const ScopedNodeId & previouslyE
     //
     // Let's create a SessionHandle strong-reference to it to keep it resident.
     //
-    mPinnedSecureSession = GetSession().CopySecureSession();
+    responder->mPinnedSecureSession = responder->mSession.CopySecureSession();
 
     //
     // If we've gotten this far, it means we have successfully allocated a SecureSession to back our next attempt. If we haven't,
     // there is a bug somewhere and we should raise attention to it by dying.
     //
-    VerifyOrDie(mPinnedSecureSession.HasValue());
+    VerifyOrDie(responder->mPinnedSecureSession.HasValue());
+
+    mArmedResponder = responder;
+}
+
+void CASEServer::ReleaseResponder(Responder & responder, CHIP_ERROR err, const ScopedNodeId & establishedPeer)
+{
+    if (responder.mBusy)
+    {
+        responder.mBusy = false;
+        mStatistics.activeHandshakes--;
+
+        if (err == CHIP_NO_ERROR)
+        {
+            const System::Clock::Milliseconds64 latency = Since(responder.mSigma1ReceivedTime);
+            mStatistics.handshakesEstablished++;
+            mStatistics.totalHandshakeLatency += latency;
+            mStatistics.maxHandshakeLatency = std::max(mStatistics.maxHandshakeLatency, latency);
+            ChipLogProgress(Inet, "CASE Session established to peer: " ChipLogFormatScopedNodeId " in %" PRIu32 " ms",
+                            ChipLogValueScopedNodeId(establishedPeer), static_cast<uint32_t>(latency.count()));
+        }
+        else
+        {
+            mStatistics.handshakesFailed++;
+        }
+    }
+
+    // An armed responder can also fail, e.g. if its session gets released; it then needs to be prepared again.
+    if (mArmedResponder == &responder)
+    {
+        mArmedResponder = nullptr;
+    }
+
+    responder.mSession.Clear();
+    responder.mPinnedSecureSession.ClearValue();
+
+    ArmResponder(establishedPeer);
+
+    // Serve queued Sigma1 messages outside of the callbacks of the session that just ended.
+    if (mStatistics.queueDepth > 0 && mArmedResponder != nullptr)
+    {
+        LogErrorOnFailure(mSessionManager->SystemLayer()->StartTimer(System::Clock::kZero, ServeQueuedSigma1, this));
+    }
+}
+
+CHIP_ERROR CASEServer::QueueSigma1(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                   System::PacketBufferHandle && payload, System::Clock::Timestamp receivedTime,
+                                   FabricIndex fabricIndex)
+{
+    // A queued message keeps its exchange until a responder picks it up. Only take a free entry while that leaves the reserved
+    // exchanges to other traffic, otherwise the message can only take the place of one from a busier fabric.
+    QueuedSigma1 * entry = nullptr;
+    if (CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS - mExchangeManager->GetNumActiveExchanges() >= kExchangeReserve)
+    {
+        entry = FindQueuedSigma1(nullptr);
+    }
+    if (entry == nullptr)
+    {
+        entry = FindQueuedSigma1ToDisplace(fabricIndex);
+        if (entry != nullptr)
+        {
+            DropQueuedSigma1(*entry);
+        }
+    }
+
+    if (entry == nullptr)
+    {
+        mStatistics.sigma1Dropped++;
+        ChipLogError(Inet, "CASE Server busy, dropping Sigma1 message EC %p", ec);
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    // Keep the exchange open until a responder is available.
+    ec->WillSendMessage();
+
+    entry->mExchange      = ec;
+    entry->mPayloadHeader = payloadHeader;
+    entry->mPayload       = std::move(payload);
+    entry->mReceivedTime  = receivedTime;
+    entry->mSequence      = mNextSequence++;
+    entry->mFabricIndex   = fabricIndex;
+
+    mStatistics.queueDepth++;
+    mStatistics.queueHighWaterMark = std::max(mStatistics.queueHighWaterMark, mStatistics.queueDepth);
+
+    ChipLogProgress(Inet, "CASE Server busy, queued Sigma1 message EC %p (%u queued)", ec,
+                    static_cast<unsigned>(mStatistics.queueDepth));
+    return CHIP_NO_ERROR;
+}
+
+CASEServer::QueuedSigma1 * CASEServer::FindQueuedSigma1(const Messaging::ExchangeContext * ec)
+{
+    // The queue is disabled when its size is 0, even though mQueue has one entry.
+    VerifyOrReturnValue(kSigma1QueueSize > 0, nullptr);
+
+    for (auto & entry : mQueue)
+    {
+        if (entry.mExchange == ec)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+CASEServer::QueuedSigma1 * CASEServer::FindQueuedSigma1ToDisplace(FabricIndex fabricIndex)
+{
+    VerifyOrReturnValue(kSigma1QueueSize > 0, nullptr);
+
+    // When no entry can be taken, the queue makes room for a fabric by dropping the newest message of the fabric with the most
+    // queued messages, as long as that fabric has more of them than this one.
+    auto queuedOnFabric = [this](FabricIndex index) {
+        size_t count = 0;
+        for (const auto & entry : mQueue)
+        {
+            count += (entry.mExchange != nullptr && entry.mFabricIndex == index) ? 1 : 0;
+        }
+        return count;
+    };
+
+    QueuedSigma1 * victim = nullptr;
+    size_t victimCount    = queuedOnFabric(fabricIndex) + 1;
+    for (auto & entry : mQueue)
+    {
+        if (entry.mExchange == nullptr)
+        {
+            continue;
+        }
+
+        const size_t count = queuedOnFabric(entry.mFabricIndex);
+        if (count > victimCount ||
+            (victim != nullptr && count == victimCount && entry.mFabricIndex == victim->mFabricIndex &&
+             entry.IsNewerThan(*victim)))
+        {
+            victim      = &entry;
+            victimCount = count;
+        }
+    }
+    return victim;
+}
+
+void CASEServer::DropQueuedSigma1(QueuedSigma1 & entry)
+{
+    Messaging::ExchangeContext * ec = entry.mExchange;
+
+    entry.mExchange = nullptr;
+    entry.mPayload  = nullptr;
+    mStatistics.queueDepth--;
+    mStatistics.sigma1Dropped++;
+
+    ChipLogError(Inet, "CASE Server dropping queued Sigma1 message EC %p", ec);
+
+    // We own the exchange since WillSendMessage was called on it.
+    ec->Close();
+}
+
+void CASEServer::ServeQueuedSigma1(System::Layer * systemLayer, void * appState)
+{
+    static_cast<CASEServer *>(appState)->ServeQueuedSigma1();
+}
+
+void CASEServer::ServeQueuedSigma1()
+{
+    while (mStatistics.queueDepth > 0 && mArmedResponder != nullptr)
+    {
+        QueuedSigma1 * next = nullptr;
+        size_t nextActive   = 0;
+
+        for (auto & entry : mQueue)
+        {
+            if (entry.mExchange == nullptr)
+            {
+                continue;
+            }
+
+            // Don't bother with messages whose initiator has given up on a response.
+            if (!entry.mExchange->HasSessionHandle() ||
+                Since(entry.mReceivedTime) >
+                    CASESession::ComputeSigma1ResponseTimeout(entry.mExchange->GetSessionHandle()->GetRemoteMRPConfig()))
+            {
+                DropQueuedSigma1(entry);
+                continue;
+            }
+
+            // Serve the fabrics with the fewest handshakes in progress first, then the oldest message.
+            const size_t active = ActiveHandshakes(entry.mFabricIndex);
+            if (active < kMaxHandshakesPerFabric &&
+                (next == nullptr || active < nextActive || (active == nextActive && next->IsNewerThan(entry))))
+            {
+                next       = &entry;
+                nextActive = active;
+            }
+        }
+
+        VerifyOrReturn(next != nullptr);
+
+        Messaging::ExchangeContext * ec = next->mExchange;
+        PayloadHeader payloadHeader     = next->mPayloadHeader;
+        System::PacketBufferHandle payload(std::move(next->mPayload));
+        const System::Clock::Timestamp receivedTime = next->mReceivedTime;
+        const FabricIndex fabricIndex               = next->mFabricIndex;
+
+        next->mExchange = nullptr;
+        mStatistics.queueDepth--;
+
+        const System::Clock::Milliseconds64 queueDelay = Since(receivedTime);
+        mStatistics.totalQueueDelay += queueDelay;
+        mStatistics.maxQueueDelay = std::max(mStatistics.maxQueueDelay, queueDelay);
+
+        ChipLogProgress(Inet, "CASE Server starting handshake for Sigma1 message EC %p queued for %" PRIu32 " ms", ec,
+                        static_cast<uint32_t>(queueDelay.count()));
+
+        // Hold the exchange: if the handshake fails before anything is sent on it, it is still ours to close. On success, the
+        // session may still be computing its response in the background.
+        Messaging::ExchangeHandle exchange(*ec);
+        CHIP_ERROR err = StartHandshake(ec, payloadHeader, std::move(payload), receivedTime, fabricIndex);
+        if (err != CHIP_NO_ERROR && ec->IsSendExpected())
+        {
+            ec->Close();
+        }
+    }
 }
 
-void CASEServer::OnSessionEstablishmentError(CHIP_ERROR err)
+void CASEServer::Responder::OnSessionEstablishmentError(CHIP_ERROR err)
 {
     ChipLogError(Inet, "CASE Session establishment failed: %" CHIP_ERROR_FORMAT, err.Format());
 
-    PrepareForSessionEstablishment();
+    mServer->ReleaseResponder(*this, err, ScopedNodeId());
 }
 
-void CASEServer::OnSessionEstablished(const SessionHandle & session)
+void CASEServer::Responder::OnSessionEstablished(const SessionHandle & session)
 {
-    ChipLogProgress(Inet, "CASE Session established to peer: " ChipLogFormatScopedNodeId,
-                    ChipLogValueScopedNodeId(session->GetPeer()));
-    PrepareForSessionEstablishment(session->GetPeer());
+    mServer->ReleaseResponder(*this, CHIP_NO_ERROR, session->GetPeer());
 }
 } // namespace chip
@@ -25,41 +25,59 @@
 
 namespace chip {
 
-class CASEServer : public SessionEstablishmentDelegate,
-                   public Messaging::UnsolicitedMessageHandler,
-                   public Messaging::ExchangeDelegate
+/**
+ * Responder side of CASE: listens for Sigma1 messages and runs up to
+ * CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES handshakes at a time, each in its own
+ * CASESession.
+ *
+ * One idle responder is kept armed, i.e. holding the secure session that the next handshake will
+ * use, and another one is armed as soon as a Sigma1 message is handed to it. When no responder is
+ * available, or when the fabric targeted by the Sigma1 message already has
+ * CHIP_CONFIG_CASE_SERVER_MAX_HANDSHAKES_PER_FABRIC handshakes in progress, the message is queued
+ * (see CHIP_CONFIG_CASE_SERVER_SIGMA1_QUEUE_SIZE) until a responder frees up, as long as that leaves
+ * CHIP_CONFIG_CASE_SERVER_EXCHANGE_RESERVE exchanges for other traffic. Queued messages are then
+ * served starting with the fabrics that have the fewest handshakes in progress.
+ */
+class CASEServer : public Messaging::UnsolicitedMessageHandler, public Messaging::ExchangeDelegate
 {
 public:
+    /**
+     *  Counters describing the handshakes served since ListenForSessionEstablishment() or the last ResetStatistics().
+     */
+    struct Statistics
+    {
+        uint32_t handshakesStarted     = 0; /**< Sigma1 messages handed to a responder. */
+        uint32_t handshakesEstablished = 0; /**< Handshakes that established a session. */
+        uint32_t handshakesFailed      = 0; /**< Handshakes that failed, including timeouts. */
+        uint32_t sigma1Dropped         = 0; /**< Sigma1 messages that found no room in the queue, or expired in it. */
+        /** Sum and maximum of the time between the reception of Sigma1 and the establishment of the session. */
+        System::Clock::Milliseconds64 totalHandshakeLatency = System::Clock::Milliseconds64(0);
+        System::Clock::Milliseconds64 maxHandshakeLatency   = System::Clock::Milliseconds64(0);
+        /** Sum and maximum of the time that Sigma1 messages spent in the queue. */
+        System::Clock::Milliseconds64 totalQueueDelay = System::Clock::Milliseconds64(0);
+        System::Clock::Milliseconds64 maxQueueDelay   = System::Clock::Milliseconds64(0);
+        size_t activeHandshakes                       = 0; /**< Handshakes currently in progress. */
+        size_t activeHighWaterMark                    = 0; /**< Highest value reached by activeHandshakes. */
+        size_t queueDepth                             = 0; /**< Sigma1 messages currently queued. */
+        size_t queueHighWaterMark                     = 0; /**< Highest value reached by queueDepth. */
+    };
+
     CASEServer() {}
     ~CASEServer() override { Shutdown(); }
 
     /*
-     * This method will shutdown this object, releasing the strong reference to the pinned SecureSession object.
-     * It will also unregister the unsolicited handler and clear out the session object (which will release the weak
-     * reference through the underlying SessionHolder).
+     * This method will shutdown this object, releasing the strong references to the pinned SecureSession objects.
+     * It will also unregister the unsolicited handler, drop the queued Sigma1 messages and clear out the session objects
+     * (which will release the weak references through the underlying SessionHolder).
      *
      */
-    void Shutdown()
-    {
-        if (mExchangeManager != nullptr)
-        {
-            mExchangeManager->UnregisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1);
-            mExchangeManager = nullptr;
-        }
-
-        GetSession().Clear();
-        mPinnedSecureSession.ClearValue();
-    }
+    void Shutdown();
 
     CHIP_ERROR ListenForSessionEstablishment(Messaging::ExchangeManager * exchangeManager, SessionManager * sessionManager,
                                              FabricTable * fabrics, SessionResumptionStorage * sessionResumptionStorage,
                                              Credentials::CertificateValidityPolicy * policy,
                                              Credentials::GroupDataProvider * responderGroupDataProvider);
 
-    //////////// SessionEstablishmentDelegate Implementation ///////////////
-    void OnSessionEstablishmentError(CHIP_ERROR error) override;
-    void OnSessionEstablished(const SessionHandle & session) override;
-
     //// UnsolicitedMessageHandler Implementation ////
     CHIP_ERROR OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader, ExchangeDelegate *& newDelegate) override;
 
@@ -67,46 +85,106 @@ public:
     CHIP_ERROR OnMessageReceived(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
                                  System::PacketBufferHandle && payload) override;
     void OnResponseTimeout(Messaging::ExchangeContext * ec) override {}
-    Messaging::ExchangeMessageDispatch & GetMessageDispatch() override { return GetSession().GetMessageDispatch(); }
+    void OnExchangeClosing(Messaging::ExchangeContext * ec) override;
+    Messaging::ExchangeMessageDispatch & GetMessageDispatch() override { return SessionEstablishmentExchangeDispatch::Instance(); }
 
-    CASESession & GetSession() { return mPairingSession; }
+    const Statistics & GetStatistics() const { return mStatistics; }
+
+    /**
+     * Reset the counters, except for the current number of handshakes and queued messages, which become the new
+     * high water marks.
+     */
+    void ResetStatistics();
 
 private:
+    static constexpr size_t kMaxHandshakes          = CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES;
+    static constexpr size_t kMaxHandshakesPerFabric = CHIP_CONFIG_CASE_SERVER_MAX_HANDSHAKES_PER_FABRIC;
+    static constexpr size_t kSigma1QueueSize        = CHIP_CONFIG_CASE_SERVER_SIGMA1_QUEUE_SIZE;
+    static constexpr size_t kExchangeReserve        = CHIP_CONFIG_CASE_SERVER_EXCHANGE_RESERVE;
+    static_assert(kMaxHandshakes > 0, "CASEServer needs at least one responder");
+    static_assert(kMaxHandshakesPerFabric > 0, "CASEServer needs at least one responder per fabric");
+    static_assert(kMaxHandshakes + kSigma1QueueSize < CHIP_CONFIG_UNAUTHENTICATED_CONNECTION_POOL_SIZE,
+                  "Each handshake in progress or queued holds an unauthenticated session, and PASE needs one too");
+    static_assert(kSigma1QueueSize == 0 || kExchangeReserve < CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS,
+                  "Queued Sigma1 messages need exchanges beyond the reserve");
+
+    class Responder : public SessionEstablishmentDelegate
+    {
+    public:
+        //////////// SessionEstablishmentDelegate Implementation ///////////////
+        void OnSessionEstablishmentError(CHIP_ERROR error) override;
+        void OnSessionEstablished(const SessionHandle & session) override;
+
+        CASEServer * mServer = nullptr;
+        CASESession mSession;
+
+        //
+        // While the responder is armed or busy, this is used to maintain an additional, strong reference to
+        // the underlying SecureSession. This is because the existing reference in PairingSession is a weak one
+        // (i.e a SessionHolder) and can lose its reference if the session is evicted for any reason.
+        //
+        // This initially points to a session that is not yet active. Upon activation, it transfers ownership
+        // of the session to the SecureSessionManager and this reference is released when the responder is.
+        //
+        Optional<SessionHandle> mPinnedSecureSession;
+
+        System::Clock::Timestamp mSigma1ReceivedTime = System::Clock::kZero;
+        FabricIndex mFabricIndex                      = kUndefinedFabricIndex;
+        bool mBusy                                    = false;
+    };
+
+    struct QueuedSigma1
+    {
+        Messaging::ExchangeContext * mExchange = nullptr;
+        PayloadHeader mPayloadHeader;
+        System::PacketBufferHandle mPayload;
+        System::Clock::Timestamp mReceivedTime = System::Clock::kZero;
+        uint32_t mSequence                     = 0; // Order of arrival, messages of a burst get the same mReceivedTime.
+        FabricIndex mFabricIndex               = kUndefinedFabricIndex;
+
+        bool IsNewerThan(const QueuedSigma1 & other) const { return static_cast<int32_t>(mSequence - other.mSequence) > 0; }
+    };
+
     Messaging::ExchangeManager * mExchangeManager                       = nullptr;
     SessionResumptionStorage * mSessionResumptionStorage                = nullptr;
     Credentials::CertificateValidityPolicy * mCertificateValidityPolicy = nullptr;
 
-    //
-    // When we're in the process of establishing a session, this is used
-    // to maintain an additional, strong reference to the underlying SecureSession.
-    // This is because the existing reference in PairingSession is a weak one
-    // (i.e a SessionHolder) and can lose its reference if the session is evicted
-    // for any reason.
-    //
-    // This initially points to a session that is not yet active. Upon activation, it
-    // transfers ownership of the session to the SecureSessionManager and this reference
-    // is released before simultaneously acquiring ownership of a new SecureSession.
-    //
-    Optional<SessionHandle> mPinnedSecureSession;
-
-    CASESession mPairingSession;
+    Responder mResponders[kMaxHandshakes];
+    Responder * mArmedResponder      = nullptr;
     SessionManager * mSessionManager = nullptr;
 
+    QueuedSigma1 mQueue[kSigma1QueueSize > 0 ? kSigma1QueueSize : 1];
+    uint32_t mNextSequence = 0;
+
     FabricTable * mFabrics                              = nullptr;
     Credentials::GroupDataProvider * mGroupDataProvider = nullptr;
 
-    CHIP_ERROR InitCASEHandshake(Messaging::ExchangeContext * ec);
+    Statistics mStatistics;
 
     /*
-     * This will clean up any state from a previous session establishment
-     * attempt (if any) and setup the machinery to listen for and handle
-     * any session handshakes there-after.
+     * Get an idle responder ready for the next Sigma1 message, unless one already is. This allocates the
+     * SecureSession that the handshake will use.
      *
      * If a session had previously been established successfully, previouslyEstablishedPeer
      * should be set to the scoped node-id of the peer associated with that session.
      *
      */
-    void PrepareForSessionEstablishment(const ScopedNodeId & previouslyEstablishedPeer = ScopedNodeId());
+    void ArmResponder(const ScopedNodeId & previouslyEstablishedPeer = ScopedNodeId());
+    void ReleaseResponder(Responder & responder, CHIP_ERROR err, const ScopedNodeId & establishedPeer);
+
+    bool CanStartHandshake(FabricIndex fabricIndex) const;
+    size_t ActiveHandshakes(FabricIndex fabricIndex) const;
+    CHIP_ERROR StartHandshake(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                              System::PacketBufferHandle && payload, System::Clock::Timestamp receivedTime,
+                              FabricIndex fabricIndex);
+
+    CHIP_ERROR QueueSigma1(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                           System::PacketBufferHandle && payload, System::Clock::Timestamp receivedTime, FabricIndex fabricIndex);
+    QueuedSigma1 * FindQueuedSigma1(const Messaging::ExchangeContext * ec);
+    QueuedSigma1 * FindQueuedSigma1ToDisplace(FabricIndex fabricIndex);
+    void DropQueuedSigma1(QueuedSigma1 & entry);
+    void ServeQueuedSigma1();
+    static void ServeQueuedSigma1(System::Layer * systemLayer, void * appState);
 };
 
 } // namespace chip
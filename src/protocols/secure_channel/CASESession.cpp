@@ -215,10 +215,6 @@ CASESession::PrepareForSessionEstablishment(SessionManager & sessionManager, Fab
 
     CHIP_ERROR err = CHIP_NO_ERROR;
 
-    // Sequence number used to coordinate foreground/background work for a
-    // particular session establishment.
-    mSequence++;
-
     SuccessOrExit(err = fabricTable->AddFabricDelegate(this));
 
     mFabricsTable             = fabricTable;
@@ -506,19 +502,27 @@ CHIP_ERROR CASESession::FindLocalNodeFromDestinationId(const ByteSpan & destinat
 {
     VerifyOrReturnError(mFabricsTable != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    bool found = false;
-    for (const FabricInfo & fabricInfo : *mFabricsTable)
+    MutableByteSpan ipkSpan(mIPK);
+    return MatchDestinationId(*mFabricsTable, *mGroupDataProvider, destinationId, initiatorRandom, mFabricIndex, mLocalNodeId,
+                              ipkSpan);
+}
+
+CHIP_ERROR CASESession::MatchDestinationId(const FabricTable & fabricTable, GroupDataProvider & groupDataProvider,
+                                           const ByteSpan & destinationId, const ByteSpan & initiatorRandom,
+                                           FabricIndex & fabricIndex, NodeId & nodeId, MutableByteSpan & ipk)
+{
+    for (const FabricInfo & fabricInfo : fabricTable)
     {
         // Basic data for candidate fabric, used to compute candidate destination identifiers
-        FabricId fabricId = fabricInfo.GetFabricId();
-        NodeId nodeId     = fabricInfo.GetNodeId();
+        FabricId fabricId      = fabricInfo.GetFabricId();
+        NodeId candidateNodeId = fabricInfo.GetNodeId();
         Crypto::P256PublicKey rootPubKey;
-        ReturnErrorOnFailure(mFabricsTable->FetchRootPubkey(fabricInfo.GetFabricIndex(), rootPubKey));
+        ReturnErrorOnFailure(fabricTable.FetchRootPubkey(fabricInfo.GetFabricIndex(), rootPubKey));
         Credentials::P256PublicKeySpan rootPubKeySpan{ rootPubKey.ConstBytes() };
 
         // Get IPK operational group key set for current candidate fabric
         GroupDataProvider::KeySet ipkKeySet;
-        CHIP_ERROR err = mGroupDataProvider->GetIpkKeySet(fabricInfo.GetFabricIndex(), ipkKeySet);
+        CHIP_ERROR err = groupDataProvider.GetIpkKeySet(fabricInfo.GetFabricIndex(), ipkKeySet);
         if ((err != CHIP_NO_ERROR) ||
             ((ipkKeySet.num_keys_used == 0) || (ipkKeySet.num_keys_used > Credentials::GroupDataProvider::KeySet::kEpochKeysMax)))
         {
@@ -532,27 +536,77 @@ CHIP_ERROR CASESession::FindLocalNodeFromDestinationId(const ByteSpan & destinat
             MutableByteSpan candidateDestinationIdSpan(candidateDestinationId);
             ByteSpan candidateIpkSpan(ipkKeySet.epoch_keys[keyIdx].key);
 
-            err = GenerateCaseDestinationId(ByteSpan(candidateIpkSpan), ByteSpan(initiatorRandom), rootPubKeySpan, fabricId, nodeId,
-                                            candidateDestinationIdSpan);
+            err = GenerateCaseDestinationId(ByteSpan(candidateIpkSpan), ByteSpan(initiatorRandom), rootPubKeySpan, fabricId,
+                                            candidateNodeId, candidateDestinationIdSpan);
             if ((err == CHIP_NO_ERROR) && (candidateDestinationIdSpan.data_equal(destinationId)))
             {
-                // Found a match, stop working, cache IPK, update local fabric context
-                found = true;
-                MutableByteSpan ipkSpan(mIPK);
-                CopySpanToMutableSpan(candidateIpkSpan, ipkSpan);
-                mFabricIndex = fabricInfo.GetFabricIndex();
-                mLocalNodeId = nodeId;
-                break;
+                // Found a match, stop working, return IPK and local fabric context
+                ReturnErrorOnFailure(CopySpanToMutableSpan(candidateIpkSpan, ipk));
+                fabricIndex = fabricInfo.GetFabricIndex();
+                nodeId      = candidateNodeId;
+                return CHIP_NO_ERROR;
             }
         }
+    }
 
-        if (found)
+    return CHIP_ERROR_KEY_NOT_FOUND;
+}
+
+FabricIndex CASESession::FindFabricForSigma1(const System::PacketBufferHandle & msg, const FabricTable & fabricTable,
+                                             GroupDataProvider & groupDataProvider,
+                                             SessionResumptionStorage * sessionResumptionStorage)
+{
+    using namespace TLV;
+
+    VerifyOrReturnValue(!msg.IsNull(), kUndefinedFabricIndex);
+
+    ContiguousBufferTLVReader tlvReader;
+    tlvReader.Init(msg->Start(), msg->DataLength());
+
+    ByteSpan initiatorRandom;
+    ByteSpan destinationId;
+    TLVType containerType = kTLVType_Structure;
+    VerifyOrReturnValue(tlvReader.Next(containerType, AnonymousTag()) == CHIP_NO_ERROR, kUndefinedFabricIndex);
+    VerifyOrReturnValue(tlvReader.EnterContainer(containerType) == CHIP_NO_ERROR, kUndefinedFabricIndex);
+    VerifyOrReturnValue(tlvReader.Next(ContextTag(kTag_Sigma1_InitiatorRandom)) == CHIP_NO_ERROR, kUndefinedFabricIndex);
+    VerifyOrReturnValue(tlvReader.GetByteView(initiatorRandom) == CHIP_NO_ERROR, kUndefinedFabricIndex);
+    VerifyOrReturnValue(tlvReader.Next(ContextTag(kTag_Sigma1_InitiatorSessionId)) == CHIP_NO_ERROR, kUndefinedFabricIndex);
+    VerifyOrReturnValue(tlvReader.Next(ContextTag(kTag_Sigma1_DestinationId)) == CHIP_NO_ERROR, kUndefinedFabricIndex);
+    VerifyOrReturnValue(tlvReader.GetByteView(destinationId) == CHIP_NO_ERROR, kUndefinedFabricIndex);
+
+    // A resumption ID identifies the fabric without any crypto. Its MIC is checked by the handshake itself.
+    if (sessionResumptionStorage != nullptr)
+    {
+        while (tlvReader.Next() == CHIP_NO_ERROR)
         {
+            ByteSpan resumptionId;
+            if (tlvReader.GetTag() != ContextTag(kTag_Sigma1_ResumptionID) ||
+                tlvReader.GetByteView(resumptionId) != CHIP_NO_ERROR ||
+                resumptionId.size() != SessionResumptionStorage::kResumptionIdSize)
+            {
+                continue;
+            }
+
+            ScopedNodeId node;
+            Crypto::P256ECDHDerivedSecret sharedSecret;
+            CATValues peerCATs;
+            if (sessionResumptionStorage->FindByResumptionId(SessionResumptionStorage::ConstResumptionIdView(resumptionId.data()),
+                                                             node, sharedSecret, peerCATs) == CHIP_NO_ERROR)
+            {
+                return node.GetFabricIndex();
+            }
             break;
         }
     }
 
-    return found ? CHIP_NO_ERROR : CHIP_ERROR_KEY_NOT_FOUND;
+    FabricIndex fabricIndex = kUndefinedFabricIndex;
+    NodeId nodeId           = kUndefinedNodeId;
+    uint8_t ipk[kIPKSize];
+    MutableByteSpan ipkSpan(ipk);
+    CHIP_ERROR err =
+        MatchDestinationId(fabricTable, groupDataProvider, destinationId, initiatorRandom, fabricIndex, nodeId, ipkSpan);
+    Crypto::ClearSecretData(ipk);
+    return (err == CHIP_NO_ERROR) ? fabricIndex : kUndefinedFabricIndex;
 }
 
 CHIP_ERROR CASESession::TryResumeSession(SessionResumptionStorage::ConstResumptionIdView resumptionId, ByteSpan resume1MIC,
@@ -644,7 +698,7 @@ CHIP_ERROR CASESession::HandleSigma1(System::PacketBufferHandle && msg)
     // mRemotePubKey.Length() == initiatorPubKey.size() == kP256_PublicKey_Length.
     memcpy(mRemotePubKey.Bytes(), initiatorPubKey.data(), mRemotePubKey.Length());
 
-    SuccessOrExit(err = SendSigma2());
+    SuccessOrExit(err = SendSigma2a());
 
     mDelegate->OnSessionEstablishmentStarted();
 
@@ -717,6 +771,82 @@ CHIP_ERROR CASESession::SendSigma2Resume()
     return CHIP_NO_ERROR;
 }
 
+struct CASESession::SendSigma2Data
+{
+    ~SendSigma2Data()
+    {
+        if (ephemeralKey != nullptr)
+        {
+            fabricTable->ReleaseEphemeralKeypair(ephemeralKey);
+        }
+    }
+
+    FabricTable * fabricTable = nullptr;
+
+    // Owned by the work until SendSigma2c hands it over to the session.
+    P256Keypair * ephemeralKey = nullptr;
+
+    P256PublicKey remotePubKey;
+    P256ECDHDerivedSecret sharedSecret;
+};
+
+CHIP_ERROR CASESession::SendSigma2a()
+{
+    MATTER_TRACE_EVENT_SCOPE("SendSigma2", "CASESession");
+
+    VerifyOrReturnError(mFabricsTable != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    auto * work = Platform::New<CryptoWorkWithData<CASESession, SendSigma2Data>>(*this, &CASESession::SendSigma2b,
+                                                                                 &CASESession::SendSigma2c);
+    VerifyOrReturnError(work != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    work->mData.fabricTable  = mFabricsTable;
+    work->mData.ephemeralKey = mFabricsTable->AllocateEphemeralKeypairForCASE();
+    work->mData.remotePubKey = mRemotePubKey;
+    if (work->mData.ephemeralKey == nullptr)
+    {
+        Platform::Delete(work);
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    ReturnErrorOnFailure(ScheduleCryptoWork(work));
+    mExchangeCtxt->WillSendMessage();
+    mState = State::kBackgroundPending;
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CASESession::SendSigma2b(SendSigma2Data & data)
+{
+    // Generate an ephemeral keypair
+    ReturnErrorOnFailure(data.ephemeralKey->Initialize(ECPKeyTarget::ECDH));
+
+    // Generate a Shared Secret
+    return data.ephemeralKey->ECDH_derive_secret(data.remotePubKey, data.sharedSecret);
+}
+
+void CASESession::SendSigma2c(SendSigma2Data & data, CHIP_ERROR status)
+{
+    CHIP_ERROR err = status;
+    SuccessOrExit(err);
+
+    mEphemeralKey     = data.ephemeralKey;
+    data.ephemeralKey = nullptr;
+    mSharedSecret     = data.sharedSecret;
+
+    SuccessOrExit(err = SendSigma2());
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
+        // Abort the pending establish, which is normally done by CASESession::OnMessageReceived,
+        // but in the background processing case must be done here.
+        DiscardExchange();
+        AbortPendingEstablish(err);
+    }
+}
+
 CHIP_ERROR CASESession::SendSigma2()
 {
     MATTER_TRACE_EVENT_SCOPE("SendSigma2", "CASESession");
@@ -740,13 +870,7 @@ CHIP_ERROR CASESession::SendSigma2()
     uint8_t msg_rand[kSigmaParamRandomNumberSize];
     ReturnErrorOnFailure(DRBG_get_bytes(&msg_rand[0], sizeof(msg_rand)));
 
-    // Generate an ephemeral keypair
-    mEphemeralKey = mFabricsTable->AllocateEphemeralKeypairForCASE();
-    VerifyOrReturnError(mEphemeralKey != nullptr, CHIP_ERROR_NO_MEMORY);
-    ReturnErrorOnFailure(mEphemeralKey->Initialize(ECPKeyTarget::ECDH));
-
-    // Generate a Shared Secret
-    ReturnErrorOnFailure(mEphemeralKey->ECDH_derive_secret(mRemotePubKey, mSharedSecret));
+    VerifyOrReturnError(mEphemeralKey != nullptr, CHIP_ERROR_INTERNAL);
 
     uint8_t msg_salt[kIPKSize + kSigmaParamRandomNumberSize + kP256_PublicKey_Length + kSHA256_Hash_Length];
 
@@ -921,16 +1045,33 @@ exit:
     return err;
 }
 
-CHIP_ERROR CASESession::HandleSigma2_and_SendSigma3(System::PacketBufferHandle && msg)
+struct CASESession::PeerCredentialsData
 {
-    MATTER_TRACE_EVENT_SCOPE("HandleSigma2_and_SendSigma3", "CASESession");
-    ReturnErrorOnFailure(HandleSigma2(std::move(msg)));
-    ReturnErrorOnFailure(SendSigma3());
+    // TBS data signed by the peer, which also holds the peer certificates.
+    chip::Platform::ScopedMemoryBuffer<uint8_t> msgSigned;
+    size_t msgSignedLen = 0;
 
-    return CHIP_NO_ERROR;
-}
+    ByteSpan peerNOC;
+    ByteSpan peerICAC;
+
+    uint8_t rootCertBuf[kMaxCHIPCertLength];
+    ByteSpan fabricRCAC;
+
+    P256ECDSASignature signature;
+
+    FabricId fabricId = kUndefinedFabricId;
+    NodeId peerNodeId = kUndefinedNodeId;
 
-CHIP_ERROR CASESession::HandleSigma2(System::PacketBufferHandle && msg)
+    ValidationContext validContext;
+
+    // Key of the peer certificate chain in the verified chains of the fabric table, whether the chain was found
+    // there, and the generation of the cache when the fabric RCAC was fetched.
+    VerifiedCertChainCache::Key chainKey;
+    bool chainVerified            = false;
+    uint32_t chainCacheGeneration = 0;
+};
+
+CHIP_ERROR CASESession::HandleSigma2a(System::PacketBufferHandle && msg)
 {
     MATTER_TRACE_EVENT_SCOPE("HandleSigma2", "CASESession");
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -947,151 +1088,140 @@ CHIP_ERROR CASESession::HandleSigma2(System::PacketBufferHandle && msg)
     size_t msg_r2_encrypted_len          = 0;
     size_t msg_r2_encrypted_len_with_tag = 0;
 
-    chip::Platform::ScopedMemoryBuffer<uint8_t> msg_R2_Signed;
-    size_t msg_r2_signed_len;
     size_t max_msg_r2_signed_enc_len;
     constexpr size_t kCaseOverheadForFutureTbeData = 128;
 
     AutoReleaseSessionKey sr2k(*mSessionManager->GetSessionKeystore());
 
-    P256ECDSASignature tbsData2Signature;
-
-    NodeId responderNodeId;
-    P256PublicKey responderPublicKey;
-
     uint8_t responderRandom[kSigmaParamRandomNumberSize];
-    ByteSpan responderNOC;
-    ByteSpan responderICAC;
 
     uint16_t responderSessionId;
 
     ChipLogProgress(SecureChannel, "Received Sigma2 msg");
 
-    FabricId fabricId = kUndefinedFabricId;
+    auto * workPtr = Platform::New<CryptoWorkWithData<CASESession, PeerCredentialsData>>(
+        *this, &CASESession::VerifyPeerCredentials, &CASESession::HandleSigma2c);
+    VerifyOrExit(workPtr != nullptr, err = CHIP_ERROR_NO_MEMORY);
     {
-        VerifyOrExit(mFabricsTable != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
-        const auto * fabricInfo = mFabricsTable->FindFabricWithIndex(mFabricIndex);
-        VerifyOrExit(fabricInfo != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
-        fabricId = fabricInfo->GetFabricId();
-    }
+        auto & data = workPtr->mData;
 
-    VerifyOrExit(mEphemeralKey != nullptr, err = CHIP_ERROR_INTERNAL);
-    VerifyOrExit(buf != nullptr, err = CHIP_ERROR_MESSAGE_INCOMPLETE);
+        {
+            VerifyOrExit(mFabricsTable != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
+            const auto * fabricInfo = mFabricsTable->FindFabricWithIndex(mFabricIndex);
+            VerifyOrExit(fabricInfo != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
+            data.fabricId = fabricInfo->GetFabricId();
+        }
 
-    tlvReader.Init(std::move(msg));
-    SuccessOrExit(err = tlvReader.Next(containerType, TLV::AnonymousTag()));
-    SuccessOrExit(err = tlvReader.EnterContainer(containerType));
+        VerifyOrExit(mEphemeralKey != nullptr, err = CHIP_ERROR_INTERNAL);
+        VerifyOrExit(buf != nullptr, err = CHIP_ERROR_MESSAGE_INCOMPLETE);
 
-    // Retrieve Responder's Random value
-    SuccessOrExit(err = tlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_Sigma2_ResponderRandom)));
-    SuccessOrExit(err = tlvReader.GetBytes(responderRandom, sizeof(responderRandom)));
+        tlvReader.Init(std::move(msg));
+        SuccessOrExit(err = tlvReader.Next(containerType, TLV::AnonymousTag()));
+        SuccessOrExit(err = tlvReader.EnterContainer(containerType));
 
-    // Assign Session ID
-    SuccessOrExit(err = tlvReader.Next(TLV::kTLVType_UnsignedInteger, TLV::ContextTag(kTag_Sigma2_ResponderSessionId)));
-    SuccessOrExit(err = tlvReader.Get(responderSessionId));
+        // Retrieve Responder's Random value
+        SuccessOrExit(err = tlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_Sigma2_ResponderRandom)));
+        SuccessOrExit(err = tlvReader.GetBytes(responderRandom, sizeof(responderRandom)));
 
-    ChipLogDetail(SecureChannel, "Peer assigned session session ID %d", responderSessionId);
-    SetPeerSessionId(responderSessionId);
+        // Assign Session ID
+        SuccessOrExit(err = tlvReader.Next(TLV::kTLVType_UnsignedInteger, TLV::ContextTag(kTag_Sigma2_ResponderSessionId)));
+        SuccessOrExit(err = tlvReader.Get(responderSessionId));
 
-    // Retrieve Responder's Ephemeral Pubkey
-    SuccessOrExit(err = tlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_Sigma2_ResponderEphPubKey)));
-    SuccessOrExit(err = tlvReader.GetBytes(mRemotePubKey, static_cast<uint32_t>(mRemotePubKey.Length())));
+        ChipLogDetail(SecureChannel, "Peer assigned session session ID %d", responderSessionId);
+        SetPeerSessionId(responderSessionId);
 
-    // Generate a Shared Secret
-    SuccessOrExit(err = mEphemeralKey->ECDH_derive_secret(mRemotePubKey, mSharedSecret));
+        // Retrieve Responder's Ephemeral Pubkey
+        SuccessOrExit(err = tlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_Sigma2_ResponderEphPubKey)));
+        SuccessOrExit(err = tlvReader.GetBytes(mRemotePubKey, static_cast<uint32_t>(mRemotePubKey.Length())));
 
-    // Generate the S2K key
-    {
-        MutableByteSpan saltSpan(msg_salt);
-        SuccessOrExit(err = ConstructSaltSigma2(ByteSpan(responderRandom), mRemotePubKey, ByteSpan(mIPK), saltSpan));
-        SuccessOrExit(err = DeriveSigmaKey(saltSpan, ByteSpan(kKDFSR2Info), sr2k));
-    }
+        // Generate a Shared Secret
+        SuccessOrExit(err = mEphemeralKey->ECDH_derive_secret(mRemotePubKey, mSharedSecret));
 
-    SuccessOrExit(err = mCommissioningHash.AddData(ByteSpan{ buf, buflen }));
+        // Generate the S2K key
+        {
+            MutableByteSpan saltSpan(msg_salt);
+            SuccessOrExit(err = ConstructSaltSigma2(ByteSpan(responderRandom), mRemotePubKey, ByteSpan(mIPK), saltSpan));
+            SuccessOrExit(err = DeriveSigmaKey(saltSpan, ByteSpan(kKDFSR2Info), sr2k));
+        }
 
-    // Generate decrypted data
-    SuccessOrExit(err = tlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_Sigma2_Encrypted2)));
+        SuccessOrExit(err = mCommissioningHash.AddData(ByteSpan{ buf, buflen }));
 
-    max_msg_r2_signed_enc_len =
-        TLV::EstimateStructOverhead(Credentials::kMaxCHIPCertLength, Credentials::kMaxCHIPCertLength, tbsData2Signature.Length(),
-                                    SessionResumptionStorage::kResumptionIdSize, kCaseOverheadForFutureTbeData);
-    msg_r2_encrypted_len_with_tag = tlvReader.GetLength();
+        // Generate decrypted data
+        SuccessOrExit(err = tlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_Sigma2_Encrypted2)));
 
-    // Validate we did not receive a buffer larger than legal
-    VerifyOrExit(msg_r2_encrypted_len_with_tag <= max_msg_r2_signed_enc_len, err = CHIP_ERROR_INVALID_TLV_ELEMENT);
-    VerifyOrExit(msg_r2_encrypted_len_with_tag > CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES, err = CHIP_ERROR_INVALID_TLV_ELEMENT);
-    VerifyOrExit(msg_R2_Encrypted.Alloc(msg_r2_encrypted_len_with_tag), err = CHIP_ERROR_NO_MEMORY);
+        max_msg_r2_signed_enc_len =
+            TLV::EstimateStructOverhead(Credentials::kMaxCHIPCertLength, Credentials::kMaxCHIPCertLength, data.signature.Length(),
+                                        SessionResumptionStorage::kResumptionIdSize, kCaseOverheadForFutureTbeData);
+        msg_r2_encrypted_len_with_tag = tlvReader.GetLength();
 
-    SuccessOrExit(err = tlvReader.GetBytes(msg_R2_Encrypted.Get(), static_cast<uint32_t>(msg_r2_encrypted_len_with_tag)));
-    msg_r2_encrypted_len = msg_r2_encrypted_len_with_tag - CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES;
+        // Validate we did not receive a buffer larger than legal
+        VerifyOrExit(msg_r2_encrypted_len_with_tag <= max_msg_r2_signed_enc_len, err = CHIP_ERROR_INVALID_TLV_ELEMENT);
+        VerifyOrExit(msg_r2_encrypted_len_with_tag > CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES, err = CHIP_ERROR_INVALID_TLV_ELEMENT);
+        VerifyOrExit(msg_R2_Encrypted.Alloc(msg_r2_encrypted_len_with_tag), err = CHIP_ERROR_NO_MEMORY);
 
-    SuccessOrExit(err = AES_CCM_decrypt(msg_R2_Encrypted.Get(), msg_r2_encrypted_len, nullptr, 0,
-                                        msg_R2_Encrypted.Get() + msg_r2_encrypted_len, CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES,
-                                        sr2k.KeyHandle(), kTBEData2_Nonce, kTBEDataNonceLength, msg_R2_Encrypted.Get()));
+        SuccessOrExit(err = tlvReader.GetBytes(msg_R2_Encrypted.Get(), static_cast<uint32_t>(msg_r2_encrypted_len_with_tag)));
+        msg_r2_encrypted_len = msg_r2_encrypted_len_with_tag - CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES;
 
-    decryptedDataTlvReader.Init(msg_R2_Encrypted.Get(), msg_r2_encrypted_len);
-    containerType = TLV::kTLVType_Structure;
-    SuccessOrExit(err = decryptedDataTlvReader.Next(containerType, TLV::AnonymousTag()));
-    SuccessOrExit(err = decryptedDataTlvReader.EnterContainer(containerType));
+        SuccessOrExit(err = AES_CCM_decrypt(msg_R2_Encrypted.Get(), msg_r2_encrypted_len, nullptr, 0,
+                                            msg_R2_Encrypted.Get() + msg_r2_encrypted_len, CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES,
+                                            sr2k.KeyHandle(), kTBEData2_Nonce, kTBEDataNonceLength, msg_R2_Encrypted.Get()));
 
-    SuccessOrExit(err = decryptedDataTlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_TBEData_SenderNOC)));
-    SuccessOrExit(err = decryptedDataTlvReader.Get(responderNOC));
+        decryptedDataTlvReader.Init(msg_R2_Encrypted.Get(), msg_r2_encrypted_len);
+        containerType = TLV::kTLVType_Structure;
+        SuccessOrExit(err = decryptedDataTlvReader.Next(containerType, TLV::AnonymousTag()));
+        SuccessOrExit(err = decryptedDataTlvReader.EnterContainer(containerType));
 
-    SuccessOrExit(err = decryptedDataTlvReader.Next());
-    if (TLV::TagNumFromTag(decryptedDataTlvReader.GetTag()) == kTag_TBEData_SenderICAC)
-    {
-        VerifyOrExit(decryptedDataTlvReader.GetType() == TLV::kTLVType_ByteString, err = CHIP_ERROR_WRONG_TLV_TYPE);
-        SuccessOrExit(err = decryptedDataTlvReader.Get(responderICAC));
-        SuccessOrExit(err = decryptedDataTlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_TBEData_Signature)));
-    }
+        SuccessOrExit(err = decryptedDataTlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_TBEData_SenderNOC)));
+        SuccessOrExit(err = decryptedDataTlvReader.Get(data.peerNOC));
 
-    // Validate responder identity located in msg_r2_encrypted
-    // Constructing responder identity
-    {
-        CompressedFabricId unused;
-        FabricId responderFabricId;
-        SuccessOrExit(err = SetEffectiveTime());
-        SuccessOrExit(err = mFabricsTable->VerifyCredentials(mFabricIndex, responderNOC, responderICAC, mValidContext, unused,
-                                                             responderFabricId, responderNodeId, responderPublicKey));
-        VerifyOrExit(fabricId == responderFabricId, err = CHIP_ERROR_INVALID_CASE_PARAMETER);
-        // Verify that responderNodeId (from responderNOC) matches one that was included
-        // in the computation of the Destination Identifier when generating Sigma1.
-        VerifyOrExit(mPeerNodeId == responderNodeId, err = CHIP_ERROR_INVALID_CASE_PARAMETER);
-    }
+        SuccessOrExit(err = decryptedDataTlvReader.Next());
+        if (TLV::TagNumFromTag(decryptedDataTlvReader.GetTag()) == kTag_TBEData_SenderICAC)
+        {
+            VerifyOrExit(decryptedDataTlvReader.GetType() == TLV::kTLVType_ByteString, err = CHIP_ERROR_WRONG_TLV_TYPE);
+            SuccessOrExit(err = decryptedDataTlvReader.Get(data.peerICAC));
+            SuccessOrExit(err = decryptedDataTlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_TBEData_Signature)));
+        }
 
-    // Construct msg_R2_Signed and validate the signature in msg_r2_encrypted
-    msg_r2_signed_len = TLV::EstimateStructOverhead(sizeof(uint16_t), responderNOC.size(), responderICAC.size(),
-                                                    kP256_PublicKey_Length, kP256_PublicKey_Length);
+        // Construct msg_R2_Signed, whose signature in msg_r2_encrypted is validated in the background
+        data.msgSignedLen = TLV::EstimateStructOverhead(sizeof(uint16_t), data.peerNOC.size(), data.peerICAC.size(),
+                                                        kP256_PublicKey_Length, kP256_PublicKey_Length);
 
-    VerifyOrExit(msg_R2_Signed.Alloc(msg_r2_signed_len), err = CHIP_ERROR_NO_MEMORY);
+        VerifyOrExit(data.msgSigned.Alloc(data.msgSignedLen), err = CHIP_ERROR_NO_MEMORY);
 
-    SuccessOrExit(err = ConstructTBSData(responderNOC, responderICAC, ByteSpan(mRemotePubKey, mRemotePubKey.Length()),
-                                         ByteSpan(mEphemeralKey->Pubkey(), mEphemeralKey->Pubkey().Length()), msg_R2_Signed.Get(),
-                                         msg_r2_signed_len));
+        SuccessOrExit(err = ConstructTBSData(data.peerNOC, data.peerICAC, ByteSpan(mRemotePubKey, mRemotePubKey.Length()),
+                                             ByteSpan(mEphemeralKey->Pubkey(), mEphemeralKey->Pubkey().Length()),
+                                             data.msgSigned.Get(), data.msgSignedLen));
 
-    VerifyOrExit(TLV::TagNumFromTag(decryptedDataTlvReader.GetTag()) == kTag_TBEData_Signature, err = CHIP_ERROR_INVALID_TLV_TAG);
-    VerifyOrExit(tbsData2Signature.Capacity() >= decryptedDataTlvReader.GetLength(), err = CHIP_ERROR_INVALID_TLV_ELEMENT);
-    tbsData2Signature.SetLength(decryptedDataTlvReader.GetLength());
-    SuccessOrExit(err = decryptedDataTlvReader.GetBytes(tbsData2Signature.Bytes(), tbsData2Signature.Length()));
+        VerifyOrExit(TLV::TagNumFromTag(decryptedDataTlvReader.GetTag()) == kTag_TBEData_Signature,
+                     err = CHIP_ERROR_INVALID_TLV_TAG);
+        VerifyOrExit(data.signature.Capacity() >= decryptedDataTlvReader.GetLength(), err = CHIP_ERROR_INVALID_TLV_ELEMENT);
+        data.signature.SetLength(decryptedDataTlvReader.GetLength());
+        SuccessOrExit(err = decryptedDataTlvReader.GetBytes(data.signature.Bytes(), data.signature.Length()));
 
-    // Validate signature
-    SuccessOrExit(err = responderPublicKey.ECDSA_validate_msg_signature(msg_R2_Signed.Get(), msg_r2_signed_len, tbsData2Signature));
+        // Retrieve session resumption ID
+        SuccessOrExit(err = decryptedDataTlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_TBEData_ResumptionID)));
+        SuccessOrExit(err = decryptedDataTlvReader.GetBytes(mNewResumptionId.data(), mNewResumptionId.size()));
 
-    // Retrieve session resumption ID
-    SuccessOrExit(err = decryptedDataTlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_TBEData_ResumptionID)));
-    SuccessOrExit(err = decryptedDataTlvReader.GetBytes(mNewResumptionId.data(), mNewResumptionId.size()));
+        // Retrieve responderMRPParams if present
+        if (tlvReader.Next() != CHIP_END_OF_TLV)
+        {
+            SuccessOrExit(err = DecodeMRPParametersIfPresent(TLV::ContextTag(kTag_Sigma2_ResponderMRPParams), tlvReader));
+            mExchangeCtxt->GetSessionHandle()->AsUnauthenticatedSession()->SetRemoteMRPConfig(mRemoteMRPConfig);
+        }
 
-    // Retrieve peer CASE Authenticated Tags (CATs) from peer's NOC.
-    SuccessOrExit(err = ExtractCATsFromOpCert(responderNOC, mPeerCATs));
+        SuccessOrExit(err = PrepareToVerifyPeerCredentials(data));
 
-    // Retrieve responderMRPParams if present
-    if (tlvReader.Next() != CHIP_END_OF_TLV)
-    {
-        SuccessOrExit(err = DecodeMRPParametersIfPresent(TLV::ContextTag(kTag_Sigma2_ResponderMRPParams), tlvReader));
-        mExchangeCtxt->GetSessionHandle()->AsUnauthenticatedSession()->SetRemoteMRPConfig(mRemoteMRPConfig);
+        // ScheduleCryptoWork takes ownership of the work, even on failure.
+        auto * work = workPtr;
+        workPtr     = nullptr;
+        SuccessOrExit(err = ScheduleCryptoWork(work));
+        mExchangeCtxt->WillSendMessage();
+        mState = State::kBackgroundPending;
     }
 
 exit:
+    Platform::Delete(workPtr);
+
     if (err != CHIP_NO_ERROR)
     {
         SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
@@ -1099,6 +1229,112 @@ exit:
     return err;
 }
 
+void CASESession::HandleSigma2c(PeerCredentialsData & data, CHIP_ERROR status)
+{
+    CHIP_ERROR err = status;
+    SuccessOrExit(err);
+
+    RememberVerifiedPeerCredentials(data);
+
+    // Verify that responderNodeId (from responderNOC) matches one that was included
+    // in the computation of the Destination Identifier when generating Sigma1.
+    VerifyOrExit(mPeerNodeId == data.peerNodeId, err = CHIP_ERROR_INVALID_CASE_PARAMETER);
+
+    // Retrieve peer CASE Authenticated Tags (CATs) from peer's NOC.
+    SuccessOrExit(err = ExtractCATsFromOpCert(data.peerNOC, mPeerCATs));
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
+    }
+    else
+    {
+        // SendSigma3 sends its own status report on failure.
+        err = SendSigma3();
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        // Abort the pending establish, which is normally done by CASESession::OnMessageReceived,
+        // but in the background processing case must be done here.
+        DiscardExchange();
+        AbortPendingEstablish(err);
+    }
+}
+
+CHIP_ERROR CASESession::PrepareToVerifyPeerCredentials(PeerCredentialsData & data)
+{
+    // peerNOC and peerICAC are spans into the decrypted message, which is going
+    // away, so to save memory, redirect them to their copies in msgSigned,
+    // which is staying around
+    {
+        TLV::TLVType containerType = TLV::kTLVType_Structure;
+        TLV::TLVReader signedDataTlvReader;
+        signedDataTlvReader.Init(data.msgSigned.Get(), data.msgSignedLen);
+        ReturnErrorOnFailure(signedDataTlvReader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag()));
+        ReturnErrorOnFailure(signedDataTlvReader.EnterContainer(containerType));
+
+        ReturnErrorOnFailure(signedDataTlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_TBSData_SenderNOC)));
+        ReturnErrorOnFailure(signedDataTlvReader.Get(data.peerNOC));
+
+        if (!data.peerICAC.empty())
+        {
+            ReturnErrorOnFailure(signedDataTlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_TBSData_SenderICAC)));
+            ReturnErrorOnFailure(signedDataTlvReader.Get(data.peerICAC));
+        }
+    }
+
+    MutableByteSpan fabricRCAC{ data.rootCertBuf };
+    ReturnErrorOnFailure(mFabricsTable->FetchRootCert(mFabricIndex, fabricRCAC));
+    data.fabricRCAC = fabricRCAC;
+
+    // TODO probably should make SetEffectiveTime static and call closer to VerifyCredentials
+    ReturnErrorOnFailure(SetEffectiveTime());
+    data.validContext = mValidContext;
+
+    // A peer that was seen recently presents the same chain, of which only the validity periods need checking.
+    VerifiedCertChainCache & cache = mFabricsTable->GetVerifiedCertChainCache();
+    ReturnErrorOnFailure(
+        VerifiedCertChainCache::ComputeKey(data.peerNOC, data.peerICAC, data.fabricRCAC, data.validContext, data.chainKey));
+    data.chainVerified        = cache.Lookup(data.chainKey);
+    data.chainCacheGeneration = cache.GetGeneration();
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CASESession::VerifyPeerCredentials(PeerCredentialsData & data)
+{
+    // Validate peer identity located in the TBE data
+    CompressedFabricId unused;
+    FabricId peerFabricId;
+    P256PublicKey peerPublicKey;
+    ReturnErrorOnFailure(FabricTable::VerifyCredentials(data.peerNOC, data.peerICAC, data.fabricRCAC, data.validContext, unused,
+                                                        peerFabricId, data.peerNodeId, peerPublicKey, nullptr, data.chainVerified));
+    VerifyOrReturnError(data.fabricId == peerFabricId, CHIP_ERROR_INVALID_CASE_PARAMETER);
+
+    // TODO - Validate message signature prior to validating the received operational credentials.
+    //        The op cert check requires traversal of cert chain, that is a more expensive operation.
+    //        If message signature check fails, the cert chain check will be unnecessary, but with the
+    //        current flow of code, a malicious node can trigger a DoS style attack on the device.
+    // Validate Signature
+#ifdef ENABLE_HSM_ECDSA_VERIFY
+    P256PublicKeyHSM peerPublicKeyHSM;
+    memcpy(Uint8::to_uchar(peerPublicKeyHSM), peerPublicKey.Bytes(), peerPublicKey.Length());
+    return peerPublicKeyHSM.ECDSA_validate_msg_signature(data.msgSigned.Get(), data.msgSignedLen, data.signature);
+#else
+    return peerPublicKey.ECDSA_validate_msg_signature(data.msgSigned.Get(), data.msgSignedLen, data.signature);
+#endif
+}
+
+void CASESession::RememberVerifiedPeerCredentials(const PeerCredentialsData & data)
+{
+    if (!data.chainVerified)
+    {
+        mFabricsTable->GetVerifiedCertChainCache().Add(data.chainKey, data.chainCacheGeneration);
+    }
+}
+
 CHIP_ERROR CASESession::SendSigma3()
 {
     MATTER_TRACE_EVENT_SCOPE("SendSigma3", "CASESession");
@@ -1244,35 +1480,6 @@ exit:
     return err;
 }
 
-struct CASESession::Sigma3Work
-{
-    // Status of background processing.
-    CHIP_ERROR status;
-
-    // Session to use after background processing.
-    CASESession * session;
-
-    // Sequence number used to coordinate foreground/background work for a
-    // particular session establishment.
-    int sequence;
-
-    chip::Platform::ScopedMemoryBuffer<uint8_t> msg_R3_Signed;
-    size_t msg_r3_signed_len;
-
-    ByteSpan initiatorNOC;
-    ByteSpan initiatorICAC;
-
-    uint8_t rootCertBuf[kMaxCHIPCertLength];
-    ByteSpan fabricRCAC;
-
-    P256ECDSASignature tbsData3Signature;
-
-    FabricId fabricId;
-    NodeId initiatorNodeId;
-
-    ValidationContext validContext;
-};
-
 CHIP_ERROR CASESession::HandleSigma3a(System::PacketBufferHandle && msg)
 {
     MATTER_TRACE_EVENT_SCOPE("HandleSigma3", "CASESession");
@@ -1297,23 +1504,17 @@ CHIP_ERROR CASESession::HandleSigma3a(System::PacketBufferHandle && msg)
 
     ChipLogProgress(SecureChannel, "Received Sigma3 msg");
 
-    auto * workPtr = Platform::New<Sigma3Work>();
+    auto * workPtr = Platform::New<CryptoWorkWithData<CASESession, PeerCredentialsData>>(
+        *this, &CASESession::VerifyPeerCredentials, &CASESession::HandleSigma3c);
     VerifyOrExit(workPtr != nullptr, err = CHIP_ERROR_NO_MEMORY);
     {
-        auto & work = *workPtr;
-
-        // Used to call back into the session after background event processing.
-        // It happens that there's only one pairing session (in CASEServer)
-        // so it will still be available for use. Use a sequence number to
-        // coordinate.
-        work.session  = this;
-        work.sequence = mSequence;
+        auto & data = workPtr->mData;
 
         {
             VerifyOrExit(mFabricsTable != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
             const auto * fabricInfo = mFabricsTable->FindFabricWithIndex(mFabricIndex);
             VerifyOrExit(fabricInfo != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
-            work.fabricId = fabricInfo->GetFabricId();
+            data.fabricId = fabricInfo->GetFabricId();
         }
 
         VerifyOrExit(mEphemeralKey != nullptr, err = CHIP_ERROR_INTERNAL);
@@ -1324,7 +1525,7 @@ CHIP_ERROR CASESession::HandleSigma3a(System::PacketBufferHandle && msg)
 
         // Fetch encrypted data
         max_msg_r3_signed_enc_len = TLV::EstimateStructOverhead(Credentials::kMaxCHIPCertLength, Credentials::kMaxCHIPCertLength,
-                                                                work.tbsData3Signature.Length(), kCaseOverheadForFutureTbeData);
+                                                                data.signature.Length(), kCaseOverheadForFutureTbeData);
 
         SuccessOrExit(err = tlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_Sigma3_Encrypted3)));
 
@@ -1358,67 +1559,39 @@ CHIP_ERROR CASESession::HandleSigma3a(System::PacketBufferHandle && msg)
         SuccessOrExit(err = decryptedDataTlvReader.EnterContainer(containerType));
 
         SuccessOrExit(err = decryptedDataTlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_TBEData_SenderNOC)));
-        SuccessOrExit(err = decryptedDataTlvReader.Get(work.initiatorNOC));
+        SuccessOrExit(err = decryptedDataTlvReader.Get(data.peerNOC));
 
         SuccessOrExit(err = decryptedDataTlvReader.Next());
         if (TLV::TagNumFromTag(decryptedDataTlvReader.GetTag()) == kTag_TBEData_SenderICAC)
         {
             VerifyOrExit(decryptedDataTlvReader.GetType() == TLV::kTLVType_ByteString, err = CHIP_ERROR_WRONG_TLV_TYPE);
-            SuccessOrExit(err = decryptedDataTlvReader.Get(work.initiatorICAC));
+            SuccessOrExit(err = decryptedDataTlvReader.Get(data.peerICAC));
             SuccessOrExit(err = decryptedDataTlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_TBEData_Signature)));
         }
 
         // Step 4 - Construct Sigma3 TBS Data
-        work.msg_r3_signed_len = TLV::EstimateStructOverhead(sizeof(uint16_t), work.initiatorNOC.size(), work.initiatorICAC.size(),
-                                                             kP256_PublicKey_Length, kP256_PublicKey_Length);
+        data.msgSignedLen = TLV::EstimateStructOverhead(sizeof(uint16_t), data.peerNOC.size(), data.peerICAC.size(),
+                                                        kP256_PublicKey_Length, kP256_PublicKey_Length);
 
-        VerifyOrExit(work.msg_R3_Signed.Alloc(work.msg_r3_signed_len), err = CHIP_ERROR_NO_MEMORY);
+        VerifyOrExit(data.msgSigned.Alloc(data.msgSignedLen), err = CHIP_ERROR_NO_MEMORY);
 
-        SuccessOrExit(err = ConstructTBSData(work.initiatorNOC, work.initiatorICAC, ByteSpan(mRemotePubKey, mRemotePubKey.Length()),
+        SuccessOrExit(err = ConstructTBSData(data.peerNOC, data.peerICAC, ByteSpan(mRemotePubKey, mRemotePubKey.Length()),
                                              ByteSpan(mEphemeralKey->Pubkey(), mEphemeralKey->Pubkey().Length()),
-                                             work.msg_R3_Signed.Get(), work.msg_r3_signed_len));
+                                             data.msgSigned.Get(), data.msgSignedLen));
 
         VerifyOrExit(TLV::TagNumFromTag(decryptedDataTlvReader.GetTag()) == kTag_TBEData_Signature,
                      err = CHIP_ERROR_INVALID_TLV_TAG);
-        VerifyOrExit(work.tbsData3Signature.Capacity() >= decryptedDataTlvReader.GetLength(), err = CHIP_ERROR_INVALID_TLV_ELEMENT);
-        work.tbsData3Signature.SetLength(decryptedDataTlvReader.GetLength());
-        SuccessOrExit(err = decryptedDataTlvReader.GetBytes(work.tbsData3Signature.Bytes(), work.tbsData3Signature.Length()));
+        VerifyOrExit(data.signature.Capacity() >= decryptedDataTlvReader.GetLength(), err = CHIP_ERROR_INVALID_TLV_ELEMENT);
+        data.signature.SetLength(decryptedDataTlvReader.GetLength());
+        SuccessOrExit(err = decryptedDataTlvReader.GetBytes(data.signature.Bytes(), data.signature.Length()));
 
         // Prepare for Step 5/6
-        {
-            MutableByteSpan fabricRCAC{ work.rootCertBuf };
-            SuccessOrExit(err = mFabricsTable->FetchRootCert(mFabricIndex, fabricRCAC));
-            work.fabricRCAC = fabricRCAC;
-            // TODO probably should make SetEffectiveTime static and call closer to VerifyCredentials
-            SuccessOrExit(err = SetEffectiveTime());
-        }
-
-        // Copy remaining needed data into work structure
-        {
-            work.validContext = mValidContext;
-
-            // initiatorNOC and initiatorICAC are spans into msg_R3_Encrypted
-            // which is going away, so to save memory, redirect them to their
-            // copies in msg_R3_signed, which is staying around
-            TLV::TLVReader signedDataTlvReader;
-            signedDataTlvReader.Init(work.msg_R3_Signed.Get(), work.msg_r3_signed_len);
-            SuccessOrExit(err = signedDataTlvReader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag()));
-            SuccessOrExit(err = signedDataTlvReader.EnterContainer(containerType));
-
-            SuccessOrExit(err = signedDataTlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_TBSData_SenderNOC)));
-            SuccessOrExit(err = signedDataTlvReader.Get(work.initiatorNOC));
-
-            if (!work.initiatorICAC.empty())
-            {
-                SuccessOrExit(err = signedDataTlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_TBSData_SenderICAC)));
-                SuccessOrExit(err = signedDataTlvReader.Get(work.initiatorICAC));
-            }
-        }
+        SuccessOrExit(err = PrepareToVerifyPeerCredentials(data));
 
-        SuccessOrExit(
-            err = DeviceLayer::PlatformMgr().ScheduleBackgroundWork(
-                [](intptr_t arg) { HandleSigma3b(*reinterpret_cast<Sigma3Work *>(arg)); }, reinterpret_cast<intptr_t>(&work)));
-        workPtr = nullptr; // scheduling succeeded, so don't delete
+        // ScheduleCryptoWork takes ownership of the work, even on failure.
+        auto * work = workPtr;
+        workPtr     = nullptr;
+        SuccessOrExit(err = ScheduleCryptoWork(work));
         mExchangeCtxt->WillSendMessage();
         mState = State::kBackgroundPending;
     }
@@ -1434,70 +1607,14 @@ exit:
     return err;
 }
 
-void CASESession::HandleSigma3b(Sigma3Work & work)
-{
-    CHIP_ERROR err = CHIP_NO_ERROR;
-
-    // Step 5/6
-    // Validate initiator identity located in msg->Start()
-    // Constructing responder identity
-    CompressedFabricId unused;
-    FabricId initiatorFabricId;
-    P256PublicKey initiatorPublicKey;
-    SuccessOrExit(err = FabricTable::VerifyCredentials(work.initiatorNOC, work.initiatorICAC, work.fabricRCAC, work.validContext,
-                                                       unused, initiatorFabricId, work.initiatorNodeId, initiatorPublicKey));
-    VerifyOrExit(work.fabricId == initiatorFabricId, err = CHIP_ERROR_INVALID_CASE_PARAMETER);
-
-    // TODO - Validate message signature prior to validating the received operational credentials.
-    //        The op cert check requires traversal of cert chain, that is a more expensive operation.
-    //        If message signature check fails, the cert chain check will be unnecessary, but with the
-    //        current flow of code, a malicious node can trigger a DoS style attack on the device.
-    //        The same change should be made in Sigma2 processing.
-    // Step 7 - Validate Signature
-#ifdef ENABLE_HSM_ECDSA_VERIFY
-    {
-        P256PublicKeyHSM initiatorPublicKeyHSM;
-        memcpy(Uint8::to_uchar(initiatorPublicKeyHSM), initiatorPublicKey.Bytes(), initiatorPublicKey.Length());
-        SuccessOrExit(err = initiatorPublicKeyHSM.ECDSA_validate_msg_signature(work.msg_R3_Signed.Get(), work.msg_r3_signed_len,
-                                                                               work.tbsData3Signature));
-    }
-#else
-    SuccessOrExit(err = initiatorPublicKey.ECDSA_validate_msg_signature(work.msg_R3_Signed.Get(), work.msg_r3_signed_len,
-                                                                        work.tbsData3Signature));
-#endif
-
-exit:
-    work.status = err;
-
-    auto err2 = DeviceLayer::PlatformMgr().ScheduleWork(
-        [](intptr_t arg) {
-            auto & work2 = *reinterpret_cast<Sigma3Work *>(arg);
-            work2.session->HandleSigma3c(work2);
-        },
-        reinterpret_cast<intptr_t>(&work));
-
-    if (err2 != CHIP_NO_ERROR)
-    {
-        Platform::Delete(&work); // scheduling failed, so delete
-    }
-}
-
-CHIP_ERROR CASESession::HandleSigma3c(Sigma3Work & work)
+void CASESession::HandleSigma3c(PeerCredentialsData & data, CHIP_ERROR status)
 {
-    CHIP_ERROR err     = CHIP_NO_ERROR;
-    bool ignoreFailure = true;
-
-    // Special case: if for whatever reason not in expected state or sequence,
-    // don't do anything, including sending a status report or aborting the
-    // pending establish.
-    VerifyOrExit(mState == State::kBackgroundPending, err = CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrExit(mSequence == work.sequence, err = CHIP_ERROR_INCORRECT_STATE);
-
-    ignoreFailure = false;
+    CHIP_ERROR err = status;
+    SuccessOrExit(err);
 
-    SuccessOrExit(err = work.status);
+    RememberVerifiedPeerCredentials(data);
 
-    mPeerNodeId = work.initiatorNodeId;
+    mPeerNodeId = data.peerNodeId;
 
     {
         MutableByteSpan messageDigestSpan(mMessageDigest);
@@ -1506,7 +1623,7 @@ CHIP_ERROR CASESession::HandleSigma3c(Sigma3Work & work)
 
     // Retrieve peer CASE Authenticated Tags (CATs) from peer's NOC.
     {
-        SuccessOrExit(err = ExtractCATsFromOpCert(work.initiatorNOC, mPeerCATs));
+        SuccessOrExit(err = ExtractCATsFromOpCert(data.peerNOC, mPeerCATs));
     }
 
     if (mSessionResumptionStorage != nullptr)
@@ -1524,9 +1641,7 @@ CHIP_ERROR CASESession::HandleSigma3c(Sigma3Work & work)
     Finish();
 
 exit:
-    Platform::Delete(&work);
-
-    if (err != CHIP_NO_ERROR && !ignoreFailure)
+    if (err != CHIP_NO_ERROR)
     {
         SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
         // Abort the pending establish, which is normally done by CASESession::OnMessageReceived,
@@ -1534,8 +1649,6 @@ exit:
         DiscardExchange();
         AbortPendingEstablish(err);
     }
-
-    return err;
 }
 
 CHIP_ERROR CASESession::DeriveSigmaKey(const ByteSpan & salt, const ByteSpan & info, AutoReleaseSessionKey & key) const
@@ -1896,7 +2009,7 @@ CHIP_ERROR CASESession::OnMessageReceived(ExchangeContext * ec, const PayloadHea
         switch (static_cast<Protocols::SecureChannel::MsgType>(payloadHeader.GetMessageType()))
         {
         case Protocols::SecureChannel::MsgType::CASE_Sigma2:
-            err = HandleSigma2_and_SendSigma3(std::move(msg));
+            err = HandleSigma2a(std::move(msg));
             break;
 
         case MsgType::StatusReport:
@@ -1912,7 +2025,7 @@ CHIP_ERROR CASESession::OnMessageReceived(ExchangeContext * ec, const PayloadHea
         switch (static_cast<Protocols::SecureChannel::MsgType>(payloadHeader.GetMessageType()))
         {
         case Protocols::SecureChannel::MsgType::CASE_Sigma2:
-            err = HandleSigma2_and_SendSigma3(std::move(msg));
+            err = HandleSigma2a(std::move(msg));
             break;
 
         case Protocols::SecureChannel::MsgType::CASE_Sigma2Resume:
@@ -138,6 +138,18 @@ public:
                            ByteSpan & destinationId, ByteSpan & initiatorEphPubKey, bool & resumptionRequested,
                            ByteSpan & resumptionId, ByteSpan & initiatorResumeMIC);
 
+    /**
+     * Find the local fabric that a Sigma1 message targets, from its resumption ID or destination
+     * identifier, without otherwise processing the message. This lets a responder schedule
+     * handshakes per fabric before committing resources to them.
+     *
+     * @return the index of the fabric, or kUndefinedFabricIndex if the message is malformed or
+     *         matches no fabric.
+     */
+    static FabricIndex FindFabricForSigma1(const System::PacketBufferHandle & msg, const FabricTable & fabricTable,
+                                           Credentials::GroupDataProvider & groupDataProvider,
+                                           SessionResumptionStorage * sessionResumptionStorage);
+
     /**
      * @brief
      *   Derive a secure session from the established session. The API will return error if called before session is established.
@@ -222,22 +234,37 @@ private:
     // On success, sets locally maching mFabricInfo in internal state to the entry matched by
     // destinationId/initiatorRandom from processing of Sigma1, and sets mIpk to the right IPK.
     CHIP_ERROR FindLocalNodeFromDestinationId(const ByteSpan & destinationId, const ByteSpan & initiatorRandom);
+    // Find the fabric, local node and IPK of fabricTable matched by destinationId/initiatorRandom.
+    static CHIP_ERROR MatchDestinationId(const FabricTable & fabricTable, Credentials::GroupDataProvider & groupDataProvider,
+                                         const ByteSpan & destinationId, const ByteSpan & initiatorRandom,
+                                         FabricIndex & fabricIndex, NodeId & nodeId, MutableByteSpan & ipk);
 
     CHIP_ERROR SendSigma1();
     CHIP_ERROR HandleSigma1_and_SendSigma2(System::PacketBufferHandle && msg);
     CHIP_ERROR HandleSigma1(System::PacketBufferHandle && msg);
     CHIP_ERROR TryResumeSession(SessionResumptionStorage::ConstResumptionIdView resumptionId, ByteSpan resume1MIC,
                                 ByteSpan initiatorRandom);
+
+    // The public-key crypto of the handshake steps below runs in the background, see PairingSession::ScheduleCryptoWork().
+    // Step "a" prepares it on the Matter thread, step "b" runs it, and step "c" handles its result on the Matter thread.
+    struct SendSigma2Data;
+    CHIP_ERROR SendSigma2a();
+    static CHIP_ERROR SendSigma2b(SendSigma2Data & data);
+    void SendSigma2c(SendSigma2Data & data, CHIP_ERROR status);
     CHIP_ERROR SendSigma2();
-    CHIP_ERROR HandleSigma2_and_SendSigma3(System::PacketBufferHandle && msg);
-    CHIP_ERROR HandleSigma2(System::PacketBufferHandle && msg);
+
+    struct PeerCredentialsData;
+    CHIP_ERROR PrepareToVerifyPeerCredentials(PeerCredentialsData & data);
+    static CHIP_ERROR VerifyPeerCredentials(PeerCredentialsData & data);
+    void RememberVerifiedPeerCredentials(const PeerCredentialsData & data);
+
+    CHIP_ERROR HandleSigma2a(System::PacketBufferHandle && msg);
+    void HandleSigma2c(PeerCredentialsData & data, CHIP_ERROR status);
     CHIP_ERROR HandleSigma2Resume(System::PacketBufferHandle && msg);
 
     CHIP_ERROR SendSigma3();
-    struct Sigma3Work;
     CHIP_ERROR HandleSigma3a(System::PacketBufferHandle && msg);
-    static void HandleSigma3b(Sigma3Work & work);
-    CHIP_ERROR HandleSigma3c(Sigma3Work & work);
+    void HandleSigma3c(PeerCredentialsData & data, CHIP_ERROR status);
 
     CHIP_ERROR SendSigma2Resume();
 
@@ -297,10 +324,6 @@ private:
     // Sigma1 initiator random, maintained to be reused post-Sigma1, such as when generating Sigma2 S2RK key
     uint8_t mInitiatorRandom[kSigmaParamRandomNumberSize];
 
-    // Sequence number used to coordinate foreground/background work for a
-    // particular session establishment.
-    int mSequence = 0;
-
     State mState;
 
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
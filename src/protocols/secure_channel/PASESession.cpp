@@ -94,7 +94,7 @@ void PASESession::Clear()
     memset(&mKe[0], 0, sizeof(mKe));
     mNextExpectedMsg.ClearValue();
 
-    mSpake2p.Clear();
+    mSpake2p.reset();
     mCommissioningHash.Clear();
 
     mIterationCount = 0;
@@ -154,11 +154,72 @@ CHIP_ERROR PASESession::SetupSpake2p()
     MutableByteSpan contextSpan{ context };
 
     ReturnErrorOnFailure(mCommissioningHash.Finish(contextSpan));
-    ReturnErrorOnFailure(mSpake2p.Init(contextSpan.data(), contextSpan.size()));
+
+    mSpake2p = Platform::MakeUnique<Spake2pImpl>();
+    VerifyOrReturnError(mSpake2p, CHIP_ERROR_NO_MEMORY);
+    ReturnErrorOnFailure(mSpake2p->Init(contextSpan.data(), contextSpan.size()));
+
+    return CHIP_NO_ERROR;
+}
+
+struct PASESession::Spake2pData
+{
+    ~Spake2pData()
+    {
+        setupPINCode = 0;
+        Crypto::ClearSecretData(reinterpret_cast<uint8_t *>(&paseVerifier), sizeof(paseVerifier));
+        Crypto::ClearSecretData(ke);
+    }
+
+    Platform::UniquePtr<Spake2pImpl> spake2p;
+
+    // Prover inputs
+    uint32_t iterationCount = 0;
+    uint8_t salt[kSpake2p_Max_PBKDF_Salt_Length];
+    size_t saltLength     = 0;
+    uint32_t setupPINCode = 0;
+
+    // Verifier input
+    Spake2pVerifier paseVerifier;
+
+    // Received from the peer
+    uint8_t peerPoint[kMAX_Point_Length];
+    size_t peerPointLength = 0;
+    uint8_t peerVerifier[kMAX_Hash_Length];
+    size_t peerVerifierLength = 0;
+
+    // Computed for the next message
+    uint8_t point[kMAX_Point_Length];
+    size_t pointLength = sizeof(point);
+    uint8_t verifier[kMAX_Hash_Length];
+    size_t verifierLength = sizeof(verifier);
+    uint8_t ke[kMAX_Hash_Length];
+    size_t keLength = sizeof(ke);
+};
+
+CHIP_ERROR PASESession::ScheduleSpake2pWork(Spake2pWork * work)
+{
+    work->mData.spake2p = std::move(mSpake2p);
+    ReturnErrorOnFailure(ScheduleCryptoWork(work));
+
+    // Only a status report from the peer can be handled until the work completes.
+    mNextExpectedMsg.ClearValue();
+    mExchangeCtxt->WillSendMessage();
 
     return CHIP_NO_ERROR;
 }
 
+void PASESession::AbortPendingPairing(CHIP_ERROR err)
+{
+    // Discard the exchange so that Clear() doesn't try closing it.  The
+    // exchange will handle that.
+    DiscardExchange();
+    Clear();
+    ChipLogError(SecureChannel, "Failed during PASE session setup: %" CHIP_ERROR_FORMAT, err.Format());
+    // Do this last in case the delegate frees us.
+    NotifySessionEstablishmentError(err);
+}
+
 CHIP_ERROR PASESession::WaitForPairing(SessionManager & sessionManager, const Spake2pVerifier & verifier, uint32_t pbkdf2IterCount,
                                        const ByteSpan & salt, Optional<ReliableMessageProtocolConfig> mrpLocalConfig,
                                        SessionEstablishmentDelegate * delegate)
@@ -448,7 +509,7 @@ CHIP_ERROR PASESession::HandlePBKDFParamResponse(System::PacketBufferHandle && m
 
     uint32_t decodeTagIdSeq = 0;
     ByteSpan salt;
-    uint8_t serializedWS[kSpake2p_WS_Length * 2] = { 0 };
+    Spake2pWork * work = nullptr;
 
     ChipLogDetail(SecureChannel, "Received PBKDF param response");
 
@@ -513,17 +574,22 @@ CHIP_ERROR PASESession::HandlePBKDFParamResponse(System::PacketBufferHandle && m
     err = SetupSpake2p();
     SuccessOrExit(err);
 
-    err = Spake2pVerifier::ComputeWS(mIterationCount, salt, mSetupPINCode, serializedWS, sizeof(serializedWS));
-    SuccessOrExit(err);
-
-    err = mSpake2p.BeginProver(nullptr, 0, nullptr, 0, &serializedWS[0], kSpake2p_WS_Length, &serializedWS[kSpake2p_WS_Length],
-                               kSpake2p_WS_Length);
-    SuccessOrExit(err);
-
-    err = SendMsg1();
+    work = Platform::New<Spake2pWork>(*this, &PASESession::ComputeMsg1, &PASESession::SendMsg1);
+    VerifyOrExit(work != nullptr, err = CHIP_ERROR_NO_MEMORY);
+    VerifyOrExit(salt.size() <= sizeof(work->mData.salt), err = CHIP_ERROR_INVALID_PASE_PARAMETER);
+    memcpy(work->mData.salt, salt.data(), salt.size());
+    work->mData.saltLength     = salt.size();
+    work->mData.iterationCount = mIterationCount;
+    work->mData.setupPINCode   = mSetupPINCode;
+
+    // ScheduleSpake2pWork takes ownership of the work, even on failure.
+    err  = ScheduleSpake2pWork(work);
+    work = nullptr;
     SuccessOrExit(err);
 
 exit:
+    Platform::Delete(work);
+
     if (err != CHIP_NO_ERROR)
     {
         SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
@@ -531,57 +597,72 @@ exit:
     return err;
 }
 
-CHIP_ERROR PASESession::SendMsg1()
+CHIP_ERROR PASESession::ComputeMsg1(Spake2pData & data)
+{
+    uint8_t serializedWS[kSpake2p_WS_Length * 2] = { 0 };
+
+    ReturnErrorOnFailure(Spake2pVerifier::ComputeWS(data.iterationCount, ByteSpan(data.salt, data.saltLength), data.setupPINCode,
+                                                    serializedWS, sizeof(serializedWS)));
+
+    ReturnErrorOnFailure(data.spake2p->BeginProver(nullptr, 0, nullptr, 0, &serializedWS[0], kSpake2p_WS_Length,
+                                                   &serializedWS[kSpake2p_WS_Length], kSpake2p_WS_Length));
+
+    ReturnErrorOnFailure(data.spake2p->ComputeRoundOne(nullptr, 0, data.point, &data.pointLength));
+    VerifyOrReturnError(data.pointLength == sizeof(data.point), CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
+void PASESession::SendMsg1(Spake2pData & data, CHIP_ERROR status)
 {
     MATTER_TRACE_EVENT_SCOPE("SendMsg1", "PASESession");
-    const size_t max_msg_len       = TLV::EstimateStructOverhead(kMAX_Point_Length);
-    System::PacketBufferHandle msg = System::PacketBufferHandle::New(max_msg_len);
-    VerifyOrReturnError(!msg.IsNull(), CHIP_ERROR_NO_MEMORY);
+    CHIP_ERROR err = status;
 
     System::PacketBufferTLVWriter tlvWriter;
-    tlvWriter.Init(std::move(msg));
-
     TLV::TLVType outerContainerType = TLV::kTLVType_NotSpecified;
-    ReturnErrorOnFailure(tlvWriter.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outerContainerType));
-
-    uint8_t X[kMAX_Point_Length];
-    size_t X_len = sizeof(X);
 
     constexpr uint8_t kPake1_pA = 1;
 
-    ReturnErrorOnFailure(mSpake2p.ComputeRoundOne(nullptr, 0, X, &X_len));
-    VerifyOrReturnError(X_len == sizeof(X), CHIP_ERROR_INTERNAL);
-    ReturnErrorOnFailure(tlvWriter.Put(TLV::ContextTag(kPake1_pA), ByteSpan(X)));
-    ReturnErrorOnFailure(tlvWriter.EndContainer(outerContainerType));
-    ReturnErrorOnFailure(tlvWriter.Finalize(&msg));
+    const size_t max_msg_len       = TLV::EstimateStructOverhead(kMAX_Point_Length);
+    System::PacketBufferHandle msg = System::PacketBufferHandle::New(max_msg_len);
 
-    ReturnErrorOnFailure(
-        mExchangeCtxt->SendMessage(MsgType::PASE_Pake1, std::move(msg), SendFlags(SendMessageFlags::kExpectResponse)));
+    mSpake2p = std::move(data.spake2p);
+    SuccessOrExit(err);
+
+    VerifyOrExit(!msg.IsNull(), err = CHIP_ERROR_NO_MEMORY);
+    tlvWriter.Init(std::move(msg));
+
+    SuccessOrExit(err = tlvWriter.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outerContainerType));
+    SuccessOrExit(err = tlvWriter.Put(TLV::ContextTag(kPake1_pA), ByteSpan(data.point, data.pointLength)));
+    SuccessOrExit(err = tlvWriter.EndContainer(outerContainerType));
+    SuccessOrExit(err = tlvWriter.Finalize(&msg));
+
+    SuccessOrExit(
+        err = mExchangeCtxt->SendMessage(MsgType::PASE_Pake1, std::move(msg), SendFlags(SendMessageFlags::kExpectResponse)));
     ChipLogDetail(SecureChannel, "Sent spake2p msg1");
 
     mNextExpectedMsg.SetValue(MsgType::PASE_Pake2);
 
-    return CHIP_NO_ERROR;
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
+        AbortPendingPairing(err);
+    }
 }
 
-CHIP_ERROR PASESession::HandleMsg1_and_SendMsg2(System::PacketBufferHandle && msg1)
+CHIP_ERROR PASESession::HandleMsg1(System::PacketBufferHandle && msg1)
 {
-    MATTER_TRACE_EVENT_SCOPE("HandleMsg1_and_SendMsg2", "PASESession");
+    MATTER_TRACE_EVENT_SCOPE("HandleMsg1", "PASESession");
     CHIP_ERROR err = CHIP_NO_ERROR;
 
-    uint8_t Y[kMAX_Point_Length];
-    size_t Y_len = sizeof(Y);
-
-    uint8_t verifier[kMAX_Hash_Length];
-    size_t verifier_len = kMAX_Hash_Length;
-
     ChipLogDetail(SecureChannel, "Received spake2p msg1");
 
     System::PacketBufferTLVReader tlvReader;
     TLV::TLVType containerType = TLV::kTLVType_Structure;
 
-    const uint8_t * X;
-    size_t X_len = 0;
+    auto * work = Platform::New<Spake2pWork>(*this, &PASESession::ComputeMsg2, &PASESession::SendMsg2);
+    VerifyOrExit(work != nullptr, err = CHIP_ERROR_NO_MEMORY);
 
     tlvReader.Init(std::move(msg1));
     SuccessOrExit(err = tlvReader.Next(containerType, TLV::AnonymousTag()));
@@ -589,125 +670,176 @@ CHIP_ERROR PASESession::HandleMsg1_and_SendMsg2(System::PacketBufferHandle && ms
 
     SuccessOrExit(err = tlvReader.Next());
     VerifyOrExit(TLV::TagNumFromTag(tlvReader.GetTag()) == 1, err = CHIP_ERROR_INVALID_TLV_TAG);
-    X_len = tlvReader.GetLength();
-    SuccessOrExit(err = tlvReader.GetDataPtr(X));
-    SuccessOrExit(err = mSpake2p.BeginVerifier(nullptr, 0, nullptr, 0, mPASEVerifier.mW0, kP256_FE_Length, mPASEVerifier.mL,
-                                               kP256_Point_Length));
+    VerifyOrExit(tlvReader.GetLength() <= sizeof(work->mData.peerPoint), err = CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+    work->mData.peerPointLength = tlvReader.GetLength();
+    SuccessOrExit(err = tlvReader.GetBytes(work->mData.peerPoint, sizeof(work->mData.peerPoint)));
 
-    SuccessOrExit(err = mSpake2p.ComputeRoundOne(X, X_len, Y, &Y_len));
-    VerifyOrReturnError(Y_len == sizeof(Y), CHIP_ERROR_INTERNAL);
-    SuccessOrExit(err = mSpake2p.ComputeRoundTwo(X, X_len, verifier, &verifier_len));
-    msg1 = nullptr;
+    work->mData.paseVerifier = mPASEVerifier;
 
     {
-        const size_t max_msg_len    = TLV::EstimateStructOverhead(Y_len, verifier_len);
-        constexpr uint8_t kPake2_pB = 1;
-        constexpr uint8_t kPake2_cB = 2;
+        // ScheduleSpake2pWork takes ownership of the work, even on failure.
+        auto * scheduled = work;
+        work             = nullptr;
+        SuccessOrExit(err = ScheduleSpake2pWork(scheduled));
+    }
+
+exit:
+    Platform::Delete(work);
 
-        System::PacketBufferHandle msg2 = System::PacketBufferHandle::New(max_msg_len);
-        VerifyOrExit(!msg2.IsNull(), err = CHIP_ERROR_NO_MEMORY);
+    if (err != CHIP_NO_ERROR)
+    {
+        SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
+    }
+    return err;
+}
 
-        System::PacketBufferTLVWriter tlvWriter;
-        tlvWriter.Init(std::move(msg2));
+CHIP_ERROR PASESession::ComputeMsg2(Spake2pData & data)
+{
+    ReturnErrorOnFailure(data.spake2p->BeginVerifier(nullptr, 0, nullptr, 0, data.paseVerifier.mW0, kP256_FE_Length,
+                                                     data.paseVerifier.mL, kP256_Point_Length));
 
-        TLV::TLVType outerContainerType = TLV::kTLVType_NotSpecified;
-        SuccessOrExit(err = tlvWriter.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outerContainerType));
-        SuccessOrExit(err = tlvWriter.Put(TLV::ContextTag(kPake2_pB), ByteSpan(Y)));
-        SuccessOrExit(err = tlvWriter.Put(TLV::ContextTag(kPake2_cB), ByteSpan(verifier, verifier_len)));
-        SuccessOrExit(err = tlvWriter.EndContainer(outerContainerType));
-        SuccessOrExit(err = tlvWriter.Finalize(&msg2));
+    ReturnErrorOnFailure(data.spake2p->ComputeRoundOne(data.peerPoint, data.peerPointLength, data.point, &data.pointLength));
+    VerifyOrReturnError(data.pointLength == sizeof(data.point), CHIP_ERROR_INTERNAL);
+    return data.spake2p->ComputeRoundTwo(data.peerPoint, data.peerPointLength, data.verifier, &data.verifierLength);
+}
 
-        err = mExchangeCtxt->SendMessage(MsgType::PASE_Pake2, std::move(msg2), SendFlags(SendMessageFlags::kExpectResponse));
-        SuccessOrExit(err);
+void PASESession::SendMsg2(Spake2pData & data, CHIP_ERROR status)
+{
+    MATTER_TRACE_EVENT_SCOPE("SendMsg2", "PASESession");
+    CHIP_ERROR err = status;
 
-        mNextExpectedMsg.SetValue(MsgType::PASE_Pake3);
-    }
+    System::PacketBufferTLVWriter tlvWriter;
+    TLV::TLVType outerContainerType = TLV::kTLVType_NotSpecified;
+
+    const size_t max_msg_len    = TLV::EstimateStructOverhead(data.pointLength, data.verifierLength);
+    constexpr uint8_t kPake2_pB = 1;
+    constexpr uint8_t kPake2_cB = 2;
+
+    System::PacketBufferHandle msg2 = System::PacketBufferHandle::New(max_msg_len);
+
+    mSpake2p = std::move(data.spake2p);
+    SuccessOrExit(err);
+
+    VerifyOrExit(!msg2.IsNull(), err = CHIP_ERROR_NO_MEMORY);
+    tlvWriter.Init(std::move(msg2));
+
+    SuccessOrExit(err = tlvWriter.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outerContainerType));
+    SuccessOrExit(err = tlvWriter.Put(TLV::ContextTag(kPake2_pB), ByteSpan(data.point, data.pointLength)));
+    SuccessOrExit(err = tlvWriter.Put(TLV::ContextTag(kPake2_cB), ByteSpan(data.verifier, data.verifierLength)));
+    SuccessOrExit(err = tlvWriter.EndContainer(outerContainerType));
+    SuccessOrExit(err = tlvWriter.Finalize(&msg2));
+
+    err = mExchangeCtxt->SendMessage(MsgType::PASE_Pake2, std::move(msg2), SendFlags(SendMessageFlags::kExpectResponse));
+    SuccessOrExit(err);
+
+    mNextExpectedMsg.SetValue(MsgType::PASE_Pake3);
 
     ChipLogDetail(SecureChannel, "Sent spake2p msg2");
 
 exit:
-
     if (err != CHIP_NO_ERROR)
     {
         SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
+        AbortPendingPairing(err);
     }
-    return err;
 }
 
-CHIP_ERROR PASESession::HandleMsg2_and_SendMsg3(System::PacketBufferHandle && msg2)
+CHIP_ERROR PASESession::HandleMsg2(System::PacketBufferHandle && msg2)
 {
-    MATTER_TRACE_EVENT_SCOPE("HandleMsg2_and_SendMsg3", "PASESession");
+    MATTER_TRACE_EVENT_SCOPE("HandleMsg2", "PASESession");
     CHIP_ERROR err = CHIP_NO_ERROR;
 
-    uint8_t verifier[kMAX_Hash_Length];
-    size_t verifier_len = kMAX_Hash_Length;
-
-    System::PacketBufferHandle resp;
-
     ChipLogDetail(SecureChannel, "Received spake2p msg2");
 
     System::PacketBufferTLVReader tlvReader;
     TLV::TLVType containerType = TLV::kTLVType_Structure;
 
-    const uint8_t * Y;
-    size_t Y_len = 0;
-
-    const uint8_t * peer_verifier;
-    size_t peer_verifier_len = 0;
-
     uint32_t decodeTagIdSeq = 0;
 
+    auto * work = Platform::New<Spake2pWork>(*this, &PASESession::ComputeMsg3, &PASESession::SendMsg3);
+    VerifyOrExit(work != nullptr, err = CHIP_ERROR_NO_MEMORY);
+
     tlvReader.Init(std::move(msg2));
     SuccessOrExit(err = tlvReader.Next(containerType, TLV::AnonymousTag()));
     SuccessOrExit(err = tlvReader.EnterContainer(containerType));
 
     SuccessOrExit(err = tlvReader.Next());
     VerifyOrExit(TLV::TagNumFromTag(tlvReader.GetTag()) == ++decodeTagIdSeq, err = CHIP_ERROR_INVALID_TLV_TAG);
-    Y_len = tlvReader.GetLength();
-    SuccessOrExit(err = tlvReader.GetDataPtr(Y));
+    VerifyOrExit(tlvReader.GetLength() <= sizeof(work->mData.peerPoint), err = CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+    work->mData.peerPointLength = tlvReader.GetLength();
+    SuccessOrExit(err = tlvReader.GetBytes(work->mData.peerPoint, sizeof(work->mData.peerPoint)));
 
     SuccessOrExit(err = tlvReader.Next());
     VerifyOrExit(TLV::TagNumFromTag(tlvReader.GetTag()) == ++decodeTagIdSeq, err = CHIP_ERROR_INVALID_TLV_TAG);
-    peer_verifier_len = tlvReader.GetLength();
-    SuccessOrExit(err = tlvReader.GetDataPtr(peer_verifier));
+    VerifyOrExit(tlvReader.GetLength() <= sizeof(work->mData.peerVerifier), err = CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+    work->mData.peerVerifierLength = tlvReader.GetLength();
+    SuccessOrExit(err = tlvReader.GetBytes(work->mData.peerVerifier, sizeof(work->mData.peerVerifier)));
 
-    SuccessOrExit(err = mSpake2p.ComputeRoundTwo(Y, Y_len, verifier, &verifier_len));
+    {
+        // ScheduleSpake2pWork takes ownership of the work, even on failure.
+        auto * scheduled = work;
+        work             = nullptr;
+        SuccessOrExit(err = ScheduleSpake2pWork(scheduled));
+    }
 
-    SuccessOrExit(err = mSpake2p.KeyConfirm(peer_verifier, peer_verifier_len));
-    SuccessOrExit(err = mSpake2p.GetKeys(mKe, &mKeLen));
-    msg2 = nullptr;
+exit:
+    Platform::Delete(work);
 
+    if (err != CHIP_NO_ERROR)
     {
-        const size_t max_msg_len    = TLV::EstimateStructOverhead(verifier_len);
-        constexpr uint8_t kPake3_cB = 1;
+        SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
+    }
+    return err;
+}
 
-        System::PacketBufferHandle msg3 = System::PacketBufferHandle::New(max_msg_len);
-        VerifyOrExit(!msg3.IsNull(), err = CHIP_ERROR_NO_MEMORY);
+CHIP_ERROR PASESession::ComputeMsg3(Spake2pData & data)
+{
+    ReturnErrorOnFailure(data.spake2p->ComputeRoundTwo(data.peerPoint, data.peerPointLength, data.verifier, &data.verifierLength));
 
-        System::PacketBufferTLVWriter tlvWriter;
-        tlvWriter.Init(std::move(msg3));
+    ReturnErrorOnFailure(data.spake2p->KeyConfirm(data.peerVerifier, data.peerVerifierLength));
+    return data.spake2p->GetKeys(data.ke, &data.keLength);
+}
 
-        TLV::TLVType outerContainerType = TLV::kTLVType_NotSpecified;
-        SuccessOrExit(err = tlvWriter.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outerContainerType));
-        SuccessOrExit(err = tlvWriter.Put(TLV::ContextTag(kPake3_cB), ByteSpan(verifier, verifier_len)));
-        SuccessOrExit(err = tlvWriter.EndContainer(outerContainerType));
-        SuccessOrExit(err = tlvWriter.Finalize(&msg3));
+void PASESession::SendMsg3(Spake2pData & data, CHIP_ERROR status)
+{
+    MATTER_TRACE_EVENT_SCOPE("SendMsg3", "PASESession");
+    CHIP_ERROR err = status;
 
-        err = mExchangeCtxt->SendMessage(MsgType::PASE_Pake3, std::move(msg3), SendFlags(SendMessageFlags::kExpectResponse));
-        SuccessOrExit(err);
+    System::PacketBufferTLVWriter tlvWriter;
+    TLV::TLVType outerContainerType = TLV::kTLVType_NotSpecified;
 
-        mNextExpectedMsg.SetValue(MsgType::StatusReport);
-    }
+    const size_t max_msg_len    = TLV::EstimateStructOverhead(data.verifierLength);
+    constexpr uint8_t kPake3_cB = 1;
+
+    System::PacketBufferHandle msg3 = System::PacketBufferHandle::New(max_msg_len);
+
+    mSpake2p = std::move(data.spake2p);
+    SuccessOrExit(err);
+
+    memcpy(mKe, data.ke, data.keLength);
+    mKeLen = data.keLength;
+
+    VerifyOrExit(!msg3.IsNull(), err = CHIP_ERROR_NO_MEMORY);
+    tlvWriter.Init(std::move(msg3));
+
+    SuccessOrExit(err = tlvWriter.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outerContainerType));
+    SuccessOrExit(err = tlvWriter.Put(TLV::ContextTag(kPake3_cB), ByteSpan(data.verifier, data.verifierLength)));
+    SuccessOrExit(err = tlvWriter.EndContainer(outerContainerType));
+    SuccessOrExit(err = tlvWriter.Finalize(&msg3));
+
+    err = mExchangeCtxt->SendMessage(MsgType::PASE_Pake3, std::move(msg3), SendFlags(SendMessageFlags::kExpectResponse));
+    SuccessOrExit(err);
+
+    mNextExpectedMsg.SetValue(MsgType::StatusReport);
 
     ChipLogDetail(SecureChannel, "Sent spake2p msg3");
 
 exit:
-
     if (err != CHIP_NO_ERROR)
     {
         SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
+        AbortPendingPairing(err);
     }
-    return err;
 }
 
 CHIP_ERROR PASESession::HandleMsg3(System::PacketBufferHandle && msg)
@@ -736,8 +868,9 @@ CHIP_ERROR PASESession::HandleMsg3(System::PacketBufferHandle && msg)
 
     VerifyOrExit(peer_verifier_len == kMAX_Hash_Length, err = CHIP_ERROR_INVALID_MESSAGE_LENGTH);
 
-    SuccessOrExit(err = mSpake2p.KeyConfirm(peer_verifier, peer_verifier_len));
-    SuccessOrExit(err = mSpake2p.GetKeys(mKe, &mKeLen));
+    VerifyOrExit(mSpake2p, err = CHIP_ERROR_INCORRECT_STATE);
+    SuccessOrExit(err = mSpake2p->KeyConfirm(peer_verifier, peer_verifier_len));
+    SuccessOrExit(err = mSpake2p->GetKeys(mKe, &mKeLen));
 
     // Send confirmation to peer that we succeeded so they can start using the session.
     SendStatusReport(mExchangeCtxt, kProtocolCodeSuccess);
@@ -844,11 +977,11 @@ CHIP_ERROR PASESession::OnMessageReceived(ExchangeContext * exchange, const Payl
         break;
 
     case MsgType::PASE_Pake1:
-        err = HandleMsg1_and_SendMsg2(std::move(msg));
+        err = HandleMsg1(std::move(msg));
         break;
 
     case MsgType::PASE_Pake2:
-        err = HandleMsg2_and_SendMsg3(std::move(msg));
+        err = HandleMsg2(std::move(msg));
         break;
 
     case MsgType::PASE_Pake3:
@@ -870,13 +1003,7 @@ exit:
     // Call delegate to indicate pairing failure
     if (err != CHIP_NO_ERROR)
     {
-        // Discard the exchange so that Clear() doesn't try closing it.  The
-        // exchange will handle that.
-        DiscardExchange();
-        Clear();
-        ChipLogError(SecureChannel, "Failed during PASE session setup: %" CHIP_ERROR_FORMAT, err.Format());
-        // Do this last in case the delegate frees us.
-        NotifySessionEstablishmentError(err);
+        AbortPendingPairing(err);
     }
     return err;
 }
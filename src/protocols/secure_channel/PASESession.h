@@ -197,14 +197,30 @@ private:
     CHIP_ERROR HandlePBKDFParamRequest(System::PacketBufferHandle && msg);
 
     CHIP_ERROR SendPBKDFParamResponse(ByteSpan initiatorRandom, bool initiatorHasPBKDFParams);
+
+    // The SPAKE2+ rounds below run in the background, see PairingSession::ScheduleCryptoWork(). The received message is
+    // handled on the Matter thread, then the next round is computed by a static function that owns mSpake2p meanwhile, then
+    // the next message is sent on the Matter thread.
+    struct Spake2pData;
+    using Spake2pWork = CryptoWorkWithData<PASESession, Spake2pData>;
+    CHIP_ERROR ScheduleSpake2pWork(Spake2pWork * work);
+
     CHIP_ERROR HandlePBKDFParamResponse(System::PacketBufferHandle && msg);
+    static CHIP_ERROR ComputeMsg1(Spake2pData & data);
+    void SendMsg1(Spake2pData & data, CHIP_ERROR status);
 
-    CHIP_ERROR SendMsg1();
+    CHIP_ERROR HandleMsg1(System::PacketBufferHandle && msg);
+    static CHIP_ERROR ComputeMsg2(Spake2pData & data);
+    void SendMsg2(Spake2pData & data, CHIP_ERROR status);
+
+    CHIP_ERROR HandleMsg2(System::PacketBufferHandle && msg);
+    static CHIP_ERROR ComputeMsg3(Spake2pData & data);
+    void SendMsg3(Spake2pData & data, CHIP_ERROR status);
 
-    CHIP_ERROR HandleMsg1_and_SendMsg2(System::PacketBufferHandle && msg);
-    CHIP_ERROR HandleMsg2_and_SendMsg3(System::PacketBufferHandle && msg);
     CHIP_ERROR HandleMsg3(System::PacketBufferHandle && msg);
 
+    void AbortPendingPairing(CHIP_ERROR err);
+
     void OnSuccessStatusReport() override;
     CHIP_ERROR OnFailureStatusReport(Protocols::SecureChannel::GeneralStatusCode generalCode, uint16_t protocolCode) override;
 
@@ -214,10 +230,12 @@ private:
     Optional<Protocols::SecureChannel::MsgType> mNextExpectedMsg;
 
 #ifdef ENABLE_HSM_SPAKE
-    Spake2pHSM_P256_SHA256_HKDF_HMAC mSpake2p;
+    using Spake2pImpl = Spake2pHSM_P256_SHA256_HKDF_HMAC;
 #else
-    Spake2p_P256_SHA256_HKDF_HMAC mSpake2p;
+    using Spake2pImpl = Spake2p_P256_SHA256_HKDF_HMAC;
 #endif
+    // Allocated by SetupSpake2p(), and owned by the pending Spake2pWork, if any.
+    Platform::UniquePtr<Spake2pImpl> mSpake2p;
 
     Spake2pVerifier mPASEVerifier;
 
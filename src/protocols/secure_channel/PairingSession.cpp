@@ -20,6 +20,7 @@
 
 #include <lib/core/TLVTypes.h>
 #include <lib/support/SafeInt.h>
+#include <platform/PlatformManager.h>
 
 namespace chip {
 
@@ -164,11 +165,94 @@ void PairingSession::Clear()
         mExchangeCtxt = nullptr;
     }
 
+    CancelCryptoWork();
+
     mSecureSessionHolder.Release();
     mPeerSessionId.ClearValue();
     mSessionManager = nullptr;
 }
 
+CHIP_ERROR PairingSession::ScheduleCryptoWork(CryptoWork * work)
+{
+    VerifyOrReturnError(work != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    CHIP_ERROR err = CHIP_ERROR_INCORRECT_STATE;
+    if (mPendingCryptoWork == nullptr)
+    {
+        work->mSession = this;
+
+        err = DeviceLayer::PlatformMgr().ScheduleBackgroundWork(CryptoWork::RunInBackground, reinterpret_cast<intptr_t>(work));
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        Platform::Delete(work);
+        return err;
+    }
+
+    mPendingCryptoWork = work;
+    return CHIP_NO_ERROR;
+}
+
+void PairingSession::CancelCryptoWork()
+{
+    if (mPendingCryptoWork != nullptr)
+    {
+        // The work still belongs to the background task, which deletes it on the Matter thread.
+        mPendingCryptoWork->mCancelled = true;
+        mPendingCryptoWork             = nullptr;
+    }
+}
+
+void PairingSession::CryptoWork::RunInBackground(intptr_t arg)
+{
+    auto * work   = reinterpret_cast<CryptoWork *>(arg);
+    work->mStatus = work->mCancelled ? CHIP_ERROR_CANCELLED : work->Run();
+    PostCompletion(arg);
+}
+
+void PairingSession::CryptoWork::PostCompletion(intptr_t arg)
+{
+    // The work can only be deleted on the Matter thread, where its session may still reference it, so
+    // failing to get back there must not leave the session waiting forever.
+    auto & platformMgr = DeviceLayer::PlatformMgr();
+    if (platformMgr.ScheduleWork(CompleteOnMatterThread, arg) == CHIP_NO_ERROR)
+    {
+        return;
+    }
+
+    // The event queue is full. Platforms without background event processing run background work on the
+    // Matter thread, which already holds the stack lock, so the work can be completed in place there.
+#if CHIP_STACK_LOCK_TRACKING_ENABLED
+    const bool stackLocked = platformMgr.IsChipStackLockedByCurrentThread();
+#else
+    const bool stackLocked = !CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING;
+#endif // CHIP_STACK_LOCK_TRACKING_ENABLED
+    ChipLogError(SecureChannel, "Event queue full, completing pairing crypto work in place");
+    if (stackLocked)
+    {
+        CompleteOnMatterThread(arg);
+        return;
+    }
+
+    // Otherwise this is a background task, which must wait for the Matter thread to release the stack lock
+    // before it touches the session.
+    platformMgr.LockChipStack();
+    CompleteOnMatterThread(arg);
+    platformMgr.UnlockChipStack();
+}
+
+void PairingSession::CryptoWork::CompleteOnMatterThread(intptr_t arg)
+{
+    auto * work = reinterpret_cast<CryptoWork *>(arg);
+    if (!work->mCancelled)
+    {
+        work->mSession->mPendingCryptoWork = nullptr;
+        work->Complete(work->mStatus);
+    }
+    Platform::Delete(work);
+}
+
 void PairingSession::NotifySessionEstablishmentError(CHIP_ERROR error)
 {
     if (mDelegate == nullptr)
@@ -27,6 +27,7 @@
 
 #include <lib/core/CHIPError.h>
 #include <lib/core/TLV.h>
+#include <lib/support/CHIPMem.h>
 #include <messaging/ExchangeContext.h>
 #include <protocols/secure_channel/Constants.h>
 #include <protocols/secure_channel/SessionEstablishmentDelegate.h>
@@ -34,6 +35,8 @@
 #include <transport/CryptoContext.h>
 #include <transport/SecureSession.h>
 
+#include <atomic>
+
 namespace chip {
 
 class SessionManager;
@@ -106,6 +109,72 @@ public:
                                           TLV::TLVWriter & tlvWriter);
 
 protected:
+    /**
+     * A step of the handshake that does public-key cryptography, which ScheduleCryptoWork() runs off the
+     * Matter thread on platforms with background event processing.
+     *
+     * Run() may be called on a background task, so it must only use the members of the work object and
+     * thread-safe crypto primitives. Complete() is then called on the Matter thread with the result,
+     * unless the session was cleared in the meantime, in which case the work is deleted without completing.
+     */
+    class CryptoWork
+    {
+    public:
+        virtual ~CryptoWork() = default;
+
+    protected:
+        virtual CHIP_ERROR Run()                 = 0;
+        virtual void Complete(CHIP_ERROR status) = 0;
+
+    private:
+        friend class PairingSession;
+
+        static void RunInBackground(intptr_t arg);
+        static void PostCompletion(intptr_t arg);
+        static void CompleteOnMatterThread(intptr_t arg);
+
+        PairingSession * mSession = nullptr;
+        CHIP_ERROR mStatus        = CHIP_NO_ERROR;
+        std::atomic<bool> mCancelled{ false };
+    };
+
+    /**
+     * CryptoWork that holds the data of the step, runs a static function of SESSION on it in the
+     * background, then hands it to a member function of SESSION on the Matter thread.
+     */
+    template <class SESSION, class DATA>
+    class CryptoWorkWithData : public CryptoWork
+    {
+    public:
+        using WorkFunction       = CHIP_ERROR (*)(DATA & data);
+        using CompletionFunction = void (SESSION::*)(DATA & data, CHIP_ERROR status);
+
+        CryptoWorkWithData(SESSION & session, WorkFunction work, CompletionFunction completion) :
+            mOwner(session), mWork(work), mCompletion(completion)
+        {}
+
+        DATA mData;
+
+    private:
+        CHIP_ERROR Run() override { return mWork(mData); }
+        void Complete(CHIP_ERROR status) override { (mOwner.*mCompletion)(mData, status); }
+
+        SESSION & mOwner;
+        WorkFunction mWork;
+        CompletionFunction mCompletion;
+    };
+
+    /**
+     * Schedule crypto work, taking ownership of it. The work is deleted right away if it cannot be
+     * scheduled. At most one crypto work may be pending per session.
+     */
+    CHIP_ERROR ScheduleCryptoWork(CryptoWork * work);
+
+    /**
+     * Make sure that the pending crypto work, if any, does not complete. Called by Clear().
+     */
+    void CancelCryptoWork();
+
     /**
      * Allocate a secure session object from the passed session manager for the
      * pending session establishment operation.
@@ -218,6 +287,7 @@ protected:
 
 private:
     Optional<uint16_t> mPeerSessionId;
+    CryptoWork * mPendingCryptoWork = nullptr;
 };
 
 } // namespace chip
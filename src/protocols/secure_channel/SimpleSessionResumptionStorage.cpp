@@ -48,6 +48,21 @@ StorageKeyName SimpleSessionResumptionStorage::GetStorageKey(ConstResumptionIdVi
     return DefaultStorageKeyAllocator::SessionResumption(resumptionIdBase64);
 }
 
+CHIP_ERROR SimpleSessionResumptionStorage::Save(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
+                                                const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs)
+{
+    PersistentStorageBatch batch(mStorage);
+    ReturnErrorOnFailure(DefaultSessionResumptionStorage::Save(node, resumptionId, sharedSecret, peerCATs));
+    return batch.End();
+}
+
+CHIP_ERROR SimpleSessionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
+{
+    PersistentStorageBatch batch(mStorage);
+    ReturnErrorOnFailure(DefaultSessionResumptionStorage::DeleteAll(fabricIndex));
+    return batch.End();
+}
+
 CHIP_ERROR SimpleSessionResumptionStorage::SaveIndex(const SessionIndex & index)
 {
     std::array<uint8_t, MaxIndexSize()> buf;
@@ -60,16 +60,18 @@ namespace {
 
 void ServiceEvents(TestContext & ctx)
 {
-    // Service any messages
-    ctx.DrainAndServiceIO();
-
-    // Messages may have scheduled work, so service them
-    chip::DeviceLayer::PlatformMgr().ScheduleWork([](intptr_t) -> void { chip::DeviceLayer::PlatformMgr().StopEventLoopTask(); },
-                                                  (intptr_t) nullptr);
-    chip::DeviceLayer::PlatformMgr().RunEventLoop();
-
-    // Work may have sent messages, so service them
-    ctx.DrainAndServiceIO();
+    // Each handshake step does its crypto in scheduled work, which sends the next message, so keep going until no more
+    // messages are sent.
+    do
+    {
+        // Service any messages
+        ctx.DrainAndServiceIO();
+
+        // Messages may have scheduled work, so service them
+        chip::DeviceLayer::PlatformMgr().ScheduleWork(
+            [](intptr_t) -> void { chip::DeviceLayer::PlatformMgr().StopEventLoopTask(); }, (intptr_t) nullptr);
+        chip::DeviceLayer::PlatformMgr().RunEventLoop();
+    } while (ctx.GetLoopback().HasPendingMessages());
 }
 
 class TemporarySessionManager
@@ -197,8 +199,11 @@ GroupDataProviderImpl gCommissionerGroupDataProvider;
 TestPersistentStorageDelegate gCommissionerStorageDelegate;
 Crypto::DefaultSessionKeystore gCommissionerSessionKeystore;
 
+FabricIndex gCommissionerFabric02Index;
+
 FabricTable gDeviceFabrics;
 FabricIndex gDeviceFabricIndex;
+FabricIndex gDeviceFabric02Index;
 GroupDataProviderImpl gDeviceGroupDataProvider;
 TestPersistentStorageDelegate gDeviceStorageDelegate;
 TestOperationalKeystore gDeviceOperationalKeystore;
@@ -209,6 +214,7 @@ Credentials::PersistentStorageOpCertStore gDeviceOpCertStore;
 
 NodeId Node01_01 = 0xDEDEDEDE00010001;
 NodeId Node01_02 = 0xDEDEDEDE00010002;
+NodeId Node02_01 = 0xDEDEDEDE00020001;
 
 CHIP_ERROR InitTestIpk(GroupDataProvider & groupDataProvider, const FabricInfo & fabricInfo, size_t numIpks)
 {
@@ -232,6 +238,26 @@ CHIP_ERROR InitTestIpk(GroupDataProvider & groupDataProvider, const FabricInfo &
     return groupDataProvider.SetKeySet(fabricInfo.GetFabricIndex(), compressedIdSpan, ipkKeySet);
 }
 
+// Add the fabric of the Root02 test certificates, with an injected operational key.
+CHIP_ERROR AddFabric02(FabricTable & fabricTable, GroupDataProvider & groupDataProvider, const ByteSpan & noc,
+                       const ByteSpan & publicKey, const ByteSpan & privateKey, FabricIndex & outFabricIndex)
+{
+    P256SerializedKeypair opKeysSerialized;
+    VerifyOrReturnError(publicKey.size() + privateKey.size() <= opKeysSerialized.Capacity(), CHIP_ERROR_BUFFER_TOO_SMALL);
+    memcpy(opKeysSerialized.Bytes(), publicKey.data(), publicKey.size());
+    memcpy(opKeysSerialized.Bytes() + publicKey.size(), privateKey.data(), privateKey.size());
+    ReturnErrorOnFailure(opKeysSerialized.SetLength(publicKey.size() + privateKey.size()));
+
+    chip::ByteSpan rcacSpan(sTestCert_Root02_Chip, sTestCert_Root02_Chip_Len);
+    chip::ByteSpan icacSpan(sTestCert_ICA02_Chip, sTestCert_ICA02_Chip_Len);
+    chip::ByteSpan opKeySpan(opKeysSerialized.ConstBytes(), opKeysSerialized.Length());
+    ReturnErrorOnFailure(fabricTable.AddNewFabricForTest(rcacSpan, icacSpan, noc, opKeySpan, &outFabricIndex));
+
+    const FabricInfo * newFabric = fabricTable.FindFabricWithIndex(outFabricIndex);
+    VerifyOrReturnError(newFabric != nullptr, CHIP_ERROR_INTERNAL);
+    return InitTestIpk(groupDataProvider, *newFabric, /* numIpks= */ 1);
+}
+
 CHIP_ERROR InitCredentialSets()
 {
     gCommissionerStorageDelegate.ClearStorage();
@@ -299,7 +325,15 @@ CHIP_ERROR InitCredentialSets()
     VerifyOrReturnError(newFabric != nullptr, CHIP_ERROR_INTERNAL);
     ReturnErrorOnFailure(InitTestIpk(gDeviceGroupDataProvider, *newFabric, /* numIpks= */ 1));
 
-    return CHIP_NO_ERROR;
+    // Both sides also share a second fabric, for the tests that need more than one.
+    ReturnErrorOnFailure(AddFabric02(gCommissionerFabrics, gCommissionerGroupDataProvider,
+                                     ByteSpan(sTestCert_Node02_02_Chip, sTestCert_Node02_02_Chip_Len),
+                                     ByteSpan(sTestCert_Node02_02_PublicKey, sTestCert_Node02_02_PublicKey_Len),
+                                     ByteSpan(sTestCert_Node02_02_PrivateKey, sTestCert_Node02_02_PrivateKey_Len),
+                                     gCommissionerFabric02Index));
+    return AddFabric02(gDeviceFabrics, gDeviceGroupDataProvider, ByteSpan(sTestCert_Node02_01_Chip, sTestCert_Node02_01_Chip_Len),
+                       ByteSpan(sTestCert_Node02_01_PublicKey, sTestCert_Node02_01_PublicKey_Len),
+                       ByteSpan(sTestCert_Node02_01_PrivateKey, sTestCert_Node02_01_PrivateKey_Len), gDeviceFabric02Index);
 }
 
 } // anonymous namespace
@@ -314,6 +348,7 @@ public:
     static void SecurePairingStartTest(nlTestSuite * inSuite, void * inContext);
     static void SecurePairingHandshakeTest(nlTestSuite * inSuite, void * inContext);
     static void SecurePairingHandshakeServerTest(nlTestSuite * inSuite, void * inContext);
+    static void SecurePairingConcurrentServerTest(nlTestSuite * inSuite, void * inContext);
     static void Sigma1ParsingTest(nlTestSuite * inSuite, void * inContext);
     static void DestinationIdTest(nlTestSuite * inSuite, void * inContext);
     static void SessionResumptionStorage(nlTestSuite * inSuite, void * inContext);
@@ -536,6 +571,117 @@ void TestCASESession::SecurePairingHandshakeServerTest(nlTestSuite * inSuite, vo
     chip::Platform::Delete(pairingCommissioner1);
 }
 
+void TestCASESession::SecurePairingConcurrentServerTest(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr size_t kMaxHandshakes          = CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES;
+    constexpr size_t kMaxHandshakesPerFabric = CHIP_CONFIG_CASE_SERVER_MAX_HANDSHAKES_PER_FABRIC;
+    constexpr size_t kSigma1QueueSize        = CHIP_CONFIG_CASE_SERVER_SIGMA1_QUEUE_SIZE;
+
+    // The first fabric takes its share of the responders and fills the queue. The second fabric then takes the other
+    // responders and displaces the newest messages queued for the first one, until both have about as many queued.
+    constexpr size_t kNumDisplaced = std::min<size_t>(kMaxHandshakesPerFabric, (kSigma1QueueSize - 1) / 2);
+    constexpr size_t kNumFabric1   = kMaxHandshakesPerFabric + kSigma1QueueSize;
+    constexpr size_t kNumFabric2   = kMaxHandshakesPerFabric + kNumDisplaced;
+    constexpr size_t kNumSigma1    = kNumFabric1 + kNumFabric2;
+
+    // Each handshake in flight holds an unauthenticated session on both sides of the loopback.
+    if (kSigma1QueueSize < 3 || 2 * kMaxHandshakesPerFabric > kMaxHandshakes ||
+        2 * kNumSigma1 > CHIP_CONFIG_UNAUTHENTICATED_CONNECTION_POOL_SIZE)
+    {
+        ChipLogProgress(SecureChannel, "CASE server configuration too small for concurrent handshakes on two fabrics");
+        return;
+    }
+
+    class OrderedPairingDelegate : public TestCASESecurePairingDelegate
+    {
+    public:
+        void OnSessionEstablished(const SessionHandle & session) override
+        {
+            TestCASESecurePairingDelegate::OnSessionEstablished(session);
+            mEstablishedOrder = ++(*mNumEstablished);
+        }
+
+        size_t * mNumEstablished  = nullptr;
+        size_t mEstablishedOrder = 0;
+    };
+
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    NL_TEST_ASSERT(inSuite,
+                   gPairingServer.ListenForSessionEstablishment(&ctx.GetExchangeManager(), &ctx.GetSecureSessionManager(),
+                                                                &gDeviceFabrics, nullptr, nullptr,
+                                                                &gDeviceGroupDataProvider) == CHIP_NO_ERROR);
+    gPairingServer.ResetStatistics();
+    NL_TEST_ASSERT(inSuite, gPairingServer.GetStatistics().activeHandshakes == 0);
+
+    size_t numEstablished = 0;
+    OrderedPairingDelegate delegates[kNumSigma1];
+    CASESession * initiators[kNumSigma1];
+
+    // Send all the Sigma1 messages before servicing any of them, so that they reach the server as a burst: first those of
+    // the first fabric, then those of the second one.
+    for (size_t i = 0; i < kNumSigma1; i++)
+    {
+        const bool onFabric1 = i < kNumFabric1;
+        const ScopedNodeId peer =
+            onFabric1 ? ScopedNodeId{ Node01_01, gCommissionerFabricIndex } : ScopedNodeId{ Node02_01, gCommissionerFabric02Index };
+
+        delegates[i].mNumEstablished = &numEstablished;
+        initiators[i]                = chip::Platform::New<CASESession>();
+        initiators[i]->SetGroupDataProvider(&gCommissionerGroupDataProvider);
+
+        ExchangeContext * exchange = ctx.NewUnauthenticatedExchangeToBob(initiators[i]);
+        NL_TEST_ASSERT(inSuite,
+                       initiators[i]->EstablishSession(ctx.GetSecureSessionManager(), &gCommissionerFabrics, peer, exchange,
+                                                       nullptr, nullptr, &delegates[i],
+                                                       Optional<ReliableMessageProtocolConfig>::Missing()) == CHIP_NO_ERROR);
+    }
+
+    // Queued handshakes only start once earlier ones are done, so it takes a few rounds.
+    for (size_t round = 0; round < 4 * kNumSigma1; round++)
+    {
+        ServiceEvents(ctx);
+    }
+
+    // The newest messages of the first fabric were dropped to make room for the second one, all the others were served.
+    size_t lastQueuedOnFabric1 = 0;
+    size_t lastQueuedOnFabric2 = 0;
+    for (size_t i = 0; i < kNumSigma1; i++)
+    {
+        const bool displaced = i >= kNumFabric1 - kNumDisplaced && i < kNumFabric1;
+        NL_TEST_ASSERT(inSuite, delegates[i].mNumPairingComplete == (displaced ? 0u : 1u));
+        NL_TEST_ASSERT(inSuite, delegates[i].mNumPairingErrors == 0);
+
+        if (i >= kMaxHandshakesPerFabric && i < kNumFabric1 - kNumDisplaced)
+        {
+            lastQueuedOnFabric1 = std::max(lastQueuedOnFabric1, delegates[i].mEstablishedOrder);
+        }
+        else if (i >= kNumFabric1 + kMaxHandshakesPerFabric)
+        {
+            lastQueuedOnFabric2 = std::max(lastQueuedOnFabric2, delegates[i].mEstablishedOrder);
+        }
+    }
+
+    // The queued messages of the second fabric did not wait for those that the first one had queued before them.
+    NL_TEST_ASSERT(inSuite, lastQueuedOnFabric2 > 0);
+    NL_TEST_ASSERT(inSuite, lastQueuedOnFabric2 < lastQueuedOnFabric1);
+
+    const CASEServer::Statistics & stats = gPairingServer.GetStatistics();
+    NL_TEST_ASSERT(inSuite, stats.handshakesStarted == kNumSigma1 - kNumDisplaced);
+    NL_TEST_ASSERT(inSuite, stats.handshakesEstablished == kNumSigma1 - kNumDisplaced);
+    NL_TEST_ASSERT(inSuite, stats.handshakesFailed == 0);
+    NL_TEST_ASSERT(inSuite, stats.sigma1Dropped == kNumDisplaced);
+    NL_TEST_ASSERT(inSuite, stats.activeHandshakes == 0);
+    NL_TEST_ASSERT(inSuite, stats.activeHighWaterMark == 2 * kMaxHandshakesPerFabric);
+    NL_TEST_ASSERT(inSuite, stats.queueDepth == 0);
+    NL_TEST_ASSERT(inSuite, stats.queueHighWaterMark == kSigma1QueueSize);
+
+    for (auto * initiator : initiators)
+    {
+        chip::Platform::Delete(initiator);
+    }
+}
+
 struct Sigma1Params
 {
     // Purposefully not using constants like kSigmaParamRandomNumberSize that
@@ -1113,6 +1259,7 @@ static const nlTest sTests[] =
     NL_TEST_DEF("Start",       chip::TestCASESession::SecurePairingStartTest),
     NL_TEST_DEF("Handshake",   chip::TestCASESession::SecurePairingHandshakeTest),
     NL_TEST_DEF("ServerHandshake", chip::TestCASESession::SecurePairingHandshakeServerTest),
+    NL_TEST_DEF("ConcurrentServerHandshakes", chip::TestCASESession::SecurePairingConcurrentServerTest),
     NL_TEST_DEF("Sigma1Parsing", chip::TestCASESession::Sigma1ParsingTest),
     NL_TEST_DEF("DestinationId", chip::TestCASESession::DestinationIdTest),
     NL_TEST_DEF("SessionResumptionStorage", chip::TestCASESession::SessionResumptionStorage),
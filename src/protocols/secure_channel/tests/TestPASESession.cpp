@@ -32,6 +32,7 @@
 #include <lib/support/UnitTestRegistration.h>
 #include <lib/support/UnitTestUtils.h>
 #include <messaging/tests/MessagingContext.h>
+#include <platform/CHIPDeviceLayer.h>
 #include <protocols/secure_channel/PASESession.h>
 #include <stdarg.h>
 
@@ -88,6 +89,22 @@ public:
 
 using TestContext = chip::Test::LoopbackMessagingContext;
 
+void ServiceEvents(TestContext & ctx)
+{
+    // Each SPAKE2+ round is computed in scheduled work, which sends the next message, so keep going until no more
+    // messages are sent.
+    do
+    {
+        // Service any messages
+        ctx.DrainAndServiceIO();
+
+        // Messages may have scheduled work, so service them
+        DeviceLayer::PlatformMgr().ScheduleWork([](intptr_t) -> void { DeviceLayer::PlatformMgr().StopEventLoopTask(); },
+                                                (intptr_t) nullptr);
+        DeviceLayer::PlatformMgr().RunEventLoop();
+    } while (ctx.GetLoopback().HasPendingMessages());
+}
+
 class TestSecurePairingDelegate : public SessionEstablishmentDelegate
 {
 public:
@@ -164,27 +181,27 @@ void SecurePairingWaitTest(nlTestSuite * inSuite, void * inContext)
                    pairing.WaitForPairing(sessionManager, sTestSpake2p01_PASEVerifier, sTestSpake2p01_IterationCount,
                                           ByteSpan(nullptr, 0), Optional<ReliableMessageProtocolConfig>::Missing(),
                                           &delegate) == CHIP_ERROR_INVALID_ARGUMENT);
-    ctx.DrainAndServiceIO();
+    ServiceEvents(ctx);
 
     NL_TEST_ASSERT(inSuite,
                    pairing.WaitForPairing(sessionManager, sTestSpake2p01_PASEVerifier, sTestSpake2p01_IterationCount,
                                           ByteSpan(reinterpret_cast<const uint8_t *>("saltSalt"), 8),
                                           Optional<ReliableMessageProtocolConfig>::Missing(),
                                           nullptr) == CHIP_ERROR_INVALID_ARGUMENT);
-    ctx.DrainAndServiceIO();
+    ServiceEvents(ctx);
 
     NL_TEST_ASSERT(inSuite,
                    pairing.WaitForPairing(sessionManager, sTestSpake2p01_PASEVerifier, sTestSpake2p01_IterationCount,
                                           ByteSpan(reinterpret_cast<const uint8_t *>("saltSalt"), 8),
                                           Optional<ReliableMessageProtocolConfig>::Missing(),
                                           &delegate) == CHIP_ERROR_INVALID_ARGUMENT);
-    ctx.DrainAndServiceIO();
+    ServiceEvents(ctx);
 
     NL_TEST_ASSERT(inSuite,
                    pairing.WaitForPairing(sessionManager, sTestSpake2p01_PASEVerifier, sTestSpake2p01_IterationCount,
                                           ByteSpan(sTestSpake2p01_Salt), Optional<ReliableMessageProtocolConfig>::Missing(),
                                           &delegate) == CHIP_NO_ERROR);
-    ctx.DrainAndServiceIO();
+    ServiceEvents(ctx);
 }
 
 void SecurePairingStartTest(nlTestSuite * inSuite, void * inContext)
@@ -209,7 +226,7 @@ void SecurePairingStartTest(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite,
                    pairing.Pair(sessionManager, sTestSpake2p01_PinCode, Optional<ReliableMessageProtocolConfig>::Missing(), context,
                                 &delegate) == CHIP_NO_ERROR);
-    ctx.DrainAndServiceIO();
+    ServiceEvents(ctx);
 
     // There should have been two messages sent: PBKDFParamRequest and an ack.
     NL_TEST_ASSERT(inSuite, loopback.mSentMessageCount == 2);
@@ -226,7 +243,7 @@ void SecurePairingStartTest(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite,
                    pairing1.Pair(sessionManager, sTestSpake2p01_PinCode, Optional<ReliableMessageProtocolConfig>::Missing(),
                                  context1, &delegate) == CHIP_ERROR_BAD_REQUEST);
-    ctx.DrainAndServiceIO();
+    ServiceEvents(ctx);
 
     loopback.mMessageSendError = CHIP_NO_ERROR;
 }
@@ -270,19 +287,19 @@ void SecurePairingHandshakeTestCommon(nlTestSuite * inSuite, void * inContext, S
                    pairingAccessory.WaitForPairing(sessionManager, sTestSpake2p01_PASEVerifier, sTestSpake2p01_IterationCount,
                                                    ByteSpan(sTestSpake2p01_Salt), mrpAccessoryConfig,
                                                    &delegateAccessory) == CHIP_NO_ERROR);
-    ctx.DrainAndServiceIO();
+    ServiceEvents(ctx);
 
     NL_TEST_ASSERT(inSuite,
                    pairingCommissioner.Pair(sessionManager, sTestSpake2p01_PinCode, mrpCommissionerConfig, contextCommissioner,
                                             &delegateCommissioner) == CHIP_NO_ERROR);
-    ctx.DrainAndServiceIO();
+    ServiceEvents(ctx);
 
     while (delegate.mMessageDropped)
     {
         chip::test_utils::SleepMillis(100);
         delegate.mMessageDropped = false;
         ReliableMessageMgr::Timeout(&ctx.GetSystemLayer(), ctx.GetExchangeManager().GetReliableMessageMgr());
-        ctx.DrainAndServiceIO();
+        ServiceEvents(ctx);
     };
 
     // Standalone acks also increment the mSentMessageCount. But some messages could be acked
@@ -328,7 +345,7 @@ void SecurePairingHandshakeTestCommon(nlTestSuite * inSuite, void * inContext, S
     // that notification is what would delete the PASESession, but in our case
     // that will happen as soon as things come off the stack.  So make sure to
     // process the async bits before that happens.
-    ctx.DrainAndServiceIO();
+    ServiceEvents(ctx);
 
     // And check that this did not result in any new notifications.
     NL_TEST_ASSERT(inSuite, delegateAccessory.mNumPairingErrors == 0);
@@ -451,12 +468,12 @@ void SecurePairingFailedHandshake(nlTestSuite * inSuite, void * inContext)
                    pairingAccessory.WaitForPairing(
                        sessionManager, sTestSpake2p01_PASEVerifier, sTestSpake2p01_IterationCount, ByteSpan(sTestSpake2p01_Salt),
                        Optional<ReliableMessageProtocolConfig>::Missing(), &delegateAccessory) == CHIP_NO_ERROR);
-    ctx.DrainAndServiceIO();
+    ServiceEvents(ctx);
 
     NL_TEST_ASSERT(inSuite,
                    pairingCommissioner.Pair(sessionManager, 4321, Optional<ReliableMessageProtocolConfig>::Missing(),
                                             contextCommissioner, &delegateCommissioner) == CHIP_NO_ERROR);
-    ctx.DrainAndServiceIO();
+    ServiceEvents(ctx);
 
     NL_TEST_ASSERT(inSuite, delegateAccessory.mNumPairingComplete == 0);
     NL_TEST_ASSERT(inSuite, delegateAccessory.mNumPairingErrors == 1);
@@ -531,6 +548,9 @@ int TestSecurePairing_Setup(void * inContext)
     ctx.ConfigInitializeNodes(false);
     VerifyOrReturnError(TestContext::Initialize(inContext) == SUCCESS, FAILURE);
 
+    VerifyOrReturnError(DeviceLayer::PlatformMgr().InitChipStack() == CHIP_NO_ERROR, FAILURE);
+    DeviceLayer::SetSystemLayerForTesting(&ctx.GetSystemLayer());
+
     return SUCCESS;
 }
 
@@ -539,6 +559,8 @@ int TestSecurePairing_Setup(void * inContext)
  */
 int TestSecurePairing_Teardown(void * inContext)
 {
+    DeviceLayer::SetSystemLayerForTesting(nullptr);
+    DeviceLayer::PlatformMgr().Shutdown();
     return TestContext::Finalize(inContext);
 }
 
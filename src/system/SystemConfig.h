@@ -356,6 +356,33 @@
 #define CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE 15
 #endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES
+ *
+ *  @brief
+ *      When packet buffers are allocated from the heap (#CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE is zero), round each
+ *      allocation up to one of a small number of size classes (small, MTU-sized and maximum-sized buffers) and keep recently
+ *      freed buffers of each class on a per-thread free list, so that bursts of traffic reuse buffers instead of going
+ *      through the general-purpose heap for every message.
+ *
+ *      Requires compiler support for \c thread_local.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES 0
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASS_CACHE_SIZE
+ *
+ *  @brief
+ *      The maximum number of freed packet buffers each thread keeps for reuse in each size class, when
+ *      #CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES is enabled. Buffers freed beyond this are returned to the heap, so the
+ *      memory held after a burst of traffic is bounded.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASS_CACHE_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASS_CACHE_SIZE 16
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASS_CACHE_SIZE */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_LWIP_PBUF_TYPE
  *
@@ -487,6 +514,31 @@ struct LwIPEvent;
 #define CHIP_SYSTEM_CONFIG_NUM_TIMERS 32
 #endif /* CHIP_SYSTEM_CONFIG_NUM_TIMERS */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+ *
+ *  @brief
+ *      Keep pending System::Layer timers in a hierarchical timer wheel (chip::System::TimerWheel) rather than a sorted
+ *      linked list, making timer start and cancellation independent of the number of active timers.
+ *
+ *      This costs a few kilobytes per System::Layer plus four pointers per timer, so it is intended for systems that
+ *      run thousands of concurrent timers (e.g. Linux).
+ */
+#ifndef CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+#define CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL 0
+#endif /* CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_BUCKETS
+ *
+ *  @brief
+ *      Number of buckets in the (callback, application state) index of a timer wheel, used when cancelling timers.
+ *      Should be of the order of the expected number of concurrent timers.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_BUCKETS
+#define CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_BUCKETS 1024
+#endif /* CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_BUCKETS */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
  *
@@ -0,0 +1,478 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements Layer using Linux epoll() and timerfd.
+ */
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TimeUtils.h>
+#include <platform/LockTracker.h>
+#include <system/SystemFaultInjection.h>
+#include <system/SystemLayer.h>
+#include <system/SystemLayerImplEpoll.h>
+#include <system/SystemPacketBuffer.h>
+
+#include <algorithm>
+#include <errno.h>
+#include <limits>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+// Choose an approximation of PTHREAD_NULL if pthread.h doesn't define one.
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+#define PTHREAD_NULL 0
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+
+namespace chip {
+namespace System {
+
+constexpr Clock::Seconds64 kDefaultMinSleepPeriod = Clock::Seconds64(60 * 60 * 24 * 30); // Month [sec]
+
+CHIP_ERROR LayerImplEpoll::Init()
+{
+    VerifyOrReturnError(mLayerState.SetInitializing(), CHIP_ERROR_INCORRECT_STATE);
+
+    RegisterPOSIXErrorFormatter();
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    epoll_event timerEvent;
+
+    mEpollResult = 0;
+
+    mEpollFd = epoll_create1(EPOLL_CLOEXEC);
+    VerifyOrExit(mEpollFd >= 0, err = CHIP_ERROR_POSIX(errno));
+
+    mTimerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    VerifyOrExit(mTimerFd >= 0, err = CHIP_ERROR_POSIX(errno));
+
+    // The timerfd is identified in the ready list by a null data pointer; socket watches always carry their SocketWatch.
+    timerEvent          = {};
+    timerEvent.events   = EPOLLIN;
+    timerEvent.data.ptr = nullptr;
+    VerifyOrExit(epoll_ctl(mEpollFd, EPOLL_CTL_ADD, mTimerFd, &timerEvent) == 0, err = CHIP_ERROR_POSIX(errno));
+
+    // Create an event to allow an arbitrary thread to wake the thread in the epoll loop.
+    SuccessOrExit(err = mWakeEvent.Open(*this));
+
+    VerifyOrExit(mLayerState.SetInitialized(), err = CHIP_ERROR_INCORRECT_STATE);
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        if (mTimerFd >= 0)
+        {
+            close(mTimerFd);
+            mTimerFd = kInvalidFd;
+        }
+        if (mEpollFd >= 0)
+        {
+            close(mEpollFd);
+            mEpollFd = kInvalidFd;
+        }
+    }
+    return err;
+}
+
+void LayerImplEpoll::Shutdown()
+{
+    VerifyOrReturn(mLayerState.SetShuttingDown());
+
+    mTimerList.Clear();
+    mTimerPool.ReleaseAll();
+
+    mWakeEvent.Close(*this);
+    mSocketWatchPool.ReleaseAll();
+
+    close(mTimerFd);
+    mTimerFd = kInvalidFd;
+    close(mEpollFd);
+    mEpollFd = kInvalidFd;
+
+    // Buffers cached by the event loop thread would otherwise only be released when it exits, which may be after the heap has
+    // been shut down.
+    PacketBuffer::ReleaseCachedBuffers();
+
+    mLayerState.ResetFromShuttingDown(); // Return to uninitialized state to permit re-initialization.
+}
+
+void LayerImplEpoll::Signal()
+{
+    /*
+     * Wake up the I/O thread by notifying the wake event.
+     *
+     * If this is being called from within an I/O event callback, then notifying the wake event can be skipped,
+     * since the I/O thread is already awake.
+     *
+     * Furthermore, we don't care if this write fails as the only reasonably likely failure is that the pipe is full, in which
+     * case the epoll calling thread is going to wake up anyway.
+     */
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    if (pthread_equal(mHandleSelectThread, pthread_self()))
+    {
+        return;
+    }
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    // Send notification to wake up the epoll call.
+    CHIP_ERROR status = mWakeEvent.Notify();
+    if (status != CHIP_NO_ERROR)
+    {
+        ChipLogError(chipSystemLayer, "System wake event notify failed: %" CHIP_ERROR_FORMAT, status.Format());
+    }
+}
+
+CHIP_ERROR LayerImplEpoll::StartTimer(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState)
+{
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    CHIP_SYSTEM_FAULT_INJECT(FaultInjection::kFault_TimeoutImmediate, delay = System::Clock::kZero);
+
+    CancelTimer(onComplete, appState);
+
+    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp() + delay, onComplete, appState);
+    VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    if (mTimerList.Add(timer) == timer)
+    {
+        // The new timer is the earliest, so the time until the next event has probably changed.
+        Signal();
+    }
+    return CHIP_NO_ERROR;
+}
+
+void LayerImplEpoll::CancelTimer(TimerCompleteCallback onComplete, void * appState)
+{
+    VerifyOrReturn(mLayerState.IsInitialized());
+
+    TimerList::Node * timer = mTimerList.Remove(onComplete, appState);
+    if (timer == nullptr)
+    {
+        // The timer was not in our "will fire in the future" list, but it might
+        // be in the "we're about to fire these" chunk we already grabbed from
+        // that list.  Check for it there too, and if found there we still want
+        // to cancel it.
+        timer = mExpiredTimers.Remove(onComplete, appState);
+    }
+    VerifyOrReturn(timer != nullptr);
+
+    mTimerPool.Release(timer);
+    Signal();
+}
+
+CHIP_ERROR LayerImplEpoll::ScheduleWork(TimerCompleteCallback onComplete, void * appState)
+{
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    // As in LayerImplSelect, use an expires-ASAP timer as a closure capturing `this`, onComplete and appState, and do not
+    // cancel existing timers with the same callback and appState, so ScheduleWork invocations don't stomp on each other.
+    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
+    VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    if (mTimerList.Add(timer) == timer)
+    {
+        // The new timer is the earliest, so the time until the next event has probably changed.
+        Signal();
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::StartWatchingSocket(int fd, SocketWatchToken * tokenOut)
+{
+    VerifyOrReturnError(fd >= 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Duplicate registration is an error.
+    bool duplicate = false;
+    mSocketWatchPool.ForEachActiveObject([&](SocketWatch * w) {
+        duplicate = (w->mFD == fd);
+        return duplicate ? Loop::Break : Loop::Continue;
+    });
+    VerifyOrReturnError(!duplicate, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The descriptor is only added to the epoll interest list once a callback on read or write is requested.
+    SocketWatch * watch = mSocketWatchPool.CreateObject(fd);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_ENDPOINT_POOL_FULL);
+
+    *tokenOut = reinterpret_cast<SocketWatchToken>(watch);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::SetCallback(SocketWatchToken token, SocketWatchCallback callback, intptr_t data)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mCallback     = callback;
+    watch->mCallbackData = data;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingRead(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Set(SocketEventFlags::kRead);
+    return UpdateInterest(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingWrite(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Set(SocketEventFlags::kWrite);
+    return UpdateInterest(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingRead(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Clear(SocketEventFlags::kRead);
+    return UpdateInterest(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingWrite(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Clear(SocketEventFlags::kWrite);
+    return UpdateInterest(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::StopWatchingSocket(SocketWatchToken * tokenInOut)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(*tokenInOut);
+    *tokenInOut         = InvalidSocketWatchToken();
+
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(watch->mFD >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    if (watch->mEpollEvents != 0)
+    {
+        // The descriptor may already have been closed, in which case the kernel has dropped it from the interest list.
+        (void) epoll_ctl(mEpollFd, EPOLL_CTL_DEL, watch->mFD, nullptr);
+    }
+
+    // If this is called from a callback in HandleEvents(), make sure that events still pending for this watch in the
+    // current batch are not dispatched to the released object.
+    for (int i = 0; i < mEpollResult; i++)
+    {
+        if (mEpollEvents[i].data.ptr == watch)
+        {
+            mEpollEvents[i].events = 0;
+        }
+    }
+
+    mSocketWatchPool.ReleaseObject(watch);
+    return CHIP_NO_ERROR;
+}
+
+uint32_t LayerImplEpoll::SocketWatch::EpollEventsFor(SocketEvents pendingIO)
+{
+    uint32_t events = 0;
+    if (pendingIO.Has(SocketEventFlags::kRead))
+    {
+        events |= EPOLLIN;
+    }
+    if (pendingIO.Has(SocketEventFlags::kWrite))
+    {
+        events |= EPOLLOUT;
+    }
+    return events;
+}
+
+/**
+ *  Bring the epoll interest list in line with the events requested for a socket.
+ *
+ *  Descriptors with no pending I/O are removed from the interest list entirely, since epoll always reports
+ *  EPOLLERR and EPOLLHUP and a level-triggered watch on such a descriptor would otherwise spin the loop.
+ */
+CHIP_ERROR LayerImplEpoll::UpdateInterest(SocketWatch & watch)
+{
+    const uint32_t events = SocketWatch::EpollEventsFor(watch.mPendingIO);
+    if (events == watch.mEpollEvents)
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    int op;
+    if (watch.mEpollEvents == 0)
+    {
+        op = EPOLL_CTL_ADD;
+    }
+    else if (events == 0)
+    {
+        op = EPOLL_CTL_DEL;
+    }
+    else
+    {
+        op = EPOLL_CTL_MOD;
+    }
+
+    epoll_event event = {};
+    event.events      = events;
+    event.data.ptr    = &watch;
+    if (epoll_ctl(mEpollFd, op, watch.mFD, &event) != 0)
+    {
+        return CHIP_ERROR_POSIX(errno);
+    }
+
+    watch.mEpollEvents = events;
+    return CHIP_NO_ERROR;
+}
+
+/**
+ *  Translate the events reported by epoll for a socket into SocketEvents.
+ *
+ *  As with select(), error and hang-up conditions are reported as readability or writability, so that the owner
+ *  discovers them from the failing I/O call. Only the events the owner currently asks for are reported.
+ *
+ *  @param[in]    watch        The socket watch for which the events were reported.
+ *
+ *  @param[in]    epollEvents  The event mask reported by epoll_wait().
+ */
+SocketEvents LayerImplEpoll::SocketEventsFromEpoll(const SocketWatch & watch, uint32_t epollEvents)
+{
+    SocketEvents res;
+
+    if ((epollEvents & (EPOLLIN | EPOLLERR | EPOLLHUP)) && watch.mPendingIO.Has(SocketEventFlags::kRead))
+    {
+        res.Set(SocketEventFlags::kRead);
+    }
+    if ((epollEvents & (EPOLLOUT | EPOLLERR | EPOLLHUP)) && watch.mPendingIO.Has(SocketEventFlags::kWrite))
+    {
+        res.Set(SocketEventFlags::kWrite);
+    }
+
+    return res;
+}
+
+void LayerImplEpoll::PrepareEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    const Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
+    Clock::Timestamp awakenTime        = currentTime + kDefaultMinSleepPeriod;
+
+    TimerList::Node * timer = mTimerList.Earliest();
+    if (timer && timer->AwakenTime() < awakenTime)
+    {
+        awakenTime = timer->AwakenTime();
+    }
+
+    const Clock::Timestamp sleepTime = (awakenTime > currentTime) ? (awakenTime - currentTime) : Clock::kZero;
+
+    // A zero it_value would disarm the timerfd, so a timer that is already due is handled by polling instead.
+    itimerspec timerSpec = {};
+    if (sleepTime == Clock::kZero)
+    {
+        mEpollTimeoutMs = 0;
+    }
+    else
+    {
+        timeval sleepTimeval;
+        Clock::ToTimeval(sleepTime, sleepTimeval);
+        timerSpec.it_value.tv_sec  = sleepTimeval.tv_sec;
+        timerSpec.it_value.tv_nsec = static_cast<long>(sleepTimeval.tv_usec) * kNanosecondsPerMicrosecond;
+        mEpollTimeoutMs            = -1;
+    }
+
+    if (timerfd_settime(mTimerFd, 0, &timerSpec, nullptr) != 0)
+    {
+        ChipLogError(DeviceLayer, "timerfd_settime failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+        // Fall back to the (millisecond-granular) epoll timeout so that timers still fire.
+        // The sleep period can be longer than the INT_MAX milliseconds that epoll_wait() takes.
+        uint32_t sleepTimeMs = std::chrono::duration_cast<Clock::Milliseconds32>(sleepTime).count();
+        sleepTimeMs          = std::min(sleepTimeMs, static_cast<uint32_t>(std::numeric_limits<int>::max()));
+        mEpollTimeoutMs      = static_cast<int>(sleepTimeMs);
+    }
+}
+
+void LayerImplEpoll::WaitForEvents()
+{
+    mEpollResult = epoll_wait(mEpollFd, mEpollEvents, kEpollMaxEvents, mEpollTimeoutMs);
+}
+
+void LayerImplEpoll::HandleEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    if (!IsSelectResultValid())
+    {
+        if (errno != EINTR)
+        {
+            ChipLogError(DeviceLayer, "epoll_wait failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+        }
+        mEpollResult = 0;
+        return;
+    }
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = pthread_self();
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    // Obtain the list of currently expired timers. Any new timers added by timer callback are NOT handled on this pass,
+    // since that could result in infinite handling of new timers blocking any other progress.
+    VerifyOrDieWithMsg(mExpiredTimers.Empty(), DeviceLayer, "Re-entry into HandleEvents from a timer callback?");
+    mExpiredTimers          = mTimerList.ExtractEarlier(Clock::Timeout(1) + SystemClock().GetMonotonicTimestamp());
+    TimerList::Node * timer = nullptr;
+    while ((timer = mExpiredTimers.PopEarliest()) != nullptr)
+    {
+        mTimerPool.Invoke(timer);
+    }
+
+    for (int i = 0; i < mEpollResult; i++)
+    {
+        const epoll_event & event = mEpollEvents[i];
+        if (event.data.ptr == nullptr)
+        {
+            // The timerfd expired; timers were already handled above, so just consume the expiration count.
+            uint64_t expirations;
+            (void) read(mTimerFd, &expirations, sizeof(expirations));
+            continue;
+        }
+        if (event.events == 0)
+        {
+            // The watch was stopped by an earlier callback in this batch.
+            continue;
+        }
+
+        SocketWatch * watch = static_cast<SocketWatch *>(event.data.ptr);
+        SocketEvents events = SocketEventsFromEpoll(*watch, event.events);
+        if (events.HasAny() && watch->mCallback != nullptr)
+        {
+            watch->mCallback(events, watch->mCallbackData);
+        }
+    }
+    mEpollResult = 0;
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+}
+
+} // namespace System
+} // namespace chip
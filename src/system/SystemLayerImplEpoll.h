@@ -0,0 +1,139 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares an implementation of System::Layer using Linux epoll() and timerfd.
+ */
+
+#pragma once
+
+#include <sys/epoll.h>
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#include <atomic>
+#include <pthread.h>
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+#include <lib/support/ObjectLifeCycle.h>
+#include <lib/support/Pool.h>
+#include <system/SystemLayer.h>
+#include <system/SystemTimer.h>
+#include <system/WakeEvent.h>
+
+namespace chip {
+namespace System {
+
+/**
+ * System::Layer implementation for Linux hosts that watch many sockets.
+ *
+ * Unlike LayerImplSelect, socket interest is registered with the kernel once, when it changes, rather than rebuilt on
+ * every loop iteration, so the cost of a wakeup is proportional to the number of ready sockets instead of the number of
+ * watched sockets. Watches are level-triggered, which preserves the select() semantics that endpoints rely on (a callback
+ * that leaves data unread is invoked again on the next iteration). The earliest pending timer is programmed into a
+ * timerfd that is itself watched by the epoll instance.
+ */
+class LayerImplEpoll : public LayerSocketsLoop
+{
+public:
+    LayerImplEpoll() = default;
+    ~LayerImplEpoll() override { VerifyOrDie(mLayerState.Destroy()); }
+
+    // Layer overrides.
+    CHIP_ERROR Init() override;
+    void Shutdown() override;
+    bool IsInitialized() const override { return mLayerState.IsInitialized(); }
+    CHIP_ERROR StartTimer(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState) override;
+    void CancelTimer(TimerCompleteCallback onComplete, void * appState) override;
+    CHIP_ERROR ScheduleWork(TimerCompleteCallback onComplete, void * appState) override;
+
+    // LayerSocket overrides.
+    CHIP_ERROR StartWatchingSocket(int fd, SocketWatchToken * tokenOut) override;
+    CHIP_ERROR SetCallback(SocketWatchToken token, SocketWatchCallback callback, intptr_t data) override;
+    CHIP_ERROR RequestCallbackOnPendingRead(SocketWatchToken token) override;
+    CHIP_ERROR RequestCallbackOnPendingWrite(SocketWatchToken token) override;
+    CHIP_ERROR ClearCallbackOnPendingRead(SocketWatchToken token) override;
+    CHIP_ERROR ClearCallbackOnPendingWrite(SocketWatchToken token) override;
+    CHIP_ERROR StopWatchingSocket(SocketWatchToken * tokenInOut) override;
+    SocketWatchToken InvalidSocketWatchToken() override { return reinterpret_cast<SocketWatchToken>(nullptr); }
+
+    // LayerSocketLoop overrides.
+    void Signal() override;
+    void EventLoopBegins() override {}
+    void PrepareEvents() override;
+    void WaitForEvents() override;
+    void HandleEvents() override;
+    void EventLoopEnds() override {}
+
+    // Expose the result of WaitForEvents() for non-blocking socket implementations.
+    bool IsSelectResultValid() const { return mEpollResult >= 0; }
+
+protected:
+    static constexpr int kSocketWatchMax = (INET_CONFIG_ENABLE_TCP_ENDPOINT ? INET_CONFIG_NUM_TCP_ENDPOINTS : 0) +
+        (INET_CONFIG_ENABLE_UDP_ENDPOINT ? INET_CONFIG_NUM_UDP_ENDPOINTS : 0) + 1 /* wake event */;
+
+    // Maximum number of ready descriptors retrieved by a single epoll_wait(); any remaining ones are reported on the
+    // next loop iteration.
+    static constexpr int kEpollMaxEvents = 64;
+
+    struct SocketWatch
+    {
+        SocketWatch(int fd) : mFD(fd) {}
+        static uint32_t EpollEventsFor(SocketEvents pendingIO);
+
+        int mFD;
+        SocketEvents mPendingIO;
+        SocketWatchCallback mCallback = nullptr;
+        intptr_t mCallbackData        = 0;
+        // Events currently registered with the epoll instance; zero when the descriptor is not in the interest list.
+        uint32_t mEpollEvents = 0;
+    };
+
+    CHIP_ERROR UpdateInterest(SocketWatch & watch);
+    static SocketEvents SocketEventsFromEpoll(const SocketWatch & watch, uint32_t epollEvents);
+
+    // Under CHIP_SYSTEM_CONFIG_POOL_USE_HEAP the number of watched sockets is only bounded by available memory.
+    ObjectPool<SocketWatch, kSocketWatchMax> mSocketWatchPool;
+
+    TimerPool<TimerList::Node> mTimerPool;
+    TimerQueue mTimerList;
+    // List of expired timers being processed right now.  Stored in a member so
+    // we can cancel them.
+    TimerList mExpiredTimers;
+
+    int mEpollFd = kInvalidFd;
+    int mTimerFd = kInvalidFd;
+    // Timeout passed to epoll_wait(): zero when a timer is already due, otherwise -1 with the timerfd armed.
+    int mEpollTimeoutMs;
+
+    // Ready events, carried between WaitForEvents() and HandleEvents().
+    epoll_event mEpollEvents[kEpollMaxEvents];
+    // Return value from epoll_wait(), carried between WaitForEvents() and HandleEvents().
+    int mEpollResult = 0;
+
+    ObjectLifeCycle mLayerState;
+    WakeEvent mWakeEvent;
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    std::atomic<pthread_t> mHandleSelectThread;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+};
+
+using LayerImpl = LayerImplEpoll;
+
+} // namespace System
+} // namespace chip
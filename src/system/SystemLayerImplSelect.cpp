@@ -27,6 +27,7 @@
 #include <system/SystemFaultInjection.h>
 #include <system/SystemLayer.h>
 #include <system/SystemLayerImplSelect.h>
+#include <system/SystemPacketBuffer.h>
 
 #include <errno.h>
 
@@ -90,6 +91,10 @@ void LayerImplSelect::Shutdown()
 
     mWakeEvent.Close(*this);
 
+    // Buffers cached by the event loop thread would otherwise only be released when it exits, which may be after the heap has
+    // been shut down.
+    PacketBuffer::ReleaseCachedBuffers();
+
     mLayerState.ResetFromShuttingDown(); // Return to uninitialized state to permit re-initialization.
 }
 
@@ -62,6 +62,11 @@
 #include <lib/support/CHIPMem.h>
 #endif
 
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+#include <algorithm>
+#include <new>
+#endif
+
 namespace chip {
 namespace System {
 
@@ -126,6 +131,185 @@ void PacketBuffer::InternalCheck(const PacketBuffer * buffer)
 }
 #endif // CHIP_SYSTEM_PACKETBUFFER_HAS_CHECK
 
+namespace {
+
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+
+// Capacities of the heap buffer size classes: small buffers (acknowledgements, status responses, short commands), buffers
+// holding a full IPv6-MTU message, and maximum-sized buffers. Every heap buffer is allocated with one of these sizes.
+constexpr uint16_t kSizeClassCapacities[] = {
+    std::min<uint16_t>(256, PacketBuffer::kMaxSizeWithoutReserve),
+    std::min<uint16_t>(1280, PacketBuffer::kMaxSizeWithoutReserve),
+    PacketBuffer::kMaxSizeWithoutReserve,
+};
+constexpr size_t kNumSizeClasses = ArraySize(kSizeClassCapacities);
+
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+constexpr int kSizeClassStatistics[kNumSizeClasses] = {
+    chip::System::Stats::kSystemLayer_NumSmallPacketBufs,
+    chip::System::Stats::kSystemLayer_NumMtuPacketBufs,
+    chip::System::Stats::kSystemLayer_NumLargePacketBufs,
+};
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+
+// Returns the smallest size class able to hold aAllocSize bytes, or kNumSizeClasses if there is none.
+size_t SizeClassFor(size_t aAllocSize)
+{
+    size_t sizeClass = 0;
+    while (sizeClass < kNumSizeClasses && kSizeClassCapacities[sizeClass] < aAllocSize)
+    {
+        sizeClass++;
+    }
+    return sizeClass;
+}
+
+// Returns the size class a buffer of capacity aAllocSize was allocated from, or kNumSizeClasses if it was not allocated by
+// PacketBuffer::AllocateFromHeap() (e.g. a buffer adopted from elsewhere).
+size_t SizeClassOf(size_t aAllocSize)
+{
+    const size_t sizeClass = SizeClassFor(aAllocSize);
+    return (sizeClass < kNumSizeClasses && kSizeClassCapacities[sizeClass] == aAllocSize) ? sizeClass : kNumSizeClasses;
+}
+
+/**
+ * Per-thread free lists of heap packet buffer blocks, one per size class.
+ *
+ * Each thread only touches its own lists, so no locking is needed; a buffer freed on a different thread than the one that
+ * allocated it simply moves to the freeing thread's lists. Each list is bounded by
+ * CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASS_CACHE_SIZE so that the memory held after a burst of traffic is returned to
+ * the heap, and all cached blocks are released when the thread exits.
+ */
+class SizeClassFreeLists
+{
+public:
+    ~SizeClassFreeLists() { Release(); }
+
+    void Release()
+    {
+        for (size_t sizeClass = 0; sizeClass < kNumSizeClasses; sizeClass++)
+        {
+            for (void * block = Take(sizeClass); block != nullptr; block = Take(sizeClass))
+            {
+                chip::Platform::MemoryFree(block);
+            }
+        }
+    }
+
+    void * Take(size_t aSizeClass)
+    {
+        FreeBlock * block = mHeads[aSizeClass];
+        if (block != nullptr)
+        {
+            mHeads[aSizeClass] = block->mNext;
+            mCounts[aSizeClass]--;
+            SYSTEM_STATS_DECREMENT(chip::System::Stats::kSystemLayer_NumCachedPacketBufs);
+        }
+        return block;
+    }
+
+    bool Give(size_t aSizeClass, void * aBlock)
+    {
+        VerifyOrReturnValue(mCounts[aSizeClass] < CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASS_CACHE_SIZE, false);
+
+        mHeads[aSizeClass] = new (aBlock) FreeBlock{ mHeads[aSizeClass] };
+        mCounts[aSizeClass]++;
+        SYSTEM_STATS_INCREMENT(chip::System::Stats::kSystemLayer_NumCachedPacketBufs);
+        return true;
+    }
+
+private:
+    struct FreeBlock
+    {
+        FreeBlock * mNext;
+    };
+
+    FreeBlock * mHeads[kNumSizeClasses] = {};
+    size_t mCounts[kNumSizeClasses]     = {};
+};
+
+thread_local SizeClassFreeLists sFreeLists;
+
+#endif // CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+
+// Returns the buffer capacity PacketBuffer::AllocateFromHeap() provides for a request of aAllocSize bytes.
+size_t HeapAllocationSize(size_t aAllocSize)
+{
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+    const size_t sizeClass = SizeClassFor(aAllocSize);
+    return (sizeClass < kNumSizeClasses) ? kSizeClassCapacities[sizeClass] : aAllocSize;
+#else
+    return aAllocSize;
+#endif
+}
+
+} // namespace
+
+PacketBuffer * PacketBuffer::AllocateFromHeap(size_t aAllocSize)
+{
+    const size_t allocSize = HeapAllocationSize(aAllocSize);
+    void * block           = nullptr;
+
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+    const size_t sizeClass = SizeClassOf(allocSize);
+    if (sizeClass < kNumSizeClasses)
+    {
+        block = sFreeLists.Take(sizeClass);
+    }
+#endif // CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+
+    if (block == nullptr)
+    {
+        block = chip::Platform::MemoryAlloc(kStructureSize + allocSize);
+        VerifyOrReturnValue(block != nullptr, nullptr);
+    }
+
+    PacketBuffer * packet = reinterpret_cast<PacketBuffer *>(block);
+    packet->alloc_size    = static_cast<uint16_t>(allocSize);
+
+    SYSTEM_STATS_INCREMENT(chip::System::Stats::kSystemLayer_NumPacketBufs);
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES && CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    if (sizeClass < kNumSizeClasses)
+    {
+        SYSTEM_STATS_INCREMENT(kSizeClassStatistics[sizeClass]);
+    }
+#endif
+    return packet;
+}
+
+void PacketBuffer::FreeToHeap(PacketBuffer * aPacket)
+{
+    ::chip::Platform::MemoryDebugCheckPointer(aPacket, aPacket->alloc_size + kStructureSize);
+
+    SYSTEM_STATS_DECREMENT(chip::System::Stats::kSystemLayer_NumPacketBufs);
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+    const size_t sizeClass = SizeClassOf(aPacket->alloc_size);
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    if (sizeClass < kNumSizeClasses)
+    {
+        SYSTEM_STATS_DECREMENT(kSizeClassStatistics[sizeClass]);
+    }
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+#endif // CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+
+    aPacket->Clear();
+
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+    if (sizeClass < kNumSizeClasses && sFreeLists.Give(sizeClass, aPacket))
+    {
+        return;
+    }
+#endif // CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+
+    chip::Platform::MemoryFree(aPacket);
+}
+
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+void PacketBuffer::InternalReleaseCachedBuffers()
+{
+    sFreeLists.Release();
+}
+#endif // CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+
 // Number of unused bytes below which \c RightSize() won't bother reallocating.
 constexpr uint16_t kRightSizingThreshold = 16;
 
@@ -141,13 +325,12 @@ void PacketBufferHandle::InternalRightSize()
     const uint8_t * const start   = mBuffer->ReserveStart();
     const uint8_t * const payload = mBuffer->Start();
     const uint16_t usedSize       = static_cast<uint16_t>(payload - start + mBuffer->len);
-    if (usedSize + kRightSizingThreshold > mBuffer->alloc_size)
+    if (HeapAllocationSize(usedSize) + kRightSizingThreshold > mBuffer->alloc_size)
     {
         return;
     }
 
-    const size_t blockSize   = usedSize + PacketBuffer::kStructureSize;
-    PacketBuffer * newBuffer = reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(blockSize));
+    PacketBuffer * newBuffer = PacketBuffer::AllocateFromHeap(usedSize);
     if (newBuffer == nullptr)
     {
         ChipLogError(chipSystemLayer, "PacketBuffer: pool EMPTY.");
@@ -160,7 +343,6 @@ void PacketBufferHandle::InternalRightSize()
     newBuffer->tot_len       = mBuffer->tot_len;
     newBuffer->len           = mBuffer->len;
     newBuffer->ref           = 1;
-    newBuffer->alloc_size    = static_cast<uint16_t>(usedSize);
     memcpy(newStart, start, usedSize);
 
     PacketBuffer::Free(mBuffer);
@@ -527,8 +709,7 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
 
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
 
-    lPacket = reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(lBlockSize));
-    SYSTEM_STATS_INCREMENT(chip::System::Stats::kSystemLayer_NumPacketBufs);
+    lPacket = PacketBuffer::AllocateFromHeap(lAllocSize);
 
 #else
 #error "Unimplemented PacketBuffer storage case"
@@ -544,9 +725,6 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
     lPacket->len = lPacket->tot_len = 0;
     lPacket->next                   = nullptr;
     lPacket->ref                    = 1;
-#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
-    lPacket->alloc_size = static_cast<uint16_t>(lAllocSize);
-#endif
 
     return PacketBufferHandle(lPacket);
 }
@@ -603,18 +781,15 @@ void PacketBuffer::Free(PacketBuffer * aPacket)
         aPacket->ref--;
         if (aPacket->ref == 0)
         {
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL
             SYSTEM_STATS_DECREMENT(chip::System::Stats::kSystemLayer_NumPacketBufs);
-#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
-            ::chip::Platform::MemoryDebugCheckPointer(aPacket, aPacket->alloc_size + kStructureSize);
-#endif
             aPacket->Clear();
-#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL
             aPacket->next = sFreeList;
             sFreeList     = aPacket;
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
-            chip::Platform::MemoryFree(aPacket);
+            FreeToHeap(aPacket);
 #endif
-            aPacket       = lNextPacket;
+            aPacket = lNextPacket;
         }
         else
         {
@@ -332,6 +332,19 @@ public:
         return Read(buf, N);
     }
 
+    /**
+     * Return the packet buffers the calling thread keeps for reuse to the heap.
+     *
+     * Only does anything when #CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES is enabled. Threads release their cached buffers
+     * when they exit; a thread that outlives chip::Platform::MemoryShutdown() (e.g. the main thread) must call this first.
+     */
+    static void ReleaseCachedBuffers()
+    {
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+        InternalReleaseCachedBuffers();
+#endif
+    }
+
     /**
      * Perform an implementation-defined check on the validity of a PacketBuffer pointer.
      *
@@ -369,6 +382,15 @@ private:
     static PacketBuffer * BuildFreeList();
 #endif // CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL || defined(DOXYGEN)
 
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
+    static PacketBuffer * AllocateFromHeap(size_t aAllocSize);
+    static void FreeToHeap(PacketBuffer * aPacket);
+#endif // CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
+
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+    static void InternalReleaseCachedBuffers();
+#endif
+
 #if CHIP_SYSTEM_PACKETBUFFER_HAS_CHECK
     static void InternalCheck(const PacketBuffer * buffer);
 #endif
@@ -82,6 +82,17 @@
 #define CHIP_SYSTEM_PACKETBUFFER_FROM_LWIP_CUSTOM_POOL 0
 #endif
 
+/**
+ * CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+ *
+ * True if heap packet buffers are rounded up to size classes and recycled through per-thread free lists.
+ */
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP && CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES
+#define CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES 1
+#else
+#define CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES 0
+#endif
+
 /**
  * CHIP_SYSTEM_PACKETBUFFER_HAS_RIGHTSIZE
  *
@@ -44,6 +44,12 @@ static const Label sStatsStrings[chip::System::Stats::kNumEntries] = {
 #undef LWIP_PBUF_MEMPOOL
 #else
     "SystemLayer_NumPacketBufs",
+#endif
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+    "SystemLayer_NumSmallPacketBufs",
+    "SystemLayer_NumMtuPacketBufs",
+    "SystemLayer_NumLargePacketBufs",
+    "SystemLayer_NumCachedPacketBufs",
 #endif
     "SystemLayer_NumTimersInUse",
 #if INET_CONFIG_NUM_TCP_ENDPOINTS
@@ -32,6 +32,7 @@
 // Include configuration headers
 #include <inet/InetConfig.h>
 #include <lib/core/CHIPConfig.h>
+#include <system/SystemPacketBufferInternal.h>
 
 // Include dependent headers
 #include <lib/support/DLLUtil.h>
@@ -58,6 +59,12 @@ enum
 #undef LWIP_PBUF_MEMPOOL
 #else
     kSystemLayer_NumPacketBufs,
+#endif
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+    kSystemLayer_NumSmallPacketBufs,
+    kSystemLayer_NumMtuPacketBufs,
+    kSystemLayer_NumLargePacketBufs,
+    kSystemLayer_NumCachedPacketBufs,
 #endif
     kSystemLayer_NumTimers,
 #if INET_CONFIG_NUM_TCP_ENDPOINTS
@@ -160,5 +160,424 @@ TimerList TimerList::ExtractEarlier(Clock::Timestamp t)
     return out;
 }
 
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+
+void TimerWheel::Clear()
+{
+    mWheelTime = 0;
+    for (auto & occupied : mOccupied)
+    {
+        occupied = 0;
+    }
+    for (auto & level : mSlots)
+    {
+        for (auto & slot : level)
+        {
+            slot = nullptr;
+        }
+    }
+    for (auto & bucket : mIndex)
+    {
+        bucket = nullptr;
+    }
+    mOverdue       = nullptr;
+    mOverflow      = nullptr;
+    mCount         = 0;
+    mEarliestTimer = nullptr;
+}
+
+size_t TimerWheel::IndexBucket(TimerCompleteCallback onComplete, void * appState)
+{
+    // appState is usually an object pointer, so its low bits carry little information; fold in the callback and mix.
+    uint64_t hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(appState)) ^
+        (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(onComplete)) << 1);
+
+    // MurmurHash3 finalizer.
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    return static_cast<size_t>(hash % kIndexBuckets);
+}
+
+void TimerWheel::AddToIndex(Node * node)
+{
+    Node *& bucket     = mIndex[IndexBucket(node->GetCallback().GetOnComplete(), node->GetCallback().GetAppState())];
+    node->mPrevInIndex = nullptr;
+    node->mNextInIndex = bucket;
+    if (bucket != nullptr)
+    {
+        bucket->mPrevInIndex = node;
+    }
+    bucket = node;
+}
+
+void TimerWheel::RemoveFromIndex(Node * node)
+{
+    if (node->mPrevInIndex != nullptr)
+    {
+        node->mPrevInIndex->mNextInIndex = node->mNextInIndex;
+    }
+    else
+    {
+        mIndex[IndexBucket(node->GetCallback().GetOnComplete(), node->GetCallback().GetAppState())] = node->mNextInIndex;
+    }
+    if (node->mNextInIndex != nullptr)
+    {
+        node->mNextInIndex->mPrevInIndex = node->mPrevInIndex;
+    }
+    node->mNextInIndex = nullptr;
+    node->mPrevInIndex = nullptr;
+}
+
+/**
+ * Insert @a node into the circular list headed by @a slot, before @a before (or at the tail if @a before is nullptr).
+ */
+void TimerWheel::Link(Node ** slot, Node * before, Node * node)
+{
+    Node * head = *slot;
+    if (head == nullptr)
+    {
+        node->mNextTimer = node;
+        node->mPrevTimer = node;
+        *slot            = node;
+
+        const size_t position = static_cast<size_t>(slot - &mSlots[0][0]);
+        if (position < kLevels * kSlots)
+        {
+            mOccupied[position / kSlots] |= (static_cast<uint64_t>(1) << (position % kSlots));
+        }
+    }
+    else
+    {
+        Node * next                  = (before != nullptr) ? before : head;
+        node->mNextTimer             = next;
+        node->mPrevTimer             = next->mPrevTimer;
+        next->mPrevTimer->mNextTimer = node;
+        next->mPrevTimer             = node;
+        if (before == head)
+        {
+            *slot = node;
+        }
+    }
+    node->mWheelSlot = slot;
+}
+
+void TimerWheel::Unlink(Node * node)
+{
+    Node ** slot = node->mWheelSlot;
+    if (node->mNextTimer == node)
+    {
+        *slot = nullptr;
+
+        const size_t position = static_cast<size_t>(slot - &mSlots[0][0]);
+        if (position < kLevels * kSlots)
+        {
+            mOccupied[position / kSlots] &= ~(static_cast<uint64_t>(1) << (position % kSlots));
+        }
+    }
+    else
+    {
+        node->mPrevTimer->mNextTimer = node->mNextTimer;
+        node->mNextTimer->mPrevTimer = node->mPrevTimer;
+        if (*slot == node)
+        {
+            *slot = node->mNextTimer;
+        }
+    }
+    node->mNextTimer = nullptr;
+    node->mPrevTimer = nullptr;
+    node->mWheelSlot = nullptr;
+}
+
+/**
+ * Put @a node in the slot matching its expiration time relative to the current wheel time.
+ */
+void TimerWheel::Place(Node * node)
+{
+    const uint64_t t = Time(node);
+
+    if (t < mWheelTime)
+    {
+        // Overdue timers are rare and usually added in expiration order, so search for the insertion point from the tail.
+        Node * before = nullptr;
+        if (mOverdue != nullptr)
+        {
+            Node * last = mOverdue->mPrevTimer;
+            while (t < Time(last))
+            {
+                before = last;
+                if (last == mOverdue)
+                {
+                    break;
+                }
+                last = last->mPrevTimer;
+            }
+        }
+        Link(&mOverdue, before, node);
+        return;
+    }
+
+    // The right level is the lowest one whose slots, anchored at the wheel time, span the expiration time.
+    for (unsigned level = 0; level < kLevels; level++)
+    {
+        const unsigned shift = kSlotBits * level;
+        if ((t >> (shift + kSlotBits)) == (mWheelTime >> (shift + kSlotBits)))
+        {
+            Link(&mSlots[level][(t >> shift) & (kSlots - 1)], nullptr, node);
+            return;
+        }
+    }
+    Link(&mOverflow, nullptr, node);
+}
+
+/**
+ * Advance the wheel time to @a now, cascading the timers of every slot that now contains the wheel time into lower levels.
+ *
+ * All timers in the wheel (apart from overdue ones) must expire at or after @a now.
+ */
+void TimerWheel::SetWheelTime(uint64_t now)
+{
+    const uint64_t previous = mWheelTime;
+    mWheelTime              = now;
+
+    if ((previous >> (kSlotBits * kLevels)) != (now >> (kSlotBits * kLevels)))
+    {
+        Node * overflow = mOverflow;
+        mOverflow       = nullptr;
+        while (overflow != nullptr)
+        {
+            Node * node                  = overflow;
+            overflow                     = (node->mNextTimer == node) ? nullptr : node->mNextTimer;
+            node->mPrevTimer->mNextTimer = node->mNextTimer;
+            node->mNextTimer->mPrevTimer = node->mPrevTimer;
+            Place(node);
+        }
+    }
+
+    // Cascade from the top so that timers landing in a lower slot that also contains the wheel time move on down.
+    for (unsigned level = kLevels - 1; level > 0; level--)
+    {
+        const unsigned index = static_cast<unsigned>((now >> (kSlotBits * level)) & (kSlots - 1));
+        if ((mOccupied[level] & (static_cast<uint64_t>(1) << index)) == 0)
+        {
+            continue;
+        }
+
+        Node * node = mSlots[level][index];
+        while (node != nullptr)
+        {
+            Node * next = (node->mNextTimer == node) ? nullptr : node->mNextTimer;
+            Unlink(node);
+            Place(node);
+            node = next;
+        }
+    }
+}
+
+TimerWheel::Node * TimerWheel::FindEarliest() const
+{
+    if (mOverdue != nullptr)
+    {
+        return mOverdue;
+    }
+
+    // Lower levels only hold earlier timers, and within a level slot order is time order.
+    Node * slot = mOverflow;
+    for (unsigned level = 0; level < kLevels; level++)
+    {
+        if (mOccupied[level] != 0)
+        {
+            unsigned index = 0;
+            while ((mOccupied[level] & (static_cast<uint64_t>(1) << index)) == 0)
+            {
+                index++;
+            }
+            slot = mSlots[level][index];
+            if (level == 0)
+            {
+                // All timers in a level 0 slot expire in the same millisecond.
+                return slot;
+            }
+            break;
+        }
+    }
+
+    Node * earliest = slot;
+    if (slot != nullptr)
+    {
+        for (Node * node = slot->mNextTimer; node != slot; node = node->mNextTimer)
+        {
+            if (node->AwakenTime() < earliest->AwakenTime())
+            {
+                earliest = node;
+            }
+        }
+    }
+    return earliest;
+}
+
+TimerWheel::Node * TimerWheel::Earliest() const
+{
+    if (mEarliestTimer == nullptr && mCount != 0)
+    {
+        mEarliestTimer = FindEarliest();
+    }
+    return mEarliestTimer;
+}
+
+TimerWheel::Node * TimerWheel::Add(Node * add)
+{
+    VerifyOrDie(add->mWheelSlot == nullptr);
+
+    Node * earliest = Earliest();
+
+    Place(add);
+    AddToIndex(add);
+    mCount++;
+
+    if (earliest == nullptr || add->AwakenTime() < earliest->AwakenTime())
+    {
+        mEarliestTimer = add;
+    }
+    return mEarliestTimer;
+}
+
+TimerWheel::Node * TimerWheel::Remove(Node * remove)
+{
+    if (remove != nullptr && remove->mWheelSlot != nullptr)
+    {
+        Unlink(remove);
+        RemoveFromIndex(remove);
+        mCount--;
+        if (remove == mEarliestTimer)
+        {
+            mEarliestTimer = nullptr;
+        }
+    }
+    return Earliest();
+}
+
+TimerWheel::Node * TimerWheel::Remove(TimerCompleteCallback aOnComplete, void * aAppState)
+{
+    // Chains are in reverse insertion order, so the last of several equally early matches is the one added first.
+    Node * found = nullptr;
+    for (Node * timer = mIndex[IndexBucket(aOnComplete, aAppState)]; timer != nullptr; timer = timer->mNextInIndex)
+    {
+        if (timer->GetCallback().GetOnComplete() == aOnComplete && timer->GetCallback().GetAppState() == aAppState &&
+            (found == nullptr || !(found->AwakenTime() < timer->AwakenTime())))
+        {
+            found = timer;
+        }
+    }
+    if (found != nullptr)
+    {
+        Remove(found);
+    }
+    return found;
+}
+
+TimerWheel::Node * TimerWheel::PopEarliest()
+{
+    Node * earliest = Earliest();
+    if (earliest != nullptr)
+    {
+        Remove(earliest);
+    }
+    return earliest;
+}
+
+TimerWheel::Node * TimerWheel::PopIfEarlier(Clock::Timestamp t)
+{
+    Node * earliest = Earliest();
+    if ((earliest == nullptr) || !(earliest->AwakenTime() < t))
+    {
+        return nullptr;
+    }
+    Remove(earliest);
+    return earliest;
+}
+
+TimerList TimerWheel::ExtractEarlier(Clock::Timestamp t)
+{
+    const uint64_t end = static_cast<uint64_t>(t.count());
+    Node * head        = nullptr;
+    Node * tail        = nullptr;
+
+    auto extract = [&](Node * node) {
+        Unlink(node);
+        RemoveFromIndex(node);
+        mCount--;
+        if (tail == nullptr)
+        {
+            head = node;
+        }
+        else
+        {
+            tail->mNextTimer = node;
+        }
+        tail = node;
+    };
+
+    while (mOverdue != nullptr && Time(mOverdue) < end)
+    {
+        extract(mOverdue);
+    }
+
+    while (mWheelTime < end)
+    {
+        unsigned level = 0;
+        while (level < kLevels && mOccupied[level] == 0)
+        {
+            level++;
+        }
+
+        uint64_t next;
+        if (level < kLevels)
+        {
+            unsigned index = 0;
+            while ((mOccupied[level] & (static_cast<uint64_t>(1) << index)) == 0)
+            {
+                index++;
+            }
+            const unsigned shift = kSlotBits * level;
+            const uint64_t base  = (mWheelTime >> (shift + kSlotBits)) << (shift + kSlotBits);
+            next                 = base | (static_cast<uint64_t>(index) << shift);
+        }
+        else if (mOverflow != nullptr)
+        {
+            next = ((mWheelTime >> (kSlotBits * kLevels)) + 1) << (kSlotBits * kLevels);
+        }
+        else
+        {
+            next = end;
+        }
+
+        if (next >= end)
+        {
+            SetWheelTime(end);
+            break;
+        }
+
+        SetWheelTime(next);
+        if (level == 0)
+        {
+            Node ** slot = &mSlots[0][next & (kSlots - 1)];
+            while (*slot != nullptr)
+            {
+                extract(*slot);
+            }
+        }
+    }
+
+    if (tail != nullptr)
+    {
+        tail->mNextTimer = nullptr;
+        mEarliestTimer   = nullptr;
+    }
+    return TimerList(head);
+}
+
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+
 } // namespace System
 } // namespace chip
@@ -45,6 +45,9 @@ namespace System {
 
 class Layer;
 class TestTimer;
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+class TimerWheel;
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
 
 /**
  * Basic Timer information: time and callback.
@@ -111,6 +114,15 @@ public:
             TimerData(systemLayer, awakenTime, onComplete, appState), mNextTimer(nullptr)
         {}
         Node * mNextTimer;
+
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+    private:
+        friend class TimerWheel;
+        Node * mPrevTimer   = nullptr; // Previous node in a (circular) TimerWheel slot.
+        Node ** mWheelSlot  = nullptr; // Head of the TimerWheel slot holding this node, or nullptr if not in a wheel.
+        Node * mNextInIndex = nullptr; // Next node in the TimerWheel (callback, appState) index chain.
+        Node * mPrevInIndex = nullptr; // Previous node in the TimerWheel (callback, appState) index chain.
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
     };
 
     TimerList() : mEarliestTimer(nullptr) {}
@@ -174,9 +186,137 @@ public:
     void Clear() { mEarliestTimer = nullptr; }
 
 private:
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+    friend class TimerWheel;
+    explicit TimerList(Node * earliest) : mEarliestTimer(earliest) {}
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+
     Node * mEarliestTimer;
 };
 
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+
+/**
+ * Hierarchical timer wheel holding `TimerList::Node`s, with the same interface as `TimerList`.
+ *
+ * Level 0 has one slot per millisecond, and each further level has slots spanning a whole lower level. A timer is kept
+ * in the lowest level whose current span contains its expiration time, and moves down a level (cascades) when the wheel
+ * time reaches its slot, so each timer is touched at most `kLevels` times however long it waits. An intrusive hash index
+ * on (callback, appState) makes `Remove(onComplete, appState)` independent of the number of timers.
+ *
+ * The wheel time only advances in `ExtractEarlier()`. Timers added with an expiration time before the wheel time (e.g.
+ * `ScheduleWork()` from a timer callback) are kept in a short sorted list that is always drained first. Expired timers
+ * are returned as a `TimerList` in expiration order, with ties in insertion order, exactly as `TimerList` would.
+ */
+class TimerWheel
+{
+public:
+    using Node = TimerList::Node;
+
+    TimerWheel() { Clear(); }
+
+    /**
+     * Add a timer to the wheel
+     *
+     * @return  The new earliest timer in the wheel. If this is the newly added timer, that implies it is earlier
+     *          than any existing timer.
+     */
+    Node * Add(Node * timer);
+
+    /**
+     * Remove the given timer from the wheel, if present. It is not an error for the timer not to be present.
+     *
+     * @return  The new earliest timer in the wheel, or nullptr if the wheel is empty.
+     */
+    Node * Remove(Node * remove);
+
+    /**
+     * Remove the earliest timer with the given properties, if present. It is not an error for no such timer to be present.
+     *
+     * @return  The removed timer, or nullptr if the wheel contains no matching timer.
+     */
+    Node * Remove(TimerCompleteCallback onComplete, void * appState);
+
+    /**
+     * Remove and return the earliest timer in the wheel.
+     *
+     * @return  The earliest timer, or nullptr if the wheel is empty.
+     */
+    Node * PopEarliest();
+
+    /**
+     * Remove and return the earliest timer in the wheel, provided it expires earlier than the given time @a t.
+     *
+     * @return  The earliest timer expiring before @a t, or nullptr if there is no such timer.
+     */
+    Node * PopIfEarlier(Clock::Timestamp t);
+
+    /**
+     * Get the earliest timer in the wheel.
+     *
+     * @return  The earliest timer, or nullptr if there are no timers.
+     */
+    Node * Earliest() const;
+
+    /**
+     * Test whether there are any timers.
+     */
+    bool Empty() const { return mCount == 0; }
+
+    /**
+     * Remove and return all timers that expire before the given time @a t, ordered by expiration time.
+     */
+    TimerList ExtractEarlier(Clock::Timestamp t);
+
+    /**
+     * Remove all timers.
+     */
+    void Clear();
+
+private:
+    friend class TestTimer;
+
+    static constexpr unsigned kSlotBits   = 6;
+    static constexpr unsigned kSlots      = 1u << kSlotBits;
+    static constexpr unsigned kLevels     = 6; // Spans 2^36 ms (about 795 days) before falling back to mOverflow.
+    static constexpr size_t kIndexBuckets = CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_BUCKETS;
+
+    static uint64_t Time(const Node * node) { return static_cast<uint64_t>(node->AwakenTime().count()); }
+    static size_t IndexBucket(TimerCompleteCallback onComplete, void * appState);
+
+    void Place(Node * node);
+    void Link(Node ** slot, Node * after, Node * node);
+    void Unlink(Node * node);
+    void AddToIndex(Node * node);
+    void RemoveFromIndex(Node * node);
+    void SetWheelTime(uint64_t now);
+    Node * FindEarliest() const;
+
+    // Current wheel time [ms]; all timers in mSlots and mOverflow expire at or after it.
+    uint64_t mWheelTime;
+    // Bitmap of non-empty slots per level.
+    uint64_t mOccupied[kLevels];
+    // Circular lists of timers, in insertion order.
+    Node * mSlots[kLevels][kSlots];
+    // Circular list of timers expiring before mWheelTime, in expiration order.
+    Node * mOverdue;
+    // Circular list of timers beyond the span of the top level.
+    Node * mOverflow;
+    // Hash chains keyed by (callback, appState).
+    Node * mIndex[kIndexBuckets];
+    size_t mCount;
+    // Cached result of Earliest(), or nullptr if it must be recomputed.
+    mutable Node * mEarliestTimer;
+};
+
+using TimerQueue = TimerWheel;
+
+#else // CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+
+using TimerQueue = TimerList;
+
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+
 /**
  * ObjectPool wrapper that keeps System Timer statistics.
  */
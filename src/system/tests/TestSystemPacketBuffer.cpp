@@ -39,7 +39,9 @@
 #include <lib/support/UnitTestContext.h>
 #include <lib/support/UnitTestRegistration.h>
 #include <platform/CHIPDeviceLayer.h>
+#include <system/SystemClock.h>
 #include <system/SystemPacketBuffer.h>
+#include <system/SystemStats.h>
 
 #if CHIP_SYSTEM_CONFIG_USE_LWIP
 #include <lwip/init.h>
@@ -133,6 +135,8 @@ public:
     static void CheckHandleRightSize(nlTestSuite * inSuite, void * inContext);
     static void CheckHandleCloneData(nlTestSuite * inSuite, void * inContext);
     static void CheckPacketBufferWriter(nlTestSuite * inSuite, void * inContext);
+    static void CheckSizeClasses(nlTestSuite * inSuite, void * inContext);
+    static void CheckAllocationBenchmark(nlTestSuite * inSuite, void * inContext);
     static void CheckBuildFreeList(nlTestSuite * inSuite, void * inContext);
 
     static void PrintHandle(const char * tag, const PacketBuffer * buffer)
@@ -1963,6 +1967,115 @@ void PacketBufferTest::CheckPacketBufferWriter(nlTestSuite * inSuite, void * inC
     NL_TEST_ASSERT(inSuite, memcmp(yayBuffer->Start(), kPayload, sizeof kPayload) == 0);
 }
 
+void PacketBufferTest::CheckSizeClasses(nlTestSuite * inSuite, void * inContext)
+{
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+    constexpr size_t kCacheSize = CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASS_CACHE_SIZE;
+
+    // Allocations are rounded up to the capacity of their size class.
+    PacketBufferHandle small = PacketBufferHandle::New(10, 0);
+    PacketBufferHandle mtu   = PacketBufferHandle::New(1000, 0);
+    PacketBufferHandle large = PacketBufferHandle::New(PacketBuffer::kMaxSizeWithoutReserve, 0);
+    NL_TEST_ASSERT(inSuite, !small.IsNull() && !mtu.IsNull() && !large.IsNull());
+    NL_TEST_ASSERT(inSuite, small->AllocSize() >= 10 && small->AllocSize() <= mtu->AllocSize());
+    NL_TEST_ASSERT(inSuite, mtu->AllocSize() >= 1000 && mtu->AllocSize() <= large->AllocSize());
+    NL_TEST_ASSERT(inSuite, large->AllocSize() == PacketBuffer::kMaxSizeWithoutReserve);
+
+    // RightSize() moves a mostly empty buffer to a smaller class.
+    large->SetDataLength(10);
+    large.RightSize();
+    NL_TEST_ASSERT(inSuite, large->AllocSize() < PacketBuffer::kMaxSizeWithoutReserve);
+    NL_TEST_ASSERT(inSuite, large->DataLength() == 10);
+
+    // Drain this thread's small buffers, then free them again: only kCacheSize of them are kept, and the most recently
+    // kept one is handed out first.
+    std::vector<PacketBufferHandle> burst;
+    for (size_t i = 0; i <= kCacheSize; i++)
+    {
+        burst.push_back(PacketBufferHandle::New(small->AllocSize(), 0));
+        NL_TEST_ASSERT(inSuite, !burst.back().IsNull() && burst.back()->AllocSize() == small->AllocSize());
+    }
+    const PacketBuffer * const lastCached = burst[kCacheSize - 1].mBuffer;
+
+    const chip::System::Stats::count_t cachedBefore =
+        chip::System::Stats::GetResourcesInUse()[chip::System::Stats::kSystemLayer_NumCachedPacketBufs];
+    for (auto & buffer : burst)
+    {
+        buffer = nullptr;
+    }
+    NL_TEST_ASSERT(inSuite,
+                   SYSTEM_STATS_TEST_IN_USE(chip::System::Stats::kSystemLayer_NumCachedPacketBufs,
+                                            static_cast<chip::System::Stats::count_t>(cachedBefore + kCacheSize)));
+    static_cast<void>(cachedBefore);
+
+    PacketBufferHandle reused = PacketBufferHandle::New(1, 0);
+    NL_TEST_ASSERT(inSuite, reused.mBuffer == lastCached);
+    NL_TEST_ASSERT(inSuite, reused->DataLength() == 0 && reused->ReservedSize() == 0);
+#endif // CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+}
+
+/**
+ *  Measure New()/Free() throughput for a report storm: bursts of MTU-sized reports interleaved with small acknowledgements,
+ *  all of which are in flight at once before being released. The same pattern is timed against plain heap allocations of
+ *  the same sizes for comparison.
+ */
+void PacketBufferTest::CheckAllocationBenchmark(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr size_t kStormSize = 48;
+    constexpr size_t kRounds    = 2000;
+    const size_t kSizes[]       = { 40, 1100, 60, 1100, 900 };
+
+    SYSTEM_STATS_RESET_HIGH_WATER_MARK_FOR_TESTING(chip::System::Stats::kSystemLayer_NumPacketBufs);
+
+    PacketBufferHandle buffers[kStormSize];
+    bool allocated = true;
+
+    chip::System::Clock::Microseconds64 start = chip::System::SystemClock().GetMonotonicMicroseconds64();
+    for (size_t round = 0; round < kRounds; round++)
+    {
+        for (size_t i = 0; i < kStormSize; i++)
+        {
+            buffers[i] = PacketBufferHandle::New(kSizes[(round + i) % ArraySize(kSizes)]);
+            allocated  = allocated && !buffers[i].IsNull();
+        }
+        for (auto & buffer : buffers)
+        {
+            buffer = nullptr;
+        }
+    }
+    chip::System::Clock::Microseconds64 done = chip::System::SystemClock().GetMonotonicMicroseconds64();
+    NL_TEST_ASSERT(inSuite, allocated);
+    const double packetBufferUs = static_cast<double>((done - start).count());
+
+    void * blocks[kStormSize];
+    start = chip::System::SystemClock().GetMonotonicMicroseconds64();
+    for (size_t round = 0; round < kRounds; round++)
+    {
+        for (size_t i = 0; i < kStormSize; i++)
+        {
+            blocks[i] = chip::Platform::MemoryAlloc(PacketBuffer::kStructureSize + PacketBuffer::kDefaultHeaderReserve +
+                                                    kSizes[(round + i) % ArraySize(kSizes)]);
+        }
+        for (void * block : blocks)
+        {
+            chip::Platform::MemoryFree(block);
+        }
+    }
+    done                 = chip::System::SystemClock().GetMonotonicMicroseconds64();
+    const double heapUs  = static_cast<double>((done - start).count());
+    const double divisor = static_cast<double>(kRounds * kStormSize);
+
+    printf("PacketBuffer New/Free: %6.3f us/buffer, plain heap: %6.3f us/buffer\n", packetBufferUs / divisor, heapUs / divisor);
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    printf("Peak packet buffers in use: %d\n",
+           chip::System::Stats::GetHighWatermarks()[chip::System::Stats::kSystemLayer_NumPacketBufs]);
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+    printf("Peak packet buffers cached: %d\n",
+           chip::System::Stats::GetHighWatermarks()[chip::System::Stats::kSystemLayer_NumCachedPacketBufs]);
+#endif // CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+}
+
 /**
  *   Test Suite. It lists all the test functions.
  */
@@ -2003,6 +2116,8 @@ const nlTest sTests[] =
     NL_TEST_DEF("PacketBuffer::HandleRightSize",        PacketBufferTest::CheckHandleRightSize),
     NL_TEST_DEF("PacketBuffer::HandleCloneData",        PacketBufferTest::CheckHandleCloneData),
     NL_TEST_DEF("PacketBuffer::PacketBufferWriter",     PacketBufferTest::CheckPacketBufferWriter),
+    NL_TEST_DEF("PacketBuffer::SizeClasses",            PacketBufferTest::CheckSizeClasses),
+    NL_TEST_DEF("PacketBuffer::AllocationBenchmark",    PacketBufferTest::CheckAllocationBenchmark),
 
     NL_TEST_SENTINEL()
 };
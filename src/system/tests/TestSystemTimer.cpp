@@ -29,6 +29,7 @@
 
 #include <system/SystemConfig.h>
 
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/ErrorStr.h>
 #include <lib/support/UnitTestContext.h>
@@ -439,6 +440,10 @@ class TestTimer
 {
 public:
     static void CheckTimerPool(nlTestSuite * inSuite, void * aContext);
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+    static void CheckTimerWheel(nlTestSuite * inSuite, void * aContext);
+    static void BenchmarkTimerQueues(nlTestSuite * inSuite, void * aContext);
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
 };
 } // namespace System
 } // namespace chip
@@ -580,6 +585,150 @@ void chip::System::TestTimer::CheckTimerPool(nlTestSuite * inSuite, void * aCont
     NL_TEST_ASSERT(suite, SYSTEM_STATS_TEST_HIGH_WATER_MARK(Stats::kSystemLayer_NumTimers, 4));
 }
 
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+
+void chip::System::TestTimer::CheckTimerWheel(nlTestSuite * inSuite, void * aContext)
+{
+    TestContext & testContext = *static_cast<TestContext *>(aContext);
+    Layer & systemLayer       = *testContext.mLayer;
+    nlTestSuite * const suite = testContext.mTestSuite;
+
+    using Timer = TimerWheel::Node;
+    struct TestState
+    {
+        static void A(Layer * layer, void * state) {}
+        static void B(Layer * layer, void * state) {}
+    };
+    int state[2];
+
+    using namespace Clock::Literals;
+    Timer t0(systemLayer, 111_ms, TestState::A, &state[0]);
+    Timer t1(systemLayer, 100_ms, TestState::A, &state[1]);
+    Timer t2(systemLayer, 70000_ms, TestState::B, &state[0]); // Starts above level 0.
+    Timer t3(systemLayer, 100_ms, TestState::B, &state[1]);   // Ties with t1.
+    Timer t4(systemLayer, 50_ms, TestState::B, &state[0]);    // Added after the wheel time passes it.
+
+    TimerWheel wheel;
+    NL_TEST_ASSERT(suite, wheel.Remove(nullptr) == nullptr);
+    NL_TEST_ASSERT(suite, wheel.Remove(nullptr, nullptr) == nullptr);
+    NL_TEST_ASSERT(suite, wheel.PopEarliest() == nullptr);
+    NL_TEST_ASSERT(suite, wheel.Earliest() == nullptr);
+    NL_TEST_ASSERT(suite, wheel.Empty());
+
+    NL_TEST_ASSERT(suite, wheel.Add(&t0) == &t0);
+    NL_TEST_ASSERT(suite, wheel.Add(&t1) == &t1);
+    NL_TEST_ASSERT(suite, wheel.Add(&t2) == &t1);
+    NL_TEST_ASSERT(suite, wheel.Add(&t3) == &t1);
+    NL_TEST_ASSERT(suite, wheel.mCount == 4);
+
+    // Nothing expires before 100 ms; ties expire in insertion order.
+    TimerList early = wheel.ExtractEarlier(100_ms);
+    NL_TEST_ASSERT(suite, early.Empty());
+    early = wheel.ExtractEarlier(101_ms);
+    NL_TEST_ASSERT(suite, early.PopEarliest() == &t1);
+    NL_TEST_ASSERT(suite, early.PopEarliest() == &t3);
+    NL_TEST_ASSERT(suite, early.PopEarliest() == nullptr);
+    NL_TEST_ASSERT(suite, wheel.Earliest() == &t0);
+
+    // A timer expiring before the wheel time is still the earliest and expires first.
+    NL_TEST_ASSERT(suite, wheel.Add(&t4) == &t4);
+    NL_TEST_ASSERT(suite, wheel.Remove(TestState::A, &state[0]) == &t0);
+    NL_TEST_ASSERT(suite, wheel.Remove(TestState::A, &state[0]) == nullptr);
+    NL_TEST_ASSERT(suite, wheel.PopIfEarlier(10_ms) == nullptr);
+    NL_TEST_ASSERT(suite, wheel.PopIfEarlier(60_ms) == &t4);
+
+    // Timers in higher levels cascade down as the wheel time advances.
+    early = wheel.ExtractEarlier(69999_ms);
+    NL_TEST_ASSERT(suite, early.Empty());
+    NL_TEST_ASSERT(suite, wheel.Earliest() == &t2);
+    early = wheel.ExtractEarlier(80000_ms);
+    NL_TEST_ASSERT(suite, early.PopEarliest() == &t2);
+    NL_TEST_ASSERT(suite, wheel.Empty());
+
+    wheel.Add(&t0);
+    wheel.Clear();
+    NL_TEST_ASSERT(suite, wheel.Empty());
+    NL_TEST_ASSERT(suite, wheel.Earliest() == nullptr);
+}
+
+namespace {
+
+// Start kBenchmarkTimers timers with pseudo-random delays of up to a minute, cancel every other one, and expire the rest
+// in 10 ms steps, as a System::Layer event loop would.
+template <class Queue>
+void RunTimerQueueBenchmark(nlTestSuite * suite, Layer & systemLayer, const char * name, uint64_t & checksum)
+{
+    static constexpr size_t kBenchmarkTimers = 10000;
+    struct Callback
+    {
+        static void Fire(Layer * layer, void * state) {}
+    };
+
+    auto * timers = static_cast<TimerList::Node *>(chip::Platform::MemoryCalloc(kBenchmarkTimers, sizeof(TimerList::Node)));
+    NL_TEST_ASSERT(suite, timers != nullptr);
+    if (timers == nullptr)
+    {
+        return;
+    }
+
+    Queue queue;
+    uint32_t seed = 12345;
+    checksum      = 0;
+
+    const Clock::Microseconds64 start = SystemClock().GetMonotonicMicroseconds64();
+    for (size_t i = 0; i < kBenchmarkTimers; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        new (&timers[i]) TimerList::Node(systemLayer, Clock::Milliseconds64(seed % 60000u), Callback::Fire, &timers[i]);
+        queue.Add(&timers[i]);
+    }
+    const Clock::Microseconds64 added = SystemClock().GetMonotonicMicroseconds64();
+    for (size_t i = 0; i < kBenchmarkTimers; i += 2)
+    {
+        NL_TEST_ASSERT(suite, queue.Remove(Callback::Fire, &timers[i]) == &timers[i]);
+    }
+    const Clock::Microseconds64 cancelled = SystemClock().GetMonotonicMicroseconds64();
+    size_t expired                        = 0;
+    for (uint64_t now = 0; !queue.Empty(); now += 10)
+    {
+        TimerList batch = queue.ExtractEarlier(Clock::Milliseconds64(now));
+        for (TimerList::Node * timer = batch.PopEarliest(); timer != nullptr; timer = batch.PopEarliest())
+        {
+            checksum = checksum * 31 + static_cast<uint64_t>(timer - timers);
+            expired++;
+        }
+    }
+    const Clock::Microseconds64 done = SystemClock().GetMonotonicMicroseconds64();
+    NL_TEST_ASSERT(suite, expired == kBenchmarkTimers / 2);
+
+    printf("%-10s %zu timers: start %6llu us, cancel %6llu us, expire %6llu us\n", name, kBenchmarkTimers,
+           static_cast<unsigned long long>((added - start).count()), static_cast<unsigned long long>((cancelled - added).count()),
+           static_cast<unsigned long long>((done - cancelled).count()));
+
+    for (size_t i = 0; i < kBenchmarkTimers; i++)
+    {
+        timers[i].~Node();
+    }
+    chip::Platform::MemoryFree(timers);
+}
+
+} // namespace
+
+void chip::System::TestTimer::BenchmarkTimerQueues(nlTestSuite * inSuite, void * aContext)
+{
+    TestContext & testContext = *static_cast<TestContext *>(aContext);
+
+    uint64_t listChecksum;
+    uint64_t wheelChecksum;
+    RunTimerQueueBenchmark<TimerList>(testContext.mTestSuite, *testContext.mLayer, "TimerList", listChecksum);
+    RunTimerQueueBenchmark<TimerWheel>(testContext.mTestSuite, *testContext.mLayer, "TimerWheel", wheelChecksum);
+
+    // Both implementations must expire the same timers in the same order.
+    NL_TEST_ASSERT(testContext.mTestSuite, listChecksum == wheelChecksum);
+}
+
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+
 // Test Suite
 
 /**
@@ -593,6 +742,10 @@ static const nlTest sTests[] =
     NL_TEST_DEF("Timer::TestTimerOrder",           CheckOrder),
     NL_TEST_DEF("Timer::TestTimerCancellation",    CheckCancellation),
     NL_TEST_DEF("Timer::TestTimerPool",            chip::System::TestTimer::CheckTimerPool),
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+    NL_TEST_DEF("Timer::TestTimerWheel",           chip::System::TestTimer::CheckTimerWheel),
+    NL_TEST_DEF("Timer::BenchmarkTimerQueues",     chip::System::TestTimer::BenchmarkTimerQueues),
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
     NL_TEST_DEF("Timer::TestCancelTimer",          CancelTimerTest::Test),
     NL_TEST_SENTINEL()
 };
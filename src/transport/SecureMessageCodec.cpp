@@ -54,11 +54,25 @@ CHIP_ERROR Encrypt(const CryptoContext & context, CryptoContext::ConstNonceView
     MessageAuthenticationCode mac;
     ReturnErrorOnFailure(context.Encrypt(data, totalLen, data, nonce, packetHeader, mac));
 
-    uint16_t taglen = 0;
-    ReturnErrorOnFailure(mac.Encode(packetHeader, &data[totalLen], msgBuf->AvailableDataLength(), &taglen));
-
-    VerifyOrReturnError(CanCastTo<uint16_t>(totalLen + taglen), CHIP_ERROR_INTERNAL);
-    msgBuf->SetDataLength(static_cast<uint16_t>(totalLen + taglen));
+    uint16_t taglen          = 0;
+    const uint16_t footerLen = packetHeader.MICTagLength();
+    if (msgBuf->AvailableDataLength() >= footerLen)
+    {
+        ReturnErrorOnFailure(mac.Encode(packetHeader, &data[totalLen], msgBuf->AvailableDataLength(), &taglen));
+
+        VerifyOrReturnError(CanCastTo<uint16_t>(totalLen + taglen), CHIP_ERROR_INTERNAL);
+        msgBuf->SetDataLength(static_cast<uint16_t>(totalLen + taglen));
+
+        return CHIP_NO_ERROR;
+    }
+
+    // There is no room for the MIC after the payload, so put it in a buffer of its own chained after the payload, rather than
+    // copying the whole message into a larger buffer. Transports send the chain as a single message.
+    PacketBufferHandle footer = PacketBufferHandle::New(footerLen, 0);
+    VerifyOrReturnError(!footer.IsNull(), CHIP_ERROR_NO_MEMORY);
+    ReturnErrorOnFailure(mac.Encode(packetHeader, footer->Start(), footerLen, &taglen));
+    footer->SetDataLength(taglen);
+    msgBuf->AddToEnd(std::move(footer));
 
     return CHIP_NO_ERROR;
 }
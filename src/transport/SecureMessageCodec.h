@@ -46,7 +46,9 @@ namespace SecureMessageCodec {
  *                      portion of the message header
  * @param msgBuf        The message buffer that contains the unencrypted message. If
  *                      the operation is successful, this buffer will be mutated to contain
- *                      the encrypted message.
+ *                      the encrypted message. The message must be a single buffer; if it
+ *                      has no room for the message integrity check, that is placed in a
+ *                      second buffer chained after it.
  * @return A CHIP_ERROR value consistent with the result of the encryption operation
  */
 CHIP_ERROR Encrypt(const CryptoContext & context, CryptoContext::ConstNonceView nonce, PayloadHeader & payloadHeader,
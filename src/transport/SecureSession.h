@@ -195,16 +195,7 @@ public:
 
     // Called when AddNOC has gone through sufficient success that we need to switch the
     // session to reflect a new fabric if it was a PASE session
-    CHIP_ERROR AdoptFabricIndex(FabricIndex fabricIndex)
-    {
-        // It's not legal to augment session type for non-PASE
-        if (mSecureSessionType != Type::kPASE)
-        {
-            return CHIP_ERROR_INVALID_ARGUMENT;
-        }
-        SetFabricIndex(fabricIndex);
-        return CHIP_NO_ERROR;
-    }
+    CHIP_ERROR AdoptFabricIndex(FabricIndex fabricIndex);
 
     System::Clock::Timestamp GetLastActivityTime() const { return mLastActivityTime; }
     System::Clock::Timestamp GetLastPeerActivityTime() const { return mLastPeerActivityTime; }
@@ -292,6 +283,7 @@ private:
     void MoveToState(State targetState);
 
     friend class SecureSessionDeleter;
+    friend class SecureSessionTable;
     friend class TestSecureSessionTable;
 
     SecureSessionTable & mTable;
@@ -314,6 +306,12 @@ private:
     ReliableMessageProtocolConfig mRemoteMRPConfig = GetDefaultMRPConfig();
     CryptoContext mCryptoContext;
     SessionMessageCounter mSessionMessageCounter;
+
+    // Links in the SecureSessionTable lookup indexes, maintained by the table.
+    SecureSession * mNextByLocalSessionId = nullptr;
+    SecureSession * mNextByPeer           = nullptr;
+    // Peer index bucket the session is linked into, which stays valid while the peer changes.
+    size_t mPeerIndexBucket = 0;
 };
 
 } // namespace Transport
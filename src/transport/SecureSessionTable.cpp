@@ -52,8 +52,8 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSessionForTest(Secure
         }
     }
 
-    SecureSession * result = mEntries.CreateObject(*this, secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs,
-                                                   peerSessionId, fabricIndex, config);
+    SecureSession * result = AllocateSession(secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs, peerSessionId,
+                                             fabricIndex, config);
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
@@ -73,7 +73,7 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSession(SecureSession
     //
     if (mEntries.Allocated() < GetMaxSessionTableSize())
     {
-        allocated = mEntries.CreateObject(*this, secureSessionType, sessionId.Value());
+        allocated = AllocateSession(secureSessionType, sessionId.Value());
     }
     else
     {
@@ -216,7 +216,7 @@ SecureSession * SecureSessionTable::EvictAndAllocate(uint16_t localSessionId, Se
         if (newCount < prevCount)
         {
             ChipLogProgress(SecureChannel, "Successfully evicted a session!");
-            auto * retSession = mEntries.CreateObject(*this, secureSessionType, localSessionId);
+            auto * retSession = AllocateSession(secureSessionType, localSessionId);
             VerifyOrDie(session != nullptr);
             return retSession;
         }
@@ -312,68 +312,91 @@ void SecureSessionTable::DefaultEvictionPolicy(EvictionPolicyContext & evictionC
 
 Optional<SessionHandle> SecureSessionTable::FindSecureSessionByLocalKey(uint16_t localSessionId)
 {
-    SecureSession * result = nullptr;
-    mEntries.ForEachActiveObject([&](auto session) {
-        if (session->GetLocalSessionId() == localSessionId)
-        {
-            result = session;
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
+    SecureSession * result = FindByLocalSessionId(localSessionId);
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
 Optional<uint16_t> SecureSessionTable::FindUnusedSessionId()
 {
-    uint16_t candidate_base = 0;
-    uint64_t candidate_mask = 0;
-    for (uint32_t i = 0; i <= kMaxSessionID; i += 64)
+    uint16_t candidate = mNextSessionId;
+    for (uint32_t i = 0; i <= kMaxSessionID; i++)
     {
-        // candidate_base is the base session ID we are searching from.
-        // We have a 64-bit mask anchored at this ID and iterate over the
-        // whole session table, setting bits in the mask for in-use IDs.
-        // If we can iterate through the entire session table and have
-        // any bits clear in the mask, we have available session IDs.
-        candidate_base = static_cast<uint16_t>(i + mNextSessionId);
-        candidate_mask = 0;
+        // kUnsecuredSessionId is never available
+        if (candidate != kUnsecuredSessionId && FindByLocalSessionId(candidate) == nullptr)
         {
-            uint16_t shift = static_cast<uint16_t>(kUnsecuredSessionId - candidate_base);
-            if (shift <= 63)
-            {
-                candidate_mask |= (1ULL << shift); // kUnsecuredSessionId is never available
-            }
+            return MakeOptional<uint16_t>(candidate);
         }
-        mEntries.ForEachActiveObject([&](auto session) {
-            uint16_t shift = static_cast<uint16_t>(session->GetLocalSessionId() - candidate_base);
-            if (shift <= 63)
-            {
-                candidate_mask |= (1ULL << shift);
-            }
-            if (candidate_mask == UINT64_MAX)
-            {
-                return Loop::Break; // No bits clear means this bucket is full.
-            }
-            return Loop::Continue;
-        });
-        if (candidate_mask != UINT64_MAX)
+        candidate = static_cast<uint16_t>(candidate + 1);
+    }
+
+    return NullOptional;
+}
+
+size_t SecureSessionTable::PeerIndexBucket(const ScopedNodeId & peer)
+{
+    // Multiplicative hashing: operational node IDs are random, but PASE and test node IDs are small and sequential, so
+    // take the bucket from the well-mixed high half of the product.
+    const uint64_t key  = peer.GetNodeId() ^ (static_cast<uint64_t>(peer.GetFabricIndex()) << 56);
+    const uint64_t hash = key * 0x9E3779B97F4A7C15ULL;
+    return static_cast<size_t>(hash >> 32) & (kIndexBuckets - 1);
+}
+
+void SecureSessionTable::AddToIndexes(SecureSession * session)
+{
+    SecureSession *& head          = mByLocalSessionId[LocalSessionIdIndexBucket(session->GetLocalSessionId())];
+    session->mNextByLocalSessionId = head;
+    head                           = session;
+
+    LinkIntoPeerIndex(session);
+}
+
+void SecureSessionTable::RemoveFromIndexes(SecureSession * session)
+{
+    for (SecureSession ** link = &mByLocalSessionId[LocalSessionIdIndexBucket(session->GetLocalSessionId())]; *link != nullptr;
+         link                  = &(*link)->mNextByLocalSessionId)
+    {
+        if (*link == session)
         {
-            break; // Any bit clear means we have an available ID in this bucket.
+            *link = session->mNextByLocalSessionId;
+            break;
         }
     }
-    if (candidate_mask != UINT64_MAX)
+    session->mNextByLocalSessionId = nullptr;
+
+    UnlinkFromPeerIndex(session);
+}
+
+void SecureSessionTable::LinkIntoPeerIndex(SecureSession * session)
+{
+    session->mPeerIndexBucket          = PeerIndexBucket(session->GetPeer());
+    session->mNextByPeer               = mByPeer[session->mPeerIndexBucket];
+    mByPeer[session->mPeerIndexBucket] = session;
+}
+
+void SecureSessionTable::UnlinkFromPeerIndex(SecureSession * session)
+{
+    for (SecureSession ** link = &mByPeer[session->mPeerIndexBucket]; *link != nullptr; link = &(*link)->mNextByPeer)
     {
-        uint16_t offset = 0;
-        while (candidate_mask & 1)
+        if (*link == session)
         {
-            candidate_mask >>= 1;
-            ++offset;
+            *link = session->mNextByPeer;
+            break;
         }
-        uint16_t available = static_cast<uint16_t>(candidate_base + offset);
-        return MakeOptional<uint16_t>(available);
     }
+    session->mNextByPeer = nullptr;
+}
 
-    return NullOptional;
+SecureSession * SecureSessionTable::FindByLocalSessionId(uint16_t localSessionId) const
+{
+    for (SecureSession * session = mByLocalSessionId[LocalSessionIdIndexBucket(localSessionId)]; session != nullptr;
+         session                 = session->mNextByLocalSessionId)
+    {
+        if (session->GetLocalSessionId() == localSessionId)
+        {
+            return session;
+        }
+    }
+    return nullptr;
 }
 
 } // namespace Transport
@@ -76,7 +76,11 @@ public:
     CHECK_RETURN_VALUE
     Optional<SessionHandle> CreateNewSecureSession(SecureSession::Type secureSessionType, ScopedNodeId sessionEvictionHint);
 
-    void ReleaseSession(SecureSession * session) { mEntries.ReleaseObject(session); }
+    void ReleaseSession(SecureSession * session)
+    {
+        RemoveFromIndexes(session);
+        mEntries.ReleaseObject(session);
+    }
 
     template <typename Function>
     Loop ForEachSession(Function && function)
@@ -84,6 +88,35 @@ public:
         return mEntries.ForEachActiveObject(std::forward<Function>(function));
     }
 
+    /**
+     * Iterate over the sessions whose peer is the given node, using the peer index.
+     *
+     * The function may release the session it is given, but must not release any other session.
+     */
+    template <typename Function>
+    Loop ForEachSessionWithPeer(const ScopedNodeId & peer, Function && function)
+    {
+        SecureSession * session = mByPeer[PeerIndexBucket(peer)];
+        while (session != nullptr)
+        {
+            SecureSession * next = session->mNextByPeer;
+            if (session->GetPeer() == peer && function(session) == Loop::Break)
+            {
+                return Loop::Break;
+            }
+            session = next;
+        }
+        return Loop::Finish;
+    }
+
+    // Move a session to the peer index bucket for its current peer, after its peer node ID or fabric index has changed.
+    // This is an internal API, using raw pointer to a session is allowed here.
+    void UpdatePeerIndex(SecureSession * session)
+    {
+        UnlinkFromPeerIndex(session);
+        LinkIntoPeerIndex(session);
+    }
+
     /**
      * Get a secure session given its session ID.
      *
@@ -243,22 +276,54 @@ private:
     /**
      * Find an available session ID that is unused in the secure session table.
      *
-     * The search algorithm iterates over the session ID space in the outer loop
-     * and the session table in the inner loop to locate an available session ID
-     * from the starting mNextSessionId clue.
-     *
-     * The outer-loop considers 64 session IDs in each iteration to give a
-     * runtime complexity of O(CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE^2/64).  Speed up could be
-     * achieved with a sorted session table or additional storage.
+     * The search probes session IDs in order from the starting mNextSessionId
+     * clue, checking each one against the local session ID index. Since every
+     * probed ID but the last is held by a session, this takes at most one more
+     * indexed lookup than there are sessions in the table.
      *
      * @return an unused session ID if any is found, else NullOptional
      */
     CHECK_RETURN_VALUE
     Optional<uint16_t> FindUnusedSessionId();
 
+    /**
+     * Allocate a session out of the pool and add it to the lookup indexes.
+     */
+    template <typename... Args>
+    SecureSession * AllocateSession(Args &&... args)
+    {
+        SecureSession * session = mEntries.CreateObject(*this, std::forward<Args>(args)...);
+        if (session != nullptr)
+        {
+            AddToIndexes(session);
+        }
+        return session;
+    }
+
+    /*
+     * Lookup indexes. Every allocated session is linked, through its own link fields, into one bucket of each index: by
+     * local session ID, and by peer. Session IDs are allocated sequentially, so masking them spreads consecutive sessions
+     * over distinct buckets.
+     */
+    static constexpr size_t kIndexBuckets = CHIP_CONFIG_SECURE_SESSION_INDEX_BUCKETS;
+    static_assert(kIndexBuckets > 0 && (kIndexBuckets & (kIndexBuckets - 1)) == 0,
+                  "CHIP_CONFIG_SECURE_SESSION_INDEX_BUCKETS must be a power of two");
+
+    static size_t LocalSessionIdIndexBucket(uint16_t localSessionId) { return localSessionId & (kIndexBuckets - 1); }
+    static size_t PeerIndexBucket(const ScopedNodeId & peer);
+
+    void AddToIndexes(SecureSession * session);
+    void RemoveFromIndexes(SecureSession * session);
+    void LinkIntoPeerIndex(SecureSession * session);
+    void UnlinkFromPeerIndex(SecureSession * session);
+    SecureSession * FindByLocalSessionId(uint16_t localSessionId) const;
+
     bool mRunningEvictionLogic = false;
     ObjectPool<SecureSession, CHIP_CONFIG_SECURE_SESSION_POOL_SIZE> mEntries;
 
+    SecureSession * mByLocalSessionId[kIndexBuckets] = {};
+    SecureSession * mByPeer[kIndexBuckets]           = {};
+
     size_t GetMaxSessionTableSize() const
     {
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
@@ -124,6 +124,11 @@ void SessionManager::Shutdown()
 
     mMessageCounterManager = nullptr;
 
+#if INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE > 1
+    // Messages held back by a send batch were reported as sent, so send them while the transport is still around.
+    FlushSendBatch();
+#endif // INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE > 1
+
     mSystemLayer  = nullptr;
     mTransportMgr = nullptr;
     mCB           = nullptr;
@@ -360,7 +365,6 @@ CHIP_ERROR SessionManager::SendPreparedMessage(const SessionHandle & sessionHand
 
     PacketBufferHandle msgBuf = preparedMessage.CastToWritable();
     VerifyOrReturnError(!msgBuf.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrReturnError(!msgBuf->HasChainedBuffer(), CHIP_ERROR_INVALID_MESSAGE_LENGTH);
 
 #if CHIP_SYSTEM_CONFIG_MULTICAST_HOMING
     if (sessionHandle->GetSessionType() == Transport::Session::SessionType::kGroupOutgoing)
@@ -384,7 +388,6 @@ CHIP_ERROR SessionManager::SendPreparedMessage(const SessionHandle & sessionHand
                     interfaceFound             = true;
                     PacketBufferHandle tempBuf = msgBuf.CloneData();
                     VerifyOrReturnError(!tempBuf.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
-                    VerifyOrReturnError(!tempBuf->HasChainedBuffer(), CHIP_ERROR_INVALID_MESSAGE_LENGTH);
 
                     destination = &(multicastAddress.SetInterface(interfaceId));
                     if (mTransportMgr != nullptr)
@@ -419,6 +422,18 @@ CHIP_ERROR SessionManager::SendPreparedMessage(const SessionHandle & sessionHand
     if (mTransportMgr != nullptr)
     {
         CHIP_TRACE_PREPARED_MESSAGE_SENT(destination, &msgBuf);
+#if INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE > 1
+        if (mSendBatchDepth > 0 && destination->GetTransportType() == Transport::Type::kUdp)
+        {
+            mSendBatchDestinations[mSendBatchLength] = *destination;
+            mSendBatchMessages[mSendBatchLength]     = std::move(msgBuf);
+            if (++mSendBatchLength == kSendBatchSize)
+            {
+                FlushSendBatch();
+            }
+            return CHIP_NO_ERROR;
+        }
+#endif // INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE > 1
         return mTransportMgr->SendMessage(*destination, std::move(msgBuf));
     }
 
@@ -426,6 +441,51 @@ CHIP_ERROR SessionManager::SendPreparedMessage(const SessionHandle & sessionHand
     return CHIP_ERROR_INCORRECT_STATE;
 }
 
+void SessionManager::BeginSendBatch()
+{
+#if INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE > 1
+    mSendBatchDepth++;
+#endif // INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE > 1
+}
+
+void SessionManager::EndSendBatch()
+{
+#if INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE > 1
+    VerifyOrDie(mSendBatchDepth > 0);
+    if (--mSendBatchDepth == 0)
+    {
+        FlushSendBatch();
+    }
+#endif // INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE > 1
+}
+
+#if INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE > 1
+void SessionManager::FlushSendBatch()
+{
+    const size_t length = mSendBatchLength;
+    mSendBatchLength    = 0;
+    VerifyOrReturn(length > 0);
+
+    // SendPreparedMessage() already reported these messages as sent, so a failure is handled like a loss on the network.
+    CHIP_ERROR err = CHIP_ERROR_INCORRECT_STATE;
+    if (mTransportMgr != nullptr)
+    {
+        err = mTransportMgr->SendMessages(mSendBatchDestinations, mSendBatchMessages, length);
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Inet, "Failed to send a batch of %u messages: %" CHIP_ERROR_FORMAT, static_cast<unsigned>(length),
+                     err.Format());
+    }
+
+    // The transport stops at the first message that fails to send.
+    for (size_t i = 0; i < length; i++)
+    {
+        mSendBatchMessages[i] = nullptr;
+    }
+}
+#endif // INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE > 1
+
 void SessionManager::ExpireAllSessions(const ScopedNodeId & node)
 {
     ChipLogDetail(Inet, "Expiring all sessions for node " ChipLogFormatScopedNodeId "!!", ChipLogValueScopedNodeId(node));
@@ -972,9 +1032,8 @@ Optional<SessionHandle> SessionManager::FindSecureSessionForNode(ScopedNodeId pe
 {
     SecureSession * found = nullptr;
 
-    mSecureSessions.ForEachSession([&peerNodeId, &type, &found](auto session) {
-        if (session->IsActiveSession() && session->GetPeer() == peerNodeId &&
-            (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
+    mSecureSessions.ForEachSessionWithPeer(peerNodeId, [&type, &found](auto session) {
+        if (session->IsActiveSession() && (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
         {
             //
             // Select the active session with the most recent activity to return back to the caller.
@@ -137,6 +137,9 @@ public:
      *    2. construct the packet header
      *    3. Encode the packet header and prepend it to message.
      *   Returns a encrypted message in encryptedMessage.
+     *
+     *   The payload of a secure session message must be a single buffer. When it has no room for the message footer, the
+     *   encrypted message is that buffer with the footer chained after it.
      */
     CHIP_ERROR PrepareMessage(const SessionHandle & session, PayloadHeader & payloadHeader, System::PacketBufferHandle && msgBuf,
                               EncryptedPacketBufferHandle & encryptedMessage);
@@ -147,6 +150,20 @@ public:
      */
     CHIP_ERROR SendPreparedMessage(const SessionHandle & session, const EncryptedPacketBufferHandle & preparedMessage);
 
+    /**
+     * @brief
+     *   Hold back the unicast UDP messages sent until the matching EndSendBatch() call, so that several messages, e.g. the
+     *   reports of one run of the reporting engine, reach the transport together and can go out with a single system call.
+     *
+     * @details
+     *   Batches nest: the messages go out when the outermost batch ends, or earlier once INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE
+     *   messages are held back. SendPreparedMessage() succeeds as soon as it holds a message back, so a message that then
+     *   fails to send is only logged, like a message lost on the network. Batches have no effect unless
+     *   INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE is greater than 1.
+     */
+    void BeginSendBatch();
+    void EndSendBatch();
+
     /// @brief Set the delegate for handling incoming messages. There can be only one message delegate (probably the
     /// ExchangeManager)
     void SetMessageDelegate(SessionMessageDelegate * cb) { mCB = cb; }
@@ -484,6 +501,18 @@ private:
 
     GlobalUnencryptedMessageCounter mGlobalUnencryptedMessageCounter;
 
+#if INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE > 1
+    static constexpr size_t kSendBatchSize = INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE;
+
+    // Send the messages held back by the current send batch.
+    void FlushSendBatch();
+
+    Transport::PeerAddress mSendBatchDestinations[kSendBatchSize];
+    System::PacketBufferHandle mSendBatchMessages[kSendBatchSize];
+    size_t mSendBatchLength  = 0;
+    uint16_t mSendBatchDepth = 0;
+#endif // INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE > 1
+
     /**
      * @brief Parse, decrypt, validate, and dispatch a secure unicast message.
      *
@@ -527,6 +556,9 @@ private:
 namespace MessagePacketBuffer {
 /**
  * Maximum size of a message footer, in bytes.
+ *
+ * Messages with this much space after their payload are encrypted into a single buffer; otherwise the footer is sent from a
+ * separate buffer chained after the payload. The payload itself must still be a single buffer.
  */
 constexpr uint16_t kMaxFooterSize = kMaxTagLen;
 
@@ -26,6 +26,7 @@
 #include <inet/IPAddress.h>
 #include <inet/UDPEndPoint.h>
 #include <lib/core/CHIPError.h>
+#include <lib/support/CodeUtils.h>
 #include <system/SystemPacketBuffer.h>
 #include <transport/raw/MessageHeader.h>
 #include <transport/raw/PeerAddress.h>
@@ -65,6 +66,21 @@ public:
      */
     virtual CHIP_ERROR SendMessage(const PeerAddress & address, System::PacketBufferHandle && msgBuf) = 0;
 
+    /**
+     * @brief Send several messages, each to its own target.
+     *
+     * Transports that can hand a batch of messages to the network stack at once override this; the default sends the
+     * messages one at a time. Sending stops at the first message that fails.
+     */
+    virtual CHIP_ERROR SendMessages(const PeerAddress * addresses, System::PacketBufferHandle * msgBufs, size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            ReturnErrorOnFailure(SendMessage(addresses[i], std::move(msgBufs[i])));
+        }
+        return CHIP_NO_ERROR;
+    }
+
     /**
      * Determine if this transport can SendMessage to the specified peer address.
      *
@@ -86,6 +86,11 @@ public:
         return SendMessageImpl<0>(address, std::move(msgBuf));
     }
 
+    CHIP_ERROR SendMessages(const PeerAddress * addresses, System::PacketBufferHandle * msgBufs, size_t count) override
+    {
+        return SendMessagesImpl<0>(addresses, msgBufs, count);
+    }
+
     CHIP_ERROR MulticastGroupJoinLeave(const Transport::PeerAddress & address, bool join) override
     {
         return MulticastGroupJoinLeaveImpl<0>(address, join);
@@ -208,6 +213,42 @@ private:
         return CHIP_ERROR_NO_MESSAGE_HANDLER;
     }
 
+    /**
+     * Recursive SendMessages implementation iterating through transport members.
+     *
+     * The batch is sent through the first transport from index N or above which returns 'CanSendToPeer' for every
+     * message in it.
+     *
+     * @tparam N the index of the underlying transport to run SendMessages through.
+     *
+     * @param addresses where to send the messages
+     * @param msgBufs the messages to send
+     * @param count number of messages in the batch
+     */
+    template <size_t N, typename std::enable_if<(N < sizeof...(TransportTypes))>::type * = nullptr>
+    CHIP_ERROR SendMessagesImpl(const PeerAddress * addresses, System::PacketBufferHandle * msgBufs, size_t count)
+    {
+        Base * base = &std::get<N>(mTransports);
+        for (size_t i = 0; i < count; i++)
+        {
+            if (!base->CanSendToPeer(addresses[i]))
+            {
+                return SendMessagesImpl<N + 1>(addresses, msgBufs, count);
+            }
+        }
+        return base->SendMessages(addresses, msgBufs, count);
+    }
+
+    /**
+     * SendMessagesImpl when N is out of range: no single transport handles the whole batch, so each message is routed
+     * on its own.
+     */
+    template <size_t N, typename std::enable_if<(N >= sizeof...(TransportTypes))>::type * = nullptr>
+    CHIP_ERROR SendMessagesImpl(const PeerAddress * addresses, System::PacketBufferHandle * msgBufs, size_t count)
+    {
+        return Base::SendMessages(addresses, msgBufs, count);
+    }
+
     /**
      * Recursive GroupJoinLeave implementation iterating through transport members.
      *
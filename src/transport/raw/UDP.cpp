@@ -28,6 +28,7 @@
 #include <lib/support/logging/CHIPLogging.h>
 #include <transport/raw/MessageHeader.h>
 
+#include <algorithm>
 #include <inttypes.h>
 
 namespace chip {
@@ -117,6 +118,39 @@ CHIP_ERROR UDP::SendMessage(const Transport::PeerAddress & address, System::Pack
     return mUDPEndPoint->SendMsg(&addrInfo, std::move(msgBuf));
 }
 
+CHIP_ERROR UDP::SendMessages(const Transport::PeerAddress * addresses, System::PacketBufferHandle * msgBufs, size_t count)
+{
+    VerifyOrReturnError(mState == State::kInitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mUDPEndPoint != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    // Drop the messages and return.
+    CHIP_FAULT_INJECT(FaultInjection::kFault_DropOutgoingUDPMsg, return CHIP_ERROR_CONNECTION_ABORTED;);
+
+    Inet::IPPacketInfo addrInfo[INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE];
+
+    while (count > 0)
+    {
+        const size_t batchSize = std::min<size_t>(count, INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE);
+        for (size_t i = 0; i < batchSize; i++)
+        {
+            VerifyOrReturnError(addresses[i].GetTransportType() == Type::kUdp, CHIP_ERROR_INVALID_ARGUMENT);
+
+            addrInfo[i].Clear();
+            addrInfo[i].DestAddress = addresses[i].GetIPAddress();
+            addrInfo[i].DestPort    = addresses[i].GetPort();
+            addrInfo[i].Interface   = addresses[i].GetInterface();
+        }
+
+        ReturnErrorOnFailure(mUDPEndPoint->SendMsgs(addrInfo, msgBufs, batchSize));
+
+        addresses += batchSize;
+        msgBufs += batchSize;
+        count -= batchSize;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
 void UDP::OnUdpReceive(Inet::UDPEndPoint * endPoint, System::PacketBufferHandle && buffer, const Inet::IPPacketInfo * pktInfo)
 {
     CHIP_ERROR err          = CHIP_NO_ERROR;
@@ -135,7 +135,20 @@ public:
             return CHIP_NO_ERROR;
         }
 
-        System::PacketBufferHandle receivedMessage = msgBuf.CloneData();
+        // Like a real network, deliver a message sent from a buffer chain in a single buffer.
+        System::PacketBufferHandle receivedMessage;
+        if (msgBuf->HasChainedBuffer())
+        {
+            const uint16_t length = msgBuf->TotalLength();
+            receivedMessage       = System::PacketBufferHandle::New(length);
+            VerifyOrReturnError(!receivedMessage.IsNull(), CHIP_ERROR_NO_MEMORY);
+            ReturnErrorOnFailure(msgBuf->Read(receivedMessage->Start(), length));
+            receivedMessage->SetDataLength(length);
+        }
+        else
+        {
+            receivedMessage = msgBuf.CloneData();
+        }
         mPendingMessageQueue.push(PendingMessageItem(address, std::move(receivedMessage)));
         return mSystemLayer->ScheduleWork(OnMessageReceived, this);
     }
@@ -161,6 +161,68 @@ void CheckMessageTest6(nlTestSuite * inSuite, void * inContext)
     CheckMessageTest(inSuite, inContext, addr);
 }
 
+/////////////////////////// Batched messaging test
+
+void CheckBatchedMessageTest(nlTestSuite * inSuite, void * inContext, const IPAddress & addr)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    // More messages than fit in a single batch, so that the batch is split.
+    constexpr size_t kMessageCount = INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE + 3;
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    Transport::UDP udp;
+
+    err = udp.Init(Transport::UdpListenParameters(ctx.GetUDPEndPointManager()).SetAddressType(addr.Type()).SetListenPort(0));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    MockTransportMgrDelegate gMockTransportMgrDelegate(inSuite);
+    TransportMgrBase gTransportMgrBase;
+    gTransportMgrBase.SetSessionManager(&gMockTransportMgrDelegate);
+    gTransportMgrBase.Init(&udp);
+
+    ReceiveHandlerCallCount = 0;
+
+    Transport::PeerAddress addresses[kMessageCount];
+    chip::System::PacketBufferHandle buffers[kMessageCount];
+    for (size_t i = 0; i < kMessageCount; i++)
+    {
+        addresses[i] = Transport::PeerAddress::UDP(addr, udp.GetBoundPort());
+        buffers[i]   = chip::System::PacketBufferHandle::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+        NL_TEST_ASSERT(inSuite, !buffers[i].IsNull());
+
+        PacketHeader header;
+        header.SetSourceNodeId(kSourceNodeId).SetDestinationNodeId(kDestinationNodeId).SetMessageCounter(kMessageCounter);
+
+        err = header.EncodeBeforeData(buffers[i]);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    }
+
+    // Should be able to send a batch of messages to itself.
+    err = gTransportMgrBase.SendMessages(addresses, buffers, kMessageCount);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    ctx.DriveIOUntil(chip::System::Clock::Seconds16(1),
+                     []() { return ReceiveHandlerCallCount == static_cast<int>(kMessageCount); });
+
+    NL_TEST_ASSERT(inSuite, ReceiveHandlerCallCount == static_cast<int>(kMessageCount));
+}
+
+void CheckBatchedMessageTest4(nlTestSuite * inSuite, void * inContext)
+{
+    IPAddress addr;
+    IPAddress::FromString("127.0.0.1", addr);
+    CheckBatchedMessageTest(inSuite, inContext, addr);
+}
+
+void CheckBatchedMessageTest6(nlTestSuite * inSuite, void * inContext)
+{
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+    CheckBatchedMessageTest(inSuite, inContext, addr);
+}
+
 // Test Suite
 
 /**
@@ -172,10 +234,12 @@ static const nlTest sTests[] =
 #if INET_CONFIG_ENABLE_IPV4
     NL_TEST_DEF("Simple Init Test IPV4",   CheckSimpleInitTest4),
     NL_TEST_DEF("Message Self Test IPV4",  CheckMessageTest4),
+    NL_TEST_DEF("Batched Message Self Test IPV4", CheckBatchedMessageTest4),
 #endif
 
     NL_TEST_DEF("Simple Init Test IPV6",   CheckSimpleInitTest6),
     NL_TEST_DEF("Message Self Test IPV6",  CheckMessageTest6),
+    NL_TEST_DEF("Batched Message Self Test IPV6", CheckBatchedMessageTest6),
 
     NL_TEST_SENTINEL()
 };
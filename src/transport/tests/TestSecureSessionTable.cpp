@@ -32,6 +32,7 @@
 #include <nlunit-test.h>
 
 #include <errno.h>
+#include <stdio.h>
 #include <vector>
 
 namespace chip {
@@ -47,6 +48,18 @@ public:
     //
     static void ValidateSessionSorting(nlTestSuite * inSuite, void * inContext);
 
+    //
+    // This test validates that the local session ID and peer lookup indexes follow sessions
+    // through allocation, activation, fabric adoption and release.
+    //
+    static void ValidateSessionIndexes(nlTestSuite * inSuite, void * inContext);
+
+    //
+    // This measures the cost of looking up the session for an inbound message by its local
+    // session ID for growing table sizes, against a linear scan of the table.
+    //
+    static void BenchmarkSessionLookup(nlTestSuite * inSuite, void * inContext);
+
 private:
     struct SessionParameters
     {
@@ -363,6 +376,138 @@ void TestSecureSessionTable::ValidateSessionSorting(nlTestSuite * inSuite, void
     }
 }
 
+void TestSecureSessionTable::ValidateSessionIndexes(nlTestSuite * inSuite, void * inContext)
+{
+    const ReliableMessageProtocolConfig config(System::Clock::Milliseconds32(0), System::Clock::Milliseconds32(0));
+    auto countSessionsWithPeer = [](SecureSessionTable & table, const ScopedNodeId & peer) {
+        size_t count = 0;
+        table.ForEachSessionWithPeer(peer, [&count](auto * session) {
+            count++;
+            return Loop::Continue;
+        });
+        return count;
+    };
+
+    SecureSessionTable table;
+    table.Init();
+
+    // Two sessions to the same peer, one to another peer on another fabric.
+    auto session1 = table.CreateNewSecureSessionForTest(SecureSession::Type::kCASE, 10, 1, 2, CATValues(), 1, kFabric1, config);
+    auto session2 = table.CreateNewSecureSessionForTest(SecureSession::Type::kCASE, 11, 1, 2, CATValues(), 2, kFabric1, config);
+    auto session3 = table.CreateNewSecureSessionForTest(SecureSession::Type::kCASE, 12, 1, 2, CATValues(), 3, kFabric2, config);
+    NL_TEST_ASSERT(inSuite, session1.HasValue() && session2.HasValue() && session3.HasValue());
+
+    auto found = table.FindSecureSessionByLocalKey(11);
+    NL_TEST_ASSERT(inSuite, found.HasValue() && found.Value()->AsSecureSession() == session2.Value()->AsSecureSession());
+    NL_TEST_ASSERT(inSuite, !table.FindSecureSessionByLocalKey(13).HasValue());
+    NL_TEST_ASSERT(inSuite, countSessionsWithPeer(table, ScopedNodeId(2, kFabric1)) == 2);
+    NL_TEST_ASSERT(inSuite, countSessionsWithPeer(table, ScopedNodeId(2, kFabric2)) == 1);
+    NL_TEST_ASSERT(inSuite, countSessionsWithPeer(table, ScopedNodeId(3, kFabric1)) == 0);
+
+    // Session IDs that are in use are skipped.
+    table.mNextSessionId = 10;
+    auto unused          = table.FindUnusedSessionId();
+    NL_TEST_ASSERT(inSuite, unused.HasValue() && unused.Value() == 13);
+
+    // A pending session is indexed by its ID right away, and by its peer once activated.
+    auto pending = table.CreateNewSecureSession(SecureSession::Type::kPASE, ScopedNodeId());
+    NL_TEST_ASSERT(inSuite, pending.HasValue());
+    SecureSession * pendingSession = pending.Value()->AsSecureSession();
+    NL_TEST_ASSERT(inSuite, pendingSession->GetLocalSessionId() == 13);
+    found = table.FindSecureSessionByLocalKey(13);
+    NL_TEST_ASSERT(inSuite, found.HasValue() && found.Value()->AsSecureSession() == pendingSession);
+
+    const NodeId paseNodeId = NodeIdFromPAKEKeyId(kDefaultCommissioningPasscodeId);
+    pendingSession->Activate(ScopedNodeId(), ScopedNodeId(paseNodeId, kUndefinedFabricIndex), CATValues(), 4, config);
+    NL_TEST_ASSERT(inSuite, countSessionsWithPeer(table, ScopedNodeId(paseNodeId, kUndefinedFabricIndex)) == 1);
+
+    // Adopting a fabric moves the session to its new peer.
+    NL_TEST_ASSERT(inSuite, pendingSession->AdoptFabricIndex(kFabric3) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, countSessionsWithPeer(table, ScopedNodeId(paseNodeId, kUndefinedFabricIndex)) == 0);
+    NL_TEST_ASSERT(inSuite, countSessionsWithPeer(table, ScopedNodeId(paseNodeId, kFabric3)) == 1);
+
+    // Released sessions leave both indexes.
+    session2.Value()->AsSecureSession()->MarkForEviction();
+    session2.ClearValue();
+    found.ClearValue();
+    NL_TEST_ASSERT(inSuite, !table.FindSecureSessionByLocalKey(11).HasValue());
+    NL_TEST_ASSERT(inSuite, countSessionsWithPeer(table, ScopedNodeId(2, kFabric1)) == 1);
+    found = table.FindSecureSessionByLocalKey(10);
+    NL_TEST_ASSERT(inSuite, found.HasValue() && found.Value()->AsSecureSession() == session1.Value()->AsSecureSession());
+
+    table.mNextSessionId = 10;
+    unused               = table.FindUnusedSessionId();
+    NL_TEST_ASSERT(inSuite, unused.HasValue() && unused.Value() == 11);
+
+    pendingSession->MarkForEviction();
+}
+
+void TestSecureSessionTable::BenchmarkSessionLookup(nlTestSuite * inSuite, void * inContext)
+{
+    static constexpr size_t kTableSizes[] = { 16, 128, 1024, 4096 };
+    static constexpr size_t kLookups      = 100000;
+
+    const ReliableMessageProtocolConfig config(System::Clock::Milliseconds32(0), System::Clock::Milliseconds32(0));
+
+    for (size_t tableSize : kTableSizes)
+    {
+        auto table = Platform::MakeUnique<SecureSessionTable>();
+        NL_TEST_ASSERT(inSuite, table.get() != nullptr);
+        table->Init();
+
+        size_t allocated = 0;
+        for (; allocated < tableSize; allocated++)
+        {
+            auto session = table->CreateNewSecureSessionForTest(SecureSession::Type::kCASE, static_cast<uint16_t>(allocated + 1), 1,
+                                                                allocated + 2, CATValues(), 1, kFabric1, config);
+            if (!session.HasValue())
+            {
+                break;
+            }
+        }
+        if (allocated < tableSize)
+        {
+            // Statically allocated pools cannot hold the larger tables.
+            break;
+        }
+
+        uint32_t seed   = 12345;
+        size_t indexed  = 0;
+        size_t scanned  = 0;
+        uint16_t lookup = 0;
+
+        const System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+        for (size_t i = 0; i < kLookups; i++)
+        {
+            seed   = seed * 1664525u + 1013904223u;
+            lookup = static_cast<uint16_t>(seed % tableSize + 1);
+            indexed += table->FindSecureSessionByLocalKey(lookup).HasValue() ? 1 : 0;
+        }
+        const System::Clock::Microseconds64 indexedDone = System::SystemClock().GetMonotonicMicroseconds64();
+        for (size_t i = 0; i < kLookups; i++)
+        {
+            seed   = seed * 1664525u + 1013904223u;
+            lookup = static_cast<uint16_t>(seed % tableSize + 1);
+            table->ForEachSession([&](auto * session) {
+                if (session->GetLocalSessionId() == lookup)
+                {
+                    scanned++;
+                    return Loop::Break;
+                }
+                return Loop::Continue;
+            });
+        }
+        const System::Clock::Microseconds64 scanDone = System::SystemClock().GetMonotonicMicroseconds64();
+
+        NL_TEST_ASSERT(inSuite, indexed == kLookups);
+        NL_TEST_ASSERT(inSuite, scanned == kLookups);
+
+        printf("%5zu sessions: indexed lookup %7.1f ns, linear scan %9.1f ns\n", tableSize,
+               static_cast<double>((indexedDone - start).count()) * 1000 / kLookups,
+               static_cast<double>((scanDone - indexedDone).count()) * 1000 / kLookups);
+    }
+}
+
 Platform::UniquePtr<TestSecureSessionTable> gTestSecureSessionTable;
 
 } // namespace Transport
@@ -379,6 +524,8 @@ namespace {
 const nlTest sTests[] =
 {
     NL_TEST_DEF("Validate Session Sorting (Over Minima)",               chip::Transport::TestSecureSessionTable::ValidateSessionSorting),
+    NL_TEST_DEF("Validate Session Indexes",                             chip::Transport::TestSecureSessionTable::ValidateSessionIndexes),
+    NL_TEST_DEF("Benchmark Session Lookup",                             chip::Transport::TestSecureSessionTable::BenchmarkSessionLookup),
     NL_TEST_SENTINEL()
 };
 // clang-format on
@@ -234,6 +234,25 @@ void CheckMessageTest(nlTestSuite * inSuite, void * inContext)
     ctx.DrainAndServiceIO();
     NL_TEST_ASSERT(inSuite, callback.ReceiveHandlerCallCount == 2);
 
+    // A message with no room for the MIC after its payload is sent with the MIC in a chained buffer
+    const uint16_t full_payload_len              = 64;
+    chip::System::PacketBufferHandle full_buffer = chip::System::PacketBufferHandle::New(full_payload_len);
+    NL_TEST_ASSERT(inSuite, !full_buffer.IsNull());
+    full_buffer->SetStart(full_buffer->Start() + full_buffer->AvailableDataLength() - full_payload_len);
+    memcpy(full_buffer->Start(), LARGE_PAYLOAD, full_payload_len);
+    full_buffer->SetDataLength(full_payload_len);
+    NL_TEST_ASSERT(inSuite, full_buffer->AvailableDataLength() == 0);
+
+    err = sessionManager.PrepareMessage(aliceToBobSession.Get().Value(), payloadHeader, std::move(full_buffer), preparedMessage);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, preparedMessage.HasChainedBuffer());
+
+    err = sessionManager.SendPreparedMessage(aliceToBobSession.Get().Value(), preparedMessage);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(inSuite, callback.ReceiveHandlerCallCount == 3);
+
     uint16_t large_payload_len = sizeof(LARGE_PAYLOAD);
 
     // Let's send bigger message than supported and make sure it fails to send
@@ -249,6 +268,98 @@ void CheckMessageTest(nlTestSuite * inSuite, void * inContext)
     sessionManager.Shutdown();
 }
 
+void SendBatchTest(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    TestSessMgrCallback callback;
+    callback.LargeMessageSent = false;
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    FabricTableHolder fabricTableHolder;
+    SessionManager sessionManager;
+    secure_channel::MessageCounterManager gMessageCounterManager;
+    chip::TestPersistentStorageDelegate deviceStorage;
+    chip::Crypto::DefaultSessionKeystore sessionKeystore;
+    FabricTable & fabricTable    = fabricTableHolder.GetFabricTable();
+    FabricIndex aliceFabricIndex = kUndefinedFabricIndex;
+    FabricIndex bobFabricIndex   = kUndefinedFabricIndex;
+
+    NL_TEST_ASSERT(inSuite, CHIP_NO_ERROR == fabricTableHolder.Init());
+    NL_TEST_ASSERT(inSuite,
+                   CHIP_NO_ERROR ==
+                       sessionManager.Init(&ctx.GetSystemLayer(), &ctx.GetTransportMgr(), &gMessageCounterManager, &deviceStorage,
+                                           &fabricTableHolder.GetFabricTable(), sessionKeystore));
+
+    callback.mSuite = inSuite;
+
+    sessionManager.SetMessageDelegate(&callback);
+
+    Transport::PeerAddress peer(Transport::PeerAddress::UDP(addr, CHIP_PORT));
+
+    err =
+        fabricTable.AddNewFabricForTestIgnoringCollisions(GetRootACertAsset().mCert, GetIAA1CertAsset().mCert,
+                                                          GetNodeA1CertAsset().mCert, GetNodeA1CertAsset().mKey, &aliceFabricIndex);
+    NL_TEST_ASSERT(inSuite, CHIP_NO_ERROR == err);
+
+    err = fabricTable.AddNewFabricForTestIgnoringCollisions(GetRootACertAsset().mCert, GetIAA1CertAsset().mCert,
+                                                            GetNodeA2CertAsset().mCert, GetNodeA2CertAsset().mKey, &bobFabricIndex);
+    NL_TEST_ASSERT(inSuite, CHIP_NO_ERROR == err);
+
+    SessionHolder aliceToBobSession;
+    err = sessionManager.InjectPaseSessionWithTestKey(aliceToBobSession, 2,
+                                                      fabricTable.FindFabricWithIndex(bobFabricIndex)->GetNodeId(), 1,
+                                                      aliceFabricIndex, peer, CryptoContext::SessionRole::kInitiator);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    SessionHolder bobToAliceSession;
+    err = sessionManager.InjectPaseSessionWithTestKey(bobToAliceSession, 1,
+                                                      fabricTable.FindFabricWithIndex(aliceFabricIndex)->GetNodeId(), 2,
+                                                      bobFabricIndex, peer, CryptoContext::SessionRole::kResponder);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    PayloadHeader payloadHeader;
+    payloadHeader.SetExchangeID(0);
+    payloadHeader.SetMessageType(chip::Protocols::Echo::MsgType::EchoRequest);
+
+    // Send more messages than fit in a batch, in nested batches.
+    constexpr int kNumMessages       = INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE + 2;
+    callback.ReceiveHandlerCallCount = 0;
+
+    sessionManager.BeginSendBatch();
+    sessionManager.BeginSendBatch();
+    for (int i = 0; i < kNumMessages; i++)
+    {
+        chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+        NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+
+        EncryptedPacketBufferHandle preparedMessage;
+        err = sessionManager.PrepareMessage(aliceToBobSession.Get().Value(), payloadHeader, std::move(buffer), preparedMessage);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+        err = sessionManager.SendPreparedMessage(aliceToBobSession.Get().Value(), preparedMessage);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    }
+    sessionManager.EndSendBatch();
+
+    // Only a full batch went out before the outermost batch ended.
+    ctx.DrainAndServiceIO();
+#if INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE > 1
+    NL_TEST_ASSERT(inSuite, callback.ReceiveHandlerCallCount == INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE);
+#else
+    NL_TEST_ASSERT(inSuite, callback.ReceiveHandlerCallCount == kNumMessages);
+#endif // INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE > 1
+
+    sessionManager.EndSendBatch();
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(inSuite, callback.ReceiveHandlerCallCount == kNumMessages);
+
+    sessionManager.Shutdown();
+}
+
 void SendEncryptedPacketTest(nlTestSuite * inSuite, void * inContext)
 {
     TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
@@ -1062,6 +1173,7 @@ const nlTest sTests[] =
 {
     NL_TEST_DEF("Simple Init Test",               CheckSimpleInitTest),
     NL_TEST_DEF("Message Self Test",              CheckMessageTest),
+    NL_TEST_DEF("Send Batch Test",                SendBatchTest),
     NL_TEST_DEF("Send Encrypted Packet Test",     SendEncryptedPacketTest),
     NL_TEST_DEF("Send Bad Encrypted Packet Test", SendBadEncryptedPacketTest),
     NL_TEST_DEF("Old counter Test",               SendPacketWithOldCounterTest),